@@ -216,6 +216,8 @@ ETX_OTA_Status init_firmware_update_module(ETX_OTA_hw_Protocol hardware_protocol
  * @details	This function sets the @ref is_etx_ota_enabled Global Flag to its enabled value so that the
  *          @ref app_side_etx_ota enables the ETX OTA data reception. In addition, this function sets the next ETX OTA
  *          byte to be received in non blocking mode.
+ * @details If @ref ETX_OTA_READY_BEACON is enabled, a READY beacon is then sent to the host so that it can start an
+ *          ETX OTA Transaction right away.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 21, 2023.
@@ -85,6 +85,22 @@
 #define CUSTOM_DATA_MAX_SIZE				(1024U)				/**< @brief	Designated maximum length in bytes for a possibly received ETX OTA Custom Data (i.e., @ref firmware_update_config_data_t::data ). */
 #endif
 
+#ifndef ETX_OTA_END_CRC_FULL_RESCAN
+#define ETX_OTA_END_CRC_FULL_RESCAN			(0U)				/**< @brief Flag used to make our MCU/MPU validate the 32-bit CRC of a received ETX OTA Custom Data by reading all of it again when the ETX OTA End Command is received with a \c 1 . Otherwise, with a \c 0 , the 32-bit CRC is calculated incrementally right after storing each ETX OTA Data Type Packet, so that the ETX OTA End Command is responded to in constant time. */
+#endif
+
+#ifndef ETX_OTA_DATA_MAX_SIZE
+#define ETX_OTA_DATA_MAX_SIZE				(1024U)				/**< @brief Designated maximum "Data" field's size in bytes of the ETX OTA Packets that our MCU/MPU can receive, which sizes its receive buffer and which is advertised to the host in the response to the ETX OTA Start Command so that the host can negotiate the size of the ETX OTA Data Type Packets (i.e., the frame size) within it. @details Hosts that do not negotiate it keep sending frames of 1024 bytes. @note This must be a multiple of 4 of at least 256, which is validated at compile time. */
+#endif
+
+#ifndef ETX_OTA_COMPRESSION
+#define ETX_OTA_COMPRESSION					(1U)				/**< @brief Flag used to make our MCU/MPU accept, with a \c 1 , ETX OTA Custom Data that is sent compressed with LZ4 (see @ref lz4_decoder ), which is decompressed on the fly straight into @ref firmware_update_config_data_t::data . Otherwise, with a \c 0 , only uncompressed ETX OTA Custom Data is accepted. */
+#endif
+
+#ifndef ETX_OTA_READY_BEACON
+#define ETX_OTA_READY_BEACON				(1U)				/**< @brief Flag used to make our MCU/MPU send, with a \c 1 , a READY beacon (i.e., an ETX OTA Response Type Packet with the @ref ETX_OTA_READY Response Status) each time that ETX OTA Transactions are started via @ref start_etx_ota , so that the host knows right away that its next ETX OTA Packet will be answered. Otherwise, with a \c 0 , our MCU/MPU stays silent until the host sends an ETX OTA Packet. */
+#endif
+
 #ifndef ETX_CUSTOM_HAL_TIMEOUT
 #define ETX_CUSTOM_HAL_TIMEOUT				(9000U)				/**< @brief Designated time in milliseconds for the HAL Timeout to be requested during each FLASH and UART request where the ETX OTA protocol is to be used on. @note For more details see @ref FLASH_WaitForLastOperation and @ref HAL_UART_Receive . */
 #endif
@@ -0,0 +1,50 @@
+/** @file
+ * @brief	ETX OTA Start Response layout header file
+ *
+ * @defgroup etx_ota_start_resp ETX OTA Start Response layout
+ * @{
+ *
+ * @brief	This module defines the layout of the bytes that follow the Response Status of the response to an ETX OTA
+ *          Start Command, which is built by the MCU/MPU and parsed by the host.
+ *
+ * @details	The response only gives the fields up to the last one that the MCU/MPU has to report (see
+ *          @ref ETX_OTA_START_RESP_LEN ), and the fields that come before it but that it does not use are zeros.
+ *          Whether each field is actually given is told by the bits of the \c features and \c ext_features fields.
+ * @details	All the multi-byte fields are given in little-endian.
+ *
+ * @note	This file is copied as it is into every program that either builds or parses the response to an ETX OTA
+ *          Start Command (see run_tests.sh ), so that all of them share the same layout.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // Library from which "offsetof()" is located at.
+
+#ifndef ETX_OTA_START_RESP_H_
+#define ETX_OTA_START_RESP_H_
+
+/**@brief	Bytes that follow the Response Status of the response to an ETX OTA Start Command.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t   window_size;          //!< Window size granted to the windowed transfer mode, in ETX OTA Data Type Packets.
+    uint8_t   features;             //!< Bits of the features that the MCU/MPU supports or that it has granted (see ETX_OTA_FEATURE_DELTA_UPDATE and the rest of the ETX_OTA_FEATURE_ bits).
+    uint8_t   patch_backlog_pages;  //!< Number of backlog pages with which the MCU/MPU applies the binary patches, or zero if it does not accept them.
+    uint8_t   lz4_window_log2;      //!< Base 2 logarithm of the window of decompressed bytes that the MCU/MPU keeps in RAM, or zero if it does not accept compressed Payloads.
+    uint32_t  checkpoint_size;      //!< Size in bytes of the Firmware Image of the latest checkpoint.
+    uint32_t  checkpoint_crc;       //!< 32-bit CRC of the Firmware Image of the latest checkpoint.
+    uint32_t  checkpoint_offset;    //!< Offset of the Firmware Image of the latest checkpoint from which its ETX OTA Transaction can be continued.
+    uint16_t  max_data_size;        //!< Maximum "Data" field's size in bytes of the ETX OTA Packets that the MCU/MPU can receive.
+    uint32_t  baud_rate_max;        //!< Fastest Baud rate to which the host may switch the UART via the ETX OTA Baud Rate Command.
+    uint16_t  baud_confirm_timeout; //!< Time in milliseconds that the MCU/MPU waits for the new Baud rate to be confirmed.
+    uint8_t   ext_features;         //!< Bits of the extended features that the MCU/MPU has granted (see ETX_OTA_EXT_FEATURE_DATA_V2 and the rest of the ETX_OTA_EXT_FEATURE_ bits).
+    uint16_t  page_size;            //!< Size in bytes of each Flash Memory page of the MCU/MPU.
+    uint32_t  bl_flash_addr;        //!< Start address of the Bootloader Firmware slot.
+    uint16_t  bl_flash_pages;       //!< Number of Flash Memory pages of the Bootloader Firmware slot.
+    uint32_t  app_flash_addr;       //!< Start address of the Application Firmware slot.
+    uint16_t  app_flash_pages;      //!< Number of Flash Memory pages of the Application Firmware slot.
+    uint16_t  rx_ring_size;         //!< Size in bytes of the receive buffer of the MCU/MPU.
+} etx_ota_start_resp_t;
+
+#define ETX_OTA_START_RESP_LEN(field)   (offsetof(etx_ota_start_resp_t, field) + sizeof(((etx_ota_start_resp_t *) 0)->field))  /**< @brief Length in bytes of the response to an ETX OTA Start Command whose last given field is \p field of @ref etx_ota_start_resp_t . */
+
+#endif /* ETX_OTA_START_RESP_H_ */
+
+/** @} */
@@ -0,0 +1,75 @@
+/** @file
+ * @brief	Streaming LZ4 Decoder header file
+ *
+ * @defgroup lz4_decoder Streaming LZ4 Decoder module
+ * @{
+ *
+ * @brief	This module provides the functions required to decompress, on the fly, a compressed ETX OTA Payload that
+ *          is received in a streaming fashion, while only holding the last @ref LZ4_DECODER_WINDOW_SIZE decompressed
+ *          bytes in RAM.
+ *
+ * @details	The compressed stream is a single LZ4 block (i.e., a sequence of LZ4 sequences, each of which is made of a
+ *          token, its literals and, unless it is the last one, a 2-byte little-endian offset and the extra bytes of its
+ *          match length), but where the offset of each match must not be greater than @ref LZ4_DECODER_WINDOW_SIZE .
+ *          Since the decompressed size is known beforehand, the stream ends as soon as that many bytes have been
+ *          decompressed, which allows the host to pad it to a multiple of 4 bytes.
+ * @details	The decompressed bytes are given to the user of this module in pieces of @ref LZ4_DECODER_FLUSH_SIZE bytes,
+ *          except for the last piece, so that they can be programmed right away into the Flash Memory.
+ *
+ * @note	This module is shared by all the firmwares that receive ETX OTA Payloads, so any change to it must be copied
+ *          into all of them.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+
+#ifndef LZ4_DECODER_H_
+#define LZ4_DECODER_H_
+
+#ifndef LZ4_DECODER_WINDOW_LOG2
+#define LZ4_DECODER_WINDOW_LOG2			(11U)			/**< @brief Base 2 logarithm of @ref LZ4_DECODER_WINDOW_SIZE , which is what gets reported to the host so that it never uses a greater match offset. @note This must be between 8 and 16. */
+#endif
+#define LZ4_DECODER_WINDOW_SIZE			(1UL << LZ4_DECODER_WINDOW_LOG2)	/**< @brief Length in bytes of the window of the last decompressed bytes that this module holds in RAM, which is the maximum match offset that it accepts. */
+#ifndef LZ4_DECODER_FLUSH_SIZE
+#define LZ4_DECODER_FLUSH_SIZE			(256U)			/**< @brief Number of decompressed bytes that are given at a time to the write callback of this module, except for the last ones. @note This must be a multiple of 4 that is smaller than @ref LZ4_DECODER_WINDOW_SIZE . */
+#endif
+
+/**@brief	Streaming LZ4 Decoder Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref lz4_decoder module, and by its write
+ *          callback, to indicate the resulting status of having executed the process contained in each of those
+ *          functions.
+ */
+typedef enum
+{
+	LZ4_DECODER_EC_OK	= 0U,	//!< Streaming LZ4 Decoder Process was successful.
+	LZ4_DECODER_EC_ERR	= 1U	//!< Streaming LZ4 Decoder Process has failed, either because the compressed stream is malformed or because the write callback has failed.
+} Lz4Decoder_Status;
+
+/**@brief	Starts the decompression of a compressed stream that will be given via @ref lz4_decoder_feed .
+ *
+ * @param decoded_size	Length in bytes of the decompressed data.
+ * @param p_write		Callback to which the decompressed bytes will be given, in the same order as they are
+ *                      decompressed.
+ */
+void lz4_decoder_init(uint32_t decoded_size, Lz4Decoder_Status (*p_write)(uint8_t *p_data, uint16_t length));
+
+/**@brief	Decompresses the next bytes of the compressed stream, which can be split in any way across the calls to this
+ *          function.
+ *
+ * @param[in] p_data	Pointer to the next bytes of the compressed stream.
+ * @param length		Length in bytes of the data towards which the \p p_data param points to.
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ * @retval	LZ4_DECODER_EC_ERR
+ */
+Lz4Decoder_Status lz4_decoder_feed(uint8_t *p_data, uint32_t length);
+
+/**@brief	Checks whether the whole data has been decompressed and given to the write callback.
+ *
+ * @return	\c true if the last decompressed byte has already been given to the write callback, or otherwise \c false .
+ */
+bool lz4_decoder_is_done(void);
+
+#endif /* LZ4_DECODER_H_ */
+
+/** @} */
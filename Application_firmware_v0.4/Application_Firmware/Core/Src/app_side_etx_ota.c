@@ -5,13 +5,16 @@
 #include "app_side_etx_ota.h"
 #include <stdio.h>	// Library from which "printf()" is located at.
 #include <string.h>	// Library from which "memset()" is located at.
+#include "etx_ota_start_resp.h" // We call the library that defines the layout of our response to an ETX OTA Start Command, which is shared with the host.
+#if ETX_OTA_COMPRESSION
+#include "lz4_decoder.h" // We call the library that decompresses, on the fly, the ETX OTA Payloads that are sent compressed.
+#endif
 
 #define ETX_OTA_SOF  				(0xAA)    		/**< @brief Designated Start Of Frame (SOF) byte to indicate the start of an ETX OTA Packet. */
 #define ETX_OTA_EOF  				(0xBB)    		/**< @brief Designated End Of Frame (EOF) byte to indicate the end of an ETX OTA Packet. */
 #define ETX_OTA_SOF_SIZE			(1U)			/**< @brief	Designated SOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_PACKET_TYPE_SIZE	(1U)			/**< @brief	Designated Packet Type field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_DATA_LENGTH_SIZE	(2U)			/**< @brief	Designated Data Length field size in bytes in a ETX OTA Packet. */
-#define ETX_OTA_DATA_MAX_SIZE 		(1024U)  		/**< @brief Designated maximum expected "Data" field's size in the General Data Format of an ETX OTA Packet. @note This definition's value does not stand for the size of the entire ETX OTA Packet. Instead, it represents the size of the "Data" field that is inside the General Data Format of an ETX OTA Packet. */
 #define ETX_OTA_CRC32_SIZE			(4U)			/**< @brief	Designated 32-bit CRC field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_EOF_SIZE			(1U)			/**< @brief	Designated EOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_DATA_OVERHEAD 		(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE + ETX_OTA_CRC32_SIZE + ETX_OTA_EOF_SIZE)  	/**< @brief Data overhead in bytes of an ETX OTA Packet, which represents the bytes of an ETX OTA Packet except for the ones that it has at the Data field. */
@@ -19,6 +22,12 @@
 #define ETX_OTA_DATA_FIELD_INDEX	(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE) 											/**< @brief Index position of where the Data field bytes of a ETX OTA Packet starts at. */
 #define ETX_OTA_BL_FW_SIZE          (FLASH_PAGE_SIZE_IN_BYTES * ETX_BL_FLASH_PAGES_SIZE)   	/**< @brief Maximum size allowable for a Bootloader Firmware Image to have. */
 #define ETX_OTA_APP_FW_SIZE         (FLASH_PAGE_SIZE_IN_BYTES * ETX_APP_FLASH_PAGES_SIZE)   /**< @brief Maximum size allowable for an Application Firmware Image to have. */
+#define ETX_OTA_RESP_DATA_MAX_SIZE	(1U + sizeof(etx_ota_start_resp_t))					/**< @brief Maximum "Data" field's size in bytes of an ETX OTA Response Type Packet, which is given by its Response Status byte plus the room of a whole @ref etx_ota_start_resp_t , even though our MCU/MPU only gives the bytes of its response to an ETX OTA Start Command up to its 2-byte @ref ETX_OTA_DATA_MAX_SIZE . */
+#define ETX_OTA_LEGACY_FRAME_SIZE	(1024U)													/**< @brief Size in bytes of the ETX OTA Data Type Packets sent by the hosts that do not negotiate it, which is assumed whenever the reserved2 field of the ETX OTA Header holds its erased value of \c 0xFFFF . */
+#define ETX_OTA_FEATURE_COMPRESSION	(0x04U)													/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it accepts ETX OTA Payloads compressed with LZ4, in which case the backlog pages byte is followed by the value of @ref LZ4_DECODER_WINDOW_LOG2 . */
+#define ETX_OTA_FEATURE_FRAME_SIZE	(0x20U)													/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it gives, in @ref etx_ota_start_resp_t::max_data_size , the 2-byte @ref ETX_OTA_DATA_MAX_SIZE within which the host can choose the size of the ETX OTA Data Type Packets. */
+#define ETX_OTA_PAYLOAD_COMPRESSED_FLAG	(0x80U)												/**< @brief Bit of the Payload Type given in an ETX OTA Header that indicates that the ETX OTA Payload is sent compressed with LZ4 (see @ref lz4_decoder ), in which case the Payload Size and 32-bit CRC given in there are the ones of the decompressed bytes, whereas the size of the compressed ETX OTA Payload is given in its reserved1 field. */
+#define ETX_OTA_SYNC_CMD_SIZE		(2U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Sync Command, which is given by the Command byte and the 1-byte sequence number that our MCU/MPU echoes in its ACK. */
 
 /**@brief	ETX OTA process states.
  *
@@ -67,7 +76,9 @@ typedef enum
 {
 	ETX_OTA_CMD_START = 0U,		    //!< ETX OTA Firmware Update Start Command. @details This command indicates to the MCU/MPU that the host is connected to (via @ref COMPORT_NUMBER ) to start an ETX OTA Process.
 	ETX_OTA_CMD_END   = 1U,    		//!< ETX OTA Firmware Update End command. @details This command indicates to the MCU/MPU that the host is connected to (via @ref COMPORT_NUMBER ) to end the current ETX OTA Process.
-	ETX_OTA_CMD_ABORT = 2U    		//!< ETX OTA Abort Command. @details This command is used by the host to request to our MCU/MPU to abort whatever ETX OTA Process that our MCU/MPU is working on. @note Unlike the other Commands, this one can be legally requested to our MCU/MPU at any time and as many times as the host wants to.
+	ETX_OTA_CMD_ABORT = 2U,    		//!< ETX OTA Abort Command. @details This command is used by the host to request to our MCU/MPU to abort whatever ETX OTA Process that our MCU/MPU is working on. @note Unlike the other Commands, this one can be legally requested to our MCU/MPU at any time and as many times as the host wants to.
+	ETX_OTA_CMD_PING  = 3U,    		//!< ETX OTA Ping Command. @details This command is used by the host to measure the round-trip time of its link with our MCU/MPU, to which our MCU/MPU will just respond with an ACK without changing the state of the current ETX OTA Process. @note The host only sends this command after our MCU/MPU has appended data to its response to the ETX OTA Start Command, since older firmwares would consider it an invalid command.
+	ETX_OTA_CMD_SYNC  = 7U			//!< ETX OTA Sync Command. @details This command is used by the host, before the ETX OTA Start Command, to synchronize with our MCU/MPU, which resets the current ETX OTA Transaction back to the ETX OTA Start State and responds right away with an ACK that echoes the sequence number of this Command. @details The "Data" field of this Command holds the Command byte, followed by the 1-byte sequence number. @note Like the ETX OTA Abort Command, this one can be legally requested to our MCU/MPU at any time, but without ending the current ETX OTA Transaction.
 } ETX_OTA_Command;
 
 /**@brief	Payload Type definitions available in the ETX OTA Firmware Update process.
@@ -93,13 +104,18 @@ typedef enum
 typedef enum
 {
 	ETX_OTA_ACK  = 0U,   		//!< Acknowledge (ACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has been processed successfully by our MCU/MPU.
-	ETX_OTA_NACK   = 1U   		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by our MCU/MPU.
+	ETX_OTA_NACK   = 1U,  		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by our MCU/MPU.
+	ETX_OTA_READY  = 2U   		//!< READY beacon data byte used in an ETX OTA Response Type Packet that our MCU/MPU sends, without being requested to, each time that ETX OTA Transactions are started via @ref start_etx_ota (see @ref ETX_OTA_READY_BEACON ).
 } ETX_OTA_Response_Status;
 
 /**@brief	Is ETX OTA Enabled Flag Status definitions available in the ETX OTA Protocol.
  *
  * @details	These definitions indicate the values with with it is possible to enabled or disable ETX OTA Transactions.
  */
+#if ((ETX_OTA_DATA_MAX_SIZE % 4U) != 0U) || (ETX_OTA_DATA_MAX_SIZE < 256U) || (ETX_OTA_DATA_MAX_SIZE > 0xFFFCU)
+#error "ETX_OTA_DATA_MAX_SIZE must be a multiple of 4 from 256 up to 65532."
+#endif
+
 typedef enum
 {
     ETX_OTA_DISABLED  = 0U,   		//!< ETX OTA Transactions are disabled.
@@ -109,6 +125,15 @@ typedef enum
 static uint8_t Rx_Buffer[ETX_OTA_PACKET_MAX_SIZE];			                    /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received ETX OTA Packet from the host. */
 static ETX_OTA_State etx_ota_state = ETX_OTA_STATE_IDLE;	                    /**< @brief Global variable used to hold the ETX OTA Process State at which our MCU/MPU is currently at. */
 static uint32_t etx_ota_fw_received_size = 0;				                    /**< @brief Global variable used to indicate the Total Size in bytes of the whole ETX OTA Payload that our MCU/MPU has received and written into the Flash Memory designated to the ETX OTA Protocol. */
+#if !ETX_OTA_END_CRC_FULL_RESCAN
+static uint32_t etx_ota_fw_running_crc = CRC32_MPEG2_INIT_VALUE;                /**< @brief Global variable used to hold the 32-bit CRC of the @ref etx_ota_fw_received_size bytes of the ETX OTA Payload that have been stored so far, as read back from where they were stored. */
+#endif
+#if ETX_OTA_COMPRESSION
+static bool is_etx_ota_compressed = false;                                      /**< @brief Global flag used to indicate whether the ETX OTA Payload of the current ETX OTA Transaction is being received compressed with a \c true , or otherwise with a \c false . */
+#endif
+static uint16_t etx_ota_frame_size = ETX_OTA_LEGACY_FRAME_SIZE;                 /**< @brief Global variable used to hold the size in bytes of the ETX OTA Data Type Packets that the host sends during the current ETX OTA Transaction, as given in the reserved2 field of its ETX OTA Header, which is never greater than @ref ETX_OTA_DATA_MAX_SIZE . */
+static uint8_t etx_ota_resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];                 /**< @brief Global buffer holding the additional "Data" bytes, if any, that are to be appended right after the Response Status of the next ETX OTA Response Type Packet to be sent to the host. */
+static uint8_t etx_ota_resp_data_len = 0U;                                      /**< @brief Global variable used to indicate the number of valid bytes in @ref etx_ota_resp_data . @note This is reset back to \c 0 each time that an ETX OTA Response Type Packet is sent. */
 static is_ETX_OTA_enabled_flag_status is_etx_ota_enabled = ETX_OTA_DISABLED;    /**< @brief Global Flag used enable or disable ETX OTA Transactions. */
 static firmware_update_config_data_t *p_fw_config;			                    /**< @brief Global pointer to the latest data of the @ref firmware_update_config sub-module. */
 static etx_ota_custom_data_t *p_custom_data;                                    /**< @brief Global pointer to the handling struct of a received ETX OTA Custom Data. */
@@ -163,8 +188,8 @@ typedef struct __attribute__ ((__packed__)) {
 typedef struct __attribute__ ((__packed__)) {
 	uint32_t 	package_size;		//!< Total length/size in bytes of the data expected to be received by our MCU/MPU from the host via all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packet(s) (i.e., in a Data Type Packet or Packets) to be received.
 	uint32_t 	package_crc;		//!< 32-bit CRC of the whole data to be obtained from all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets).
-	uint32_t 	reserved1;			//!< 32-bits reserved for future changes on this firmware.
-	uint16_t 	reserved2;			//!< 16-bits reserved for future changes on this firmware.
+	uint32_t 	reserved1;			//!< Size in bytes of the compressed Payload whenever @ref ETX_OTA_PAYLOAD_COMPRESSED_FLAG is set in the \c payload_type field, or otherwise 32-bits reserved for future changes on this firmware.
+	uint16_t 	reserved2;			//!< Size in bytes of the ETX OTA Data Type Packets that the host will send (see @ref etx_ota_frame_size ), or \c 0xFFFF if the host does not negotiate it, in which case @ref ETX_OTA_LEGACY_FRAME_SIZE is assumed.
 	uint8_t 	reserved3;			//!< 8-bits reserved for future changes on this firmware.
 	uint8_t		payload_type;	    //!< Expected payload type to be received whenever receiving the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets). @note see @ref ETX_OTA_Payload_t to learn about the available Payload Types.
 } header_data_t;
@@ -315,6 +340,14 @@ typedef struct __attribute__ ((__packed__)) {
  */
 static ETX_OTA_Status start_etx_ota_transaction();
 
+/**@brief	Resets the ETX OTA Transaction back to the ETX OTA Start State, which discards the Header data of the ETX OTA
+ *          Payload that was being received, if any, and the negotiated frame size.
+ *
+ * @details	This is done at the beginning of each ETX OTA Transaction and whenever the host sends the ETX OTA Sync
+ *          Command.
+ */
+static void etx_ota_reset_transaction();
+
 /**
  * @brief   Gets one Packet from the ETX OTA process, if any is given.
  *
@@ -391,10 +424,14 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf);
 /**@brief	Sends an ETX OTA Response Type Packet with a desired Response Status (i.e., ACK or NACK) to the host either
  *          via the UART or the BT Hardware Protocol correspondingly.
  *
+ * @details	If there are any bytes pending in @ref etx_ota_resp_data , then they will be appended to the "Data" field
+ * 			of the Response Type Packet right after its Response Status byte. This is only used with hosts that have
+ * 			requested the windowed transfer mode, since older hosts expect a 1-byte "Data" field.
+ *
  * @note    This function decides on sending the data on a certain Hardware Protocol according to the current value of
  *          @ref ETX_OTA_hardware_protocol , which should be set only via the @ref init_firmware_update_module function.
  *
- * @param response_status	\c ETX_OTA_ACK or \c ETX_OTA_NACK .
+ * @param response_status	\c ETX_OTA_ACK , \c ETX_OTA_NACK or \c ETX_OTA_READY .
  *
  * @retval  ETX_OTA_EC_OK
  * @retval 	ETX_OTA_EC_NR
@@ -422,6 +459,20 @@ static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
  */
 static void write_data_to_ram(uint8_t *data, uint16_t data_len);
 
+#if ETX_OTA_COMPRESSION
+/**@brief	Writes the next decompressed bytes of the ETX OTA Custom Data via @ref write_data_to_ram .
+ *
+ * @note	This is the write callback of the @ref lz4_decoder module for the ETX OTA Payloads that our MCU/MPU receives
+ *          compressed.
+ *
+ * @param[in] p_data	Pointer to the decompressed bytes.
+ * @param length		Number of decompressed bytes.
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ */
+static Lz4Decoder_Status etx_ota_lz4_write(uint8_t *p_data, uint16_t length);
+#endif
+
 /**@brief	Gets the corresponding @ref ETX_OTA_Status value depending on the given @ref HAL_StatusTypeDef value.
  *
  * @param HAL_status	HAL Status value (see @ref HAL_StatusTypeDef ) that wants to be converted into its equivalent
@@ -603,6 +654,11 @@ void start_etx_ota()
 {
 	is_etx_ota_enabled = ETX_OTA_ENABLED;
 	HAL_UART_Receive_IT(p_huart, Rx_Buffer, ETX_OTA_SOF_SIZE);
+	#if ETX_OTA_READY_BEACON
+	/* Let the host know that our MCU/MPU is now listening for an ETX OTA Transaction. */
+	etx_ota_resp_data_len = 0U;
+	etx_ota_send_resp(ETX_OTA_READY);
+	#endif
 }
 
 void stop_etx_ota()
@@ -663,9 +719,7 @@ static ETX_OTA_Status start_etx_ota_transaction()
 	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref FirmUpdConf_Status or a @ref ETX_OTA_Status function type. */
 	ETX_OTA_Status ret;
 
-	/* Reset the global variables related to: 1) The Header data of a received Firmware Image and 2) The ETX OTA Process State. */
-	etx_ota_fw_received_size = 0U;
-	etx_ota_state            = ETX_OTA_STATE_START;
+	etx_ota_reset_transaction();
 
 	/* Attempt to receive an ETX OTA Request from the host and, if applicable, install it. */
 	do
@@ -755,6 +809,21 @@ static ETX_OTA_Status start_etx_ota_transaction()
 	return ETX_OTA_EC_OK;
 }
 
+static void etx_ota_reset_transaction()
+{
+	/* Reset the global variables related to: 1) The Header data of a received Firmware Image and 2) The ETX OTA Process State. */
+	etx_ota_fw_received_size = 0U;
+	etx_ota_state            = ETX_OTA_STATE_START;
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	etx_ota_fw_running_crc   = CRC32_MPEG2_INIT_VALUE;
+	#endif
+	#if ETX_OTA_COMPRESSION
+	is_etx_ota_compressed    = false;
+	#endif
+	etx_ota_frame_size       = ETX_OTA_LEGACY_FRAME_SIZE;
+	etx_ota_resp_data_len    = 0U;
+}
+
 static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf)
 {
 	/** <b>Local variable ret:</b> Used to hold the exception code value returned by either a @ref FirmUpdConf_Status , a @ref ETX_OTA_Status or a @ref HM10_Status function type. */
@@ -777,15 +846,19 @@ static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf)
 	switch (ETX_OTA_hardware_protocol)
 	{
 		case ETX_OTA_hw_Protocol_UART:
-			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet. */
+			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet, where any other byte is silently discarded during the ETX OTA Start State since it can only be part of the resync sequence of the host. */
 			if (Rx_Buffer[0] == 0)
             {
-                ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-                ret = HAL_ret_handler(ret);
-                if (ret != HAL_OK)
+                do
                 {
-                    return ret;
+                    ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
+                    ret = HAL_ret_handler(ret);
+                    if (ret != HAL_OK)
+                    {
+                        return ret;
+                    }
                 }
+                while ((buf[len] != ETX_OTA_SOF) && (etx_ota_state == ETX_OTA_STATE_START));
                 if (buf[len] != ETX_OTA_SOF)
                 {
                     #if ETX_OTA_VERBOSE
@@ -857,14 +930,18 @@ static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf)
 			}
 			break;
 		case ETX_OTA_hw_Protocol_BT:
-			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet. */
+			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet, where any other byte is silently discarded during the ETX OTA Start State since it can only be part of the resync sequence of the host. */
             if (Rx_Buffer[0] == 0)
             {
-                ret = get_hm10_ota_data(&buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-                if (ret != HAL_OK)
+                do
                 {
-                    return ret;
+                    ret = get_hm10_ota_data(&buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
+                    if (ret != HAL_OK)
+                    {
+                        return ret;
+                    }
                 }
+                while ((buf[len] != ETX_OTA_SOF) && (etx_ota_state == ETX_OTA_STATE_START));
                 if (buf[len] != ETX_OTA_SOF)
                 {
                     #if ETX_OTA_VERBOSE
@@ -992,6 +1069,23 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 			#endif
 			return ETX_OTA_EC_STOP;
 		}
+		if (cmd->cmd == ETX_OTA_CMD_PING)
+		{
+			#if ETX_OTA_VERBOSE
+				printf("DONE: ETX OTA Ping command received.\r\n");
+			#endif
+			return ETX_OTA_EC_OK;
+		}
+		if ((cmd->cmd == ETX_OTA_CMD_SYNC) && (cmd->data_len == ETX_OTA_SYNC_CMD_SIZE))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("DONE: ETX OTA Sync command received. Resetting the ETX OTA Transaction...\r\n");
+			#endif
+			etx_ota_reset_transaction();
+			etx_ota_resp_data[0] = buf[ETX_OTA_DATA_FIELD_INDEX + 1U];
+			etx_ota_resp_data_len = 1U;
+			return ETX_OTA_EC_OK;
+		}
 	}
 
 	switch (etx_ota_state)
@@ -1008,6 +1102,23 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 				#if ETX_OTA_VERBOSE
 					printf("DONE: Received ETX OTA Start Command.\r\n");
 				#endif
+
+				/* If the host has requested the windowed transfer mode, then only grant it a window size of 1, but let it know the largest ETX OTA Data Type Packets that our MCU/MPU can receive and whether it accepts compressed ETX OTA Payloads. */
+				if (cmd->data_len > 1U)
+				{
+					/** <b>Local pointer start_resp:</b> Points to the bytes that will follow the Response Status of our response but in @ref etx_ota_start_resp_t type, whose fields that are not given by our MCU/MPU are left as zeros. */
+					etx_ota_start_resp_t *start_resp = (etx_ota_start_resp_t *) etx_ota_resp_data;
+
+					memset(etx_ota_resp_data, 0, sizeof(etx_ota_resp_data));
+					start_resp->window_size = 1U;
+					start_resp->features = ETX_OTA_FEATURE_FRAME_SIZE;
+					#if ETX_OTA_COMPRESSION
+					start_resp->features |= ETX_OTA_FEATURE_COMPRESSION;
+					start_resp->lz4_window_log2 = LZ4_DECODER_WINDOW_LOG2;
+					#endif
+					start_resp->max_data_size = ETX_OTA_DATA_MAX_SIZE;
+					etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(max_data_size);
+				}
 				etx_ota_state = ETX_OTA_STATE_HEADER;
 				return ETX_OTA_EC_OK;
 			}
@@ -1022,8 +1133,42 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 
 			if (header->packet_type == ETX_OTA_PACKET_TYPE_HEADER)
 			{
+				/** <b>Local variable payload_type:</b> Payload Type given in the ETX OTA Header, but without its @ref ETX_OTA_PAYLOAD_COMPRESSED_FLAG bit. */
+				uint8_t payload_type = header->meta_data.payload_type;
+
+				/* Validate the size of the ETX OTA Data Type Packets that the host has chosen, which must fit into @ref Rx_Buffer . */
+				etx_ota_frame_size = (header->meta_data.reserved2 == 0xFFFFU) ? ETX_OTA_LEGACY_FRAME_SIZE : header->meta_data.reserved2;
+				if ((etx_ota_frame_size == 0U) || ((etx_ota_frame_size % 4U) != 0U) || (etx_ota_frame_size > ETX_OTA_DATA_MAX_SIZE))
+				{
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The host has chosen ETX OTA Data Type Packets of %d bytes, but our MCU/MPU can only receive multiples of 4 bytes of up to %d bytes.\r\n", etx_ota_frame_size, ETX_OTA_DATA_MAX_SIZE);
+					#endif
+					return ETX_OTA_EC_ERR;
+				}
+
+				#if ETX_OTA_COMPRESSION
+				/* If the ETX OTA Payload is to be sent compressed, then validate the size of its compressed bytes and prepare to decompress them. */
+				is_etx_ota_compressed = ((payload_type & ETX_OTA_PAYLOAD_COMPRESSED_FLAG) != 0U);
+				payload_type &= ~ETX_OTA_PAYLOAD_COMPRESSED_FLAG;
+				if (is_etx_ota_compressed)
+				{
+					if ((header->meta_data.reserved1 == 0U) || ((header->meta_data.reserved1 % 4U) != 0U)
+							|| (header->meta_data.reserved1 > ((header->meta_data.package_size + 3U) & ~3UL)))
+					{
+						#if ETX_OTA_VERBOSE
+							printf("ERROR: The compressed ETX OTA Payload has an invalid size of %ld bytes.\r\n", header->meta_data.reserved1);
+						#endif
+						return ETX_OTA_EC_ERR;
+					}
+					lz4_decoder_init(header->meta_data.package_size, etx_ota_lz4_write);
+					#if ETX_OTA_VERBOSE
+						printf("The ETX OTA Payload will be received compressed into %ld bytes.\r\n", header->meta_data.reserved1);
+					#endif
+				}
+				#endif
+
 				/* We validate that the Payload Type to be received and take an action correspondingly. */
-				switch (header->meta_data.payload_type)
+				switch (payload_type)
 				{
 					case ETX_OTA_Application_Firmware_Image:
 					case ETX_OTA_Bootloader_Firmware_Image:
@@ -1062,22 +1207,42 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 
 			if (data->packet_type == ETX_OTA_PACKET_TYPE_DATA)
 			{
+				#if ETX_OTA_COMPRESSION
+				/* Decompress the ETX OTA Data Type Packet into our MCU/MPU's RAM if the ETX OTA Payload is being sent compressed. */
+				if (is_etx_ota_compressed)
+				{
+					if (lz4_decoder_feed(buf+ETX_OTA_DATA_FIELD_INDEX, data->data_len) != LZ4_DECODER_EC_OK)
+					{
+						#if ETX_OTA_VERBOSE
+							printf("ERROR: The received compressed ETX OTA Payload could not be decompressed.\r\n");
+						#endif
+						return ETX_OTA_EC_ERR;
+					}
+					if (lz4_decoder_is_done())
+					{
+						/* decompressed the full data. Therefore, move to the End State of the ETX OTA Process. */
+						etx_ota_state = ETX_OTA_STATE_END;
+					}
+					return ETX_OTA_EC_OK;
+				}
+				#endif
+
 				/* Write the ETX OTA Data Type Packet into our MCU/MPU's RAM. */
 				write_data_to_ram(buf+ETX_OTA_DATA_FIELD_INDEX, data->data_len);
 				#if ETX_OTA_VERBOSE
-					if (p_custom_data->size%ETX_OTA_DATA_MAX_SIZE == 0)
+					if (p_custom_data->size%etx_ota_frame_size == 0)
 					{
-						printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_custom_data->size/ETX_OTA_DATA_MAX_SIZE);
+						printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_custom_data->size/etx_ota_frame_size);
 					}
 					else
 					{
-						if (etx_ota_fw_received_size%ETX_OTA_DATA_MAX_SIZE == 0)
+						if (etx_ota_fw_received_size%etx_ota_frame_size == 0)
 						{
-							printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_custom_data->size/ETX_OTA_DATA_MAX_SIZE+1);
+							printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_custom_data->size/etx_ota_frame_size+1);
 						}
 						else
 						{
-							printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", (etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE+1), p_custom_data->size/ETX_OTA_DATA_MAX_SIZE+1);
+							printf("[%ld/%ld] parts of the current ETX OTA transaction are now stored into our MCU/MPUs RAM...\r\n", (etx_ota_fw_received_size/etx_ota_frame_size+1), p_custom_data->size/etx_ota_frame_size+1);
 						}
 					}
 				#endif
@@ -1097,7 +1262,11 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 			if ((cmd->packet_type==ETX_OTA_PACKET_TYPE_CMD) && (cmd->cmd==ETX_OTA_CMD_END))
 			{
 				/** <b>Local variable cal_crc:</b> Value holder for the calculated 32-bit CRC of the ETX OTA data that has just been received by our MCU/MPU. */
+				#if ETX_OTA_END_CRC_FULL_RESCAN
 				uint32_t cal_crc = crc32_mpeg2(p_custom_data->data, p_custom_data->size);
+				#else
+				uint32_t cal_crc = etx_ota_fw_running_crc;
+				#endif
 
 				/* Validate the 32-bit CRC of the whole data received from the current whole ETX OTA Transaction. */
 				#if ETX_OTA_VERBOSE
@@ -1137,26 +1306,37 @@ static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
 {
 	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
 	ETX_OTA_Status  ret;
-
-	ETX_OTA_Response_Packet_t response =
-	{
-		.sof         	= ETX_OTA_SOF,
-		.packet_type 	= ETX_OTA_PACKET_TYPE_RESPONSE,
-		.data_len    	= 1U,
-		.status      	= response_status,
-		.crc			= 0U,
-		.eof         	= ETX_OTA_EOF
-	};
-	response.crc = crc32_mpeg2((uint8_t *) &response.status, 1);
+	/** <b>Local variable response:</b> Holds the whole ETX OTA Response Type Packet to be sent, whose format is that of @ref ETX_OTA_Response_Packet_t but with any pending bytes of @ref etx_ota_resp_data appended right after its Response Status. */
+	uint8_t response[ETX_OTA_DATA_OVERHEAD + ETX_OTA_RESP_DATA_MAX_SIZE];
+	/** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Response Type Packet to be sent. */
+	uint16_t data_len = 1U + etx_ota_resp_data_len;
+	/** <b>Local variable len:</b> Current length in bytes of the ETX OTA Response Type Packet that is being populated. */
+	uint16_t len = 0;
+	/** <b>Local variable crc:</b> 32-bit CRC of the "Data" field of the ETX OTA Response Type Packet to be sent. */
+	uint32_t crc;
+
+	/* Populate the ETX OTA Response Type Packet. */
+	response[len++] = ETX_OTA_SOF;
+	response[len++] = ETX_OTA_PACKET_TYPE_RESPONSE;
+	memcpy(&response[len], &data_len, ETX_OTA_DATA_LENGTH_SIZE);
+	len += ETX_OTA_DATA_LENGTH_SIZE;
+	response[len++] = response_status;
+	memcpy(&response[len], etx_ota_resp_data, etx_ota_resp_data_len);
+	len += etx_ota_resp_data_len;
+	crc = crc32_mpeg2(&response[ETX_OTA_DATA_FIELD_INDEX], data_len);
+	memcpy(&response[len], &crc, ETX_OTA_CRC32_SIZE);
+	len += ETX_OTA_CRC32_SIZE;
+	response[len++] = ETX_OTA_EOF;
+	etx_ota_resp_data_len = 0U;
 
 	switch (ETX_OTA_hardware_protocol)
 	{
 		case ETX_OTA_hw_Protocol_UART:
-			ret = HAL_UART_Transmit(p_huart, (uint8_t *) &response, sizeof(ETX_OTA_Response_Packet_t), ETX_CUSTOM_HAL_TIMEOUT);
+			ret = HAL_UART_Transmit(p_huart, response, len, ETX_CUSTOM_HAL_TIMEOUT);
 			ret = HAL_ret_handler(ret);
 			break;
 		case ETX_OTA_hw_Protocol_BT:
-			ret = send_hm10_ota_data((uint8_t *) &response, sizeof(ETX_OTA_Response_Packet_t), ETX_CUSTOM_HAL_TIMEOUT);
+			ret = send_hm10_ota_data(response, len, ETX_CUSTOM_HAL_TIMEOUT);
 			break;
 		default:
 			/* This should not happen since it should have been previously validated. */
@@ -1177,7 +1357,21 @@ static void write_data_to_ram(uint8_t *data, uint16_t data_len)
 		p_custom_data->data[etx_ota_fw_received_size] = data[bytes_written];
         etx_ota_fw_received_size++;
 	}
+
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	/* Update the running 32-bit CRC of the ETX OTA Custom Data with the bytes that have just been stored, as read back from the RAM. */
+	etx_ota_fw_running_crc = crc32_mpeg2_update(etx_ota_fw_running_crc, &p_custom_data->data[etx_ota_fw_received_size - data_len], data_len);
+	#endif
+}
+
+#if ETX_OTA_COMPRESSION
+static Lz4Decoder_Status etx_ota_lz4_write(uint8_t *p_data, uint16_t length)
+{
+	write_data_to_ram(p_data, length);
+
+	return LZ4_DECODER_EC_OK;
 }
+#endif
 
 static ETX_OTA_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 {
@@ -0,0 +1,253 @@
+/** @addtogroup lz4_decoder
+ * @{
+ */
+
+#include "lz4_decoder.h"
+#include <stddef.h> // Library from which the "NULL" definition is located at.
+
+#if (LZ4_DECODER_WINDOW_LOG2 < 8U) || (LZ4_DECODER_WINDOW_LOG2 > 16U) || ((LZ4_DECODER_FLUSH_SIZE % 4U) != 0U) || (LZ4_DECODER_FLUSH_SIZE >= LZ4_DECODER_WINDOW_SIZE)
+#error "LZ4_DECODER_WINDOW_LOG2 must be between 8 and 16, and LZ4_DECODER_FLUSH_SIZE a multiple of 4 smaller than LZ4_DECODER_WINDOW_SIZE."
+#endif
+
+#define LZ4_DECODER_MIN_MATCH			(4U)			/**< @brief Minimum length in bytes of an LZ4 match, which is added to the match length given by each token. */
+#define LZ4_DECODER_RUN_MASK			(15U)			/**< @brief Value of a nibble of an LZ4 token that indicates that its length continues in the next bytes. */
+
+/**@brief	Streaming LZ4 Decoder State definitions.
+ *
+ * @details	These definitions indicate which part of the compressed stream is expected next by the @ref lz4_decoder
+ *          module.
+ */
+typedef enum
+{
+	LZ4_DECODER_STATE_TOKEN			= 0U,	//!< The token of the next LZ4 sequence is expected next.
+	LZ4_DECODER_STATE_LITERALS_LEN	= 1U,	//!< An extra byte of the literals length of the current LZ4 sequence is expected next.
+	LZ4_DECODER_STATE_LITERALS		= 2U,	//!< The literals of the current LZ4 sequence are expected next.
+	LZ4_DECODER_STATE_OFFSET_LOW	= 3U,	//!< The low byte of the match offset of the current LZ4 sequence is expected next.
+	LZ4_DECODER_STATE_OFFSET_HIGH	= 4U,	//!< The high byte of the match offset of the current LZ4 sequence is expected next.
+	LZ4_DECODER_STATE_MATCH_LEN		= 5U,	//!< An extra byte of the match length of the current LZ4 sequence is expected next.
+	LZ4_DECODER_STATE_DONE			= 6U,	//!< The whole data has been decompressed, so any remaining bytes are just padding.
+	LZ4_DECODER_STATE_FAILED		= 7U	//!< The compressed stream has failed to be decompressed, so any remaining bytes are rejected.
+} Lz4Decoder_State;
+
+static Lz4Decoder_Status (*p_lz4_write)(uint8_t *p_data, uint16_t length) = NULL;	/**< @brief Global pointer to the callback to which the decompressed bytes are given. */
+static Lz4Decoder_State lz4_state = LZ4_DECODER_STATE_FAILED;	/**< @brief Global variable used to hold the part of the compressed stream that is expected next. */
+static uint8_t Lz4_Window[LZ4_DECODER_WINDOW_SIZE];			/**< @brief Global ring buffer holding the last @ref LZ4_DECODER_WINDOW_SIZE decompressed bytes, where the decompressed byte number \c n is held at the index <tt>n % @ref LZ4_DECODER_WINDOW_SIZE</tt> . */
+static uint32_t lz4_decoded_size = 0U;						/**< @brief Global variable used to indicate the length in bytes of the decompressed data. */
+static uint32_t lz4_out_pos = 0U;							/**< @brief Global variable used to indicate the number of bytes that have been decompressed so far. */
+static uint32_t lz4_flushed_pos = 0U;						/**< @brief Global variable used to indicate the number of decompressed bytes that have been given to the write callback so far. */
+static uint8_t lz4_token = 0U;								/**< @brief Global variable used to hold the token of the current LZ4 sequence. */
+static uint32_t lz4_len = 0U;								/**< @brief Global variable used to hold the literals length, or the match length, of the current LZ4 sequence. */
+static uint16_t lz4_offset = 0U;							/**< @brief Global variable used to hold the match offset of the current LZ4 sequence. */
+
+/**@brief	Gives the decompressed bytes that have not been given yet to the write callback.
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ * @retval	LZ4_DECODER_EC_ERR
+ */
+static Lz4Decoder_Status lz4_decoder_flush(void);
+
+/**@brief	Appends a decompressed byte into @ref Lz4_Window , and gives the pending decompressed bytes to the write
+ *          callback once there are @ref LZ4_DECODER_FLUSH_SIZE of them or once the whole data has been decompressed.
+ *
+ * @param byte	The decompressed byte.
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ * @retval	LZ4_DECODER_EC_ERR
+ */
+static Lz4Decoder_Status lz4_decoder_put(uint8_t byte);
+
+/**@brief	Moves on to the match of the current LZ4 sequence, unless the whole data has already been decompressed.
+ */
+static void lz4_decoder_end_literals(void);
+
+/**@brief	Copies the match of the current LZ4 sequence from @ref Lz4_Window .
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ * @retval	LZ4_DECODER_EC_ERR
+ */
+static Lz4Decoder_Status lz4_decoder_copy_match(void);
+
+void lz4_decoder_init(uint32_t decoded_size, Lz4Decoder_Status (*p_write)(uint8_t *p_data, uint16_t length))
+{
+	p_lz4_write = p_write;
+	lz4_decoded_size = decoded_size;
+	lz4_out_pos = 0U;
+	lz4_flushed_pos = 0U;
+	lz4_token = 0U;
+	lz4_len = 0U;
+	lz4_offset = 0U;
+	lz4_state = (decoded_size == 0U) ? LZ4_DECODER_STATE_DONE : LZ4_DECODER_STATE_TOKEN;
+}
+
+Lz4Decoder_Status lz4_decoder_feed(uint8_t *p_data, uint32_t length)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref Lz4Decoder_Status function type. */
+	Lz4Decoder_Status ret = LZ4_DECODER_EC_OK;
+	/** <b>Local variable byte:</b> Current byte of the compressed stream. */
+	uint8_t byte;
+
+	while ((length > 0U) && (ret == LZ4_DECODER_EC_OK))
+	{
+		if (lz4_state == LZ4_DECODER_STATE_DONE)
+		{
+			/* The remaining bytes are just padding. */
+			break;
+		}
+		byte = *p_data++;
+		length--;
+
+		switch (lz4_state)
+		{
+			case LZ4_DECODER_STATE_TOKEN:
+				lz4_token = byte;
+				lz4_len = lz4_token >> 4;
+				if (lz4_len == LZ4_DECODER_RUN_MASK)
+				{
+					lz4_state = LZ4_DECODER_STATE_LITERALS_LEN;
+				}
+				else if (lz4_len > 0U)
+				{
+					lz4_state = LZ4_DECODER_STATE_LITERALS;
+				}
+				else
+				{
+					lz4_decoder_end_literals();
+				}
+				break;
+
+			case LZ4_DECODER_STATE_LITERALS_LEN:
+				lz4_len += byte;
+				if (byte != 255U)
+				{
+					lz4_state = LZ4_DECODER_STATE_LITERALS;
+				}
+				break;
+
+			case LZ4_DECODER_STATE_LITERALS:
+				/* Validate that the literals do not go beyond the decompressed data. */
+				if (lz4_len > (lz4_decoded_size - lz4_out_pos))
+				{
+					ret = LZ4_DECODER_EC_ERR;
+					break;
+				}
+				ret = lz4_decoder_put(byte);
+				if (--lz4_len == 0U)
+				{
+					lz4_decoder_end_literals();
+				}
+				break;
+
+			case LZ4_DECODER_STATE_OFFSET_LOW:
+				lz4_offset = byte;
+				lz4_state = LZ4_DECODER_STATE_OFFSET_HIGH;
+				break;
+
+			case LZ4_DECODER_STATE_OFFSET_HIGH:
+				lz4_offset |= ((uint16_t) byte) << 8;
+				lz4_len = (lz4_token & LZ4_DECODER_RUN_MASK) + LZ4_DECODER_MIN_MATCH;
+				if ((lz4_token & LZ4_DECODER_RUN_MASK) == LZ4_DECODER_RUN_MASK)
+				{
+					lz4_state = LZ4_DECODER_STATE_MATCH_LEN;
+					break;
+				}
+				ret = lz4_decoder_copy_match();
+				break;
+
+			case LZ4_DECODER_STATE_MATCH_LEN:
+				lz4_len += byte;
+				if (byte != 255U)
+				{
+					ret = lz4_decoder_copy_match();
+				}
+				break;
+
+			default:
+				ret = LZ4_DECODER_EC_ERR;
+				break;
+		}
+	}
+
+	if (ret != LZ4_DECODER_EC_OK)
+	{
+		lz4_state = LZ4_DECODER_STATE_FAILED;
+	}
+
+	return ret;
+}
+
+bool lz4_decoder_is_done(void)
+{
+	return (lz4_state == LZ4_DECODER_STATE_DONE) && (lz4_flushed_pos == lz4_decoded_size);
+}
+
+static Lz4Decoder_Status lz4_decoder_flush(void)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref Lz4Decoder_Status function type. */
+	Lz4Decoder_Status ret;
+	/** <b>Local variable index:</b> Index of @ref Lz4_Window at which the next byte to be given to the write callback is. */
+	uint16_t index;
+	/** <b>Local variable n:</b> Number of bytes that are given to the write callback at a time, which are the ones up to the end of @ref Lz4_Window at the most. */
+	uint16_t n;
+
+	while (lz4_flushed_pos < lz4_out_pos)
+	{
+		index = lz4_flushed_pos % LZ4_DECODER_WINDOW_SIZE;
+		n = LZ4_DECODER_WINDOW_SIZE - index;
+		if (n > (lz4_out_pos - lz4_flushed_pos))
+		{
+			n = lz4_out_pos - lz4_flushed_pos;
+		}
+		ret = p_lz4_write(&Lz4_Window[index], n);
+		if (ret != LZ4_DECODER_EC_OK)
+		{
+			return ret;
+		}
+		lz4_flushed_pos += n;
+	}
+
+	return LZ4_DECODER_EC_OK;
+}
+
+static Lz4Decoder_Status lz4_decoder_put(uint8_t byte)
+{
+	Lz4_Window[lz4_out_pos % LZ4_DECODER_WINDOW_SIZE] = byte;
+	lz4_out_pos++;
+	if (((lz4_out_pos - lz4_flushed_pos) == LZ4_DECODER_FLUSH_SIZE) || (lz4_out_pos == lz4_decoded_size))
+	{
+		return lz4_decoder_flush();
+	}
+
+	return LZ4_DECODER_EC_OK;
+}
+
+static void lz4_decoder_end_literals(void)
+{
+	lz4_state = (lz4_out_pos == lz4_decoded_size) ? LZ4_DECODER_STATE_DONE : LZ4_DECODER_STATE_OFFSET_LOW;
+}
+
+static Lz4Decoder_Status lz4_decoder_copy_match(void)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref Lz4Decoder_Status function type. */
+	Lz4Decoder_Status ret;
+
+	/* Validate that the match is within @ref Lz4_Window and that it does not go beyond the decompressed data. */
+	if ((lz4_offset == 0U) || (lz4_offset > LZ4_DECODER_WINDOW_SIZE) || (lz4_offset > lz4_out_pos) || (lz4_len > (lz4_decoded_size - lz4_out_pos)))
+	{
+		return LZ4_DECODER_EC_ERR;
+	}
+
+	/* Copy the match one byte at a time, since it may overlap with the bytes that it produces. */
+	for (; lz4_len>0U; lz4_len--)
+	{
+		ret = lz4_decoder_put(Lz4_Window[(lz4_out_pos - lz4_offset) % LZ4_DECODER_WINDOW_SIZE]);
+		if (ret != LZ4_DECODER_EC_OK)
+		{
+			return ret;
+		}
+	}
+	lz4_state = (lz4_out_pos == lz4_decoded_size) ? LZ4_DECODER_STATE_DONE : LZ4_DECODER_STATE_TOKEN;
+
+	return LZ4_DECODER_EC_OK;
+}
+
+/** @} */
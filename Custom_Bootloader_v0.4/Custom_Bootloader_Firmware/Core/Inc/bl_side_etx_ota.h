@@ -142,6 +142,9 @@ typedef enum
  * @details The Application Firmware Image is expected to be received, during the Timeout specified in
  *          @ref ETX_CUSTOM_HAL_TIMEOUT, from a certain host via the initialized Hardware Protocol (see
  *          @ref init_firmware_update_module function) and by using the ETX OTA Communication Protocol.
+ * @details If @ref ETX_OTA_READY_BEACON is enabled, a READY beacon is sent to the host right before listening for it,
+ *          so that the host can start the ETX OTA Transaction right away instead of waiting for this function to be
+ *          called again.
  *
  * @note    This function may not be able to successfully complete an entire ETX OTA Transaction if there are any
  *          Non-Blocking Callback functions working while this function is still running. Therefore, if your program
@@ -150,6 +153,9 @@ typedef enum
  * @note    For more details on how the ETX OTA Protocol works, see the @ref bl_side_etx_ota module.
  * @note	This function expects that the @ref firmware_update_config has already been initialized via the
  *          @ref firmware_update_configurations_init function.
+ * @note    The UART of the chosen Hardware Protocol must have a DMA channel in circular mode linked to its Rx (i.e.,
+ *          to its \c hdmarx ), since all the bytes received from the host are written into a circular buffer via that
+ *          DMA while this function runs (see @ref ETX_OTA_RX_RING_SIZE ).
  *
  * @retval  ETX_OTA_EC_OK
  * @retval	ETX_OTA_EC_STOP
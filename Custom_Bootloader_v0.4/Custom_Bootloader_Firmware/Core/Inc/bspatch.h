@@ -0,0 +1,121 @@
+/** @file
+ * @brief	Binary Patch Applier header file
+ *
+ * @defgroup bspatch Binary Patch Applier module
+ * @{
+ *
+ * @brief	This module provides the functions required to rebuild a new Firmware Image from the one that is currently
+ *          installed in our MCU/MPU and from a binary patch (bsdiff-style) that is received in a streaming fashion,
+ *          without ever holding the whole patch nor the whole new Firmware Image in RAM.
+ *
+ * @details	The binary patch has the following format, where all the multi-byte fields are little-endian:
+ *          <ol>
+ *              <li>Header: @ref bspatch_header_t (20 bytes).</li>
+ *              <li>One or more Control Entries, each of which is made of:
+ *                  <ol>
+ *                      <li>Diff Length: 4 bytes, whose most significant bit is the Copy flag
+ *                          (@ref BSPATCH_CTRL_COPY_FLAG ).</li>
+ *                      <li>Extra Length: 4 bytes.</li>
+ *                      <li>Seek: 4 bytes (signed).</li>
+ *                      <li>Diff bytes: Diff Length bytes, each of which is added to the byte of the old Firmware Image
+ *                          that is at the current old offset in order to get the next byte of the new Firmware Image,
+ *                          after which the old offset is incremented. If the Copy flag is set, then no Diff bytes
+ *                          are sent and the old bytes are copied as they are instead (i.e., as if all the Diff bytes
+ *                          were zeros), which is what keeps the patch compact for code that has only been moved.</li>
+ *                      <li>Extra bytes: Extra Length bytes, which are copied as they are into the new Firmware Image.
+ *                          </li>
+ *                  </ol>
+ *                  where the Seek value is added to the old offset once the Control Entry has been applied.</li>
+ *              <li>Padding: Any bytes that follow the Control Entry that completes the new Firmware Image are ignored,
+ *                  which allows the host to pad the patch to a multiple of 4 bytes.</li>
+ *          </ol>
+ * @details	The new Firmware Image is meant to be written page by page over the old one (i.e., in place). Therefore,
+ *          the patch generator guarantees that each byte of the new Firmware Image that lands in the Flash Memory page
+ *          number \c p only reads old bytes from page number <tt>p - @ref bspatch_header_t::backlog_pages</tt> onwards,
+ *          so that the user of this module only needs to keep a copy in RAM of the last
+ *          @ref bspatch_header_t::backlog_pages old pages that it has overwritten.
+ *
+ * @note	This module does not access the Flash Memory by itself. Instead, the old Firmware Image is read, and the new
+ *          one is written, through the callbacks given via @ref bspatch_io_t .
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+
+#ifndef BSPATCH_H_
+#define BSPATCH_H_
+
+#define BSPATCH_MAGIC				(0x50585445U)	/**< @brief Value of the @ref bspatch_header_t::magic field, which stands for the "ETXP" ASCII characters in little-endian. */
+#define BSPATCH_HEADER_SIZE			(20U)			/**< @brief Length in bytes of the header of a binary patch (i.e., of @ref bspatch_header_t ). */
+#define BSPATCH_CTRL_SIZE			(12U)			/**< @brief Length in bytes of each Control Entry of a binary patch. */
+#define BSPATCH_CTRL_COPY_FLAG		(0x80000000U)	/**< @brief Bit of the Diff Length of a Control Entry that indicates that its Diff bytes are all zeros and that they are therefore not sent. */
+#ifndef BSPATCH_CHUNK_SIZE
+#define BSPATCH_CHUNK_SIZE			(64U)			/**< @brief Maximum number of bytes of the new Firmware Image that are rebuilt from the Diff bytes at a time, which is the size of the only buffer that this module keeps in the stack. */
+#endif
+
+/**@brief	Binary Patch Applier Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref bspatch module, and by the callbacks given
+ *          to it via @ref bspatch_io_t , to indicate the resulting status of having executed the process contained in
+ *          each of those functions.
+ */
+typedef enum
+{
+	BSPATCH_EC_OK	= 0U,	//!< Binary Patch Applier Process was successful.
+	BSPATCH_EC_ERR	= 1U,	//!< Binary Patch Applier Process has failed, either because the binary patch is malformed, because it tried to read or write beyond the old or new Firmware Images, or because a callback has failed.
+	BSPATCH_EC_NA	= 2U	//!< Binary Patch Applier Process has failed because the binary patch was not made for the Firmware Image that is currently installed in our MCU/MPU.
+} BsPatch_Status;
+
+/**@brief	Binary patch header parameters structure.
+ *
+ * @details	This structure contains all the fields of the header with which every binary patch starts.
+ */
+typedef struct __attribute__ ((__packed__))
+{
+	uint32_t	magic;			//!< Magic number of the binary patch, which must be @ref BSPATCH_MAGIC .
+	uint32_t	old_size;		//!< Size in bytes of the old Firmware Image from which the binary patch was made.
+	uint32_t	old_crc;		//!< 32-bit CRC of the old Firmware Image from which the binary patch was made.
+	uint32_t	new_size;		//!< Size in bytes of the new Firmware Image that the binary patch rebuilds.
+	uint16_t	page_size;		//!< Flash Memory page size in bytes that the patch generator assumed.
+	uint8_t		backlog_pages;	//!< Number of already overwritten old Flash Memory pages that the binary patch may still read from (see @ref bspatch ).
+	uint8_t		reserved;		//!< 8-bits reserved for future changes on the binary patch format.
+} bspatch_header_t;
+
+/**@brief	Binary Patch Applier callbacks structure.
+ *
+ * @details	This structure contains the functions through which the @ref bspatch module validates the binary patch
+ *          header, reads the old Firmware Image and writes the new one.
+ */
+typedef struct
+{
+	BsPatch_Status (*check_header)(const bspatch_header_t *p_header);				//!< Validates the header of the binary patch, which is called once, before any byte of the new Firmware Image is written. @note Any Exception Code other than @ref BSPATCH_EC_OK aborts the patching.
+	BsPatch_Status (*read_old)(uint32_t offset, uint8_t *p_data, uint16_t length);	//!< Reads \c length bytes of the old Firmware Image, starting from its \c offset byte, into \c p_data .
+	BsPatch_Status (*write_new)(uint8_t *p_data, uint16_t length);					//!< Writes the next \c length bytes of the new Firmware Image, which are given in \c p_data .
+} bspatch_io_t;
+
+/**@brief	Starts the rebuilding of a new Firmware Image from a binary patch that will be given via @ref bspatch_feed .
+ *
+ * @param[in] p_io	Pointer to the callbacks through which the binary patch will be applied, which must remain valid
+ *                  until the whole binary patch has been given.
+ */
+void bspatch_init(const bspatch_io_t *p_io);
+
+/**@brief	Applies the next bytes of the binary patch, which can be split in any way across the calls to this function.
+ *
+ * @param[in] p_data	Pointer to the next bytes of the binary patch.
+ * @param length		Length in bytes of the data towards which the \p p_data param points to.
+ *
+ * @retval	BSPATCH_EC_OK
+ * @retval	BSPATCH_EC_ERR
+ * @retval	BSPATCH_EC_NA
+ */
+BsPatch_Status bspatch_feed(uint8_t *p_data, uint32_t length);
+
+/**@brief	Checks whether the whole new Firmware Image has been rebuilt.
+ *
+ * @return	\c true if the last byte of the new Firmware Image has already been written, or otherwise \c false .
+ */
+bool bspatch_is_done(void);
+
+#endif /* BSPATCH_H_ */
+
+/** @} */
@@ -81,14 +81,98 @@
 /* NOTE: The UART configurations such as its Baud rate, the Data-bits, the Parity, the Stop-bit and whether the Flow
  *       Control is enabled or not, are all defined in the STM32CubeMx App. */
 
+#ifndef ETX_OTA_BAUD_RATE_MAX
+#define ETX_OTA_BAUD_RATE_MAX				(0U)				/**< @brief Designated maximum Baud rate, in bits per second, to which the host may request our MCU/MPU to switch the UART of the chosen Hardware Protocol during an ETX OTA Transaction via the ETX OTA Baud Rate Command (e.g., 921600), or \c 0 to keep the Baud rate defined in the STM32CubeMx App for the whole ETX OTA Transaction. @details This defaults to \c 0 because, with the clock configuration of the STM32CubeMx App, no standard Baud rate above the one defined in there can be reached (see below), so its code would only take Flash Memory. @details This is only a cap, since the maximum Baud rate that is actually advertised and accepted is also limited to the clock of that UART divided by 16, and any requested Baud rate that cannot be generated from that clock within @ref ETX_OTA_BAUD_RATE_MAX_ERROR is rejected. With the clock configuration of the STM32CubeMx App (i.e., an 8MHz HSE with an AHB prescaler of 4), the UART clock is 2MHz and therefore the Baud rate cannot go beyond 125000. The new Baud rate is confirmed with an ETX OTA Ping Command received at that rate, or otherwise our MCU/MPU falls back to the previous one, and the Baud rate defined in the STM32CubeMx App is always restored once the ETX OTA Transaction ends. @note This only applies to the UART Hardware Protocol, since the Baud rate of the BT Hardware Protocol is set by the HM-10 BT Device. */
+#endif
+
+#ifndef ETX_OTA_BAUD_RATE_MAX_ERROR
+#define ETX_OTA_BAUD_RATE_MAX_ERROR			(2U)				/**< @brief Designated maximum error, in percent, between a Baud rate requested via the ETX OTA Baud Rate Command and the one that the UART can actually generate from its clock, beyond which that Baud rate is rejected. */
+#endif
+
+#ifndef ETX_OTA_BAUD_CONFIRM_TIMEOUT
+#define ETX_OTA_BAUD_CONFIRM_TIMEOUT		(500U)				/**< @brief Designated time in milliseconds, counted from the moment that our MCU/MPU switches to the Baud rate requested via the ETX OTA Baud Rate Command, within which it must receive a valid ETX OTA Ping Command at that rate before falling back to the previous one. @note This is reported to the host in the response to the ETX OTA Start Command, so that it knows how long to wait before resuming at the previous Baud rate. */
+#endif
+
 #ifndef ETX_CUSTOM_HAL_TIMEOUT
 #define ETX_CUSTOM_HAL_TIMEOUT				(9000U)				/**< @brief Designated time in milliseconds for the HAL Timeout to be requested during each FLASH and UART request where the ETX OTA protocol is to be used on. @note For more details see @ref FLASH_WaitForLastOperation and @ref HAL_UART_Receive . */
 #endif
 
+#ifndef ETX_OTA_READY_BEACON
+#define ETX_OTA_READY_BEACON				(1U)				/**< @brief Flag used to make our MCU/MPU send, with a \c 1 , a READY beacon (i.e., an ETX OTA Response Type Packet with the @ref ETX_OTA_READY Response Status) each time that it starts to listen for an ETX OTA Transaction, so that the host knows right away that its next ETX OTA Packet will be answered. Otherwise, with a \c 0 , our MCU/MPU stays silent until the host sends an ETX OTA Packet. */
+#endif
+
 #ifndef PRE_ETX_OTA_REQUESTS_HEARING_DELAY
 #define PRE_ETX_OTA_REQUESTS_HEARING_DELAY	(3000)				/**< @brief This delay is generated to give time to the mian program of the Bootloader Firmware to establish a Bluetooth Connection, if any, before jumping into the stage where that main program listens for any available ETX OTA Requests. @note If the UART is used instead of the Bluetooth as a communication channel means for the ETX OTA Protocol, this delay can be changed to zero at the @ref app_etx_ota_config if desired. Otherwise, this value can be leaved at its default value and the ETX OTA Protocol should still work as expected. */
 #endif
 
+#ifndef ETX_OTA_END_CRC_FULL_RESCAN
+#define ETX_OTA_END_CRC_FULL_RESCAN			(0U)				/**< @brief Flag used to make our MCU/MPU validate the 32-bit CRC of a received Firmware Image by reading its whole Flash Memory region again when the ETX OTA End Command is received with a \c 1 . Otherwise, with a \c 0 , the 32-bit CRC is calculated incrementally from the Flash Memory right after programming each ETX OTA Data Type Packet, so that the ETX OTA End Command is responded to in constant time. */
+#endif
+
+#ifndef ETX_OTA_DATA_MAX_SIZE
+#define ETX_OTA_DATA_MAX_SIZE				(1024U)				/**< @brief Designated maximum "Data" field's size in bytes of the ETX OTA Packets that our MCU/MPU can receive, which sizes its receive buffers and which is advertised to the host in the response to the ETX OTA Start Command so that the host can negotiate the size of the ETX OTA Data Type Packets (i.e., the frame size) within it. @details Larger frames amortize the per-Packet overhead and round trips on fast links, whereas smaller ones lose less data per corrupted Packet on lossy links (e.g., BLE), which is why the host picks the frame size from its link estimate and gives it in the ETX OTA Header. Hosts that do not negotiate it keep sending frames of 1024 bytes. @note This must be a multiple of 4 of at least 256, which is validated at compile time, and each extra byte of it requires @ref ETX_OTA_RX_RING_SIZE to hold that many more bytes per whole ETX OTA Packet. */
+#endif
+
+#ifndef ETX_OTA_WINDOW_SIZE_MAX
+#define ETX_OTA_WINDOW_SIZE_MAX				(2U)				/**< @brief Designated maximum number of ETX OTA Data Type Packets that our MCU/MPU will allow the host to send in a single burst (i.e., the window size) before our MCU/MPU programs them and responds back with a single cumulative ACK. @details The actual window size is negotiated with the host via the ETX OTA Start Command, where a value of \c 1 keeps the classic mode in which each ETX OTA Data Type Packet is acknowledged individually. @note Each unit of this value requires @ref ETX_OTA_RX_RING_SIZE to hold one more whole ETX OTA Packet, or two more if @ref ETX_OTA_EARLY_ACK is enabled, which is why this defaults to a window of only 2 ETX OTA Data Type Packets. @note Since our MCU/MPU cannot print messages while a burst is arriving without losing data, the windowed mode should be used with @ref ETX_OTA_VERBOSE set to \c 0 . */
+#endif
+
+#ifndef ETX_OTA_WINDOW_DRAIN_TIMEOUT
+#define ETX_OTA_WINDOW_DRAIN_TIMEOUT		(50U)				/**< @brief Designated time in milliseconds of silence in the Hardware Protocol after which our MCU/MPU will consider that the host has finished sending a windowed burst whose ETX OTA Data Type Packets are being discarded due to a previous reception error in that same burst. */
+#endif
+
+#ifndef ETX_OTA_DATA_MAX_NACKS
+#define ETX_OTA_DATA_MAX_NACKS				(8U)				/**< @brief Designated maximum number of consecutive NACKs that our MCU/MPU will give, during the ETX OTA Data State, to ETX OTA Data Type Packets that were corrupted or rejected, before ending the ETX OTA Transaction. @details Each of those NACKs carries the reason of the rejection and the offset of the ETX OTA Payload from which the host has to re-send, so that our MCU/MPU stays in the ETX OTA Data State and the host only re-sends from there instead of starting the whole ETX OTA Transaction again. This is only done with the hosts that request it via the flags byte of the ETX OTA Start Command. @note A value of \c 0 makes our MCU/MPU end the ETX OTA Transaction at the first rejected ETX OTA Data Type Packet, just like with the hosts that do not request it. @note Errors while programming the Flash Memory always end the ETX OTA Transaction, since the binary patches and the LZ4 compressed Payloads cannot be rolled back to a previous offset. */
+#endif
+
+#ifndef ETX_OTA_DATA_V2
+#define ETX_OTA_DATA_V2						(1U)				/**< @brief Flag used to make our MCU/MPU accept, with a \c 1 , the ETX OTA Data v2 Type Packets from the hosts that request them via the flags byte of the ETX OTA Start Command. Otherwise, with a \c 0 , only the ETX OTA Data Type Packets are accepted. @details Each ETX OTA Data v2 Type Packet carries the offset of the ETX OTA Payload at which its data starts, so that our MCU/MPU acknowledges again, without writing them, the ones that it has already received (i.e., the ones that the host re-sends after having lost their ACK), and so that it NACKs the ones that come out of sequence instead of writing them at the wrong offset. This makes it safe for the host to re-send them as soon as its retransmission timeout expires. @note Each of those Packets takes 4 bytes of its "Data" field for the offset, which are taken from the room given by @ref ETX_OTA_DATA_MAX_SIZE . */
+#endif
+
+#ifndef ETX_OTA_FEC
+#define ETX_OTA_FEC							(0U)				/**< @brief Flag used to make our MCU/MPU accept, with a \c 1 , the ETX OTA Data Type Packets that carry Reed-Solomon parity bytes from the hosts that request it via the flags byte of the ETX OTA Start Command. Otherwise, with a \c 0 , those Packets are not accepted. @details The corrupted bytes of those Packets are repaired in place (see @ref rs_decoder ) before validating their 32-bit CRC, so that a few corrupted bytes (e.g., due to the radio noise of the HM-10 BT Device) no longer cost the host a whole re-sent Packet plus a round trip. The host chooses which of the ETX OTA Data Type Packets carry the parity bytes. @note The parity bytes take up to 16 bytes for every 239 bytes of the "Data" field, which are taken from the room given by @ref ETX_OTA_DATA_MAX_SIZE . @note It defaults to \c 0 since the @ref rs_decoder takes a few KB of Flash Memory. */
+#endif
+
+#ifndef ETX_OTA_ERASE_PAGES_AHEAD
+#define ETX_OTA_ERASE_PAGES_AHEAD			(1U)				/**< @brief Designated number of Flash Memory pages that our MCU/MPU will erase ahead of the ones that it is about to write during an ETX OTA Transaction. @details The Flash Memory pages of the Application Firmware are erased one by one, and only the ones covered by the size of the received Firmware Image, instead of erasing all of them when the first ETX OTA Data Type Packet is received. @note Pages that are already blank are not erased again. */
+#endif
+
+#ifndef ETX_OTA_SKIP_UNCHANGED_PAGES
+#define ETX_OTA_SKIP_UNCHANGED_PAGES		(0U)				/**< @brief Flag used to make our MCU/MPU stage each Flash Memory page of the received Firmware Image in RAM and to compare it with the page that is already in its Flash Memory, so that identical pages are neither erased nor programmed, with a \c 1 . Otherwise, with a \c 0 , every page covered by the received Firmware Image is erased (see @ref ETX_OTA_ERASE_PAGES_AHEAD ) and programmed. @details This makes the programming time and the Flash Memory wear of an update proportional to the pages that actually changed with respect to the installed Firmware Image, rather than to its whole size. @note A \c 1 requires one more Flash Memory page worth of RAM, and @ref ETX_OTA_ERASE_PAGES_AHEAD is then not used since no page can be erased before knowing whether it changed. @note It defaults to \c 0 to keep the Bootloader Firmware within its 24KB of Flash Memory when it is built without optimizations. */
+#endif
+
+#ifndef ETX_OTA_PATCH_UPDATE
+#define ETX_OTA_PATCH_UPDATE				(0U)				/**< @brief Flag used to make our MCU/MPU accept, with a \c 1 , Application Firmware Images sent as a binary patch (see @ref bspatch ) against the one that is currently installed, which are rebuilt page by page over that installed Firmware Image. Otherwise, with a \c 0 , only whole Firmware Images are accepted. @note A \c 1 requires @ref ETX_OTA_SKIP_UNCHANGED_PAGES to be enabled as well, since the old Firmware Image must not be erased ahead of the pages being rebuilt. @note It defaults to \c 0 since the @ref bspatch takes Flash Memory and @ref ETX_OTA_PATCH_BACKLOG_PAGES worth of RAM. */
+#endif
+
+#ifndef ETX_OTA_PATCH_BACKLOG_PAGES
+#define ETX_OTA_PATCH_BACKLOG_PAGES			(1U)				/**< @brief Designated number of the last overwritten Flash Memory pages of the old Application Firmware Image that our MCU/MPU keeps a copy of in RAM while applying a binary patch, which is reported to the host so that its patches do not read old data from any page that is older than those. @details A larger value lets the patches reuse old code that was moved further towards the end of the Firmware Image, at the cost of one Flash Memory page worth of RAM per page. @note This must be at least \c 1 . */
+#endif
+
+#ifndef ETX_OTA_COMPRESSION
+#define ETX_OTA_COMPRESSION					(0U)				/**< @brief Flag used to make our MCU/MPU accept, with a \c 1 , ETX OTA Payloads that are sent compressed with LZ4 (see @ref lz4_decoder ), which are decompressed on the fly while only holding the last @ref LZ4_DECODER_WINDOW_SIZE decompressed bytes in RAM. Otherwise, with a \c 0 , only uncompressed ETX OTA Payloads are accepted. @note It defaults to \c 0 since the @ref lz4_decoder takes @ref LZ4_DECODER_WINDOW_SIZE bytes of RAM. */
+#endif
+
+#ifndef ETX_OTA_RESUME
+#define ETX_OTA_RESUME						(0U)				/**< @brief Flag used to make our MCU/MPU checkpoint, into the @ref firmware_update_config sub-module and then into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE , how many Flash Memory pages of a Firmware Image it has written so far along with their 32-bit CRC, and to report that checkpoint to the host in its response to the ETX OTA Start Command so that an interrupted ETX OTA Transaction of that same Firmware Image can be continued from there, with a \c 1 . Otherwise, with a \c 0 , every ETX OTA Transaction starts over from the beginning of the Firmware Image. @note A \c 1 requires @ref ETX_OTA_SKIP_UNCHANGED_PAGES to be enabled and @ref ETX_OTA_END_CRC_FULL_RESCAN to be disabled, since the host skips the checkpointed pages via the ETX OTA Seek Command and since the checkpoint holds the running 32-bit CRC of the Firmware Image. @note It defaults to \c 0 since it requires @ref ETX_OTA_SKIP_UNCHANGED_PAGES . */
+#endif
+
+#ifndef ETX_OTA_CHECKPOINT_PAGES
+#define ETX_OTA_CHECKPOINT_PAGES			(8U)				/**< @brief Designated number of Flash Memory pages of a Firmware Image that our MCU/MPU writes between two consecutive checkpoints of its ETX OTA Transaction (see @ref ETX_OTA_RESUME ). @details A smaller value loses less progress whenever the link with the host drops, at the cost of appending more records into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+#endif
+
+#ifndef ETX_OTA_CHECKPOINT_LOG_PAGE
+#define ETX_OTA_CHECKPOINT_LOG_PAGE			(124U)				/**< @brief Designated Flash Memory page, right after the ones of the @ref firmware_update_config sub-module, that holds the append-only log of the checkpoints made in the middle of an ETX OTA Transaction (see @ref ETX_OTA_RESUME ). @details Each checkpoint is appended as a new 8-byte record with the already unlocked FPEC, so that the Flash Memory is neither erased nor locked back while the Firmware Image is being received. This page is only erased while processing the ETX OTA Header, whenever a different Firmware Image is about to be received or whenever it has no room left for the checkpoints of a whole Firmware Image, in which case its latest checkpoint is first folded into the @ref firmware_update_config sub-module. */
+#endif
+
+#ifndef ETX_OTA_EARLY_ACK
+#define ETX_OTA_EARLY_ACK					(1U)				/**< @brief Flag used to make our MCU/MPU acknowledge each ETX OTA Data Type Packet (or windowed burst) as soon as it has been received and its CRC validated, and to then write it into the Flash Memory while the host is already sending the next one, with a \c 1 . Otherwise, with a \c 0 , the ACK is sent only after writing into the Flash Memory, during which the link stays idle. @note If writing into the Flash Memory fails after an early ACK, then our MCU/MPU sends a NACK with @ref ETX_OTA_NACK_REASON_FLASH right away, without waiting for the next ETX OTA Packet of the host, and ends the ETX OTA Transaction with @ref ETX_OTA_EC_ERR . The host is then expected to take that NACK as fatal, whichever ETX OTA Packet it was waiting a response to. @note A \c 1 requires @ref ETX_OTA_RX_RING_SIZE to hold one more windowed burst. */
+#endif
+
+#ifndef ETX_OTA_RX_RING_SIZE
+#define ETX_OTA_RX_RING_SIZE				(((ETX_OTA_EARLY_ACK + 1U) * ETX_OTA_WINDOW_SIZE_MAX + 1U) * (ETX_OTA_DATA_MAX_SIZE + 9U))	/**< @brief Designated size in bytes of the circular buffer into which the DMA of the UART of the chosen Hardware Protocol writes all the bytes received from the host during an ETX OTA Transaction. @details The received ETX OTA Packets are parsed and processed in place from that buffer while the DMA keeps receiving in the background, so that no bytes are lost while our MCU/MPU programs its Flash Memory. @details This defaults to the smallest size that holds the largest window that can be granted (i.e., 5165 bytes with the default settings). @note Since the DMA overwrites the oldest bytes of that buffer once it gets full, it must be able to hold @ref ETX_OTA_WINDOW_SIZE_MAX plus one whole ETX OTA Packets (i.e., @ref ETX_OTA_DATA_MAX_SIZE plus 9 bytes each), or twice @ref ETX_OTA_WINDOW_SIZE_MAX plus one if @ref ETX_OTA_EARLY_ACK is enabled, which is validated at compile time. @note If the host still overruns that buffer (i.e., by sending beyond its window), then our MCU/MPU detects it, discards its whole content and NACKs so that the host re-sends from the last acknowledged offset, unless the overwritten bytes were already acknowledged and pending to be written, which ends the ETX OTA Transaction instead. */
+#endif
+
 /** @} */ //default_etx_ota_firmware_update_settings
 
 /**@defgroup default_fw_updt_config_settings Default Firmware Update Configuration Settings
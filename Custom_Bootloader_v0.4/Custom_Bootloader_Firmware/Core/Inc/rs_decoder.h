@@ -0,0 +1,74 @@
+/** @file
+ * @brief	Reed-Solomon Decoder header file
+ *
+ * @defgroup rs_decoder Reed-Solomon Decoder module
+ * @{
+ *
+ * @brief	This module provides the functions required to repair, in place, the bytes of a received block of data that
+ *          were corrupted on their way from the host, by using the Reed-Solomon parity bytes that the host sent along
+ *          with them.
+ *
+ * @details	The block of data is split into @ref rs_decoder_get_codeword_count interleaved RS(255,239) codewords over
+ *          GF(2^8) (with the primitive polynomial \c 0x11D and with the first consecutive root of the generator
+ *          polynomial being \c 1 ), such that the data byte number \c i belongs to the codeword number
+ *          <tt>i % count</tt> . Each codeword carries @ref RS_DECODER_PARITY_SIZE parity bytes, which are given right
+ *          after the whole block of data in the order of the codewords, and it is shortened whenever it carries less
+ *          than @ref RS_DECODER_MAX_DATA_SIZE data bytes.
+ * @details	Each codeword can repair up to @ref RS_DECODER_MAX_ERRORS corrupted bytes, wherever they are. Since
+ *          consecutive bytes belong to different codewords, a burst of up to <tt>count * @ref RS_DECODER_MAX_ERRORS</tt>
+ *          corrupted bytes can also be repaired.
+ *
+ * @note	The codewords with more corrupted bytes than that are usually detected as such, but they may also be
+ *          "repaired" into wrong data, which is why the repaired data must still be validated with its 32-bit CRC.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef RS_DECODER_H_
+#define RS_DECODER_H_
+
+#define RS_DECODER_BLOCK_SIZE			(255U)			/**< @brief Length in bytes of a whole (i.e., not shortened) Reed-Solomon codeword, including its parity bytes. */
+#define RS_DECODER_PARITY_SIZE			(16U)			/**< @brief Number of parity bytes of each Reed-Solomon codeword. */
+#define RS_DECODER_MAX_DATA_SIZE		(RS_DECODER_BLOCK_SIZE - RS_DECODER_PARITY_SIZE)	/**< @brief Maximum number of data bytes of each Reed-Solomon codeword. */
+#define RS_DECODER_MAX_ERRORS			(RS_DECODER_PARITY_SIZE / 2U)	/**< @brief Maximum number of corrupted bytes that can be repaired in each Reed-Solomon codeword. */
+
+/**@brief	Reed-Solomon Decoder Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref rs_decoder module to indicate the resulting
+ *          status of having executed the process contained in each of those functions.
+ */
+typedef enum
+{
+	RS_DECODER_EC_OK	= 0U,	//!< Reed-Solomon Decoder Process was successful.
+	RS_DECODER_EC_ERR	= 1U	//!< Reed-Solomon Decoder Process has failed, because at least one of the codewords has more corrupted bytes than the ones that can be repaired.
+} RsDecoder_Status;
+
+/**@brief	Gets the number of interleaved codewords into which a block of data is split.
+ *
+ * @param data_len	Length in bytes of the block of data, without its parity bytes.
+ *
+ * @return	The number of codewords, which is <tt>ceil( \p data_len / @ref RS_DECODER_MAX_DATA_SIZE )</tt> .
+ */
+uint16_t rs_decoder_get_codeword_count(uint16_t data_len);
+
+/**@brief	Gets the length of a block of data from its length together with its parity bytes.
+ *
+ * @param total_len	Length in bytes of the block of data together with its parity bytes.
+ *
+ * @return	The length in bytes of the block of data, or \c 0 if no block of data can give \p total_len bytes.
+ */
+uint16_t rs_decoder_get_data_len(uint16_t total_len);
+
+/**@brief	Repairs, in place, the corrupted bytes of a block of data and of its parity bytes.
+ *
+ * @param[in, out] p_data		Pointer to the block of data, which must be followed right away by its parity bytes.
+ * @param data_len				Length in bytes of the block of data, without its parity bytes.
+ * @param[out] p_repaired		Pointer to where the number of bytes that have been repaired will be written into.
+ *
+ * @retval	RS_DECODER_EC_OK
+ * @retval	RS_DECODER_EC_ERR
+ */
+RsDecoder_Status rs_decoder_repair(uint8_t *p_data, uint16_t data_len, uint16_t *p_repaired);
+
+#endif /* RS_DECODER_H_ */
+
+/** @} */
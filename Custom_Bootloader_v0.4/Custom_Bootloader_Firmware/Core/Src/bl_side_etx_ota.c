@@ -6,13 +6,23 @@
 #include <stdio.h>	// Library from which "printf()" is located at.
 #include <string.h>	// Library from which "memset()" is located at.
 #include <stdbool.h> // Library from which the "bool" type is located at.
+#include "flash_writer.h" // We call the library that erases and programs the Flash Memory of our MCU/MPU directly through its FPEC registers.
+#include "etx_ota_start_resp.h" // We call the library that defines the layout of our response to an ETX OTA Start Command, which is shared with the host.
+#if ETX_OTA_PATCH_UPDATE
+#include "bspatch.h" // We call the library that rebuilds a Firmware Image from the installed one and from a binary patch.
+#endif
+#if ETX_OTA_COMPRESSION
+#include "lz4_decoder.h" // We call the library that decompresses, on the fly, the ETX OTA Payloads that are sent compressed.
+#endif
+#if ETX_OTA_FEC
+#include "rs_decoder.h" // We call the library that repairs the corrupted bytes of the ETX OTA Data Type Packets that carry Reed-Solomon parity bytes.
+#endif
 
 #define ETX_OTA_SOF  				(0xAA)    		/**< @brief Designated Start Of Frame (SOF) byte to indicate the start of an ETX OTA Packet. */
 #define ETX_OTA_EOF  				(0xBB)    		/**< @brief Designated End Of Frame (EOF) byte to indicate the end of an ETX OTA Packet. */
 #define ETX_OTA_SOF_SIZE			(1U)			/**< @brief	Designated SOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_PACKET_TYPE_SIZE	(1U)			/**< @brief	Designated Packet Type field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_DATA_LENGTH_SIZE	(2U)			/**< @brief	Designated Data Length field size in bytes in a ETX OTA Packet. */
-#define ETX_OTA_DATA_MAX_SIZE 		(1024U)  		/**< @brief Designated maximum expected "Data" field's size in the General Data Format of an ETX OTA Packet. @note This definition's value does not stand for the size of the entire ETX OTA Packet. Instead, it represents the size of the "Data" field that is inside the General Data Format of an ETX OTA Packet. */
 #define ETX_OTA_CRC32_SIZE			(4U)			/**< @brief	Designated 32-bit CRC field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_EOF_SIZE			(1U)			/**< @brief	Designated EOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_DATA_OVERHEAD 		(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE + ETX_OTA_CRC32_SIZE + ETX_OTA_EOF_SIZE)  	/**< @brief Data overhead in bytes of an ETX OTA Packet, which represents the bytes of an ETX OTA Packet except for the ones that it has at the Data field. */
@@ -20,6 +30,40 @@
 #define ETX_OTA_DATA_FIELD_INDEX	(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE) 											/**< @brief Index position of where the Data field bytes of a ETX OTA Packet starts at. */
 #define ETX_OTA_BL_FW_SIZE          (FLASH_PAGE_SIZE_IN_BYTES * ETX_BL_FLASH_PAGES_SIZE)   	/**< @brief Maximum size allowable for a Bootloader Firmware Image to have. */
 #define ETX_OTA_APP_FW_SIZE         (FLASH_PAGE_SIZE_IN_BYTES * ETX_APP_FLASH_PAGES_SIZE)   /**< @brief Maximum size allowable for an Application Firmware Image to have. */
+#define ETX_OTA_START_CMD_WINDOW_INDEX	(ETX_OTA_DATA_FIELD_INDEX + 1U)						/**< @brief Index position, in an ETX OTA Command Type Packet containing the Start Command, of the optional byte with which the host requests the windowed transfer mode and its desired window size. */
+#define ETX_OTA_START_CMD_FLAGS_INDEX	(ETX_OTA_DATA_FIELD_INDEX + 2U)						/**< @brief Index position, in an ETX OTA Command Type Packet containing the Start Command, of the optional flags byte that may follow the window size byte. */
+#define ETX_OTA_START_FLAG_RESUME	(0x01U)													/**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests our MCU/MPU to report the checkpoint of its latest ETX OTA Transaction (see @ref ETX_OTA_RESUME ). */
+#define ETX_OTA_START_FLAG_NACK_REASON	(0x02U)												/**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests our MCU/MPU to NACK the ETX OTA Data Type Packets that it rejects with their reason and with the offset of the Payload from which the host has to re-send, instead of ending the ETX OTA Transaction (see @ref ETX_OTA_DATA_MAX_NACKS ). */
+#define ETX_OTA_START_FLAG_DATA_V2	(0x04U)													/**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests to send the ETX OTA Payload via ETX OTA Data v2 Type Packets (see @ref ETX_OTA_DATA_V2 ). */
+#define ETX_OTA_START_FLAG_FEC		(0x08U)													/**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests to send ETX OTA Data Type Packets that carry Reed-Solomon parity bytes (see @ref ETX_OTA_FEC ). */
+#define ETX_OTA_START_FLAG_GEOMETRY	(0x10U)													/**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests our MCU/MPU to report the geometry of its Flash Memory and the size of its receive buffer (see @ref etx_ota_start_resp_t::page_size ). */
+#define ETX_OTA_PAGE_CRC_MAX_COUNT	(16U)													/**< @brief Maximum number of Flash Memory pages whose 32-bit CRCs can be requested by the host in a single ETX OTA Page CRC Command. */
+#define ETX_OTA_PAGE_CRC_CMD_SIZE	(4U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Page CRC Command, which is given by the Command byte, the 2-byte index of the first requested page and the 1-byte number of requested pages. */
+#define ETX_OTA_SEEK_CMD_SIZE		(9U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Seek Command, which is given by the Command byte, the 4-byte offset of the Payload from which the host continues and the 4-byte length of the run of the Payload that it will send from there. */
+#define ETX_OTA_SEEK_CMD_ERASE_SIZE	(10U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Seek Command whenever it is followed by the flags byte (see @ref ETX_OTA_SEEK_FLAG_ERASE ). */
+#define ETX_OTA_SEEK_FLAG_ERASE		(0x01U)													/**< @brief Bit of the flags byte of an ETX OTA Seek Command with which the host indicates that the Flash Memory pages that it is skipping are blank in the Firmware Image (i.e., all their bytes are \c 0xFF ), so that our MCU/MPU erases them instead of keeping them in place. */
+#define ETX_OTA_FEATURE_DELTA_UPDATE	(0x01U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it supports the ETX OTA Page CRC and Seek Commands. */
+#define ETX_OTA_FEATURE_PATCH_UPDATE	(0x02U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it accepts the @ref ETX_OTA_Application_Firmware_Patch Payload Type, in which case the features byte is followed by the value of @ref ETX_OTA_PATCH_BACKLOG_PAGES . */
+#define ETX_OTA_FEATURE_COMPRESSION		(0x04U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it accepts ETX OTA Payloads compressed with LZ4, in which case the backlog pages byte is followed by the value of @ref LZ4_DECODER_WINDOW_LOG2 . */
+#define ETX_OTA_FEATURE_RESUME			(0x08U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it reports the checkpoint of its latest ETX OTA Transaction, in which case the 4-byte size, the 4-byte 32-bit CRC and the 4-byte resume offset of its Firmware Image are given from @ref etx_ota_start_resp_t::checkpoint_size . */
+#define ETX_OTA_FEATURE_SPARSE_IMAGE	(0x10U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it accepts the flags byte of the ETX OTA Seek Command, with which the host can skip the blank Flash Memory pages of the Firmware Image instead of sending them (see @ref ETX_OTA_SEEK_FLAG_ERASE ). */
+#define ETX_OTA_FEATURE_FRAME_SIZE	(0x20U)												/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it gives, in @ref etx_ota_start_resp_t::max_data_size , the 2-byte @ref ETX_OTA_DATA_MAX_SIZE within which the host can choose the size of the ETX OTA Data Type Packets. */
+#define ETX_OTA_LEGACY_FRAME_SIZE	(1024U)													/**< @brief Size in bytes of the ETX OTA Data Type Packets sent by the hosts that do not negotiate it, which is assumed whenever the reserved2 field of the ETX OTA Header holds its erased value of \c 0xFFFF . */
+#define ETX_OTA_FEATURE_BAUD_RATE	(0x40U)													/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it accepts the ETX OTA Baud Rate Command, in which case the 4-byte @ref ETX_OTA_BAUD_RATE_MAX and the 2-byte @ref ETX_OTA_BAUD_CONFIRM_TIMEOUT are given from @ref etx_ota_start_resp_t::baud_rate_max . */
+#define ETX_OTA_FEATURE_NACK_REASON	(0x80U)													/**< @brief Bit of the features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_NACK_REASON , so that the NACKs to the rejected ETX OTA Data Type Packets carry their reason and the offset from which the host has to re-send. */
+#define ETX_OTA_NACK_DATA_SIZE		(5U)													/**< @brief Number of bytes appended by our MCU/MPU right after the Response Status of a NACK that carries its reason, which are given by the 1-byte @ref ETX_OTA_Nack_Reason and the 4-byte offset of the Payload from which the host has to re-send. */
+#define ETX_OTA_EXT_FEATURE_DATA_V2	(0x01U)													/**< @brief Bit of the extended features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_DATA_V2 . */
+#define ETX_OTA_EXT_FEATURE_FEC		(0x02U)													/**< @brief Bit of the extended features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_FEC . */
+#define ETX_OTA_EXT_FEATURE_GEOMETRY	(0x04U)												/**< @brief Bit of the extended features byte, appended by our MCU/MPU to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_GEOMETRY . */
+#define ETX_OTA_PACKET_TYPE_FEC_FLAG	(0x80U)												/**< @brief Bit of the Packet Type of an ETX OTA Data Type Packet, or of an ETX OTA Data v2 Type Packet, that indicates that its "Data" field is followed by the Reed-Solomon parity bytes of it (see @ref rs_decoder ), which are also counted by its "Data Length" field, whereas its 32-bit CRC is still the one of the "Data" field alone. @note The host only sets this bit if our MCU/MPU has set @ref ETX_OTA_EXT_FEATURE_FEC in its response to the ETX OTA Start Command. */
+#define ETX_OTA_DATA_OFFSET_SIZE	(4U)													/**< @brief Size in bytes of the offset of the ETX OTA Payload that comes at the beginning of the "Data" field of an ETX OTA Data v2 Type Packet, right before its data. */
+#define ETX_OTA_BAUD_RATE_CMD_SIZE	(5U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Baud Rate Command, which is given by the Command byte and the 4-byte Baud rate to which the host requests our MCU/MPU to switch. */
+#define ETX_OTA_SYNC_CMD_SIZE		(2U)													/**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Sync Command, which is given by the Command byte and the 1-byte sequence number that our MCU/MPU echoes in its ACK. */
+#define ETX_OTA_PAYLOAD_COMPRESSED_FLAG	(0x80U)												/**< @brief Bit of the Payload Type given in an ETX OTA Header that indicates that the ETX OTA Payload is sent compressed with LZ4 (see @ref lz4_decoder ), in which case the Payload Size and 32-bit CRC given in there are the ones of the decompressed bytes, whereas the size of the compressed ETX OTA Payload is given in its reserved1 field. */
+#define ETX_OTA_CHECKPOINT_LOG_ADDR	(FLASH_START_ADDR + ETX_OTA_CHECKPOINT_LOG_PAGE*FLASH_PAGE_SIZE_IN_BYTES)	/**< @brief Start address of the Flash Memory page given by @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+#define ETX_OTA_CHECKPOINT_LOG_RECORDS	(FLASH_PAGE_SIZE_IN_BYTES / sizeof(etx_ota_checkpoint_record_t))	/**< @brief Number of checkpoint records that fit into the Flash Memory page given by @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+#define ETX_OTA_CHECKPOINT_MAX_COUNT	((ETX_APP_FLASH_PAGES_SIZE / ETX_OTA_CHECKPOINT_PAGES) + 1U)	/**< @brief Maximum number of checkpoints that can be made during the ETX OTA Transaction of a single Firmware Image, which are the ones that the @ref ETX_OTA_CHECKPOINT_LOG_PAGE must have room for before that ETX OTA Transaction starts. */
+#define ETX_OTA_RESP_DATA_MAX_SIZE	(1U + 4U*ETX_OTA_PAGE_CRC_MAX_COUNT)					/**< @brief Maximum "Data" field's size in bytes of an ETX OTA Response Type Packet, which is given by its Response Status byte plus the 32-bit CRCs of the pages requested via an ETX OTA Page CRC Command, which is longer than the 4-byte offset of the cumulative ACKs sent in the windowed transfer mode. */
 
 /**@brief	ETX OTA process states.
  *
@@ -56,7 +100,8 @@ typedef enum
 	ETX_OTA_PACKET_TYPE_CMD       = 0U,   	//!< ETX OTA Command Type Packet. @details This Packet Type is expected to be send by the host to our MCU/MPU to request a certain ETX OTA Command to our MCU/MPU (see @ref ETX_OTA_Command ).
 	ETX_OTA_PACKET_TYPE_DATA      = 1U,   	//!< ETX OTA Data Type Packet. @details This Packet Type will contain either the full or a part/chunk of a Firmware Image being send from the host to our MCU/MPU.
 	ETX_OTA_PACKET_TYPE_HEADER    = 2U,   	//!< ETX OTA Header Type Packet. @details This Packet Type will provide the size in bytes of the Firmware Image that our MCU/MPU will receive, its recorded 32-bits CRC and the sub-type of the ETX OTA Data Type Packets to be received (i.e., @ref ETX_OTA_Payload_t ).
-	ETX_OTA_PACKET_TYPE_RESPONSE  = 3U		//!< ETX OTA Response Type Packet. @details This Packet Type contains a response from our MCU/MPU that is given to the host to indicate to it whether or not our MCU/MPU was able to successfully process the latest request or Packet from the host.
+	ETX_OTA_PACKET_TYPE_RESPONSE  = 3U,		//!< ETX OTA Response Type Packet. @details This Packet Type contains a response from our MCU/MPU that is given to the host to indicate to it whether or not our MCU/MPU was able to successfully process the latest request or Packet from the host.
+	ETX_OTA_PACKET_TYPE_DATA_V2   = 4U		//!< ETX OTA Data v2 Type Packet. @details This Packet Type is the same as @ref ETX_OTA_PACKET_TYPE_DATA , except that its "Data" field starts with the 4-byte offset of the ETX OTA Payload at which its data starts (see @ref ETX_OTA_DATA_V2 ). @note The host only sends this Packet Type if our MCU/MPU has set @ref ETX_OTA_EXT_FEATURE_DATA_V2 in its response to the ETX OTA Start Command.
 } ETX_OTA_Packet_t;
 
 /**@brief	ETX OTA Commands definitions.
@@ -66,9 +111,14 @@ typedef enum
  */
 typedef enum
 {
-	ETX_OTA_CMD_START = 0U,		    //!< ETX OTA Firmware Update Start Command. @details This command indicates to the MCU/MPU that the host is connected to (via @ref COMPORT_NUMBER ) to start an ETX OTA Process.
+	ETX_OTA_CMD_START = 0U,		    //!< ETX OTA Firmware Update Start Command. @details This command indicates to the MCU/MPU that the host is connected to (via @ref COMPORT_NUMBER ) to start an ETX OTA Process. @details If the host appends a second byte to the "Data" field of this Command, then that byte requests the windowed transfer mode with the given window size, to which our MCU/MPU will respond with an ACK carrying the window size that it grants (see @ref etx_ota_window_size ).
 	ETX_OTA_CMD_END   = 1U,    		//!< ETX OTA Firmware Update End command. @details This command indicates to the MCU/MPU that the host is connected to (via @ref COMPORT_NUMBER ) to end the current ETX OTA Process.
-	ETX_OTA_CMD_ABORT = 2U    		//!< ETX OTA Abort Command. @details This command is used by the host to request to our MCU/MPU to abort whatever ETX OTA Process that our MCU/MPU is working on. @note Unlike the other Commands, this one can be legally requested to our MCU/MPU at any time and as many times as the host wants to.
+	ETX_OTA_CMD_ABORT = 2U,    		//!< ETX OTA Abort Command. @details This command is used by the host to request to our MCU/MPU to abort whatever ETX OTA Process that our MCU/MPU is working on. @note Unlike the other Commands, this one can be legally requested to our MCU/MPU at any time and as many times as the host wants to.
+	ETX_OTA_CMD_PING  = 3U,    		//!< ETX OTA Ping Command. @details This command is used by the host to measure the round-trip time of its link with our MCU/MPU, to which our MCU/MPU will just respond with an ACK without changing the state of the current ETX OTA Process. @note The host only sends this command after our MCU/MPU has granted the windowed transfer mode in its response to the ETX OTA Start Command, since older firmwares would consider it an invalid command.
+	ETX_OTA_CMD_PAGE_CRC = 4U,		//!< ETX OTA Page CRC Command. @details This command is used by the host to request the 32-bit CRCs of up to @ref ETX_OTA_PAGE_CRC_MAX_COUNT Flash Memory pages of the Firmware Image that is currently installed at @ref ETX_APP_FLASH_ADDR , to which our MCU/MPU will respond with an ACK carrying those 32-bit CRCs without changing the state of the current ETX OTA Process. @details The "Data" field of this Command holds the Command byte, followed by the 2-byte index of the first requested page and then by the 1-byte number of requested pages. @note The host only sends this command if our MCU/MPU has set @ref ETX_OTA_FEATURE_DELTA_UPDATE in its response to the ETX OTA Start Command.
+	ETX_OTA_CMD_SEEK  = 5U,			//!< ETX OTA Seek Command. @details This command is used by the host, during the ETX OTA Data State, to skip the Flash Memory pages that it found to be unchanged via the ETX OTA Page CRC Command, which our MCU/MPU keeps in place instead of receiving them. @details The "Data" field of this Command holds the Command byte, followed by the 4-byte offset of the Payload from which the host continues and then by the 4-byte length of the run of the Payload that it will send from there via ETX OTA Data Type Packets, which may be followed by a flags byte (see @ref ETX_OTA_SEEK_FLAG_ERASE ) whenever our MCU/MPU has set @ref ETX_OTA_FEATURE_SPARSE_IMAGE . @note The host only sends this command if our MCU/MPU has set @ref ETX_OTA_FEATURE_DELTA_UPDATE in its response to the ETX OTA Start Command.
+	ETX_OTA_CMD_BAUD_RATE = 6U,		//!< ETX OTA Baud Rate Command. @details This command is used by the host, during the ETX OTA Header State, to request our MCU/MPU to switch the UART of the chosen Hardware Protocol to a faster Baud rate, to which our MCU/MPU will respond with an ACK at the current Baud rate before switching (see @ref etx_ota_switch_baud_rate ). @details The "Data" field of this Command holds the Command byte, followed by the 4-byte Baud rate, which must not be greater than @ref ETX_OTA_BAUD_RATE_MAX . @note The host only sends this command if our MCU/MPU has set @ref ETX_OTA_FEATURE_BAUD_RATE in its response to the ETX OTA Start Command.
+	ETX_OTA_CMD_SYNC  = 7U			//!< ETX OTA Sync Command. @details This command is used by the host, before the ETX OTA Start Command, to synchronize with our MCU/MPU, which resets the current ETX OTA Transaction back to the ETX OTA Start State and responds right away with an ACK that echoes the sequence number of this Command. @details The "Data" field of this Command holds the Command byte, followed by the 1-byte sequence number. @note Like the ETX OTA Abort Command, this one can be legally requested to our MCU/MPU at any time, but without ending the current ETX OTA Transaction.
 } ETX_OTA_Command;
 
 /**@brief	Payload Type definitions available in the ETX OTA Firmware Update process.
@@ -82,7 +132,8 @@ typedef enum
 {
     ETX_OTA_Application_Firmware_Image  = 0U,   	//!< ETX OTA Application Firmware Image Data Packet Type.
 	ETX_OTA_Bootloader_Firmware_Image   = 1U,  		//!< ETX OTA Bootloader Firmware Image Data Packet Type.
-	ETX_OTA_Custom_Data                 = 2U   		//!< ETX OTA Custom Data Packet Type.
+	ETX_OTA_Custom_Data                 = 2U,   	//!< ETX OTA Custom Data Packet Type.
+	ETX_OTA_Application_Firmware_Patch  = 3U   		//!< ETX OTA Application Firmware Patch Data Packet Type. @details The Payload is a binary patch (see @ref bspatch ) from the Application Firmware Image that is currently installed in our MCU/MPU, whose size is the one given in the ETX OTA Header, whereas the 32-bit CRC given in there is the one of the resulting Application Firmware Image. @note This Payload Type is only accepted if @ref ETX_OTA_PATCH_UPDATE is enabled.
 } ETX_OTA_Payload_t;
 
 /**@brief	Response Status definitions available in the ETX OTA Firmware Update process.
@@ -94,12 +145,107 @@ typedef enum
 typedef enum
 {
 	ETX_OTA_ACK  = 0U,   		//!< Acknowledge (ACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has been processed successfully by our MCU/MPU.
-	ETX_OTA_NACK   = 1U   		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by our MCU/MPU.
+	ETX_OTA_NACK   = 1U,  		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by our MCU/MPU.
+	ETX_OTA_READY  = 2U   		//!< READY beacon data byte used in an ETX OTA Response Type Packet that our MCU/MPU sends, without being requested to, each time that it starts to listen for an ETX OTA Transaction (see @ref ETX_OTA_READY_BEACON ).
 } ETX_OTA_Response_Status;
 
-static uint8_t Rx_Buffer[ETX_OTA_PACKET_MAX_SIZE];			    /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received ETX OTA Packet from the host. */
+/**@brief	NACK Reason definitions available in the ETX OTA Firmware Update process.
+ *
+ * @details	Whenever the host has requested it via @ref ETX_OTA_START_FLAG_NACK_REASON , the NACKs that our MCU/MPU
+ *          gives during the ETX OTA Data State carry one of these reasons, followed by the offset of the Payload from
+ *          which the host has to re-send. All of them let the ETX OTA Transaction continue, except for
+ *          @ref ETX_OTA_NACK_REASON_FLASH .
+ */
+typedef enum
+{
+	ETX_OTA_NACK_REASON_NONE      = 0U,   	//!< No reason, which is used for the NACKs that end the ETX OTA Transaction without appending any bytes to their Response Status.
+	ETX_OTA_NACK_REASON_CRC       = 1U,   	//!< The ETX OTA Packet was corrupted, either because its 32-bit CRC did not match or because any of its SOF, Packet Type or EOF fields was not the expected one.
+	ETX_OTA_NACK_REASON_LENGTH    = 2U,   	//!< The "Data Length" field of the ETX OTA Packet was either too long to be received, not a multiple of 4 bytes or beyond the Payload or the run of it that the host has announced.
+	ETX_OTA_NACK_REASON_FLASH     = 3U,   	//!< The Flash Memory could not be programmed at the given offset, which ends the ETX OTA Transaction.
+	ETX_OTA_NACK_REASON_SEQUENCE  = 4U		//!< An ETX OTA Packet other than an ETX OTA Data Type Packet was received in the middle of the ETX OTA Data State.
+} ETX_OTA_Nack_Reason;
+
+#if ((ETX_OTA_DATA_MAX_SIZE % 4U) != 0U) || (ETX_OTA_DATA_MAX_SIZE < 256U) || (ETX_OTA_DATA_MAX_SIZE > 0xFFFCU)
+#error "ETX_OTA_DATA_MAX_SIZE must be a multiple of 4 from 256 up to 65532."
+#endif
+#if ETX_OTA_RX_RING_SIZE < (((ETX_OTA_EARLY_ACK + 1U) * ETX_OTA_WINDOW_SIZE_MAX + 1U) * ETX_OTA_PACKET_MAX_SIZE)
+#error "ETX_OTA_RX_RING_SIZE must be able to hold (ETX_OTA_EARLY_ACK + 1) * ETX_OTA_WINDOW_SIZE_MAX + 1 whole ETX OTA Packets."
+#endif
+#if ETX_OTA_PATCH_UPDATE && (!ETX_OTA_SKIP_UNCHANGED_PAGES || (ETX_OTA_PATCH_BACKLOG_PAGES < 1U))
+#error "ETX_OTA_PATCH_UPDATE requires ETX_OTA_SKIP_UNCHANGED_PAGES and at least one ETX_OTA_PATCH_BACKLOG_PAGES."
+#endif
+#if ETX_OTA_BAUD_RATE_MAX && (ETX_OTA_BAUD_CONFIRM_TIMEOUT > 0xFFFFU)
+#error "ETX_OTA_BAUD_CONFIRM_TIMEOUT must fit into 16 bits, since it is reported to the host in the response to the ETX OTA Start Command."
+#endif
+#if ETX_OTA_RESUME && (!ETX_OTA_SKIP_UNCHANGED_PAGES || ETX_OTA_END_CRC_FULL_RESCAN || (ETX_OTA_CHECKPOINT_PAGES < 1U))
+#error "ETX_OTA_RESUME requires ETX_OTA_SKIP_UNCHANGED_PAGES, a disabled ETX_OTA_END_CRC_FULL_RESCAN and at least one ETX_OTA_CHECKPOINT_PAGES."
+#endif
+
+#if ETX_OTA_RESUME
+/**@brief	Checkpoint record parameters structure, as appended into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE .
+ *
+ * @details	Since the FPEC programs the half-words of a record in ascending address order, \c pages_inv is the last
+ *          one to be programmed, so that a record left half-written by a power loss never matches its \c pages field
+ *          and is therefore skipped.
+ */
+typedef struct __attribute__ ((__packed__)) {
+	uint32_t  crc;				//!< 32-bit CRC of the first \c pages Flash Memory pages of the Firmware Image, counted from @ref ETX_APP_FLASH_ADDR .
+	uint16_t  pages;			//!< Number of Flash Memory pages of the Firmware Image that had been written when this checkpoint was made.
+	uint16_t  pages_inv;		//!< Bitwise inverse of the \c pages field, which validates that this record was completely programmed.
+} etx_ota_checkpoint_record_t;
+#endif
+
+static uint8_t Rx_Ring[ETX_OTA_RX_RING_SIZE];					/**< @brief Global circular buffer into which the DMA of @ref p_huart writes, in the background, all the bytes received from the host during an ETX OTA Transaction. @details The received ETX OTA Packets are parsed and processed in place from this buffer, except for the one whose bytes wrap around its end, which is first placed into @ref Rx_Wrap_Buffer . */
+static uint16_t rx_ring_read_idx = 0U;							/**< @brief Global variable used to hold the index of @ref Rx_Ring from which the next byte received from the host is to be parsed. */
+static volatile uint32_t rx_ring_laps = 0U;						/**< @brief Global variable used to count the times that the DMA of @ref p_huart has wrapped around the end of @ref Rx_Ring since @ref etx_ota_rx_ring_start , which is incremented from its Transfer Complete interrupt (see @ref etx_ota_rx_ring_lap_callback ). */
+static uint32_t rx_ring_consumed = 0U;							/**< @brief Global variable used to count the bytes of @ref Rx_Ring that have been parsed since @ref etx_ota_rx_ring_start . */
+static uint32_t rx_ring_released = 0U;							/**< @brief Global variable used to count the bytes of @ref Rx_Ring , since @ref etx_ota_rx_ring_start , that are no longer referenced by any received ETX OTA Packet and that the DMA can therefore overwrite (see @ref etx_ota_rx_ring_release ). */
+static bool is_rx_ring_overrun = false;							/**< @brief Global flag used to indicate whether @ref Rx_Ring has been overrun since it was last released with a \c true , or otherwise with a \c false , in which case the ETX OTA Packets taken from it since then must be discarded. */
+static uint8_t Rx_Wrap_Buffer[ETX_OTA_PACKET_MAX_SIZE];		/**< @brief Global buffer used to hold the single ETX OTA Packet that, if any, has its bytes wrapped around the end of @ref Rx_Ring , so that it can be processed as contiguous data. @note Since @ref Rx_Ring can hold a whole windowed burst, only one of the ETX OTA Packets held at once can ever be wrapped. */
+static uint8_t *p_rx_packets[ETX_OTA_WINDOW_SIZE_MAX];			/**< @brief Global pointers to the whole data of the received ETX OTA Packets that are pending to be processed, which point either into @ref Rx_Ring or into @ref Rx_Wrap_Buffer . @details Only the first pointer is used outside of the windowed transfer mode, whereas in that mode each ETX OTA Data Type Packet of a single burst is pointed to by its own pointer. */
 static ETX_OTA_State etx_ota_state = ETX_OTA_STATE_IDLE;	    /**< @brief Global variable used to hold the ETX OTA Process State at which our MCU/MPU is currently at. */
-static uint32_t etx_ota_fw_received_size = 0;				    /**< @brief Global variable used to indicate the Total Size in bytes of the whole ETX OTA Payload that our MCU/MPU has received and written into the Flash Memory designated to the ETX OTA Protocol. */
+static uint32_t etx_ota_payload_size = 0;					    /**< @brief Global variable used to indicate the Total Size in bytes of the ETX OTA Payload that our MCU/MPU expects to receive via ETX OTA Data Type Packets, which is the size of the Firmware Image itself unless it is sent as a binary patch (see @ref ETX_OTA_Application_Firmware_Patch ). */
+static uint32_t etx_ota_fw_received_size = 0;				    /**< @brief Global variable used to indicate the Total Size in bytes of the Firmware Image that our MCU/MPU has received, or rebuilt from a binary patch, and written into the Flash Memory designated to the ETX OTA Protocol. @note If @ref ETX_OTA_SKIP_UNCHANGED_PAGES is enabled, this also counts the @ref page_stage_len bytes that are staged in @ref Page_Stage_Buffer . */
+static uint32_t etx_ota_fw_run_end = 0;						    /**< @brief Global variable used to indicate the offset of the ETX OTA Payload at which the run of ETX OTA Data Type Packets that the host is currently sending ends, which is the whole ETX OTA Payload unless the host has sent an ETX OTA Seek Command. */
+static uint32_t etx_ota_fw_buffered_size = 0;				    /**< @brief Global variable used to indicate the Total Size in bytes of the ETX OTA Payload that our MCU/MPU has received and validated, which is ahead of @ref etx_ota_fw_received_size by the size of the ETX OTA Data Type Packets pointed to by @ref p_rx_pending_data . @details This is the offset of the ETX OTA Payload that is given to the host in the cumulative ACKs of the windowed transfer mode. */
+static uint8_t *p_rx_pending_data[ETX_OTA_WINDOW_SIZE_MAX];	/**< @brief Global pointers to the received and validated ETX OTA Data Type Packets that are still pending to be written into the Flash Memory, which are held in place in @ref Rx_Ring . @details If @ref ETX_OTA_EARLY_ACK is enabled, these are written after having acknowledged them to the host, so that the next ETX OTA Data Type Packets are received in the background while our MCU/MPU programs its Flash Memory. */
+static uint8_t rx_pending_data_count = 0U;						/**< @brief Global variable used to indicate the number of valid pointers in @ref p_rx_pending_data . */
+#if ETX_OTA_SKIP_UNCHANGED_PAGES
+static uint8_t Page_Stage_Buffer[FLASH_PAGE_SIZE_IN_BYTES];	/**< @brief Global buffer in which the bytes of the received Firmware Image that belong to the Flash Memory page currently being received are staged, so that the whole page can be compared with the one already in the Flash Memory before deciding whether to write it (see @ref etx_ota_commit_staged_page ). */
+static uint16_t page_stage_len = 0U;							/**< @brief Global variable used to indicate the number of valid bytes in @ref Page_Stage_Buffer . */
+static uint16_t etx_ota_skipped_pages = 0U;					/**< @brief Global variable used to indicate the number of Flash Memory pages that were found to be unchanged, and that were therefore not written, during the current ETX OTA Transaction. */
+#if ETX_OTA_PATCH_UPDATE
+static bool is_etx_ota_patch = false;							/**< @brief Global flag used to indicate whether the Firmware Image of the current ETX OTA Transaction is being received as a binary patch with a \c true , or otherwise with a \c false . */
+static uint32_t etx_ota_patch_fw_crc = 0U;						/**< @brief Global variable used to hold the 32-bit CRC, given in the ETX OTA Header, of the Firmware Image that is rebuilt from the binary patch. */
+static uint8_t Patch_Backlog_Buffer[ETX_OTA_PATCH_BACKLOG_PAGES][FLASH_PAGE_SIZE_IN_BYTES];	/**< @brief Global buffer holding a copy of the last @ref ETX_OTA_PATCH_BACKLOG_PAGES Flash Memory pages of the old Firmware Image that have been overwritten while applying a binary patch, where the page number \c p is held at the index <tt>p % @ref ETX_OTA_PATCH_BACKLOG_PAGES</tt> . */
+#endif
+#else
+static uint16_t etx_ota_ready_pages = 0U;						/**< @brief Global variable used to indicate the number of Flash Memory pages, counted from @ref ETX_APP_FLASH_ADDR , that are known to be erased during the current ETX OTA Transaction and that are therefore ready to be written (see @ref etx_ota_prepare_flash_pages ). */
+#endif
+#if ETX_OTA_COMPRESSION
+static bool is_etx_ota_compressed = false;						/**< @brief Global flag used to indicate whether the ETX OTA Payload of the current ETX OTA Transaction is being received compressed with a \c true , or otherwise with a \c false . */
+#endif
+#if !ETX_OTA_END_CRC_FULL_RESCAN
+static uint32_t etx_ota_fw_running_crc = CRC32_MPEG2_INIT_VALUE;	/**< @brief Global variable used to hold the 32-bit CRC of the @ref etx_ota_fw_received_size bytes of the ETX OTA Payload that have been written so far into the Flash Memory designated to the ETX OTA Protocol, as read back from that Flash Memory. */
+#endif
+static uint8_t etx_ota_window_size = 1U;					    /**< @brief Global variable used to hold the window size that was negotiated with the host via the ETX OTA Start Command, which stands for the number of ETX OTA Data Type Packets that the host will send in a single burst before waiting for a cumulative ACK. @details A value of \c 1 stands for the classic mode, in which each ETX OTA Data Type Packet is acknowledged individually, and it is the only mode that older hosts (i.e., those that send the Start Command without the window size byte) will use. */
+static bool is_etx_ota_nack_reason = false;						/**< @brief Global flag used to indicate whether the host has requested, via @ref ETX_OTA_START_FLAG_NACK_REASON , that the rejected ETX OTA Data Type Packets are NACKed with their reason with a \c true , or otherwise with a \c false . */
+static ETX_OTA_Nack_Reason etx_ota_nack_reason = ETX_OTA_NACK_REASON_NONE;	/**< @brief Global variable used to hold the reason why the latest ETX OTA Packet could not be received or processed, which is set wherever that is found out and reset back to @ref ETX_OTA_NACK_REASON_NONE before receiving each ETX OTA Packet. */
+static bool is_etx_ota_data_v2 = false;						/**< @brief Global flag used to indicate whether the host has been granted, via @ref ETX_OTA_START_FLAG_DATA_V2 , to send the ETX OTA Payload via ETX OTA Data v2 Type Packets with a \c true , or otherwise with a \c false . @details While this is set, the ACKs given during the ETX OTA Data and End States carry @ref etx_ota_fw_buffered_size , so that the host can tell them apart from the late ACKs of the ETX OTA Data v2 Type Packets that it has re-sent. */
+#if ETX_OTA_FEC
+static bool is_etx_ota_fec = false;							/**< @brief Global flag used to indicate whether the host has been granted, via @ref ETX_OTA_START_FLAG_FEC , to send ETX OTA Data Type Packets that carry Reed-Solomon parity bytes with a \c true , or otherwise with a \c false . */
+#endif
+static uint8_t etx_ota_nack_count = 0U;							/**< @brief Global variable used to indicate the number of consecutive NACKs with which our MCU/MPU has rejected ETX OTA Data Type Packets without ending the ETX OTA Transaction, which is limited to @ref ETX_OTA_DATA_MAX_NACKS . */
+static uint16_t etx_ota_frame_size = ETX_OTA_LEGACY_FRAME_SIZE;	/**< @brief Global variable used to hold the size in bytes of the ETX OTA Data Type Packets that the host sends during the current ETX OTA Transaction, as given in the reserved2 field of its ETX OTA Header, which is never greater than @ref ETX_OTA_DATA_MAX_SIZE . @details Every ETX OTA Data Type Packet carries this many bytes of the ETX OTA Payload, except for the last one of each run. */
+#if ETX_OTA_RESUME
+static uint16_t etx_ota_checkpoint_log_count = ETX_OTA_CHECKPOINT_LOG_RECORDS;	/**< @brief Global variable used to indicate the number of records that have been appended into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE , which is also the index of the next record to be appended. @details This is found via @ref etx_ota_scan_checkpoint_log while processing the ETX OTA Header, and until then it is taken as full so that no record is appended. */
+#endif
+#if ETX_OTA_BAUD_RATE_MAX
+static uint32_t etx_ota_default_baud_rate = 0U;				/**< @brief Global variable used to hold the Baud rate with which the UART of @ref p_huart was initialized (i.e., the one defined in the STM32CubeMx App), which is restored at the end of every ETX OTA Transaction. */
+static uint32_t etx_ota_pending_baud_rate = 0U;				/**< @brief Global variable used to hold the Baud rate requested by the host via the ETX OTA Baud Rate Command, to which our MCU/MPU switches right after acknowledging that Command, or \c 0 if there is no pending switch. */
+#endif
+static uint8_t etx_ota_resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1]; /**< @brief Global buffer holding the additional "Data" bytes, if any, that are to be appended right after the Response Status of the next ETX OTA Response Type Packet to be sent to the host. */
+static uint8_t etx_ota_resp_data_len = 0U;					    /**< @brief Global variable used to indicate the number of valid bytes in @ref etx_ota_resp_data . @note This is reset back to \c 0 each time that an ETX OTA Response Type Packet is sent. */
 static firmware_update_config_data_t *p_fw_config;			    /**< @brief Global pointer to the latest data of the @ref firmware_update_config sub-module. */
 static UART_HandleTypeDef *p_huart;							    /**< @brief Our MCU/MPU's Hardware Protocol UART Handle from which the ETX OTA Protocol will be used on. */
 static ETX_OTA_hw_Protocol ETX_OTA_hardware_protocol;           /**< @brief Hardware Protocol into which the ETX OTA Protocol will be used for sending/receiving data to/from the host. */
@@ -152,8 +298,8 @@ typedef struct __attribute__ ((__packed__)) {
 typedef struct __attribute__ ((__packed__)) {
 	uint32_t 	package_size;		//!< Total length/size in bytes of the data expected to be received by our MCU/MPU from the host via all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packet(s) (i.e., in a Data Type Packet or Packets) to be received.
 	uint32_t 	package_crc;		//!< 32-bit CRC of the whole data to be obtained from all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets).
-	uint32_t 	reserved1;			//!< 32-bits reserved for future changes on this firmware.
-	uint16_t 	reserved2;			//!< 16-bits reserved for future changes on this firmware.
+	uint32_t 	reserved1;			//!< Size in bytes of the compressed Payload whenever @ref ETX_OTA_PAYLOAD_COMPRESSED_FLAG is set in the \c payload_type field, or otherwise 32-bits reserved for future changes on this firmware.
+	uint16_t 	reserved2;			//!< Size in bytes of the ETX OTA Data Type Packets that the host will send (see @ref etx_ota_frame_size ), or \c 0xFFFF if the host does not negotiate it, in which case @ref ETX_OTA_LEGACY_FRAME_SIZE is assumed.
 	uint8_t 	reserved3;			//!< 8-bits reserved for future changes on this firmware.
 	uint8_t		payload_type;	    //!< Expected payload type to be received from the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets). @note see @ref ETX_OTA_Payload_t to learn about the available Payload Types.
 } header_data_t;
@@ -273,6 +419,11 @@ typedef struct __attribute__ ((__packed__)) {
  * </table>
  *
  * where B = byte(s).
+ *
+ * @note	Whenever the host has requested the windowed transfer mode, the "Status" field can be followed by additional
+ * 			bytes within the "Data" field (i.e., the granted window size in the response to the Start Command, and the
+ * 			4-byte offset of the next expected Payload byte in the cumulative ACK of each burst), in which case the
+ * 			"Len" and "CRC" fields will take them into account as well.
  */
 typedef struct __attribute__ ((__packed__)) {
 	uint8_t   sof;				//!< Start of Frame (SOF). @details All ETX OTA Packets must start with a SOF byte, whose value is @ref ETX_OTA_SOF .
@@ -290,11 +441,15 @@ typedef struct __attribute__ ((__packed__)) {
  *          @ref ETX_OTA_Data_Packet_t parameters structure, which starts with a SOF byte that is followed up with the
  *          Packet Type field, the Data Length field, the Data field, the CRC32 field and ends up with an EOF byte.
  *
- * @note	The HAL Timeout for each reception of data is given by @ref ETX_CUSTOM_HAL_TIMEOUT .
+ * @details	Each field is pulled out of @ref Rx_Ring as a whole once the DMA has received all of its bytes, and the
+ *          received Packet is left in place in there (see @ref etx_ota_rx_ring_take ) so that no copy is made of it.
  *
- * @param[in, out] buf 		Buffer pointer into which the bytes of the received packet from the host, will be stored.
- * @param max_len 			Maximum length of bytes that are expected to be received from the "Data" field of the next
- * 							ETX OTA packet.
+ * @note	The Timeout for each reception of data is given by @ref ETX_CUSTOM_HAL_TIMEOUT .
+ *
+ * @param[out] pp_packet	Pointer to the pointer that will be made to point to the whole data of the received
+ * 							Packet, which remains valid until @ref Rx_Ring receives another whole burst.
+ * @param max_len 			Maximum length of bytes that are expected to be received from the whole next ETX OTA
+ * 							packet.
  *
  * @retval					ETX_OTA_EC_OK
  * @retval					ETX_OTA_EC_NR
@@ -304,7 +459,162 @@ typedef struct __attribute__ ((__packed__)) {
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date October 01, 2023.
  */
-static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf, uint16_t max_len);
+static ETX_OTA_Status etx_ota_receive_packet(uint8_t **pp_packet, uint16_t max_len);
+
+/**@brief	Gets a whole burst of ETX OTA Data Type Packets from the host whenever the windowed transfer mode has been
+ *          negotiated, pointing to each of them with its own @ref p_rx_packets pointer.
+ *
+ * @details	The number of ETX OTA Data Type Packets expected in the burst is given by @ref etx_ota_window_size , except
+ *          for the last burst of the Firmware Image, which can be shorter. This is because the host is expected to send
+ *          Packets carrying @ref etx_ota_frame_size bytes each, except for the last Packet of the Firmware Image.
+ * @details	The whole burst is received before processing any of its Packets because our MCU/MPU cannot keep listening
+ *          to the host while it is programming its Flash Memory. If any of the Packets of the burst is not received
+ *          correctly, then the rest of the burst is discarded via @ref etx_ota_drain_rx so that the host re-sends it,
+ *          starting from the offset given in the cumulative ACK.
+ * @details	If a Packet that is not an ETX OTA Data Type Packet is received (e.g., an Abort Command), then the burst
+ *          will be concluded right after that Packet so that it gets processed without waiting for the rest of it.
+ *
+ * @param[out] frames_received	Number of ETX OTA Packets that were successfully received and that are now held
+ * 								pointed to by @ref p_rx_packets , in the same order in which they were received.
+ *
+ * @retval					ETX_OTA_EC_OK
+ * @retval					ETX_OTA_EC_NR if the first Packet of the burst was not received at all.
+ */
+static ETX_OTA_Status etx_ota_receive_window(uint8_t *frames_received);
+
+/**@brief	Discards all the bytes that the host sends via the chosen Hardware Protocol until it stops sending data for
+ *          at least @ref ETX_OTA_WINDOW_DRAIN_TIMEOUT milliseconds.
+ *
+ * @details	The silence is only timed from the moment that the UART flags its Rx line as idle with no bytes left in
+ *          @ref Rx_Ring , since up to that moment the host is known to still be sending data.
+ */
+static void etx_ota_drain_rx();
+
+/**@brief	Starts the reception, via the circular DMA of @ref p_huart , of all the bytes that the host sends into
+ *          @ref Rx_Ring .
+ *
+ * @details	From this moment on, the bytes sent by the host are received in the background, even while our MCU/MPU is
+ *          programming its Flash Memory, until @ref etx_ota_rx_ring_stop is called.
+ *
+ * @retval					ETX_OTA_EC_OK
+ * @retval					ETX_OTA_EC_NR
+ * @retval					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_rx_ring_start();
+
+/**@brief	Stops the reception that was started with @ref etx_ota_rx_ring_start so that the UART of @ref p_huart can
+ *          be used again with blocking calls (e.g., by the @ref hm10_ble ).
+ */
+static void etx_ota_rx_ring_stop();
+
+/**@brief	Counts a wrap around the end of @ref Rx_Ring , which is given to the DMA of @ref p_huart as its Transfer
+ *          Complete callback by @ref etx_ota_rx_ring_start .
+ *
+ * @param[in] hdma			Handle of the DMA whose transfer has completed, whose wrap is only counted if it is the
+ *                          one of @ref p_huart .
+ */
+static void etx_ota_rx_ring_lap_callback(DMA_HandleTypeDef *hdma);
+
+/**@brief	Gets the number of bytes that the DMA has written into @ref Rx_Ring since @ref etx_ota_rx_ring_start .
+ *
+ * @return	The number of bytes written by the DMA, which may be more than the size of @ref Rx_Ring .
+ */
+static uint32_t etx_ota_rx_ring_produced();
+
+/**@brief	Gets the number of bytes that the DMA has written into @ref Rx_Ring and that have not been parsed yet.
+ *
+ * @return	The number of bytes available to be parsed from @ref rx_ring_read_idx onwards.
+ */
+static uint16_t etx_ota_rx_ring_available();
+
+/**@brief	Lets the DMA overwrite all the bytes of @ref Rx_Ring that have been parsed so far, which is to be called
+ *          once no received ETX OTA Packet is referenced anymore.
+ */
+static void etx_ota_rx_ring_release();
+
+/**@brief	Checks whether the DMA has written over bytes of @ref Rx_Ring that have not been released yet.
+ *
+ * @details	Since the DMA writes into @ref Rx_Ring circularly, this happens whenever it has written more than the size
+ *          of @ref Rx_Ring since the last @ref etx_ota_rx_ring_release , which only a host that sends beyond its
+ *          window can cause.
+ *
+ * @retval	true if @ref Rx_Ring has been lapped.
+ * @retval	false otherwise.
+ */
+static bool etx_ota_rx_ring_is_lapped();
+
+/**@brief	Checks whether any byte received from the host has been lost, either because the DMA has lapped
+ *          @ref Rx_Ring or because the UART of @ref p_huart has flagged an overrun error.
+ *
+ * @retval	true if any byte has been lost.
+ * @retval	false otherwise.
+ */
+static bool etx_ota_rx_ring_is_overrun();
+
+/**@brief	Restarts the reception of @ref Rx_Ring from scratch, which discards all the bytes held in it and clears
+ *          any overrun error of the UART of @ref p_huart .
+ *
+ * @retval					ETX_OTA_EC_OK
+ * @retval					ETX_OTA_EC_NR
+ * @retval					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_rx_ring_reset();
+
+/**@brief	Waits until at least a certain number of bytes are available to be parsed from @ref Rx_Ring .
+ *
+ * @param size				Number of bytes to wait for.
+ * @param timeout			Maximum time in milliseconds that is allowed to pass without receiving any byte.
+ *
+ * @retval					ETX_OTA_EC_OK
+ * @retval					ETX_OTA_EC_NR if the host stopped sending data before the requested bytes were received.
+ * @retval					ETX_OTA_EC_ERR if @ref Rx_Ring was overrun, in which case it is reset, @ref is_rx_ring_overrun
+ *                          is set and @ref etx_ota_nack_reason is set to @ref ETX_OTA_NACK_REASON_CRC so that the host
+ *                          re-sends from the last acknowledged offset.
+ */
+static ETX_OTA_Status etx_ota_rx_ring_wait(uint16_t size, uint32_t timeout);
+
+/**@brief	Gets an available byte from @ref Rx_Ring without parsing it.
+ *
+ * @param offset			Offset, with respect to @ref rx_ring_read_idx , of the desired byte.
+ *
+ * @return	The requested byte.
+ */
+static uint8_t etx_ota_rx_ring_peek(uint16_t offset);
+
+/**@brief	Parses a certain number of available bytes from @ref Rx_Ring .
+ *
+ * @details	The bytes are left in place in @ref Rx_Ring , unless they wrap around its end, in which case they are placed
+ *          into @ref Rx_Wrap_Buffer so that they can be processed as contiguous data.
+ *
+ * @param size				Number of bytes to be parsed, which must not be greater than @ref ETX_OTA_PACKET_MAX_SIZE .
+ *
+ * @return	Pointer to the parsed bytes.
+ */
+static uint8_t *etx_ota_rx_ring_take(uint16_t size);
+
+/**@brief	Receives and, if applicable, installs a Firmware Image with the ETX OTA Protocol once the reception of
+ *          @ref Rx_Ring has been started.
+ *
+ * @details	This is the whole ETX OTA Transaction of @ref firmware_image_download_and_install , which starts and stops
+ *          the reception of @ref Rx_Ring around it.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_STOP
+ * @retval	ETX_OTA_EC_NR
+ * @retval	ETX_OTA_EC_NA
+ * @retval	ETX_OTA_EC_ERR
+ *
+ * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
+ */
+static ETX_OTA_Status etx_ota_download_and_install();
+
+/**@brief	Resets the ETX OTA Transaction back to the ETX OTA Start State, which discards the Header data of the
+ *          Firmware Image that was being received, if any, and the negotiated window and frame sizes.
+ *
+ * @details	This is done at the beginning of each ETX OTA Transaction and whenever the host sends the ETX OTA Sync
+ *          Command, in which case any byte already received from the host is kept in @ref Rx_Ring .
+ */
+static void etx_ota_reset_transaction();
 
 /**@brief	Processes and validates the latest received ETX OTA Packet.
  *
@@ -356,13 +666,131 @@ static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf, uint16_t max_len);
  */
 static ETX_OTA_Status etx_ota_process_data(uint8_t *buf);
 
+/**@brief	Validates the offset of the ETX OTA Payload that is given in an ETX OTA Data v2 Type Packet.
+ *
+ * @details	The ETX OTA Data v2 Type Packets whose data has already been received (i.e., those that the host has
+ *          re-sent after having lost their ACK) are flagged as duplicates, so that they are acknowledged again without
+ *          being written. Otherwise, the ETX OTA Data v2 Type Packet must start right at
+ *          @ref etx_ota_fw_buffered_size .
+ *
+ * @param[in] buf				Pointer to the whole data of the ETX OTA Data v2 Type Packet.
+ * @param[out] is_duplicate		Pointer into which a \c true will be written if the data of the ETX OTA Data v2 Type
+ *                              Packet has already been received, or otherwise a \c false .
+ *
+ * @retval	ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_ERR if the ETX OTA Data v2 Type Packet is either too short to hold its offset or out of
+ *          sequence, in which case @ref etx_ota_nack_reason is set accordingly.
+ */
+static ETX_OTA_Status etx_ota_check_data_offset(uint8_t *buf, bool *is_duplicate);
+
+#if ETX_OTA_SKIP_UNCHANGED_PAGES
+/**@brief	Processes an ETX OTA Command Type Packet containing the Page CRC Command, by preparing the 32-bit CRCs of
+ *          the requested Flash Memory pages of @ref ETX_APP_FLASH_ADDR so that they are sent to the host in the ACK
+ *          to that Command.
+ *
+ * @details	Each 32-bit CRC is calculated over the whole Flash Memory page, so the host has to calculate the ones of its
+ *          new Firmware Image with its last page padded with \c 0xFF bytes, which is how @ref etx_ota_commit_staged_page
+ *          writes it.
+ *
+ * @param[in] buf	Buffer pointer to the data of the ETX OTA Command Type Packet containing the Page CRC Command.
+ *
+ * @retval	ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_ERR if the requested pages are out of the ones designated to the Application Firmware, or if
+ *          more than @ref ETX_OTA_PAGE_CRC_MAX_COUNT of them were requested.
+ */
+static ETX_OTA_Status etx_ota_process_page_crc_cmd(uint8_t *buf);
+
+/**@brief	Processes an ETX OTA Command Type Packet containing the Seek Command, by keeping in place (or erasing, if
+ *          the host has set @ref ETX_OTA_SEEK_FLAG_ERASE ) the Flash Memory pages that the host is skipping and by
+ *          getting ready to receive the run of the Payload that it announces.
+ *
+ * @details	The skipped bytes are accounted for as if they had been received (including in the running 32-bit CRC of
+ *          the Firmware Image, which reads them back from the Flash Memory), so the ETX OTA End Command still
+ *          validates the 32-bit CRC of the whole Firmware Image.
+ *
+ * @note	Only whole Flash Memory pages can be skipped, except for the last one of the Firmware Image.
+ *
+ * @param[in] buf	Buffer pointer to the data of the ETX OTA Command Type Packet containing the Seek Command.
+ *
+ * @retval	ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_ERR if the requested offset is behind the already received Payload, is not at a Flash Memory
+ *          page boundary or if the announced run goes beyond the end of the Firmware Image.
+ */
+static ETX_OTA_Status etx_ota_process_seek_cmd(uint8_t *buf);
+#endif
+
+#if ETX_OTA_BAUD_RATE_MAX
+/**@brief	Processes an ETX OTA Command Type Packet containing the Baud Rate Command, by validating the requested Baud
+ *          rate so that our MCU/MPU switches to it right after acknowledging that Command (see
+ *          @ref etx_ota_switch_baud_rate ).
+ *
+ * @param[in] buf	Buffer pointer to the data of the ETX OTA Command Type Packet containing the Baud Rate Command.
+ *
+ * @retval	ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_ERR if the UART Hardware Protocol is not the chosen one, if our MCU/MPU is not at the ETX OTA
+ *          Header State or if the requested Baud rate cannot be generated by that UART (see
+ *          @ref etx_ota_is_baud_rate_attainable ).
+ */
+static ETX_OTA_Status etx_ota_process_baud_rate_cmd(uint8_t *buf);
+
+/**@brief	Switches the UART of @ref p_huart to the Baud rate held in @ref etx_ota_pending_baud_rate and confirms it
+ *          with an ETX OTA Ping Command received from the host at that rate, which is acknowledged at that rate as
+ *          well.
+ *
+ * @details	Any bytes that are not a valid ETX OTA Ping Command are discarded while waiting for it, since the host may
+ *          send several of them in case that some of its first ones are lost while it switches its own Baud rate. If
+ *          none is received within @ref ETX_OTA_BAUD_CONFIRM_TIMEOUT , then our MCU/MPU discards whatever the host is
+ *          still sending and falls back to the previous Baud rate, where the ETX OTA Transaction continues.
+ *
+ * @retval	ETX_OTA_EC_OK whether the new Baud rate was confirmed or our MCU/MPU fell back to the previous one.
+ * @retval	ETX_OTA_EC_NR
+ * @retval	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_switch_baud_rate();
+
+/**@brief	Gets the fastest Baud rate that the UART of @ref p_huart can generate, which is given by its clock divided by
+ *          16 (i.e., a USARTDIV of 1) but is capped at @ref ETX_OTA_BAUD_RATE_MAX .
+ *
+ * @note	Just like the HAL does, USART1 is taken to be clocked by PCLK2 and any other UART by PCLK1.
+ *
+ * @return	The fastest Baud rate, in bits per second, that may be advertised to and accepted from the host.
+ */
+static uint32_t etx_ota_get_baud_rate_max();
+
+/**@brief	Validates that the UART of @ref p_huart can generate a certain Baud rate, by rounding the value that its
+ *          Baud Rate Register (BRR) would take and then checking the error of the resulting Baud rate.
+ *
+ * @param baud_rate			Baud rate, in bits per second, to be validated.
+ *
+ * @retval	true if \p baud_rate is not greater than the one given by @ref etx_ota_get_baud_rate_max , if its BRR does
+ *          not round to \c 0 and if the resulting Baud rate is within @ref ETX_OTA_BAUD_RATE_MAX_ERROR .
+ * @retval	false otherwise.
+ */
+static bool etx_ota_is_baud_rate_attainable(uint32_t baud_rate);
+
+/**@brief	Re-initializes the UART of @ref p_huart with a certain Baud rate, by stopping and then restarting the
+ *          reception of @ref Rx_Ring around it.
+ *
+ * @param baud_rate			Baud rate, in bits per second, to be set.
+ *
+ * @retval	ETX_OTA_EC_OK
+ * @retval	ETX_OTA_EC_NR
+ * @retval	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_set_baud_rate(uint32_t baud_rate);
+#endif
+
 /**@brief	Sends an ETX OTA Response Type Packet with a desired Response Status (i.e., ACK or NACK) to the host either
  *          via the UART or the BT Hardware Protocol correspondingly.
  *
+ * @details	If there are any bytes pending in @ref etx_ota_resp_data , then they will be appended to the "Data" field
+ * 			of the Response Type Packet right after its Response Status byte. This is only used with hosts that have
+ * 			requested the windowed transfer mode, since older hosts expect a 1-byte "Data" field.
+ *
  * @note    This function decides on sending the data on a certain Hardware Protocol according to the current value of
  *          @ref ETX_OTA_hardware_protocol , which should be set only via the @ref init_firmware_update_module function.
  *
- * @param response_status	\c ETX_OTA_ACK or \c ETX_OTA_NACK .
+ * @param response_status	\c ETX_OTA_ACK , \c ETX_OTA_NACK or \c ETX_OTA_READY .
  *
  * @retval  ETX_OTA_EC_OK
  * @retval 	ETX_OTA_EC_NR
@@ -374,6 +802,65 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf);
  */
 static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status);
 
+/**@brief	Sends a NACK to the host for the ETX OTA Packet(s) that our MCU/MPU could not receive or process, along
+ *          with the reason given in @ref etx_ota_nack_reason whenever the host has requested it.
+ *
+ * @details	If the host has requested it via @ref ETX_OTA_START_FLAG_NACK_REASON , our MCU/MPU is at the ETX OTA Data
+ *          State and fewer than @ref ETX_OTA_DATA_MAX_NACKS consecutive NACKs have been given, then the ETX OTA Data
+ *          Type Packets that were accepted before the rejected one are programmed, the rest of the received data is
+ *          discarded via @ref etx_ota_drain_rx and the NACK carries the reason and @ref etx_ota_fw_buffered_size ,
+ *          from which the host re-sends while our MCU/MPU stays at the ETX OTA Data State.
+ * @details	Otherwise, the NACK ends the ETX OTA Transaction and it only carries a reason if it is
+ *          @ref ETX_OTA_NACK_REASON_FLASH , in which case it is given along with @ref etx_ota_fw_received_size .
+ *
+ * @retval	ETX_OTA_EC_OK if the ETX OTA Transaction continues at the ETX OTA Data State.
+ * @retval	ETX_OTA_EC_ERR if the ETX OTA Transaction has to be ended.
+ */
+static ETX_OTA_Status etx_ota_send_nack();
+
+/**@brief	Writes all the ETX OTA Data Type Packets pointed to by @ref p_rx_pending_data into the Flash Memory of our
+ *          MCU/MPU's Application Firmware, in the same order in which they were received.
+ *
+ * @details	If @ref ETX_OTA_EARLY_ACK is enabled, this is called right after acknowledging those Packets to the host,
+ *          which is then already sending the next ones into @ref Rx_Ring while our MCU/MPU programs its Flash Memory.
+ *          Otherwise, this is called right before acknowledging them.
+ * @details	If this fails after an early ACK, the caller sends a NACK with @ref ETX_OTA_NACK_REASON_FLASH right away
+ *          and ends the ETX OTA Transaction, since the host has already moved on from those Packets.
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_NR
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_write_pending_data();
+
+/**@brief	Writes the next bytes of the ETX OTA Payload, once decompressed if it was sent compressed, into the Flash
+ *          Memory of our MCU/MPU's Application Firmware, either via @ref write_data_to_flash_app or, if they are part of
+ *          a binary patch, via @ref bspatch_feed .
+ *
+ * @param[in] data			Pointer to the bytes of the ETX OTA Payload to be written.
+ * @param data_len			Length in bytes of the data towards which the \p data param points to.
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_NR
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_write_payload(uint8_t *data, uint16_t data_len);
+
+#if ETX_OTA_COMPRESSION
+/**@brief	Writes the next decompressed bytes of the ETX OTA Payload via @ref etx_ota_write_payload .
+ *
+ * @note	This is the write callback of the @ref lz4_decoder module for the ETX OTA Payloads that our MCU/MPU receives
+ *          compressed.
+ *
+ * @param[in] p_data	Pointer to the decompressed bytes.
+ * @param length		Number of decompressed bytes.
+ *
+ * @retval	LZ4_DECODER_EC_OK
+ * @retval	LZ4_DECODER_EC_ERR
+ */
+static Lz4Decoder_Status etx_ota_lz4_write(uint8_t *p_data, uint16_t length);
+#endif
+
 /**@brief	Write the contents of the "Data" field contained in a given ETX OTA Data Type Packet into the Flash Memory
  *          of our MCU/MPU's Application Firmware.
  *
@@ -381,8 +868,13 @@ static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
  *                          written into the Flash Memory of our MCU/MPU's Application Firmware.
  * @param data_len			Length in bytes of the "Data" field of the ETX Data Type Packet that is being pointed
  *                          towards to, via the \p data param.
- * @param is_first_block	Flag used to indicate whether the current ETX OTA Data Type Packet contains the first Flash
- *                          Memory block with a \c true or otherwise with a \c false .
+ *
+ * @details	If @ref ETX_OTA_SKIP_UNCHANGED_PAGES is enabled, the given data is only staged into @ref Page_Stage_Buffer
+ *          and each Flash Memory page is then written, via @ref etx_ota_commit_staged_page , once all its bytes have
+ *          been received, or once the whole Firmware Image has been received.
+ *
+ * @note	The Flash Memory is unlocked, via @ref flash_writer_begin , by the first call to this function and it is not
+ *          locked back until the ETX OTA Transaction finishes (see @ref firmware_image_download_and_install ).
  *
  * @retval 					ETX_OTA_EC_OK
  * @retval 					ETX_OTA_EC_NR
@@ -392,7 +884,151 @@ static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
  * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
  * @date October 11, 2023.
  */
-static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len, bool is_full_image);
+static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len);
+
+#if ETX_OTA_SKIP_UNCHANGED_PAGES
+/**@brief	Writes the Flash Memory page staged in @ref Page_Stage_Buffer into the Flash Memory of our MCU/MPU's
+ *          Application Firmware, unless that page already holds the exact same bytes.
+ *
+ * @details	The staged page is the one that ends at @ref etx_ota_fw_received_size , where any of its bytes beyond the
+ *          end of the received Firmware Image are taken as \c 0xFF . If that page differs from the one in the Flash
+ *          Memory, then it is erased (unless it is already blank) and programmed. Otherwise, it is left untouched.
+ *
+ * @note	The Flash Memory is expected to be unlocked already.
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_NR
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_commit_staged_page();
+
+#if ETX_OTA_PATCH_UPDATE
+/**@brief	Validates the header of the binary patch that is being received and, if it was made for the Application
+ *          Firmware Image that is currently installed, writes the size and 32-bit CRC of the Firmware Image to be
+ *          rebuilt into the @ref firmware_update_config sub-module.
+ *
+ * @note	This is the @ref bspatch_io_t::check_header callback of the binary patches applied by our MCU/MPU.
+ *
+ * @param[in] p_header	Pointer to the header of the binary patch.
+ *
+ * @retval	BSPATCH_EC_OK
+ * @retval	BSPATCH_EC_ERR
+ * @retval	BSPATCH_EC_NA
+ */
+static BsPatch_Status etx_ota_patch_check_header(const bspatch_header_t *p_header);
+
+/**@brief	Reads some bytes of the old Application Firmware Image, either from the Flash Memory page in which they are,
+ *          if it has not been overwritten yet, or otherwise from @ref Patch_Backlog_Buffer .
+ *
+ * @note	This is the @ref bspatch_io_t::read_old callback of the binary patches applied by our MCU/MPU.
+ *
+ * @param offset		Offset of the old Application Firmware Image from which the bytes are to be read.
+ * @param[out] p_data	Pointer to where the read bytes will be written into.
+ * @param length		Number of bytes to be read.
+ *
+ * @retval	BSPATCH_EC_OK
+ * @retval	BSPATCH_EC_ERR
+ */
+static BsPatch_Status etx_ota_patch_read_old(uint32_t offset, uint8_t *p_data, uint16_t length);
+
+/**@brief	Writes the next bytes of the Application Firmware Image that is being rebuilt from a binary patch via
+ *          @ref write_data_to_flash_app .
+ *
+ * @note	This is the @ref bspatch_io_t::write_new callback of the binary patches applied by our MCU/MPU.
+ *
+ * @param[in] p_data	Pointer to the bytes to be written.
+ * @param length		Number of bytes to be written.
+ *
+ * @retval	BSPATCH_EC_OK
+ * @retval	BSPATCH_EC_ERR
+ */
+static BsPatch_Status etx_ota_patch_write_new(uint8_t *p_data, uint16_t length);
+#endif
+#else
+/**@brief	Makes sure that the Flash Memory pages of our MCU/MPU's Application Firmware that are about to be written
+ *          are erased, by erasing them one by one only right before they are needed.
+ *
+ * @details	Only the pages covered by the size of the Firmware Image given in its ETX OTA Header Type Packet are
+ *          erased, where @ref ETX_OTA_ERASE_PAGES_AHEAD more pages than the ones that are needed right away are
+ *          prepared as well so that the next ETX OTA Data Type Packet does not wait for its page to be erased.
+ * @details	Pages that are already blank (i.e., all their bytes are \c 0xFF ) are not erased again, which is what makes
+ *          small Firmware Images and repeated updates start streaming almost immediately.
+ *
+ * @note	The Flash Memory is expected to be unlocked already.
+ *
+ * @param end_offset		Offset, with respect to @ref ETX_APP_FLASH_ADDR , up to which the Flash Memory is about to
+ *                          be written.
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_NR
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_prepare_flash_pages(uint32_t end_offset);
+#endif
+
+#if ETX_OTA_RESUME
+/**@brief	Scans the @ref ETX_OTA_CHECKPOINT_LOG_PAGE for the records that have been appended into it.
+ *
+ * @details	The records are appended one after the other, so the first one whose bytes are all erased marks the end
+ *          of the log.
+ *
+ * @param[out] pp_latest	Pointer to where the address of the latest completely programmed record is written, or
+ *                          \c NULL if there is none.
+ *
+ * @return	The number of records that have been appended, whether completely programmed or not.
+ */
+static uint16_t etx_ota_scan_checkpoint_log(const etx_ota_checkpoint_record_t **pp_latest);
+
+/**@brief	Gets the offset of the Firmware Image of the latest checkpoint (i.e., the one given by
+ *          @ref firmware_update_config_data_t::App_fw_size and @ref firmware_update_config_data_t::App_fw_rec_crc )
+ *          from which its interrupted ETX OTA Transaction can be continued.
+ *
+ * @details	The latest checkpoint is the latest record of the @ref ETX_OTA_CHECKPOINT_LOG_PAGE , if any, or otherwise
+ *          the one held by @ref p_fw_config . Neither of them is taken into account if the latter has been discarded.
+ * @details	The checkpointed Flash Memory pages are only trusted if their 32-bit CRC still matches the one that was
+ *          recorded in the checkpoint, so that pages that were left half-written by a power loss are received again.
+ *
+ * @return	The number of bytes of the Firmware Image that are already in place, which is \c 0 if there is no valid
+ *          checkpoint.
+ */
+static uint32_t etx_ota_get_resume_offset();
+
+/**@brief	Discards the checkpoint of the latest ETX OTA Transaction, unless it belongs to the Firmware Image that is
+ *          about to be received, and makes room in the @ref ETX_OTA_CHECKPOINT_LOG_PAGE for the checkpoints of the
+ *          new ETX OTA Transaction.
+ *
+ * @details	The checkpoint is kept for the same Firmware Image, since that is the one whose ETX OTA Transaction the
+ *          host may be resuming. Otherwise, a new and empty checkpoint is started and the
+ *          @ref ETX_OTA_CHECKPOINT_LOG_PAGE is erased. That page is also erased if it has no room left for
+ *          @ref ETX_OTA_CHECKPOINT_MAX_COUNT records, in which case its latest record is first folded into
+ *          @ref p_fw_config .
+ *
+ * @note	This function only updates @ref p_fw_config , which is expected to be written into the
+ *          @ref firmware_update_config sub-module right after.
+ *
+ * @param fw_size	Size in bytes of the Firmware Image that is about to be received.
+ * @param fw_crc	32-bit CRC of the Firmware Image that is about to be received.
+ *
+ * @retval 	ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_NR
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_reset_checkpoint(uint32_t fw_size, uint32_t fw_crc);
+
+/**@brief	Checkpoints the ETX OTA Transaction by appending the number of whole Flash Memory pages of the Firmware
+ *          Image that have been written so far, along with their running 32-bit CRC, as a new record into the
+ *          @ref ETX_OTA_CHECKPOINT_LOG_PAGE .
+ *
+ * @note	The record is programmed with the FPEC that has already been unlocked for the Firmware Image, which is
+ *          therefore neither locked back nor made to erase any Flash Memory page in the middle of the ETX OTA
+ *          Transaction.
+ *
+ * @retval 	ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_NR
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status etx_ota_write_checkpoint();
+#endif
 
 /**@brief	Gets the corresponding @ref ETX_OTA_Status value depending on the given @ref HAL_StatusTypeDef value.
  *
@@ -410,6 +1046,10 @@ static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len,
  */
 static ETX_OTA_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 
+#if ETX_OTA_PATCH_UPDATE
+static const bspatch_io_t etx_ota_patch_io = {etx_ota_patch_check_header, etx_ota_patch_read_old, etx_ota_patch_write_new};	/**< @brief Global struct holding the callbacks through which our MCU/MPU applies the binary patches that it receives. */
+#endif
+
 ETX_OTA_Status init_firmware_update_module(ETX_OTA_hw_Protocol hardware_protocol,
 											UART_HandleTypeDef *huart,
 											firmware_update_config_data_t *fw_config,
@@ -440,6 +1080,10 @@ ETX_OTA_Status init_firmware_update_module(ETX_OTA_hw_Protocol hardware_protocol
 			#if ETX_OTA_VERBOSE
 				printf("The UART Hardware Protocol has been selected by the Firmware Update Module.\r\n");
 			#endif
+			#if ETX_OTA_BAUD_RATE_MAX
+			/* Persist the Baud rate defined in the STM32CubeMx App, which is restored after any ETX OTA Transaction in which the host switches it. */
+			etx_ota_default_baud_rate = huart->Init.BaudRate;
+			#endif
             break;
         case ETX_OTA_hw_Protocol_BT:
 			#if ETX_OTA_VERBOSE
@@ -563,12 +1207,56 @@ ETX_OTA_Status init_firmware_update_module(ETX_OTA_hw_Protocol hardware_protocol
 
 ETX_OTA_Status firmware_image_download_and_install()
 {
-	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref FirmUpdConf_Status or a @ref ETX_OTA_Status function type. */
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
 	ETX_OTA_Status ret;
 
-	/* Reset the global variables related to: 1) The Header data of a received Firmware Image and 2) The ETX OTA Process State. */
-	etx_ota_fw_received_size = 0U;
-	etx_ota_state            = ETX_OTA_STATE_START;
+	/* Receive all the bytes sent by the host in the background during the whole ETX OTA Transaction. */
+	ret = etx_ota_rx_ring_start();
+	if (ret != ETX_OTA_EC_OK)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The DMA reception of the UART of the chosen Hardware Protocol could not be started (Exception Code = %d).\r\n", ret);
+		#endif
+		return ret;
+	}
+	ret = etx_ota_download_and_install();
+	etx_ota_rx_ring_stop();
+
+	#if ETX_OTA_BAUD_RATE_MAX
+	/* Restore the Baud rate defined in the STM32CubeMx App if the host switched it during the ETX OTA Transaction. */
+	if ((ETX_OTA_hardware_protocol == ETX_OTA_hw_Protocol_UART) && (p_huart->Init.BaudRate != etx_ota_default_baud_rate))
+	{
+		p_huart->Init.BaudRate = etx_ota_default_baud_rate;
+		if (HAL_UART_Init(p_huart) != HAL_OK)
+		{
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The default Baud rate of %ld could not be restored.\r\n", etx_ota_default_baud_rate);
+			#endif
+			ret = ETX_OTA_EC_ERR;
+		}
+	}
+	#endif
+
+	/* Lock the Flash Memory, which may have been kept unlocked since the first ETX OTA Data Type Packet of the ETX OTA Transaction. */
+	flash_writer_end();
+
+	return ret;
+}
+
+static ETX_OTA_Status etx_ota_download_and_install()
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref FirmUpdConf_Status or a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable frames_received:</b> Number of ETX OTA Packets received in the current iteration, which can only be greater than one during a windowed burst. */
+	uint8_t frames_received;
+	/** <b>Local variable is_window_burst:</b> Flag used to indicate whether the ETX OTA Packets of the current iteration were received as a windowed burst with a \c true or otherwise with a \c false . */
+	bool is_window_burst;
+
+	etx_ota_reset_transaction();
+	#if ETX_OTA_READY_BEACON
+	/* Let the host know that our MCU/MPU is now listening for an ETX OTA Transaction. */
+	etx_ota_send_resp(ETX_OTA_READY);
+	#endif
 
 	/* Attempt to receive a Firmware Image from the host and, if applicable, install it. */
 	#if ETX_OTA_VERBOSE
@@ -579,19 +1267,68 @@ ETX_OTA_Status firmware_image_download_and_install()
 		#if ETX_OTA_VERBOSE
 			printf("Waiting for an ETX OTA Packet from the host...\r\n");
 		#endif
-		ret = etx_ota_receive_packet(Rx_Buffer, ETX_OTA_PACKET_MAX_SIZE);
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_NONE;
+		etx_ota_rx_ring_release();
+		is_window_burst = (etx_ota_state==ETX_OTA_STATE_DATA) && (etx_ota_window_size>1U);
+		if (is_window_burst)
+		{
+			ret = etx_ota_receive_window(&frames_received);
+		}
+		else
+		{
+			frames_received = 1U;
+			ret = etx_ota_receive_packet(&p_rx_packets[0], ETX_OTA_PACKET_MAX_SIZE);
+		}
 		switch (ret)
 		{
 		  case ETX_OTA_EC_OK:
-			/* Since the ETX OTA Packet was received successfully, proceed into processing that data correspondingly. */
-			ret = etx_ota_process_data(Rx_Buffer);
+			/* Since the ETX OTA Packet(s) were received successfully, proceed into processing that data correspondingly. */
+			for (uint8_t i=0; (i<frames_received) && (ret==ETX_OTA_EC_OK); i++)
+			{
+				ret = etx_ota_process_data(p_rx_packets[i]);
+			}
 			switch (ret)
 			{
 			  case ETX_OTA_EC_OK:
+				  #if !ETX_OTA_EARLY_ACK
+				  	  if (etx_ota_write_pending_data() != ETX_OTA_EC_OK)
+				  	  {
+				  		  etx_ota_nack_reason = ETX_OTA_NACK_REASON_FLASH;
+				  		  etx_ota_send_nack();
+				  		  return ETX_OTA_EC_ERR;
+				  	  }
+				  #endif
 				  #if ETX_OTA_VERBOSE
 				  	  printf("DONE: The current ETX OTA Packet was processed successfully. Therefore, sending ACK...\r\n");
 				  #endif
+				  etx_ota_nack_count = 0U;
+				  if ((is_window_burst || (is_etx_ota_data_v2 && ((etx_ota_state == ETX_OTA_STATE_DATA) || (etx_ota_state == ETX_OTA_STATE_END)))) && (etx_ota_resp_data_len == 0U))
+				  {
+					  /* Let the host know up to which offset of the Payload it has been received, so that it continues (or re-sends) from there. */
+					  memcpy(etx_ota_resp_data, &etx_ota_fw_buffered_size, sizeof(etx_ota_fw_buffered_size));
+					  etx_ota_resp_data_len = sizeof(etx_ota_fw_buffered_size);
+				  }
 				  etx_ota_send_resp(ETX_OTA_ACK);
+				  #if ETX_OTA_BAUD_RATE_MAX
+				  	  /* Switch to the Baud rate that the host has just requested, now that the ACK to its request has been sent at the current one. */
+				  	  if (etx_ota_pending_baud_rate != 0U)
+				  	  {
+				  		  ret = etx_ota_switch_baud_rate();
+				  		  if (ret != ETX_OTA_EC_OK)
+				  		  {
+				  			  return ret;
+				  		  }
+				  	  }
+				  #endif
+				  #if ETX_OTA_EARLY_ACK
+				  	  /* Program the ETX OTA Data Type Packet(s) that have just been acknowledged while the host sends the next one(s), where any error is reported right away with an unsolicited NACK that ends the ETX OTA Transaction. */
+				  	  if (etx_ota_write_pending_data() != ETX_OTA_EC_OK)
+				  	  {
+				  		  etx_ota_nack_reason = ETX_OTA_NACK_REASON_FLASH;
+				  		  etx_ota_send_nack();
+				  		  return ETX_OTA_EC_ERR;
+				  	  }
+				  #endif
 				  break;
 			  case ETX_OTA_EC_STOP:
 				  #if ETX_OTA_VERBOSE
@@ -614,7 +1351,10 @@ ETX_OTA_Status firmware_image_download_and_install()
 				  #if ETX_OTA_VERBOSE
 				  	  printf("ERROR: An Error Exception Code has been generated during the ETX OTA process. Therefore, sending NACK...\r\n");
 				  #endif
-				  etx_ota_send_resp(ETX_OTA_NACK);
+				  if (etx_ota_send_nack() == ETX_OTA_EC_OK)
+				  {
+					  break;
+				  }
 				  return ETX_OTA_EC_ERR;
 			  default:
 				  /* This should not happen. */
@@ -635,7 +1375,10 @@ ETX_OTA_Status firmware_image_download_and_install()
 			  #if ETX_OTA_VERBOSE
 			  	  printf("ERROR: An Error Exception Code has been generated during the ETX OTA process. Therefore, sending NACK...\r\n");
 			  #endif
-			  etx_ota_send_resp(ETX_OTA_NACK);
+			  if (etx_ota_send_nack() == ETX_OTA_EC_OK)
+			  {
+				  break;
+			  }
 			  return ETX_OTA_EC_ERR;
 
 		  default:
@@ -652,14 +1395,53 @@ ETX_OTA_Status firmware_image_download_and_install()
 	return ETX_OTA_EC_OK;
 }
 
-static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf, uint16_t max_len)
+static void etx_ota_reset_transaction()
 {
-	/** <b>Local variable ret:</b> Used to hold the exception code value returned by either a @ref FirmUpdConf_Status , a @ref ETX_OTA_Status or a @ref HM10_Status function type. */
-	int16_t  ret;
-	/** <b>Local variable len:</b> Current index against which the bytes of the current ETX OTA Packet have been fetched. */
-	uint16_t len = 0;
+	/* Reset the global variables related to: 1) The Header data of a received Firmware Image, 2) The ETX OTA Process State and 3) The negotiated window size. */
+	etx_ota_payload_size     = 0U;
+	etx_ota_fw_received_size = 0U;
+	etx_ota_fw_buffered_size = 0U;
+	rx_pending_data_count    = 0U;
+	#if ETX_OTA_SKIP_UNCHANGED_PAGES
+	page_stage_len           = 0U;
+	etx_ota_skipped_pages    = 0U;
+	#if ETX_OTA_PATCH_UPDATE
+	is_etx_ota_patch         = false;
+	#endif
+	#else
+	etx_ota_ready_pages      = 0U;
+	#endif
+	#if ETX_OTA_COMPRESSION
+	is_etx_ota_compressed    = false;
+	#endif
+	etx_ota_state            = ETX_OTA_STATE_START;
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	etx_ota_fw_running_crc   = CRC32_MPEG2_INIT_VALUE;
+	#endif
+	etx_ota_window_size      = 1U;
+	is_etx_ota_nack_reason   = false;
+	is_etx_ota_data_v2       = false;
+	#if ETX_OTA_FEC
+	is_etx_ota_fec           = false;
+	#endif
+	etx_ota_nack_count       = 0U;
+	etx_ota_frame_size       = ETX_OTA_LEGACY_FRAME_SIZE;
+	#if ETX_OTA_BAUD_RATE_MAX
+	etx_ota_pending_baud_rate = 0U;
+	#endif
+	etx_ota_resp_data_len    = 0U;
+}
+
+static ETX_OTA_Status etx_ota_receive_packet(uint8_t **pp_packet, uint16_t max_len)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable len:</b> Length in bytes of the whole ETX OTA Packet that is currently being received. */
+	uint16_t len;
 	/** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Packet that is currently being received via the chosen Hardware Protocol. @details	The value of this field should stand for the length in bytes of the current ETX OTA Packet's "Data" field. */
 	uint16_t data_len;
+	/** <b>Local pointer buf:</b> Points to the whole data of the ETX OTA Packet that has just been received. */
+	uint8_t *buf;
 	/** <b>Local variable cal_data_crc:</b> Our MCU/MPU's calculated CRC of the ETX OTA Packet received via the chosen Hardware Protocol. */
 	uint32_t cal_data_crc;
 	/** <b>Local variable rec_data_crc:</b> Value holder of the "Recorded CRC" contained in the ETX OTA Packet received via the chosen Hardware Protocol. */
@@ -668,177 +1450,142 @@ static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf, uint16_t max_len)
 	#if ETX_OTA_VERBOSE
 		printf("Waiting to receive an ETX OTA Packet from the host...\r\n");
 	#endif
-	switch (ETX_OTA_hardware_protocol)
+	/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet, where any other byte is silently discarded during the ETX OTA Start State since it can only be part of the resync sequence of the host. */
+	while (true)
 	{
-		case ETX_OTA_hw_Protocol_UART:
-			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet. */
-			ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			if (buf[len++] != ETX_OTA_SOF)
-			{
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected to receive the SOF field value from the current ETX OTA Packet.\r\n");
-				#endif
-				return ETX_OTA_EC_ERR;
-			}
-
-			/* Wait to receive the next 1-byte of data from the host and validate it to be a "Packet Type" field value of an ETX OTA Packet. */
-			ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_PACKET_TYPE_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			switch (buf[len++])
-			{
-				case ETX_OTA_PACKET_TYPE_CMD:
-				case ETX_OTA_PACKET_TYPE_DATA:
-				case ETX_OTA_PACKET_TYPE_HEADER:
-				case ETX_OTA_PACKET_TYPE_RESPONSE:
-					break;
-				default:
-					#if ETX_OTA_VERBOSE
-						printf("ERROR: The data received from the Packet Type field of the currently received ETX OTA Packet contains a value not recognized by our MCU/MPU.\r\n");
-					#endif
-					return ETX_OTA_EC_ERR;
-			}
-
-			/* Wait to receive the next 2-bytes of data from the host, which our MCU/MPU will interpret as the "Data Length" field value of an ETX OTA Packet. */
-			ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_DATA_LENGTH_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			data_len = *(uint16_t *)&buf[len];
-			len += ETX_OTA_DATA_LENGTH_SIZE;
-
-			/* Wait to receive the next \c data_len bytes of data from the host, which our MCU/MPU will interpret as the "Data" field value of an ETX OTA Packet. */
-			for (uint16_t i=0; i<data_len; i++)
-			{
-				ret = HAL_UART_Receive(p_huart, &buf[len++], 1, ETX_CUSTOM_HAL_TIMEOUT);
-				ret = HAL_ret_handler(ret);
-				if (ret != HAL_OK)
-				{
-					return ret;
-				}
-			}
-
-			/* Wait to receive the next 4-bytes of data from the host, which our MCU/MPU will interpret as the "CRC32" field value of an ETX OTA Packet. */
-			ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_CRC32_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			rec_data_crc = *(uint32_t *) &buf[len];
-			len += ETX_OTA_CRC32_SIZE;
-
-			/* Wait to receive the next 1-byte of data from the host and validate it to be a "EOF" field value of an ETX OTA Packet. */
-			ret = HAL_UART_Receive(p_huart, &buf[len], ETX_OTA_EOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
+		ret = etx_ota_rx_ring_wait(ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
+		if (ret != ETX_OTA_EC_OK)
+		{
+			return ret;
+		}
+		if (etx_ota_rx_ring_peek(0) == ETX_OTA_SOF)
+		{
 			break;
-		case ETX_OTA_hw_Protocol_BT:
-			/* Wait to receive the first byte of data from the host and validate it to be the SOF byte of an ETX OTA Packet. */
-			ret = get_hm10_ota_data(&buf[len], ETX_OTA_SOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			if (buf[len++] != ETX_OTA_SOF)
-			{
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected to receive the SOF field value from the current ETX OTA Packet.\r\n");
-				#endif
-				return ETX_OTA_EC_ERR;
-			}
-
-			/* Wait to receive the next 1-byte of data from the host and validate it to be a "Packet Type" field value of an ETX OTA Packet. */
-			ret = get_hm10_ota_data(&buf[len], ETX_OTA_PACKET_TYPE_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			switch (buf[len++])
-			{
-				case ETX_OTA_PACKET_TYPE_CMD:
-				case ETX_OTA_PACKET_TYPE_DATA:
-				case ETX_OTA_PACKET_TYPE_HEADER:
-				case ETX_OTA_PACKET_TYPE_RESPONSE:
-					break;
-				default:
-					#if ETX_OTA_VERBOSE
-						printf("ERROR: The data received from the Packet Type field of the currently received ETX OTA Packet contains a value not recognized by our MCU/MPU.\r\n");
-					#endif
-					return ETX_OTA_EC_ERR;
-			}
-
-			/* Wait to receive the next 2-bytes of data from the host, which our MCU/MPU will interpret as the "Data Length" field value of an ETX OTA Packet. */
-			ret = get_hm10_ota_data(&buf[len], ETX_OTA_DATA_LENGTH_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			data_len = *(uint16_t *)&buf[len];
-			len += ETX_OTA_DATA_LENGTH_SIZE;
-
-			/* Wait to receive the next \c data_len bytes of data from the host, which our MCU/MPU will interpret as the "Data" field value of an ETX OTA Packet. */
-			for (uint16_t i=0; i<data_len; i++)
-			{
-				ret = get_hm10_ota_data(&buf[len++], 1, ETX_CUSTOM_HAL_TIMEOUT);
-				if (ret != HAL_OK)
-				{
-					return ret;
-				}
-			}
-
-			/* Wait to receive the next 4-bytes of data from the host, which our MCU/MPU will interpret as the "CRC32" field value of an ETX OTA Packet. */
-			ret = get_hm10_ota_data(&buf[len], ETX_OTA_CRC32_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			if (ret != HAL_OK)
-			{
-				return ret;
-			}
-			rec_data_crc = *(uint32_t *) &buf[len];
-			len += ETX_OTA_CRC32_SIZE;
+		}
+		etx_ota_rx_ring_take(ETX_OTA_SOF_SIZE);
+		if (etx_ota_state != ETX_OTA_STATE_START)
+		{
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Expected to receive the SOF field value from the current ETX OTA Packet.\r\n");
+			#endif
+			return ETX_OTA_EC_ERR;
+		}
+	}
 
-			/* Wait to receive the next 1-byte of data from the host and validate it to be a "EOF" field value of an ETX OTA Packet. */
-			ret = get_hm10_ota_data(&buf[len], ETX_OTA_EOF_SIZE, ETX_CUSTOM_HAL_TIMEOUT);
-			if (ret != HAL_OK)
+	/* Wait to receive the "Packet Type" and "Data Length" fields of the ETX OTA Packet and validate them. */
+	ret = etx_ota_rx_ring_wait(ETX_OTA_DATA_FIELD_INDEX, ETX_CUSTOM_HAL_TIMEOUT);
+	if (ret != ETX_OTA_EC_OK)
+	{
+		return ret;
+	}
+	switch (etx_ota_rx_ring_peek(ETX_OTA_SOF_SIZE))
+	{
+		case ETX_OTA_PACKET_TYPE_CMD:
+		case ETX_OTA_PACKET_TYPE_DATA:
+		case ETX_OTA_PACKET_TYPE_HEADER:
+		case ETX_OTA_PACKET_TYPE_RESPONSE:
+		case ETX_OTA_PACKET_TYPE_DATA_V2:
+			break;
+		#if ETX_OTA_FEC
+		case (ETX_OTA_PACKET_TYPE_DATA | ETX_OTA_PACKET_TYPE_FEC_FLAG):
+		case (ETX_OTA_PACKET_TYPE_DATA_V2 | ETX_OTA_PACKET_TYPE_FEC_FLAG):
+			if (is_etx_ota_fec)
 			{
-				return ret;
+				break;
 			}
-			break;
+			etx_ota_rx_ring_take(ETX_OTA_DATA_FIELD_INDEX);
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The currently received ETX OTA Packet carries Reed-Solomon parity bytes, which the host did not request via the ETX OTA Start Command.\r\n");
+			#endif
+			return ETX_OTA_EC_ERR;
+		#endif
 		default:
-			/* This should not happen since it should have been previously validated. */
+			etx_ota_rx_ring_take(ETX_OTA_DATA_FIELD_INDEX);
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: Expected a Hardware Protocol value, but received something else: %d.\r\n", ETX_OTA_hardware_protocol);
+				printf("ERROR: The data received from the Packet Type field of the currently received ETX OTA Packet contains a value not recognized by our MCU/MPU.\r\n");
 			#endif
 			return ETX_OTA_EC_ERR;
 	}
+	data_len = etx_ota_rx_ring_peek(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE)
+			   | (etx_ota_rx_ring_peek(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + 1U) << 8U);
+	len = ETX_OTA_DATA_OVERHEAD + data_len;
+	if ((data_len > ETX_OTA_DATA_MAX_SIZE) || (max_len < len))
+	{
+		/* Reject the Packet right away, since waiting for all of its claimed bytes could exceed the size of @ref Rx_Ring . */
+		etx_ota_rx_ring_take(ETX_OTA_DATA_FIELD_INDEX);
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: Received more data than expected (Expected = %d, Received = %d)\r\n", max_len, len);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+
+	/* Wait to receive the "Data", "CRC32" and "EOF" fields of the ETX OTA Packet, which are then parsed in place together with the previous fields. */
+	ret = etx_ota_rx_ring_wait(len, ETX_CUSTOM_HAL_TIMEOUT);
+	if (ret != ETX_OTA_EC_OK)
+	{
+		return ret;
+	}
+	buf = etx_ota_rx_ring_take(len);
 
 	/* Validate that the latest byte received corresponds to an ETX OTA End of Frame (EOF) byte. */
-	if (buf[len++] != ETX_OTA_EOF)
+	if (buf[len-ETX_OTA_EOF_SIZE] != ETX_OTA_EOF)
 	{
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
 		#if ETX_OTA_VERBOSE
 			printf("ERROR: Expected to receive the EOF field value from the current ETX OTA Packet.\r\n");
 		#endif
 		return ETX_OTA_EC_ERR;
 	}
 
+	/* Get the "Recorded CRC", which comes right after the whole "Data" field (i.e., after the Reed-Solomon parity bytes, if any). */
+	memcpy(&rec_data_crc, &buf[ETX_OTA_DATA_FIELD_INDEX+data_len], ETX_OTA_CRC32_SIZE);
+
+	#if ETX_OTA_FEC
+	/* If the ETX OTA Packet carries Reed-Solomon parity bytes, then repair its corrupted bytes and turn it into the same ETX OTA Packet but without the parity bytes, so that it is processed just like any other one. */
+	if ((buf[ETX_OTA_SOF_SIZE] & ETX_OTA_PACKET_TYPE_FEC_FLAG) != 0U)
+	{
+		/** <b>Local variable repaired:</b> Number of corrupted bytes of the ETX OTA Packet that have been repaired. */
+		uint16_t repaired;
+		data_len = rs_decoder_get_data_len(data_len);
+		if (data_len == 0U)
+		{
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The length of the ETX OTA Packet does not match the one of any \"Data\" field along with its Reed-Solomon parity bytes.\r\n");
+			#endif
+			return ETX_OTA_EC_ERR;
+		}
+		if (rs_decoder_repair(&buf[ETX_OTA_DATA_FIELD_INDEX], data_len, &repaired) != RS_DECODER_EC_OK)
+		{
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The ETX OTA Packet has more corrupted bytes than the ones that can be repaired.\r\n");
+			#endif
+			return ETX_OTA_EC_ERR;
+		}
+		#if ETX_OTA_VERBOSE
+			if (repaired > 0U)
+			{
+				printf("WARNING: %d corrupted byte(s) of the ETX OTA Packet have been repaired.\r\n", repaired);
+			}
+		#endif
+		buf[ETX_OTA_SOF_SIZE] &= (uint8_t) ~ETX_OTA_PACKET_TYPE_FEC_FLAG;
+		buf[ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE] = (uint8_t) data_len;
+		buf[ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + 1U] = (uint8_t) (data_len >> 8U);
+	}
+	#endif
+
 	/* Calculate the 32-bit CRC only with respect to the contents of the "Data" field from the current ETX OTA Packet that has just been received. */
 	cal_data_crc = crc32_mpeg2(&buf[ETX_OTA_DATA_FIELD_INDEX], data_len);
 
 	/* Validate that the Calculated CRC matches the Recorded CRC. */
 	if (cal_data_crc != rec_data_crc)
 	{
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
 		#if ETX_OTA_VERBOSE
 			printf("ERROR: CRC mismatch with current ETX OTA Packet [Calculated CRC = 0x%08X] [Recorded CRC = 0x%08X]\r\n",
 													   (unsigned int) cal_data_crc, (unsigned int) rec_data_crc);
@@ -846,20 +1593,246 @@ static ETX_OTA_Status etx_ota_receive_packet(uint8_t *buf, uint16_t max_len)
 		return ETX_OTA_EC_ERR;
 	}
 
-	if (max_len < len)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: Received more data than expected (Expected = %d, Received = %d)\r\n", max_len, len);
-		#endif
-		return ETX_OTA_EC_ERR;
-	}
-
+	*pp_packet = buf;
 	#if ETX_OTA_VERBOSE
 		printf("ETX OTA Packet has been successfully received.\r\n");
 	#endif
 	return ETX_OTA_EC_OK;
 }
 
+static ETX_OTA_Status etx_ota_receive_window(uint8_t *frames_received)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable remaining_size:</b> Size in bytes of the Firmware Image that is still pending to be received from the host. */
+	uint32_t remaining_size = ((etx_ota_fw_run_end < etx_ota_payload_size) ? etx_ota_fw_run_end : etx_ota_payload_size) - etx_ota_fw_buffered_size;
+	/** <b>Local variable frames_in_burst:</b> Number of ETX OTA Data Type Packets that the host will send in the current burst. */
+	uint8_t frames_in_burst = etx_ota_window_size;
+
+	/* Get the number of ETX OTA Data Type Packets that the host will send in the current burst. */
+	if (remaining_size < ((uint32_t) frames_in_burst * etx_ota_frame_size))
+	{
+		frames_in_burst = (remaining_size + etx_ota_frame_size - 1U) / etx_ota_frame_size;
+	}
+
+	/* Receive the whole burst before processing any of its ETX OTA Packets. */
+	for (*frames_received=0; *frames_received<frames_in_burst; )
+	{
+		ret = etx_ota_receive_packet(&p_rx_packets[*frames_received], ETX_OTA_PACKET_MAX_SIZE);
+		if (ret != ETX_OTA_EC_OK)
+		{
+			if ((ret==ETX_OTA_EC_NR) && (*frames_received==0U))
+			{
+				return ETX_OTA_EC_NR;
+			}
+			if (is_rx_ring_overrun)
+			{
+				/* The ETX OTA Packets already received may have been overwritten, so the whole burst is NACKed instead. */
+				*frames_received = 0U;
+				return ETX_OTA_EC_ERR;
+			}
+			#if ETX_OTA_VERBOSE
+				printf("WARNING: ETX OTA Packet %d of the current burst was not received correctly. Discarding the rest of the burst...\r\n", *frames_received);
+			#endif
+			etx_ota_drain_rx();
+			break;
+		}
+		/** <b>Local variable packet_type:</b> Packet Type of the ETX OTA Packet that has just been received. */
+		uint8_t packet_type = p_rx_packets[(*frames_received)++][ETX_OTA_SOF_SIZE];
+		if ((packet_type != ETX_OTA_PACKET_TYPE_DATA) && (packet_type != ETX_OTA_PACKET_TYPE_DATA_V2))
+		{
+			break;
+		}
+	}
+
+	return ETX_OTA_EC_OK;
+}
+
+static void etx_ota_drain_rx()
+{
+	/** <b>Local variable available:</b> Number of bytes that are currently available to be discarded from @ref Rx_Ring . */
+	uint16_t available;
+	/** <b>Local variable idle_tick:</b> HAL Tick at which the Rx line was last seen idle with no bytes left to be discarded. */
+	uint32_t idle_tick = HAL_GetTick();
+	/** <b>Local variable is_idle:</b> Flag used to indicate whether the Rx line has been seen idle with no bytes left to be discarded, since the last discarded byte, with a \c true or otherwise with a \c false . */
+	bool is_idle = false;
+
+	do
+	{
+		if (etx_ota_rx_ring_is_overrun())
+		{
+			/* Whatever the DMA has overwritten was to be discarded anyway, so just start over from an empty @ref Rx_Ring . */
+			etx_ota_rx_ring_reset();
+			is_idle = false;
+			continue;
+		}
+		available = etx_ota_rx_ring_available();
+		if (available > 0U)
+		{
+			rx_ring_read_idx = (rx_ring_read_idx + available) % ETX_OTA_RX_RING_SIZE;
+			rx_ring_consumed += available;
+			etx_ota_rx_ring_release();
+			is_idle = false;
+		}
+		else if (!is_idle && __HAL_UART_GET_FLAG(p_huart, UART_FLAG_IDLE))
+		{
+			/* The host has paused, so start timing the silence from here, unless it turns out to be just a gap within its data. */
+			__HAL_UART_CLEAR_IDLEFLAG(p_huart);
+			idle_tick = HAL_GetTick();
+			is_idle = true;
+		}
+	}
+	while (!is_idle || ((HAL_GetTick()-idle_tick) < ETX_OTA_WINDOW_DRAIN_TIMEOUT));
+}
+
+static ETX_OTA_Status etx_ota_rx_ring_start()
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+
+	/* Start the circular DMA reception from the beginning of @ref Rx_Ring . */
+	rx_ring_read_idx = 0U;
+	rx_ring_laps = 0U;
+	rx_ring_consumed = 0U;
+	rx_ring_released = 0U;
+	ret = HAL_ret_handler(HAL_UART_Receive_DMA(p_huart, Rx_Ring, ETX_OTA_RX_RING_SIZE));
+	__HAL_UART_CLEAR_IDLEFLAG(p_huart);
+	if (ret != ETX_OTA_EC_OK)
+	{
+		return ret;
+	}
+
+	/* Count the wraps of the DMA around the end of @ref Rx_Ring , whose default handler does nothing but calling @ref HAL_UART_RxCpltCallback in circular mode, so that no Callback function of the user is needed for it. */
+	p_huart->hdmarx->XferCpltCallback = etx_ota_rx_ring_lap_callback;
+
+	return ETX_OTA_EC_OK;
+}
+
+static void etx_ota_rx_ring_stop()
+{
+	HAL_UART_DMAStop(p_huart);
+}
+
+static void etx_ota_rx_ring_lap_callback(DMA_HandleTypeDef *hdma)
+{
+	/* Only count the wraps of the DMA that is writing into @ref Rx_Ring . */
+	if (hdma == p_huart->hdmarx)
+	{
+		rx_ring_laps++;
+	}
+}
+
+static uint32_t etx_ota_rx_ring_produced()
+{
+	/** <b>Local variable laps:</b> Value of @ref rx_ring_laps that matches \c counter . */
+	uint32_t laps;
+	/** <b>Local variable counter:</b> Number of bytes that the DMA has left to write before wrapping around the end of @ref Rx_Ring . */
+	uint16_t counter;
+
+	/* Read the counter of the DMA again whenever it has just wrapped around, either before its Transfer Complete interrupt has been served or while reading it. */
+	do
+	{
+		laps = rx_ring_laps;
+		counter = __HAL_DMA_GET_COUNTER(p_huart->hdmarx);
+	}
+	while ((laps != rx_ring_laps) || __HAL_DMA_GET_FLAG(p_huart->hdmarx, __HAL_DMA_GET_TC_FLAG_INDEX(p_huart->hdmarx)));
+
+	return (laps * ETX_OTA_RX_RING_SIZE) + (ETX_OTA_RX_RING_SIZE - counter);
+}
+
+static uint16_t etx_ota_rx_ring_available()
+{
+	return etx_ota_rx_ring_produced() - rx_ring_consumed;
+}
+
+static void etx_ota_rx_ring_release()
+{
+	rx_ring_released = rx_ring_consumed;
+	is_rx_ring_overrun = false;
+}
+
+static bool etx_ota_rx_ring_is_lapped()
+{
+	return (etx_ota_rx_ring_produced() - rx_ring_released) > ETX_OTA_RX_RING_SIZE;
+}
+
+static bool etx_ota_rx_ring_is_overrun()
+{
+	return etx_ota_rx_ring_is_lapped() || __HAL_UART_GET_FLAG(p_huart, UART_FLAG_ORE);
+}
+
+static ETX_OTA_Status etx_ota_rx_ring_reset()
+{
+	etx_ota_rx_ring_stop();
+	return etx_ota_rx_ring_start();
+}
+
+static ETX_OTA_Status etx_ota_rx_ring_wait(uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable available:</b> Number of bytes that are currently available to be parsed from @ref Rx_Ring . */
+	uint16_t available;
+	/** <b>Local variable last_available:</b> Number of bytes that were available to be parsed from @ref Rx_Ring the last time that a new byte was received. */
+	uint16_t last_available = 0U;
+	/** <b>Local variable last_rx_tick:</b> HAL Tick at which a new byte was last received. */
+	uint32_t last_rx_tick = HAL_GetTick();
+
+	while (true)
+	{
+		if (etx_ota_rx_ring_is_overrun())
+		{
+			/* Bytes received from the host have been lost, so start over from an empty @ref Rx_Ring and let the host re-send from the last acknowledged offset. */
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The reception from the host has been overrun.\r\n");
+			#endif
+			etx_ota_rx_ring_reset();
+			is_rx_ring_overrun = true;
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_CRC;
+			return ETX_OTA_EC_ERR;
+		}
+		available = etx_ota_rx_ring_available();
+		if (available >= size)
+		{
+			break;
+		}
+		if (available != last_available)
+		{
+			last_available = available;
+			last_rx_tick = HAL_GetTick();
+		}
+		else if ((HAL_GetTick()-last_rx_tick) >= timeout)
+		{
+			return ETX_OTA_EC_NR;
+		}
+	}
+
+	return ETX_OTA_EC_OK;
+}
+
+static uint8_t etx_ota_rx_ring_peek(uint16_t offset)
+{
+	return Rx_Ring[(rx_ring_read_idx + offset) % ETX_OTA_RX_RING_SIZE];
+}
+
+static uint8_t *etx_ota_rx_ring_take(uint16_t size)
+{
+	/** <b>Local pointer p_data:</b> Points to the parsed bytes. */
+	uint8_t *p_data = &Rx_Ring[rx_ring_read_idx];
+	/** <b>Local variable size_to_end:</b> Number of bytes from @ref rx_ring_read_idx up to the end of @ref Rx_Ring . */
+	uint16_t size_to_end = ETX_OTA_RX_RING_SIZE - rx_ring_read_idx;
+
+	/* Place the parsed bytes into @ref Rx_Wrap_Buffer only if they wrap around the end of @ref Rx_Ring . */
+	if (size > size_to_end)
+	{
+		memcpy(Rx_Wrap_Buffer, p_data, size_to_end);
+		memcpy(&Rx_Wrap_Buffer[size_to_end], Rx_Ring, size - size_to_end);
+		p_data = Rx_Wrap_Buffer;
+	}
+	rx_ring_read_idx = (rx_ring_read_idx + size) % ETX_OTA_RX_RING_SIZE;
+	rx_ring_consumed += size;
+
+	return p_data;
+}
+
 static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 {
 	/** <b>Local pointer cmd:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
@@ -878,6 +1851,35 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 			#endif
 			return ETX_OTA_EC_STOP;
 		}
+		if (cmd->cmd == ETX_OTA_CMD_PING)
+		{
+			#if ETX_OTA_VERBOSE
+				printf("DONE: ETX OTA Ping command received.\r\n");
+			#endif
+			return ETX_OTA_EC_OK;
+		}
+		if ((cmd->cmd == ETX_OTA_CMD_SYNC) && (cmd->data_len == ETX_OTA_SYNC_CMD_SIZE))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("DONE: ETX OTA Sync command received. Resetting the ETX OTA Transaction...\r\n");
+			#endif
+			etx_ota_reset_transaction();
+			etx_ota_resp_data[0] = buf[ETX_OTA_DATA_FIELD_INDEX + 1U];
+			etx_ota_resp_data_len = 1U;
+			return ETX_OTA_EC_OK;
+		}
+		#if ETX_OTA_SKIP_UNCHANGED_PAGES
+		if (cmd->cmd == ETX_OTA_CMD_PAGE_CRC)
+		{
+			return etx_ota_process_page_crc_cmd(buf);
+		}
+		#endif
+		#if ETX_OTA_BAUD_RATE_MAX
+		if (cmd->cmd == ETX_OTA_CMD_BAUD_RATE)
+		{
+			return etx_ota_process_baud_rate_cmd(buf);
+		}
+		#endif
 	}
 
 	switch (etx_ota_state)
@@ -894,8 +1896,111 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 				#if ETX_OTA_VERBOSE
 					printf("DONE: Received ETX OTA Start Command.\r\n");
 				#endif
-				etx_ota_state = ETX_OTA_STATE_HEADER;
-				return ETX_OTA_EC_OK;
+
+				/* If the host has requested the windowed transfer mode, grant it with the largest window size that our MCU/MPU can hold. */
+				if (cmd->data_len > 1U)
+				{
+					/** <b>Local pointer start_resp:</b> Points to the bytes that will follow the Response Status of our response but in @ref etx_ota_start_resp_t type, whose fields that are not given by our MCU/MPU are left as zeros. */
+					etx_ota_start_resp_t *start_resp = (etx_ota_start_resp_t *) etx_ota_resp_data;
+
+					etx_ota_window_size = buf[ETX_OTA_START_CMD_WINDOW_INDEX];
+					if (etx_ota_window_size > ETX_OTA_WINDOW_SIZE_MAX)
+					{
+						etx_ota_window_size = ETX_OTA_WINDOW_SIZE_MAX;
+					}
+					else if (etx_ota_window_size == 0U)
+					{
+						etx_ota_window_size = 1U;
+					}
+					memset(start_resp, 0, sizeof(etx_ota_start_resp_t));
+					start_resp->window_size = etx_ota_window_size;
+					#if ETX_OTA_SKIP_UNCHANGED_PAGES
+					start_resp->features = ETX_OTA_FEATURE_DELTA_UPDATE | ETX_OTA_FEATURE_SPARSE_IMAGE;
+					#endif
+					etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(features);
+					#if ETX_OTA_PATCH_UPDATE
+					start_resp->features |= ETX_OTA_FEATURE_PATCH_UPDATE;
+					start_resp->patch_backlog_pages = ETX_OTA_PATCH_BACKLOG_PAGES;
+					etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(patch_backlog_pages);
+					#endif
+					#if ETX_OTA_COMPRESSION
+					start_resp->features |= ETX_OTA_FEATURE_COMPRESSION;
+					start_resp->lz4_window_log2 = LZ4_DECODER_WINDOW_LOG2;
+					etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(lz4_window_log2);
+					#endif
+					#if ETX_OTA_RESUME
+					/* If the host has requested the checkpoint of the latest ETX OTA Transaction, report its Firmware Image and the offset from which it can be continued. */
+					if ((cmd->data_len > 2U) && ((buf[ETX_OTA_START_CMD_FLAGS_INDEX] & ETX_OTA_START_FLAG_RESUME) != 0U))
+					{
+						start_resp->features |= ETX_OTA_FEATURE_RESUME;
+						start_resp->checkpoint_size = p_fw_config->App_fw_size;
+						start_resp->checkpoint_crc = p_fw_config->App_fw_rec_crc;
+						start_resp->checkpoint_offset = etx_ota_get_resume_offset();
+						etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(checkpoint_offset);
+						#if ETX_OTA_VERBOSE
+							printf("The Firmware Image of the latest checkpoint can be resumed from offset %ld.\r\n", start_resp->checkpoint_offset);
+						#endif
+					}
+					#endif
+
+					/* Advertise the largest ETX OTA Data Type Packets that our MCU/MPU can receive, so that the host negotiates their size within it. */
+					start_resp->features |= ETX_OTA_FEATURE_FRAME_SIZE;
+					start_resp->max_data_size = ETX_OTA_DATA_MAX_SIZE;
+					etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(max_data_size);
+					#if ETX_OTA_BAUD_RATE_MAX
+					/* Advertise the fastest Baud rate to which the host may switch the UART, along with how long our MCU/MPU waits for it to confirm the switch. */
+					if (ETX_OTA_hardware_protocol == ETX_OTA_hw_Protocol_UART)
+					{
+						start_resp->features |= ETX_OTA_FEATURE_BAUD_RATE;
+						start_resp->baud_rate_max = etx_ota_get_baud_rate_max();
+						start_resp->baud_confirm_timeout = ETX_OTA_BAUD_CONFIRM_TIMEOUT;
+						etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(baud_confirm_timeout);
+					}
+					#endif
+					#if ETX_OTA_DATA_MAX_NACKS
+					/* If the host has requested the rejected ETX OTA Data Type Packets to be NACKed with their reason, grant it so that it only re-sends them instead of starting over. */
+					if ((cmd->data_len > 2U) && ((buf[ETX_OTA_START_CMD_FLAGS_INDEX] & ETX_OTA_START_FLAG_NACK_REASON) != 0U))
+					{
+						is_etx_ota_nack_reason = true;
+						start_resp->features |= ETX_OTA_FEATURE_NACK_REASON;
+					}
+					#endif
+					#if ETX_OTA_DATA_V2
+					/* If the host has requested to send the Payload via ETX OTA Data v2 Type Packets, grant it so that it can safely re-send them whenever it does not get their ACK in time. */
+					if ((cmd->data_len > 2U) && ((buf[ETX_OTA_START_CMD_FLAGS_INDEX] & ETX_OTA_START_FLAG_DATA_V2) != 0U))
+					{
+						is_etx_ota_data_v2 = true;
+						start_resp->ext_features |= ETX_OTA_EXT_FEATURE_DATA_V2;
+						etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(ext_features);
+					}
+					#endif
+					#if ETX_OTA_FEC
+					/* If the host has requested to send ETX OTA Data Type Packets that carry Reed-Solomon parity bytes, grant it so that the few bytes that get corrupted on the way are repaired instead of making the host re-send the whole Packet. */
+					if ((cmd->data_len > 2U) && ((buf[ETX_OTA_START_CMD_FLAGS_INDEX] & ETX_OTA_START_FLAG_FEC) != 0U))
+					{
+						is_etx_ota_fec = true;
+						start_resp->ext_features |= ETX_OTA_EXT_FEATURE_FEC;
+						etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(ext_features);
+					}
+					#endif
+					/* If the host has requested the geometry of the Flash Memory of our MCU/MPU, report it so that the host does not have to rely on its own copy of it. */
+					if ((cmd->data_len > 2U) && ((buf[ETX_OTA_START_CMD_FLAGS_INDEX] & ETX_OTA_START_FLAG_GEOMETRY) != 0U))
+					{
+						start_resp->ext_features |= ETX_OTA_EXT_FEATURE_GEOMETRY;
+						start_resp->page_size = FLASH_PAGE_SIZE_IN_BYTES;
+						start_resp->bl_flash_addr = ETX_BL_FLASH_ADDR;
+						start_resp->bl_flash_pages = ETX_BL_FLASH_PAGES_SIZE;
+						start_resp->app_flash_addr = ETX_APP_FLASH_ADDR;
+						start_resp->app_flash_pages = ETX_APP_FLASH_PAGES_SIZE;
+						start_resp->rx_ring_size = ETX_OTA_RX_RING_SIZE;
+						etx_ota_resp_data_len = ETX_OTA_START_RESP_LEN(rx_ring_size);
+					}
+					#if ETX_OTA_VERBOSE
+						printf("The host has requested the windowed transfer mode. Granted window size = %d ETX OTA Data Type Packets.\r\n", etx_ota_window_size);
+					#endif
+				}
+				etx_ota_state = ETX_OTA_STATE_HEADER;
+				return ETX_OTA_EC_OK;
 			}
 			#if ETX_OTA_VERBOSE
 				printf("ERROR: Expected ETX OTA Command Type Packet containing an ETX OTA Start Command, but something else was received instead.\r\n");
@@ -910,9 +2015,56 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 			{
 				/** <b>Local variable header_ret:</b> Return value of a @ref FirmUpdConf_Status function function type. */
 				int16_t  header_ret;
+				/** <b>Local variable payload_type:</b> Payload Type given in the ETX OTA Header, but without its @ref ETX_OTA_PAYLOAD_COMPRESSED_FLAG bit. */
+				uint8_t payload_type = header->meta_data.payload_type;
+
+				etx_ota_payload_size = header->meta_data.package_size;
+
+				/* Validate the size of the ETX OTA Data Type Packets that the host has chosen, which must fit into the receive buffers of our MCU/MPU along with the offset of the ETX OTA Data v2 Type Packets and with the Reed-Solomon parity bytes, if used. */
+				etx_ota_frame_size = (header->meta_data.reserved2 == 0xFFFFU) ? ETX_OTA_LEGACY_FRAME_SIZE : header->meta_data.reserved2;
+				/** <b>Local variable frame_data_len:</b> Greatest "Data Length" field value that the ETX OTA Data Type Packets of the chosen size can have. */
+				uint32_t frame_data_len = (uint32_t) etx_ota_frame_size + (is_etx_ota_data_v2 ? ETX_OTA_DATA_OFFSET_SIZE : 0U);
+				#if ETX_OTA_FEC
+				if (is_etx_ota_fec && (frame_data_len <= ETX_OTA_DATA_MAX_SIZE))
+				{
+					frame_data_len += (uint32_t) rs_decoder_get_codeword_count((uint16_t) frame_data_len) * RS_DECODER_PARITY_SIZE;
+				}
+				#endif
+				if ((etx_ota_frame_size == 0U) || ((etx_ota_frame_size % 4U) != 0U) || (frame_data_len > ETX_OTA_DATA_MAX_SIZE))
+				{
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The host has chosen ETX OTA Data Type Packets of %d bytes, but our MCU/MPU can only receive multiples of 4 bytes whose \"Data\" field takes up to %d bytes.\r\n", etx_ota_frame_size, ETX_OTA_DATA_MAX_SIZE);
+					#endif
+					return ETX_OTA_EC_NA;
+				}
+				#if ETX_OTA_VERBOSE
+					printf("The ETX OTA Data Type Packets will carry %d bytes each.\r\n", etx_ota_frame_size);
+				#endif
+
+				#if ETX_OTA_COMPRESSION
+				/* If the ETX OTA Payload is to be sent compressed, then validate the size of its compressed bytes and prepare to decompress them. */
+				is_etx_ota_compressed = ((payload_type & ETX_OTA_PAYLOAD_COMPRESSED_FLAG) != 0U);
+				payload_type &= ~ETX_OTA_PAYLOAD_COMPRESSED_FLAG;
+				if (is_etx_ota_compressed)
+				{
+					if ((header->meta_data.reserved1 == 0U) || ((header->meta_data.reserved1 % 4U) != 0U)
+							|| (header->meta_data.reserved1 > ((header->meta_data.package_size + 3U) & ~3UL)))
+					{
+						#if ETX_OTA_VERBOSE
+							printf("ERROR: The compressed ETX OTA Payload has an invalid size of %ld bytes.\r\n", header->meta_data.reserved1);
+						#endif
+						return ETX_OTA_EC_NA;
+					}
+					etx_ota_payload_size = header->meta_data.reserved1;
+					lz4_decoder_init(header->meta_data.package_size, etx_ota_lz4_write);
+					#if ETX_OTA_VERBOSE
+						printf("The ETX OTA Payload will be received compressed into %ld bytes.\r\n", etx_ota_payload_size);
+					#endif
+				}
+				#endif
 
 				/* We validate that the Firmware Image to be received is either a Bootloader or an Application Firmware Image. */
-				switch (header->meta_data.payload_type)
+				switch (payload_type)
 				{
 					case ETX_OTA_Application_Firmware_Image:
 						/* We validate the size of the Application Firmware Image to be received. */
@@ -938,6 +2090,36 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 						p_fw_config->is_bl_fw_stored_in_app_fw = BT_FW_STORED_IN_APP_FW;
 						p_fw_config->is_bl_fw_install_pending = IS_PENDING;
 						break;
+					#if ETX_OTA_PATCH_UPDATE
+					case ETX_OTA_Application_Firmware_Patch:
+						/* We validate the size of the binary patch to be received and that it can be applied over the Application Firmware Image that is currently installed. */
+						if (header->meta_data.package_size > ETX_OTA_APP_FW_SIZE)
+						{
+							#if ETX_OTA_VERBOSE
+								printf("ERROR: The given Application Firmware Patch (of size %ld) exceeds the maximum bytes allowed (which is %d).\r\n", header->meta_data.package_size, ETX_OTA_APP_FW_SIZE);
+							#endif
+							return ETX_OTA_EC_NA;
+						}
+						if ((p_fw_config->is_bl_fw_stored_in_app_fw != BT_FW_NOT_STORED_IN_APP_FW) || (p_fw_config->App_fw_size > ETX_OTA_APP_FW_SIZE)
+								|| (crc32_mpeg2((uint8_t *) ETX_APP_FLASH_ADDR, p_fw_config->App_fw_size) != p_fw_config->App_fw_rec_crc))
+						{
+							#if ETX_OTA_VERBOSE
+								printf("ERROR: There is no valid Application Firmware Image installed over which to apply the given Application Firmware Patch.\r\n");
+							#endif
+							return ETX_OTA_EC_NA;
+						}
+
+						/* The Firmware Update Configurations are only written once the header of the binary patch confirms that it was made for the installed Application Firmware Image (see @ref etx_ota_patch_check_header ). */
+						is_etx_ota_patch = true;
+						etx_ota_patch_fw_crc = header->meta_data.package_crc;
+						etx_ota_fw_run_end = etx_ota_payload_size;
+						bspatch_init(&etx_ota_patch_io);
+						#if ETX_OTA_VERBOSE
+							printf("Received ETX OTA Header with an Application Firmware Patch Size of %ld bytes.\r\n", header->meta_data.package_size);
+						#endif
+						etx_ota_state = ETX_OTA_STATE_DATA;
+						return ETX_OTA_EC_OK;
+					#endif
 					case ETX_OTA_Custom_Data:
 						#if ETX_OTA_VERBOSE
 							printf("WARNING: Received an ETX OTA Custom Data request.\r\n");
@@ -951,8 +2133,16 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 				}
 
 				/* We write the newly received Firmware Image Header data into a new data block of the Flash Memory designated to the @ref firmware_update_config sub-module. */
+				#if ETX_OTA_RESUME
+				header_ret = etx_ota_reset_checkpoint(header->meta_data.package_size, header->meta_data.package_crc);
+				if (header_ret != ETX_OTA_EC_OK)
+				{
+					return header_ret;
+				}
+				#endif
 				p_fw_config->App_fw_size = header->meta_data.package_size;
 				p_fw_config->App_fw_rec_crc = header->meta_data.package_crc;
+				etx_ota_fw_run_end = etx_ota_payload_size;
 				header_ret = firmware_update_configurations_write(p_fw_config);
 				if (header_ret != FIRM_UPDT_CONF_EC_OK)
 				{
@@ -976,186 +2166,733 @@ static ETX_OTA_Status etx_ota_process_data(uint8_t *buf)
 		case ETX_OTA_STATE_DATA:
 			/** <b>Local pointer data:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Data_Packet_t type. */
 			ETX_OTA_Data_Packet_t *data = (ETX_OTA_Data_Packet_t *) buf;
-			/** <b>Local variable data_ret:</b> Return value of a @ref ETX_OTA_Status function. */
-			uint16_t data_ret;
 
-			if (data->packet_type == ETX_OTA_PACKET_TYPE_DATA)
+			#if ETX_OTA_SKIP_UNCHANGED_PAGES
+			if ((cmd->packet_type==ETX_OTA_PACKET_TYPE_CMD) && (cmd->cmd==ETX_OTA_CMD_SEEK))
 			{
+				return etx_ota_process_seek_cmd(buf);
+			}
+			#endif
+			if ((data->packet_type == ETX_OTA_PACKET_TYPE_DATA) || (is_etx_ota_data_v2 && (data->packet_type == ETX_OTA_PACKET_TYPE_DATA_V2)))
+			{
+				/** <b>Local variable payload_len:</b> Length in bytes of the Payload received from the current ETX OTA Packet, which excludes the offset of the ETX OTA Data v2 Type Packets. */
+				uint16_t payload_len = data->data_len;
+
+				if (data->packet_type == ETX_OTA_PACKET_TYPE_DATA_V2)
+				{
+					/** <b>Local variable is_duplicate:</b> Flag used to indicate whether the Payload of the current ETX OTA Data v2 Type Packet has already been received with a \c true , or otherwise with a \c false . */
+					bool is_duplicate;
+
+					if (etx_ota_check_data_offset(buf, &is_duplicate) != ETX_OTA_EC_OK)
+					{
+						return ETX_OTA_EC_ERR;
+					}
+					if (is_duplicate)
+					{
+						return ETX_OTA_EC_OK;
+					}
+					payload_len -= ETX_OTA_DATA_OFFSET_SIZE;
+				}
+
 				/* Validate that the Payload received from the current ETX OTA Packet is perfectly divisible by 4 bytes (i.e., one word). */
-				if ((data->data_len)%4 != 0)
+				if (payload_len%4 != 0)
 				{
+					etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
 					#if ETX_OTA_VERBOSE
 						printf("ERROR: The size of the currently received Payload is not perfectly divisible by 4 bytes (i.e., one word).\r\n");
 					#endif
 					return ETX_OTA_EC_ERR;
 				}
 
-				/* Write the ETX OTA Data Type Packet to the Flash Memory location of the Application Firmware. */
-				data_ret = write_data_to_flash_app(buf+ETX_OTA_DATA_FIELD_INDEX, data->data_len, etx_ota_fw_received_size==0);
-				data_ret = HAL_ret_handler(data_ret);
+				/* Validate that the Payload received from the current ETX OTA Packet fits into the Flash Memory designated to the Application Firmware. */
+				if ((etx_ota_fw_buffered_size + payload_len) > ETX_OTA_APP_FW_SIZE)
+				{
+					etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The currently received Payload exceeds the Flash Memory designated to the Application Firmware.\r\n");
+					#endif
+					return ETX_OTA_EC_ERR;
+				}
+
+				/* Validate that the Payload received from the current ETX OTA Packet does not go beyond the run that the host announced via its latest ETX OTA Seek Command, if any. */
+				if ((etx_ota_fw_buffered_size + payload_len) > etx_ota_fw_run_end)
+				{
+					etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The currently received Payload goes beyond the run of the Payload announced by the host.\r\n");
+					#endif
+					return ETX_OTA_EC_ERR;
+				}
+
+				/* Leave the ETX OTA Data Type Packet pending to be written into the Flash Memory location of the Application Firmware (see @ref etx_ota_write_pending_data ). */
+				p_rx_pending_data[rx_pending_data_count++] = buf;
+				etx_ota_fw_buffered_size += payload_len;
+				if (etx_ota_fw_buffered_size >= etx_ota_payload_size)
+				{
+					/* received the full data. Therefore, move to the End State of the ETX OTA Process. */
+					etx_ota_state = ETX_OTA_STATE_END;
+				}
+				return ETX_OTA_EC_OK;
+			}
+			etx_ota_nack_reason = ETX_OTA_NACK_REASON_SEQUENCE;
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Expected ETX OTA Data Type Packet, but something else was received instead.\r\n");
+			#endif
+			return ETX_OTA_EC_ERR;
+
+		case ETX_OTA_STATE_END:
+			if (is_etx_ota_data_v2 && (cmd->packet_type==ETX_OTA_PACKET_TYPE_DATA_V2))
+			{
+				/** <b>Local variable is_duplicate:</b> Flag used to indicate whether the Payload of the current ETX OTA Data v2 Type Packet has already been received with a \c true , or otherwise with a \c false . */
+				bool is_duplicate;
+
+				/* Acknowledge again the last ETX OTA Data v2 Type Packet(s), whose ACK the host may have lost. */
+				if ((etx_ota_check_data_offset(buf, &is_duplicate) == ETX_OTA_EC_OK) && is_duplicate)
+				{
+					return ETX_OTA_EC_OK;
+				}
+				return ETX_OTA_EC_ERR;
+			}
+			if ((cmd->packet_type==ETX_OTA_PACKET_TYPE_CMD) && (cmd->cmd==ETX_OTA_CMD_END))
+			{
+				/** <b>Local variable cal_crc:</b> Value holder for the calculated 32-bit CRC of the Application Firmware Image that has just been installed into our MCU/MPU. */
+				#if ETX_OTA_END_CRC_FULL_RESCAN
+				uint32_t cal_crc = crc32_mpeg2((uint8_t *) ETX_APP_FLASH_ADDR, p_fw_config->App_fw_size);
+				#else
+				uint32_t cal_crc = etx_ota_fw_running_crc;
+				#endif
 
-				if (data_ret != HAL_OK)
+				#if ETX_OTA_PATCH_UPDATE
+				/* Validate that the binary patch has rebuilt the whole Application Firmware Image. */
+				if (is_etx_ota_patch && !bspatch_is_done())
+				{
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The received Application Firmware Patch ended before rebuilding the whole Application Firmware Image.\r\n");
+					#endif
+					return ETX_OTA_EC_ERR;
+				}
+				#endif
+				#if ETX_OTA_COMPRESSION
+				/* Validate that the whole compressed ETX OTA Payload has been decompressed. */
+				if (is_etx_ota_compressed && !lz4_decoder_is_done())
 				{
-					return data_ret;
+					#if ETX_OTA_VERBOSE
+						printf("ERROR: The received compressed ETX OTA Payload ended before being fully decompressed.\r\n");
+					#endif
+					return ETX_OTA_EC_ERR;
 				}
+				#endif
+
+				/* Validate the 32-bit CRC of the whole Application Firmware Image. */
 				#if ETX_OTA_VERBOSE
+					printf("Received ETX OTA END Command.\r\n");
 					if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
 					{
-						if (p_fw_config->App_fw_size%ETX_OTA_DATA_MAX_SIZE == 0)
-						{
-							printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE);
-						}
-						else
-						{
-							if (etx_ota_fw_received_size%ETX_OTA_DATA_MAX_SIZE == 0)
-							{
-								printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE+1);
-							}
-							else
-							{
-								printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", (etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE+1), p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE+1);
-							}
-						}
+						printf("Validating the received Bootloader Firmware Image...\r\n");
 					}
 					else
 					{
-						if (p_fw_config->App_fw_size%ETX_OTA_DATA_MAX_SIZE == 0)
+						printf("Validating the received Application Firmware Image...\r\n");
+					}
+				#endif
+				if (cal_crc != p_fw_config->App_fw_rec_crc)
+				{
+					#if ETX_OTA_VERBOSE
+						if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
 						{
-							printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE);
+							printf("The 32-bit CRC of the received Bootloader Firmware Image mismatches with the calculated one: [Calculated CRC = 0x%08X] [Recorded CRC = 0x%08X]\r\n",
+															(unsigned int) cal_crc, (unsigned int) p_fw_config->App_fw_rec_crc);
 						}
 						else
 						{
-							if (etx_ota_fw_received_size%ETX_OTA_DATA_MAX_SIZE==0)
-							{
-								printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE, p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE+1);
-							}
-							else
-							{
-								printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", (etx_ota_fw_received_size/ETX_OTA_DATA_MAX_SIZE+1), p_fw_config->App_fw_size/ETX_OTA_DATA_MAX_SIZE+1);
-							}
+							printf("The 32-bit CRC of the installed Application Firmware Image mismatches with the calculated one: [Calculated CRC = 0x%08X] [Recorded CRC = 0x%08X]\r\n",
+															(unsigned int) cal_crc, (unsigned int) p_fw_config->App_fw_rec_crc);
 						}
+					#endif
+					#if ETX_OTA_RESUME
+					/* Discard the checkpoint, so that the next ETX OTA Transaction of this Firmware Image does not keep the pages that led to this mismatch. */
+					p_fw_config->App_fw_resume_pages = DATA_BLOCK_16BIT_ERASED_VALUE;
+					p_fw_config->App_fw_resume_crc = DATA_BLOCK_32BIT_ERASED_VALUE;
+					firmware_update_configurations_write(p_fw_config);
+					#endif
+					return ETX_OTA_EC_ERR;
+				}
+				#if ETX_OTA_VERBOSE
+					if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
+					{
+						printf("DONE: 32-bit CRC of the received Bootloader Firmware Image has been successfully validated.\r\n");
+					}
+					else
+					{
+						printf("DONE: 32-bit CRC of the installed Application Firmware Image has been successfully validated.\r\n");
 					}
 				#endif
-				if (etx_ota_fw_received_size >= p_fw_config->App_fw_size)
-				{
-					/* received the full data. Therefore, move to the End State of the ETX OTA Process. */
-					etx_ota_state = ETX_OTA_STATE_END;
-				}
+				etx_ota_state = ETX_OTA_STATE_IDLE;
 				return ETX_OTA_EC_OK;
 			}
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: Expected ETX OTA Data Type Packet, but something else was received instead.\r\n");
+				printf("ERROR: Expected ETX OTA Command Type Packet containing an ETX OTA End Command, but something else was received instead.\r\n");
 			#endif
 			return ETX_OTA_EC_ERR;
 
-		case ETX_OTA_STATE_END:
-			if ((cmd->packet_type==ETX_OTA_PACKET_TYPE_CMD) && (cmd->cmd==ETX_OTA_CMD_END))
+		default:
+			/* Should not come here */
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The current ETX OTA State %d is unrecognized by our MCU/MPU.\r\n", etx_ota_state);
+			#endif
+			return ETX_OTA_EC_ERR;
+			break;
+	}
+}
+
+static ETX_OTA_Status etx_ota_check_data_offset(uint8_t *buf, bool *is_duplicate)
+{
+	/** <b>Local pointer data:</b> Points to the data of the ETX OTA Data v2 Type Packet but in @ref ETX_OTA_Data_Packet_t type. */
+	ETX_OTA_Data_Packet_t *data = (ETX_OTA_Data_Packet_t *) buf;
+	/** <b>Local variable offset:</b> Offset of the ETX OTA Payload at which the data of the ETX OTA Data v2 Type Packet starts. */
+	uint32_t offset;
+
+	*is_duplicate = false;
+	if (data->data_len < ETX_OTA_DATA_OFFSET_SIZE)
+	{
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_LENGTH;
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The currently received ETX OTA Data v2 Type Packet is too short to hold its offset.\r\n");
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	memcpy(&offset, &buf[ETX_OTA_DATA_FIELD_INDEX], sizeof(offset));
+
+	/* Flag the ETX OTA Data v2 Type Packets whose data has already been received, so that they are acknowledged again without being written. */
+	if (((uint64_t) offset + data->data_len - ETX_OTA_DATA_OFFSET_SIZE) <= etx_ota_fw_buffered_size)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("WARNING: The currently received ETX OTA Data v2 Type Packet, at offset %ld, has already been received. Acknowledging it again...\r\n", offset);
+		#endif
+		*is_duplicate = true;
+		return ETX_OTA_EC_OK;
+	}
+
+	/* Validate that the ETX OTA Data v2 Type Packet starts right where the Payload received so far ends. */
+	if (offset != etx_ota_fw_buffered_size)
+	{
+		etx_ota_nack_reason = ETX_OTA_NACK_REASON_SEQUENCE;
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The currently received ETX OTA Data v2 Type Packet starts at offset %ld, but offset %ld was expected.\r\n", offset, etx_ota_fw_buffered_size);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+
+	return ETX_OTA_EC_OK;
+}
+
+//#pragma GCC diagnostic ignored "-Wstringop-overflow=" // This pragma definition will tell the compiler to ignore an expected Compilation Warning (due to a code functionality that it is strictly needed to work that way) that gives using the HAL_CRC_Calculate() function inside the etx_ota_send_resp() function,. which states the following: 'HAL_CRC_Calculate' accessing 4 bytes in a region of size 1.
+#if ETX_OTA_SKIP_UNCHANGED_PAGES
+static ETX_OTA_Status etx_ota_process_page_crc_cmd(uint8_t *buf)
+{
+	/** <b>Local pointer cmd:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+	ETX_OTA_Command_Packet_t *cmd = (ETX_OTA_Command_Packet_t *) buf;
+	/** <b>Local variable first_page:</b> Index, counted from @ref ETX_APP_FLASH_ADDR , of the first Flash Memory page whose 32-bit CRC has been requested. */
+	uint16_t first_page;
+	/** <b>Local variable page_count:</b> Number of Flash Memory pages whose 32-bit CRCs have been requested. */
+	uint8_t page_count;
+	/** <b>Local variable page_crc:</b> 32-bit CRC of the Flash Memory page that is currently being calculated. */
+	uint32_t page_crc;
+
+	/* Validate the requested pages. */
+	if (cmd->data_len != ETX_OTA_PAGE_CRC_CMD_SIZE)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The ETX OTA Page CRC Command has an unexpected length of %d bytes.\r\n", cmd->data_len);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	memcpy(&first_page, &buf[ETX_OTA_DATA_FIELD_INDEX + 1U], sizeof(first_page));
+	page_count = buf[ETX_OTA_DATA_FIELD_INDEX + 1U + sizeof(first_page)];
+	if ((page_count == 0U) || (page_count > ETX_OTA_PAGE_CRC_MAX_COUNT) || (((uint32_t) first_page + page_count) > ETX_APP_FLASH_PAGES_SIZE))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The 32-bit CRCs of %d pages starting from page %d cannot be given.\r\n", page_count, first_page);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+
+	/* Append the 32-bit CRC of each requested page to the ACK of this Command. */
+	for (uint8_t i=0; i<page_count; i++)
+	{
+		page_crc = crc32_mpeg2((uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + ((uint32_t) (first_page + i) * FLASH_PAGE_SIZE_IN_BYTES)), FLASH_PAGE_SIZE_IN_BYTES);
+		memcpy(&etx_ota_resp_data[i * sizeof(page_crc)], &page_crc, sizeof(page_crc));
+	}
+	etx_ota_resp_data_len = page_count * sizeof(page_crc);
+	#if ETX_OTA_VERBOSE
+		printf("DONE: ETX OTA Page CRC command received for %d pages starting from page %d.\r\n", page_count, first_page);
+	#endif
+
+	return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status etx_ota_process_seek_cmd(uint8_t *buf)
+{
+	/** <b>Local pointer cmd:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+	ETX_OTA_Command_Packet_t *cmd = (ETX_OTA_Command_Packet_t *) buf;
+	/** <b>Local variable offset:</b> Offset of the Payload from which the host continues. */
+	uint32_t offset;
+	/** <b>Local variable run_len:</b> Length in bytes of the run of the Payload that the host will send from \c offset . */
+	uint32_t run_len;
+	/** <b>Local variable skipped_len:</b> Length in bytes of the Payload that is kept in place from the Flash Memory. */
+	uint32_t skipped_len;
+	/** <b>Local variable is_erase:</b> Flag used to indicate whether the skipped Flash Memory pages are to be erased with a \c true , or otherwise kept in place with a \c false . */
+	bool is_erase;
+
+	/* Validate the requested offset and run. */
+	if ((cmd->data_len != ETX_OTA_SEEK_CMD_SIZE) && (cmd->data_len != ETX_OTA_SEEK_CMD_ERASE_SIZE))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The ETX OTA Seek Command has an unexpected length of %d bytes.\r\n", cmd->data_len);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	memcpy(&offset, &buf[ETX_OTA_DATA_FIELD_INDEX + 1U], sizeof(offset));
+	memcpy(&run_len, &buf[ETX_OTA_DATA_FIELD_INDEX + 1U + sizeof(offset)], sizeof(run_len));
+	skipped_len = offset - etx_ota_fw_buffered_size;
+	is_erase = (cmd->data_len == ETX_OTA_SEEK_CMD_ERASE_SIZE) && ((buf[ETX_OTA_DATA_FIELD_INDEX + ETX_OTA_SEEK_CMD_SIZE] & ETX_OTA_SEEK_FLAG_ERASE) != 0U);
+	#if ETX_OTA_PATCH_UPDATE
+	if (is_etx_ota_patch)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The ETX OTA Seek Command cannot be used while receiving an Application Firmware Patch.\r\n");
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	#endif
+	#if ETX_OTA_COMPRESSION
+	if (is_etx_ota_compressed)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The ETX OTA Seek Command cannot be used while receiving a compressed ETX OTA Payload.\r\n");
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	#endif
+	if ((rx_pending_data_count != 0U) || (offset < etx_ota_fw_buffered_size) || (offset > etx_ota_payload_size)
+			|| (run_len > (etx_ota_payload_size - offset)) || ((skipped_len > 0U)
+			&& (((etx_ota_fw_buffered_size % FLASH_PAGE_SIZE_IN_BYTES) != 0U) || (((offset % FLASH_PAGE_SIZE_IN_BYTES) != 0U) && (offset != etx_ota_payload_size)))))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The Payload cannot be continued from offset %ld with a run of %ld bytes after having received %ld bytes.\r\n", offset, run_len, etx_ota_fw_buffered_size);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+
+	/* Erase the skipped pages that are not blank yet, if the host has requested it. */
+	if (is_erase && (skipped_len > 0U))
+	{
+		/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+		ETX_OTA_Status ret;
+		/** <b>Local variable flash_ret:</b> Return value of a @ref FlashWriter_Status function type. */
+		FlashWriter_Status flash_ret = flash_writer_begin();
+
+		if (flash_ret != FLASH_WRITER_EC_OK)
+		{
+			ret = HAL_ret_handler((HAL_StatusTypeDef) flash_ret);
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: HAL Flash could not be unlocked; ETX OTA Exception code %d.\r\n", ret);
+			#endif
+			return ret;
+		}
+		for (uint32_t page_address=ETX_APP_FLASH_ADDR+etx_ota_fw_buffered_size; page_address<(ETX_APP_FLASH_ADDR+offset); page_address+=FLASH_PAGE_SIZE_IN_BYTES)
+		{
+			if (flash_writer_is_blank(page_address, FLASH_PAGE_SIZE_IN_BYTES))
 			{
-				/** <b>Local variable cal_crc:</b> Value holder for the calculated 32-bit CRC of the Application Firmware Image that has just been installed into our MCU/MPU. */
-				uint32_t cal_crc = crc32_mpeg2((uint8_t *) ETX_APP_FLASH_ADDR, p_fw_config->App_fw_size);
+				continue;
+			}
+			flash_ret = flash_writer_erase_page(page_address);
+			if (flash_ret != FLASH_WRITER_EC_OK)
+			{
+				ret = HAL_ret_handler((HAL_StatusTypeDef) flash_ret);
+				#if ETX_OTA_VERBOSE
+					printf("ERROR: Flash Memory page %ld of the Application Firmware of our MCU/MPU could not be erased; ETX OTA Exception code %d.\r\n", (page_address-ETX_APP_FLASH_ADDR)/FLASH_PAGE_SIZE_IN_BYTES, ret);
+				#endif
+				return ret;
+			}
+		}
+	}
 
-				/* Validate the 32-bit CRC of the whole Application Firmware Image. */
+	/* Keep the skipped pages in place, accounting for them as if they had been received. */
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	etx_ota_fw_running_crc = crc32_mpeg2_update(etx_ota_fw_running_crc, (uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + etx_ota_fw_buffered_size), skipped_len);
+	#endif
+	etx_ota_skipped_pages += (skipped_len + FLASH_PAGE_SIZE_IN_BYTES - 1U) / FLASH_PAGE_SIZE_IN_BYTES;
+	etx_ota_fw_received_size += skipped_len;
+	etx_ota_fw_buffered_size = offset;
+	etx_ota_fw_run_end = offset + run_len;
+	#if ETX_OTA_VERBOSE
+		printf("DONE: ETX OTA Seek command received; %ld bytes %s and %ld bytes to be received from offset %ld.\r\n", skipped_len, is_erase ? "erased" : "kept in place", run_len, offset);
+	#endif
+	if (etx_ota_fw_buffered_size >= etx_ota_payload_size)
+	{
+		/* The rest of the Firmware Image is already in place. Therefore, move to the End State of the ETX OTA Process. */
+		etx_ota_state = ETX_OTA_STATE_END;
+	}
+
+	return ETX_OTA_EC_OK;
+}
+#endif
+
+#if ETX_OTA_BAUD_RATE_MAX
+static ETX_OTA_Status etx_ota_process_baud_rate_cmd(uint8_t *buf)
+{
+	/** <b>Local pointer cmd:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+	ETX_OTA_Command_Packet_t *cmd = (ETX_OTA_Command_Packet_t *) buf;
+	/** <b>Local variable baud_rate:</b> Baud rate, in bits per second, to which the host requests our MCU/MPU to switch. */
+	uint32_t baud_rate;
+
+	/* Validate that the Baud rate can be switched at this point of the ETX OTA Transaction. */
+	if ((ETX_OTA_hardware_protocol != ETX_OTA_hw_Protocol_UART) || (etx_ota_state != ETX_OTA_STATE_HEADER) || (cmd->data_len != ETX_OTA_BAUD_RATE_CMD_SIZE))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The ETX OTA Baud Rate Command can only be given with %d bytes, via the UART Hardware Protocol and during the ETX OTA Header State.\r\n", ETX_OTA_BAUD_RATE_CMD_SIZE);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+
+	/* Validate the requested Baud rate, which is switched to right after acknowledging this Command. */
+	memcpy(&baud_rate, &buf[ETX_OTA_DATA_FIELD_INDEX + 1U], sizeof(baud_rate));
+	if (!etx_ota_is_baud_rate_attainable(baud_rate))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The requested Baud rate of %ld cannot be generated by the UART (up to %ld within %d%%).\r\n", baud_rate, etx_ota_get_baud_rate_max(), ETX_OTA_BAUD_RATE_MAX_ERROR);
+		#endif
+		return ETX_OTA_EC_ERR;
+	}
+	etx_ota_pending_baud_rate = baud_rate;
+	#if ETX_OTA_VERBOSE
+		printf("DONE: ETX OTA Baud Rate command received for a Baud rate of %ld.\r\n", baud_rate);
+	#endif
+
+	return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status etx_ota_switch_baud_rate()
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable previous_baud_rate:</b> Baud rate, in bits per second, to fall back to if the host does not confirm the new one. */
+	uint32_t previous_baud_rate = p_huart->Init.BaudRate;
+	/** <b>Local variable switch_tick:</b> HAL Tick at which the UART was switched to the new Baud rate. */
+	uint32_t switch_tick;
+	/** <b>Local pointer p_packet:</b> Points to the whole data of the ETX OTA Packet that has just been received at the new Baud rate. */
+	uint8_t *p_packet;
+
+	ret = etx_ota_set_baud_rate(etx_ota_pending_baud_rate);
+	etx_ota_pending_baud_rate = 0U;
+	if (ret != ETX_OTA_EC_OK)
+	{
+		return ret;
+	}
+
+	/* Wait for the host to confirm the new Baud rate with an ETX OTA Ping Command, discarding anything else that is received meanwhile. */
+	switch_tick = HAL_GetTick();
+	while ((HAL_GetTick()-switch_tick) < ETX_OTA_BAUD_CONFIRM_TIMEOUT)
+	{
+		if ((etx_ota_rx_ring_available() > 0U) && (etx_ota_rx_ring_peek(0) != ETX_OTA_SOF))
+		{
+			etx_ota_rx_ring_take(ETX_OTA_SOF_SIZE);
+		}
+		else if ((etx_ota_rx_ring_available() >= (ETX_OTA_DATA_OVERHEAD + 1U))
+				&& (etx_ota_receive_packet(&p_packet, ETX_OTA_DATA_OVERHEAD + 1U) == ETX_OTA_EC_OK)
+				&& (p_packet[ETX_OTA_SOF_SIZE] == ETX_OTA_PACKET_TYPE_CMD) && (p_packet[ETX_OTA_DATA_FIELD_INDEX] == ETX_OTA_CMD_PING))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("DONE: The host has confirmed the Baud rate of %ld.\r\n", p_huart->Init.BaudRate);
+			#endif
+			return etx_ota_send_resp(ETX_OTA_ACK);
+		}
+	}
+
+	/* Since the host did not confirm the new Baud rate, fall back to the previous one once the host stops sending data at the new one. */
+	#if ETX_OTA_VERBOSE
+		printf("WARNING: The host did not confirm the Baud rate of %ld. Falling back to %ld...\r\n", p_huart->Init.BaudRate, previous_baud_rate);
+	#endif
+	etx_ota_drain_rx();
+
+	return etx_ota_set_baud_rate(previous_baud_rate);
+}
+
+static uint32_t etx_ota_get_baud_rate_max()
+{
+	/** <b>Local variable baud_rate_max:</b> Fastest Baud rate that the clock of the UART can generate. */
+	uint32_t baud_rate_max = ((p_huart->Instance == USART1) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq()) / 16U;
+
+	return (baud_rate_max < ETX_OTA_BAUD_RATE_MAX) ? baud_rate_max : ETX_OTA_BAUD_RATE_MAX;
+}
+
+static bool etx_ota_is_baud_rate_attainable(uint32_t baud_rate)
+{
+	/** <b>Local variable pclk:</b> Frequency, in Hz, of the clock of the UART. */
+	uint32_t pclk = (p_huart->Instance == USART1) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+	/** <b>Local variable brr:</b> Value that the BRR of the UART would take for \p baud_rate , in sixteenths of USARTDIV. */
+	uint32_t brr;
+	/** <b>Local variable error:</b> Difference between \c pclk and \c brr times \p baud_rate , which is the error of the resulting Baud rate times \c brr times \p baud_rate . */
+	uint64_t error;
+
+	if ((baud_rate == 0U) || (baud_rate > etx_ota_get_baud_rate_max()))
+	{
+		return false;
+	}
+	brr = (pclk + (baud_rate / 2U)) / baud_rate;
+	if (brr == 0U)
+	{
+		return false;
+	}
+
+	/* The resulting Baud rate is pclk/brr, so its error against the requested one is |pclk - brr*baud_rate| / (brr*baud_rate). */
+	error = (pclk > ((uint64_t) brr * baud_rate)) ? (pclk - ((uint64_t) brr * baud_rate)) : (((uint64_t) brr * baud_rate) - pclk);
+	return ((error * 100U) <= ((uint64_t) brr * baud_rate * ETX_OTA_BAUD_RATE_MAX_ERROR));
+}
+
+static ETX_OTA_Status etx_ota_set_baud_rate(uint32_t baud_rate)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+
+	etx_ota_rx_ring_stop();
+	p_huart->Init.BaudRate = baud_rate;
+	ret = HAL_ret_handler(HAL_UART_Init(p_huart));
+	if (ret != ETX_OTA_EC_OK)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The UART could not be switched to the Baud rate of %ld (Exception Code = %d).\r\n", baud_rate, ret);
+		#endif
+		return ret;
+	}
+
+	return etx_ota_rx_ring_start();
+}
+#endif
+
+static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
+	ETX_OTA_Status  ret;
+	/** <b>Local variable response:</b> Holds the whole ETX OTA Response Type Packet to be sent, whose format is that of @ref ETX_OTA_Response_Packet_t but with any pending bytes of @ref etx_ota_resp_data appended right after its Response Status. */
+	uint8_t response[ETX_OTA_DATA_OVERHEAD + ETX_OTA_RESP_DATA_MAX_SIZE];
+	/** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Response Type Packet to be sent. */
+	uint16_t data_len = 1U + etx_ota_resp_data_len;
+	/** <b>Local variable len:</b> Current length in bytes of the ETX OTA Response Type Packet that is being populated. */
+	uint16_t len = 0;
+	/** <b>Local variable crc:</b> 32-bit CRC of the "Data" field of the ETX OTA Response Type Packet to be sent. */
+	uint32_t crc;
+
+	/* Populate the ETX OTA Response Type Packet. */
+	response[len++] = ETX_OTA_SOF;
+	response[len++] = ETX_OTA_PACKET_TYPE_RESPONSE;
+	memcpy(&response[len], &data_len, ETX_OTA_DATA_LENGTH_SIZE);
+	len += ETX_OTA_DATA_LENGTH_SIZE;
+	response[len++] = response_status;
+	memcpy(&response[len], etx_ota_resp_data, etx_ota_resp_data_len);
+	len += etx_ota_resp_data_len;
+	crc = crc32_mpeg2(&response[ETX_OTA_DATA_FIELD_INDEX], data_len);
+	memcpy(&response[len], &crc, ETX_OTA_CRC32_SIZE);
+	len += ETX_OTA_CRC32_SIZE;
+	response[len++] = ETX_OTA_EOF;
+	etx_ota_resp_data_len = 0U;
+
+	switch (ETX_OTA_hardware_protocol)
+	{
+		case ETX_OTA_hw_Protocol_UART:
+			ret = HAL_ret_handler(HAL_UART_Transmit(p_huart, response, len, ETX_CUSTOM_HAL_TIMEOUT));
+			break;
+		case ETX_OTA_hw_Protocol_BT:
+			ret = (ETX_OTA_Status) send_hm10_ota_data(response, len, ETX_CUSTOM_HAL_TIMEOUT);
+			break;
+		default:
+			/* This should not happen since it should have been previously validated. */
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Expected a Hardware Protocol value, but received something else: %d.\r\n", ETX_OTA_hardware_protocol);
+			#endif
+			return ETX_OTA_EC_ERR;
+	}
+
+	return ret;
+}
+
+static ETX_OTA_Status etx_ota_send_nack()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret = ETX_OTA_EC_ERR;
+	/** <b>Local variable offset:</b> Offset of the Payload that is given to the host along with the reason of the NACK. */
+	uint32_t offset = etx_ota_fw_buffered_size;
+
+	if (is_etx_ota_nack_reason && (etx_ota_nack_reason != ETX_OTA_NACK_REASON_NONE))
+	{
+		if ((etx_ota_state == ETX_OTA_STATE_DATA) && (etx_ota_nack_reason != ETX_OTA_NACK_REASON_FLASH) && (etx_ota_nack_count < ETX_OTA_DATA_MAX_NACKS))
+		{
+			/* Program the ETX OTA Data Type Packets accepted before the rejected one and discard the rest of the received data, so that the host re-sends right from the rejected one. */
+			if (etx_ota_write_pending_data() == ETX_OTA_EC_OK)
+			{
+				etx_ota_drain_rx();
+				etx_ota_nack_count++;
+				ret = ETX_OTA_EC_OK;
+			}
+			else
+			{
+				etx_ota_nack_reason = ETX_OTA_NACK_REASON_FLASH;
+			}
+		}
+		if (etx_ota_nack_reason == ETX_OTA_NACK_REASON_FLASH)
+		{
+			offset = etx_ota_fw_received_size;
+		}
+		if ((ret == ETX_OTA_EC_OK) || (etx_ota_nack_reason == ETX_OTA_NACK_REASON_FLASH))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("NACKing with reason %d at offset %ld of the Payload.\r\n", etx_ota_nack_reason, offset);
+			#endif
+			etx_ota_resp_data[0] = etx_ota_nack_reason;
+			memcpy(&etx_ota_resp_data[1], &offset, sizeof(offset));
+			etx_ota_resp_data_len = ETX_OTA_NACK_DATA_SIZE;
+		}
+	}
+	etx_ota_send_resp(ETX_OTA_NACK);
+
+	return ret;
+}
+
+static ETX_OTA_Status etx_ota_write_pending_data()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret = ETX_OTA_EC_OK;
+	/** <b>Local pointer data:</b> Points to the data of the current pending ETX OTA Packet but in @ref ETX_OTA_Data_Packet_t type. */
+	ETX_OTA_Data_Packet_t *data;
+	/** <b>Local variable header_len:</b> Number of bytes that come before the Payload in the "Data" field of the current pending ETX OTA Packet, which are those of the offset of the ETX OTA Data v2 Type Packets. */
+	uint16_t header_len;
+
+	for (uint8_t i=0; i<rx_pending_data_count; i++)
+	{
+		/* Make sure that the DMA has not overwritten the pending ETX OTA Data Type Packets since they were received, which only a host that sends beyond its window can cause. */
+		if (etx_ota_rx_ring_is_lapped())
+		{
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The host has overwritten the received ETX OTA Data Type Packets before they were written.\r\n");
+			#endif
+			ret = ETX_OTA_EC_ERR;
+			break;
+		}
+
+		/* Write the ETX OTA Data Type Packet to the Flash Memory location of the Application Firmware, or decompress it first if the ETX OTA Payload is being sent compressed. */
+		data = (ETX_OTA_Data_Packet_t *) p_rx_pending_data[i];
+		header_len = (data->packet_type == ETX_OTA_PACKET_TYPE_DATA_V2) ? ETX_OTA_DATA_OFFSET_SIZE : 0U;
+		#if ETX_OTA_COMPRESSION
+		if (is_etx_ota_compressed)
+		{
+			/** <b>Local variable lz4_ret:</b> Return value of a @ref Lz4Decoder_Status function type. */
+			Lz4Decoder_Status lz4_ret = lz4_decoder_feed(p_rx_pending_data[i]+ETX_OTA_DATA_FIELD_INDEX+header_len, data->data_len-header_len);
+			if (lz4_ret != LZ4_DECODER_EC_OK)
+			{
 				#if ETX_OTA_VERBOSE
-					printf("Received ETX OTA END Command.\r\n");
-					if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
+					printf("ERROR: The received compressed ETX OTA Payload could not be decompressed and written; Streaming LZ4 Decoder Exception code %d.\r\n", lz4_ret);
+				#endif
+				ret = ETX_OTA_EC_ERR;
+				break;
+			}
+			continue;
+		}
+		#endif
+		ret = etx_ota_write_payload(p_rx_pending_data[i]+ETX_OTA_DATA_FIELD_INDEX+header_len, data->data_len-header_len);
+		if (ret != ETX_OTA_EC_OK)
+		{
+			break;
+		}
+
+		#if ETX_OTA_VERBOSE
+			if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
+			{
+				if (p_fw_config->App_fw_size%etx_ota_frame_size == 0)
+				{
+					printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_fw_config->App_fw_size/etx_ota_frame_size);
+				}
+				else
+				{
+					if (etx_ota_fw_received_size%etx_ota_frame_size == 0)
 					{
-						printf("Validating the received Bootloader Firmware Image...\r\n");
+						printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_fw_config->App_fw_size/etx_ota_frame_size+1);
 					}
 					else
 					{
-						printf("Validating the received Application Firmware Image...\r\n");
+						printf("[%ld/%ld] parts of the Bootloader Firmware Image are now stored into the Flash Memory designated to the Application Firmware Image...\r\n", (etx_ota_fw_received_size/etx_ota_frame_size+1), p_fw_config->App_fw_size/etx_ota_frame_size+1);
 					}
-				#endif
-				if (cal_crc != p_fw_config->App_fw_rec_crc)
+				}
+			}
+			else
+			{
+				if (p_fw_config->App_fw_size%etx_ota_frame_size == 0)
 				{
-					#if ETX_OTA_VERBOSE
-						if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
-						{
-							printf("The 32-bit CRC of the received Bootloader Firmware Image mismatches with the calculated one: [Calculated CRC = 0x%08X] [Recorded CRC = 0x%08X]\r\n",
-															(unsigned int) cal_crc, (unsigned int) p_fw_config->App_fw_rec_crc);
-						}
-						else
-						{
-							printf("The 32-bit CRC of the installed Application Firmware Image mismatches with the calculated one: [Calculated CRC = 0x%08X] [Recorded CRC = 0x%08X]\r\n",
-															(unsigned int) cal_crc, (unsigned int) p_fw_config->App_fw_rec_crc);
-						}
-					#endif
-					return ETX_OTA_EC_ERR;
+					printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_fw_config->App_fw_size/etx_ota_frame_size);
 				}
-				#if ETX_OTA_VERBOSE
-					if (p_fw_config->is_bl_fw_install_pending == IS_PENDING)
+				else
+				{
+					if (etx_ota_fw_received_size%etx_ota_frame_size==0)
 					{
-						printf("DONE: 32-bit CRC of the received Bootloader Firmware Image has been successfully validated.\r\n");
+						printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", etx_ota_fw_received_size/etx_ota_frame_size, p_fw_config->App_fw_size/etx_ota_frame_size+1);
 					}
 					else
 					{
-						printf("DONE: 32-bit CRC of the installed Application Firmware Image has been successfully validated.\r\n");
+						printf("[%ld/%ld] parts of the Application Firmware Image are now installed into our MCU/MPU...\r\n", (etx_ota_fw_received_size/etx_ota_frame_size+1), p_fw_config->App_fw_size/etx_ota_frame_size+1);
 					}
-				#endif
-				etx_ota_state = ETX_OTA_STATE_IDLE;
-				return ETX_OTA_EC_OK;
+				}
 			}
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: Expected ETX OTA Command Type Packet containing an ETX OTA End Command, but something else was received instead.\r\n");
-			#endif
-			return ETX_OTA_EC_ERR;
-
-		default:
-			/* Should not come here */
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: The current ETX OTA State %d is unrecognized by our MCU/MPU.\r\n", etx_ota_state);
-			#endif
-			return ETX_OTA_EC_ERR;
-			break;
+		#endif
+	}
+	if ((ret == ETX_OTA_EC_OK) && (rx_pending_data_count != 0U) && etx_ota_rx_ring_is_lapped())
+	{
+		/* The last pending ETX OTA Data Type Packet may have been overwritten while it was being written. */
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The host has overwritten the received ETX OTA Data Type Packets while they were written.\r\n");
+		#endif
+		ret = ETX_OTA_EC_ERR;
 	}
+	rx_pending_data_count = 0U;
+
+	return ret;
 }
 
-//#pragma GCC diagnostic ignored "-Wstringop-overflow=" // This pragma definition will tell the compiler to ignore an expected Compilation Warning (due to a code functionality that it is strictly needed to work that way) that gives using the HAL_CRC_Calculate() function inside the etx_ota_send_resp() function,. which states the following: 'HAL_CRC_Calculate' accessing 4 bytes in a region of size 1.
-static ETX_OTA_Status etx_ota_send_resp(ETX_OTA_Response_Status response_status)
+static ETX_OTA_Status etx_ota_write_payload(uint8_t *data, uint16_t data_len)
 {
-	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
-	ETX_OTA_Status  ret;
-
-	ETX_OTA_Response_Packet_t response =
-	{
-		.sof         	= ETX_OTA_SOF,
-		.packet_type 	= ETX_OTA_PACKET_TYPE_RESPONSE,
-		.data_len    	= 1U,
-		.status      	= response_status,
-		.crc			= 0U,
-		.eof         	= ETX_OTA_EOF
-	};
-	response.crc = crc32_mpeg2((uint8_t *) &response.status, 1);
-
-	switch (ETX_OTA_hardware_protocol)
+	#if ETX_OTA_PATCH_UPDATE
+	/* Apply the data if it is part of a binary patch. */
+	if (is_etx_ota_patch)
 	{
-		case ETX_OTA_hw_Protocol_UART:
-			ret = HAL_UART_Transmit(p_huart, (uint8_t *) &response, sizeof(ETX_OTA_Response_Packet_t), ETX_CUSTOM_HAL_TIMEOUT);
-			ret = HAL_ret_handler(ret);
-			break;
-		case ETX_OTA_hw_Protocol_BT:
-			ret = send_hm10_ota_data((uint8_t *) &response, sizeof(ETX_OTA_Response_Packet_t), ETX_CUSTOM_HAL_TIMEOUT);
-			break;
-		default:
-			/* This should not happen since it should have been previously validated. */
+		/** <b>Local variable patch_ret:</b> Return value of a @ref BsPatch_Status function type. */
+		BsPatch_Status patch_ret = bspatch_feed(data, data_len);
+		if (patch_ret != BSPATCH_EC_OK)
+		{
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: Expected a Hardware Protocol value, but received something else: %d.\r\n", ETX_OTA_hardware_protocol);
+				printf("ERROR: The received Application Firmware Patch could not be applied; Binary Patch Applier Exception code %d.\r\n", patch_ret);
 			#endif
 			return ETX_OTA_EC_ERR;
+		}
+		return ETX_OTA_EC_OK;
 	}
+	#endif
 
-	return ret;
+	return write_data_to_flash_app(data, data_len);
+}
+
+#if ETX_OTA_COMPRESSION
+static Lz4Decoder_Status etx_ota_lz4_write(uint8_t *p_data, uint16_t length)
+{
+	return (etx_ota_write_payload(p_data, length) == ETX_OTA_EC_OK) ? LZ4_DECODER_EC_OK : LZ4_DECODER_EC_ERR;
 }
+#endif
 
-static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len, bool is_first_block)
+static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len)
 {
 	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
 	uint8_t  ret;
-	/**	<b>Local variable p_data:</b> Pointer to the data at which the \p data param points to but in \c uint32_t Type. */
-	uint32_t *p_data = (uint32_t *) data;
 
-	/* Unlock the Flash Memory of our MCU/MPU. */
-	ret = HAL_FLASH_Unlock();
+	/* Unlock the Flash Memory of our MCU/MPU, which is only actually done for the first ETX OTA Data Type Packet since it is then kept unlocked until the end of the ETX OTA Transaction. */
+	ret = flash_writer_begin();
 	ret = HAL_ret_handler(ret);
 	if(ret != HAL_OK)
 	{
@@ -1165,114 +2902,435 @@ static ETX_OTA_Status write_data_to_flash_app(uint8_t *data, uint16_t data_len,
 		return ret;
 	}
 
-	/* Erase Flash Memory dedicated to our MCU/MPU's Application Firmware but only if the current ETX OTA Data Type Packet being processed is the first one. */
-	if (is_first_block)
+	#if ETX_OTA_SKIP_UNCHANGED_PAGES
+	/** <b>Local variable chunk_len:</b> Number of bytes of the \p data param that belong to the Flash Memory page currently being staged. */
+	uint16_t chunk_len;
+
+	/* Stage the data into @ref Page_Stage_Buffer and write each page once it is complete, or once the Firmware Image has been fully received. */
+	while (data_len > 0)
+	{
+		chunk_len = FLASH_PAGE_SIZE_IN_BYTES - page_stage_len;
+		if (chunk_len > data_len)
+		{
+			chunk_len = data_len;
+		}
+		memcpy(&Page_Stage_Buffer[page_stage_len], data, chunk_len);
+		page_stage_len += chunk_len;
+		etx_ota_fw_received_size += chunk_len;
+		data += chunk_len;
+		data_len -= chunk_len;
+
+		if ((page_stage_len == FLASH_PAGE_SIZE_IN_BYTES) || (etx_ota_fw_received_size >= p_fw_config->App_fw_size))
+		{
+			ret = etx_ota_commit_staged_page();
+			if (ret != HAL_OK)
+			{
+				return ret;
+			}
+		}
+	}
+
+	return ETX_OTA_EC_OK;
+	#else
+	/* Make sure that the Flash Memory pages that are about to be written are erased. */
+	ret = etx_ota_prepare_flash_pages(etx_ota_fw_received_size + data_len);
+	if (ret != HAL_OK)
+	{
+		return ret;
+	}
+
+	/* Write the data of the current ETX OTA Data Type Packet into the Flash Memory designated pages to our MCU/MPU's Application Firmware. */
+	ret = flash_writer_program(ETX_APP_FLASH_ADDR + etx_ota_fw_received_size, data, data_len);
+	ret = HAL_ret_handler(ret);
+	if (ret != HAL_OK)
 	{
 		#if ETX_OTA_VERBOSE
-			printf("Erasing the Flash Memory pages designated to the Application Firmware of our MCU/MPU...\r\n");
+			printf("EXCEPTION CODE %d: The Firmware Image data was not successfully written into our MCU/MPU.\r\n", ret);
 		#endif
-		FLASH_EraseInitTypeDef EraseInitStruct;
-		uint32_t page_error;
+		return ret;
+	}
+	etx_ota_fw_received_size += data_len;
+
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	/* Update the running 32-bit CRC of the Firmware Image with the bytes that have just been programmed, as read back from the Flash Memory. */
+	etx_ota_fw_running_crc = crc32_mpeg2_update(etx_ota_fw_running_crc, (uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + etx_ota_fw_received_size - data_len), data_len);
+	#endif
+
+	return ret;
+	#endif
+}
+
+#if ETX_OTA_SKIP_UNCHANGED_PAGES
+static ETX_OTA_Status etx_ota_commit_staged_page()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	uint8_t  ret;
+	/** <b>Local variable page_address:</b> Start address of the Flash Memory page that is staged in @ref Page_Stage_Buffer . */
+	uint32_t page_address = ETX_APP_FLASH_ADDR + etx_ota_fw_received_size - page_stage_len;
+
+	/* Take the bytes of the staged page that lie beyond the end of the Firmware Image as erased ones. */
+	memset(&Page_Stage_Buffer[page_stage_len], 0xFF, FLASH_PAGE_SIZE_IN_BYTES - page_stage_len);
+
+	#if ETX_OTA_PATCH_UPDATE
+	/* Keep a copy of the old page that is about to be overwritten, since the binary patch may still read from it. */
+	if (is_etx_ota_patch)
+	{
+		memcpy(Patch_Backlog_Buffer[((page_address-ETX_APP_FLASH_ADDR)/FLASH_PAGE_SIZE_IN_BYTES) % ETX_OTA_PATCH_BACKLOG_PAGES], (uint8_t *) (uintptr_t) page_address, FLASH_PAGE_SIZE_IN_BYTES);
+	}
+	#endif
 
-		EraseInitStruct.TypeErase    = FLASH_TYPEERASE_PAGES;
-		EraseInitStruct.Banks        = FLASH_BANK_1;
-		EraseInitStruct.PageAddress  = ETX_APP_FLASH_ADDR;
-		EraseInitStruct.NbPages      = ETX_APP_FLASH_PAGES_SIZE;
+	if (memcmp((uint8_t *) (uintptr_t) page_address, Page_Stage_Buffer, FLASH_PAGE_SIZE_IN_BYTES) == 0)
+	{
+		/* The page is already in the Flash Memory, so leave it untouched. */
+		etx_ota_skipped_pages++;
+		#if ETX_OTA_VERBOSE
+			printf("The Flash Memory page %ld designated to the Application Firmware of our MCU/MPU is unchanged; %d pages skipped so far.\r\n", (page_address-ETX_APP_FLASH_ADDR)/FLASH_PAGE_SIZE_IN_BYTES, etx_ota_skipped_pages);
+		#endif
+	}
+	else
+	{
+		/* Erase the page, unless it is already blank, and then program it with the staged bytes. */
+		if (!flash_writer_is_blank(page_address, FLASH_PAGE_SIZE_IN_BYTES))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("Erasing the Flash Memory page %ld designated to the Application Firmware of our MCU/MPU...\r\n", (page_address-ETX_APP_FLASH_ADDR)/FLASH_PAGE_SIZE_IN_BYTES);
+			#endif
+			ret = flash_writer_erase_page(page_address);
+			ret = HAL_ret_handler(ret);
+			if (ret != HAL_OK)
+			{
+				#if ETX_OTA_VERBOSE
+					printf("ERROR: Flash Memory page %ld of the Application Firmware of our MCU/MPU could not be erased; ETX OTA Exception code %d.\r\n", (page_address-ETX_APP_FLASH_ADDR)/FLASH_PAGE_SIZE_IN_BYTES, ret);
+				#endif
+				return ret;
+			}
+		}
 
-		ret = HAL_FLASHEx_Erase(&EraseInitStruct, &page_error);
+		ret = flash_writer_program(page_address, Page_Stage_Buffer, page_stage_len);
 		ret = HAL_ret_handler(ret);
 		if (ret != HAL_OK)
 		{
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: Flash Memory pages of the Application Firmware of our MCU/MPU could not be erased; ETX OTA Exception code %d.\r\n", ret);
+				printf("EXCEPTION CODE %d: The Firmware Image data was not successfully written into our MCU/MPU.\r\n", ret);
 			#endif
 			return ret;
 		}
+	}
+
+	#if !ETX_OTA_END_CRC_FULL_RESCAN
+	/* Update the running 32-bit CRC of the Firmware Image with the bytes of the page, as read back from the Flash Memory. */
+	etx_ota_fw_running_crc = crc32_mpeg2_update(etx_ota_fw_running_crc, (uint8_t *) (uintptr_t) page_address, page_stage_len);
+	#endif
+	#if ETX_OTA_RESUME
+	/* Checkpoint the ETX OTA Transaction every @ref ETX_OTA_CHECKPOINT_PAGES whole pages. */
+	if ((page_stage_len == FLASH_PAGE_SIZE_IN_BYTES) && (((etx_ota_fw_received_size / FLASH_PAGE_SIZE_IN_BYTES) % ETX_OTA_CHECKPOINT_PAGES) == 0U))
+	{
+		ret = etx_ota_write_checkpoint();
+		if (ret != ETX_OTA_EC_OK)
+		{
+			return ret;
+		}
+	}
+	#endif
+	page_stage_len = 0U;
+
+	return ETX_OTA_EC_OK;
+}
+
+#if ETX_OTA_PATCH_UPDATE
+static BsPatch_Status etx_ota_patch_check_header(const bspatch_header_t *p_header)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref FirmUpdConf_Status function type. */
+	int16_t ret;
+
+	/* Validate that the binary patch was made for the installed Application Firmware Image and for the way in which our MCU/MPU applies it. */
+	if ((p_header->old_size != p_fw_config->App_fw_size) || (p_header->old_crc != p_fw_config->App_fw_rec_crc))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The received Application Firmware Patch was not made for the installed Application Firmware Image.\r\n");
+		#endif
+		return BSPATCH_EC_NA;
+	}
+	if ((p_header->new_size == 0U) || (p_header->new_size > ETX_OTA_APP_FW_SIZE) || (p_header->page_size != FLASH_PAGE_SIZE_IN_BYTES)
+			|| (p_header->backlog_pages > ETX_OTA_PATCH_BACKLOG_PAGES))
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The received Application Firmware Patch rebuilds a Firmware Image of %ld bytes with %d-byte pages and %d backlog pages, which our MCU/MPU cannot apply.\r\n", p_header->new_size, p_header->page_size, p_header->backlog_pages);
+		#endif
+		return BSPATCH_EC_ERR;
+	}
+
+	/* We write the size and 32-bit CRC of the Application Firmware Image to be rebuilt into a new data block of the Flash Memory designated to the @ref firmware_update_config sub-module. */
+	#if ETX_OTA_RESUME
+	if (etx_ota_reset_checkpoint(p_header->new_size, etx_ota_patch_fw_crc) != ETX_OTA_EC_OK)
+	{
+		return BSPATCH_EC_ERR;
+	}
+	#endif
+	p_fw_config->App_fw_size = p_header->new_size;
+	p_fw_config->App_fw_rec_crc = etx_ota_patch_fw_crc;
+	p_fw_config->is_bl_fw_stored_in_app_fw = BT_FW_NOT_STORED_IN_APP_FW;
+	p_fw_config->is_bl_fw_install_pending = NOT_PENDING;
+	ret = firmware_update_configurations_write(p_fw_config);
+	if (ret != FIRM_UPDT_CONF_EC_OK)
+	{
 		#if ETX_OTA_VERBOSE
-			printf("DONE: Flash Memory pages designated to the Application Firmware of our MCU/MPU have been successfully erased.\r\n");
+			printf("EXCEPTION CODE %d: The data was not written into the Firmware Update Configurations sub-module.\r\n", ret);
 		#endif
+		return BSPATCH_EC_ERR;
 	}
+	#if ETX_OTA_VERBOSE
+		printf("Rebuilding an Application Firmware Image of %ld bytes from the installed one of %ld bytes...\r\n", p_header->new_size, p_header->old_size);
+	#endif
 
-	/**	<b>Local variable word_data:</b> Array of 4 bytes (i.e., 1 word) initialized with the zeros (i.e., 0x00 in each byte) to then overwrite them if needed with the remaining bytes of the last word from the Application Firmware Image. */
-	uint8_t word_data[4] = {0x00, 0x00, 0x00, 0x00};
-	/** <b>Local variable data_len_minus_one_word:</b> Holds the length in bytes of the "Data" field from the current ETX OTA Data Type Packet, except for the last four bytes. */
-	uint16_t data_len_minus_one_word = data_len - 4;
-	/** <b>Local variable remaining_data_len_of_last_word:</b> Should contain the remaining bytes of the last word from the Application Firmware Image that are pending to be written into our MCU/MPU's Flash Memory. */
-	uint8_t remaining_data_len_of_last_word;
-	/**	<b>Local variable bytes_flashed:</b> Indicator of how many bytes of the current ETX OTA Packet's Payload have been written into the designated Flash Memory of the Application Firmware. */
-	uint16_t bytes_flashed = 0;
+	return BSPATCH_EC_OK;
+}
 
-	if (data_len > 4)
+static BsPatch_Status etx_ota_patch_read_old(uint32_t offset, uint8_t *p_data, uint16_t length)
+{
+	/** <b>Local variable staged_page:</b> Number of the Flash Memory page, counted from @ref ETX_APP_FLASH_ADDR , that is currently being staged in @ref Page_Stage_Buffer , which is the first one that has not been overwritten yet. */
+	uint32_t staged_page = (etx_ota_fw_received_size - page_stage_len) / FLASH_PAGE_SIZE_IN_BYTES;
+	/** <b>Local variable page:</b> Number of the Flash Memory page, counted from @ref ETX_APP_FLASH_ADDR , from which the bytes are currently being read. */
+	uint32_t page;
+	/** <b>Local variable n:</b> Number of bytes that are read from the current Flash Memory page. */
+	uint16_t n;
+
+	while (length > 0U)
 	{
-		/* Write the entire Application Firmware Image into our MCU/MPU's Flash Memory, except for the last word (i.e., the last four bytes). */
-		for ( ; bytes_flashed<data_len_minus_one_word; bytes_flashed+=4)
+		page = offset / FLASH_PAGE_SIZE_IN_BYTES;
+		n = FLASH_PAGE_SIZE_IN_BYTES - (offset % FLASH_PAGE_SIZE_IN_BYTES);
+		n = (n > length) ? length : n;
+		if (page >= staged_page)
 		{
-			ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,
-									(ETX_APP_FLASH_ADDR + etx_ota_fw_received_size),
-									p_data[bytes_flashed/4]);
-			ret = HAL_ret_handler(ret);
-			if (ret == HAL_OK)
-			{
-				etx_ota_fw_received_size += 4;
-			}
-			else
-			{
-				#if ETX_OTA_VERBOSE
-					printf("EXCEPTION CODE %d: The Firmware Image data was not successfully written into our MCU/MPU.\r\n", ret);
-				#endif
-				return ret;
-			}
+			memcpy(p_data, (uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + offset), n);
+		}
+		else if ((page + ETX_OTA_PATCH_BACKLOG_PAGES) >= staged_page)
+		{
+			memcpy(p_data, &Patch_Backlog_Buffer[page % ETX_OTA_PATCH_BACKLOG_PAGES][offset % FLASH_PAGE_SIZE_IN_BYTES], n);
+		}
+		else
+		{
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: The received Application Firmware Patch reads from the Flash Memory page %ld, which has already been overwritten.\r\n", page);
+			#endif
+			return BSPATCH_EC_ERR;
+		}
+		p_data += n;
+		offset += n;
+		length -= n;
+	}
+
+	return BSPATCH_EC_OK;
+}
+
+static BsPatch_Status etx_ota_patch_write_new(uint8_t *p_data, uint16_t length)
+{
+	return (write_data_to_flash_app(p_data, length) == ETX_OTA_EC_OK) ? BSPATCH_EC_OK : BSPATCH_EC_ERR;
+}
+#endif
+#else
+static ETX_OTA_Status etx_ota_prepare_flash_pages(uint32_t end_offset)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	uint8_t  ret;
+	/** <b>Local variable pages_needed:</b> Number of Flash Memory pages, counted from @ref ETX_APP_FLASH_ADDR , that have to be ready to be written when this function returns. */
+	uint16_t pages_needed = (end_offset + FLASH_PAGE_SIZE_IN_BYTES - 1U) / FLASH_PAGE_SIZE_IN_BYTES;
+	/** <b>Local variable pages_ahead:</b> Number of Flash Memory pages that will be ready to be written, including the ones that are prepared ahead of time, without exceeding the ones covered by the Firmware Image being received. */
+	uint16_t pages_ahead = pages_needed + ETX_OTA_ERASE_PAGES_AHEAD;
+	/** <b>Local variable image_pages:</b> Number of Flash Memory pages covered by the Firmware Image being received. */
+	uint16_t image_pages = (p_fw_config->App_fw_size + FLASH_PAGE_SIZE_IN_BYTES - 1U) / FLASH_PAGE_SIZE_IN_BYTES;
+	/** <b>Local variable page_address:</b> Start address of the Flash Memory page that is currently being prepared. */
+	uint32_t page_address;
+
+	/* Get how many Flash Memory pages are to be ready when this function returns. */
+	if (pages_ahead > image_pages)
+	{
+		pages_ahead = image_pages;
+	}
+	if (pages_needed < pages_ahead)
+	{
+		pages_needed = pages_ahead;
+	}
+	if (pages_needed > ETX_APP_FLASH_PAGES_SIZE)
+	{
+		pages_needed = ETX_APP_FLASH_PAGES_SIZE;
+	}
+
+	/* Erase, one by one, the Flash Memory pages that are not ready yet, unless they are already blank. */
+	for ( ; etx_ota_ready_pages<pages_needed; etx_ota_ready_pages++)
+	{
+		page_address = ETX_APP_FLASH_ADDR + ((uint32_t) etx_ota_ready_pages * FLASH_PAGE_SIZE_IN_BYTES);
+		if (flash_writer_is_blank(page_address, FLASH_PAGE_SIZE_IN_BYTES))
+		{
+			continue;
 		}
 
-		/* Populate the remaining bytes of the Application Firmware Image that is currently being written into our MCU/MPU's Flash Memory via the \c word_data variable. */
-		// NOTE: This way, if there are unused bytes in the \c word _data variable after filling it with the remaining bytes of the Application Firmware Image, these will be left with the values that the Flash Memory recognizes as Reset Values.
-		remaining_data_len_of_last_word = data_len - bytes_flashed;
-		for (uint8_t i=0; i<remaining_data_len_of_last_word; i++)
+		#if ETX_OTA_VERBOSE
+			printf("Erasing the Flash Memory page %d designated to the Application Firmware of our MCU/MPU...\r\n", etx_ota_ready_pages);
+		#endif
+		ret = flash_writer_erase_page(page_address);
+		ret = HAL_ret_handler(ret);
+		if (ret != HAL_OK)
 		{
-			word_data[i] = data[bytes_flashed + i];
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Flash Memory page %d of the Application Firmware of our MCU/MPU could not be erased; ETX OTA Exception code %d.\r\n", etx_ota_ready_pages, ret);
+			#endif
+			return ret;
 		}
 	}
-	else
+
+	return ETX_OTA_EC_OK;
+}
+#endif
+
+#if ETX_OTA_RESUME
+static uint16_t etx_ota_scan_checkpoint_log(const etx_ota_checkpoint_record_t **pp_latest)
+{
+	/** <b>Local pointer p_log:</b> Points to the records of the @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+	const etx_ota_checkpoint_record_t *p_log = (const etx_ota_checkpoint_record_t *) ETX_OTA_CHECKPOINT_LOG_ADDR;
+	/** <b>Local variable count:</b> Number of records that have been appended into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+	uint16_t count = 0U;
+
+	*pp_latest = NULL;
+	while ((count < ETX_OTA_CHECKPOINT_LOG_RECORDS) && ((p_log[count].crc != DATA_BLOCK_32BIT_ERASED_VALUE)
+			|| (p_log[count].pages != DATA_BLOCK_16BIT_ERASED_VALUE) || (p_log[count].pages_inv != DATA_BLOCK_16BIT_ERASED_VALUE)))
 	{
-		/* Populate the remaining bytes of the Application Firmware Image that is currently being written into our MCU/MPU's Flash Memory via the \c word_data variable. */
-		// NOTE: This way, if there are unused bytes in the \c word _data variable after filling it with the remaining bytes of the Application Firmware Image, these will be left with the values that the Flash Memory recognizes as Reset Values.
-		remaining_data_len_of_last_word = data_len;
-		for (uint8_t i=0; i<remaining_data_len_of_last_word; i++)
+		if ((uint16_t) (p_log[count].pages_inv ^ p_log[count].pages) == 0xFFFFU)
 		{
-			word_data[i] = data[i];
+			*pp_latest = &p_log[count];
 		}
+		count++;
 	}
 
-	/* Write the remaining bytes of the Application Firmware Image into the Flash Memory designated pages to our MCU/MPU's Application Firmware. */
-	ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,
-							(ETX_APP_FLASH_ADDR + etx_ota_fw_received_size),
-							*((uint32_t *) word_data));
-	ret = HAL_ret_handler(ret);
-	if (ret == HAL_OK)
+	return count;
+}
+
+static uint32_t etx_ota_get_resume_offset()
+{
+	/** <b>Local pointer p_latest:</b> Points to the latest record of the @ref ETX_OTA_CHECKPOINT_LOG_PAGE , if any. */
+	const etx_ota_checkpoint_record_t *p_latest;
+	/** <b>Local variable resume_pages:</b> Number of Flash Memory pages of the Firmware Image of the latest checkpoint. */
+	uint16_t resume_pages = p_fw_config->App_fw_resume_pages;
+	/** <b>Local variable resume_crc:</b> 32-bit CRC of the Flash Memory pages of the Firmware Image of the latest checkpoint. */
+	uint32_t resume_crc = p_fw_config->App_fw_resume_crc;
+	/** <b>Local variable resume_size:</b> Number of bytes of the Firmware Image that were written when the latest checkpoint was made. */
+	uint32_t resume_size;
+
+	if (resume_pages == DATA_BLOCK_16BIT_ERASED_VALUE)
+	{
+		return 0U;
+	}
+	etx_ota_scan_checkpoint_log(&p_latest);
+	if (p_latest != NULL)
+	{
+		resume_pages = p_latest->pages;
+		resume_crc = p_latest->crc;
+	}
+	resume_size = (uint32_t) resume_pages * FLASH_PAGE_SIZE_IN_BYTES;
+	if ((resume_pages == 0U) || (p_fw_config->App_fw_size > ETX_OTA_APP_FW_SIZE) || (resume_size > p_fw_config->App_fw_size))
+	{
+		return 0U;
+	}
+	if (crc32_mpeg2((uint8_t *) ETX_APP_FLASH_ADDR, resume_size) != resume_crc)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("WARNING: The %d Flash Memory pages of the latest checkpoint no longer match their 32-bit CRC.\r\n", resume_pages);
+		#endif
+		return 0U;
+	}
+
+	return resume_size;
+}
+
+static ETX_OTA_Status etx_ota_reset_checkpoint(uint32_t fw_size, uint32_t fw_crc)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable flash_ret:</b> Return value of a @ref FlashWriter_Status function type. */
+	FlashWriter_Status flash_ret;
+	/** <b>Local pointer p_latest:</b> Points to the latest record of the @ref ETX_OTA_CHECKPOINT_LOG_PAGE , if any. */
+	const etx_ota_checkpoint_record_t *p_latest;
+
+	etx_ota_checkpoint_log_count = etx_ota_scan_checkpoint_log(&p_latest);
+	if ((p_fw_config->App_fw_size != fw_size) || (p_fw_config->App_fw_rec_crc != fw_crc) || (p_fw_config->App_fw_resume_pages == DATA_BLOCK_16BIT_ERASED_VALUE))
+	{
+		p_fw_config->App_fw_resume_pages = 0U;
+		p_fw_config->App_fw_resume_crc = CRC32_MPEG2_INIT_VALUE;
+	}
+	else if ((etx_ota_checkpoint_log_count + ETX_OTA_CHECKPOINT_MAX_COUNT) > ETX_OTA_CHECKPOINT_LOG_RECORDS)
 	{
-		bytes_flashed += remaining_data_len_of_last_word;
-		etx_ota_fw_received_size += remaining_data_len_of_last_word;
+		/* Fold the latest record into the Firmware Update Configurations, which are written right after, so that the log can be erased without losing it. */
+		if (p_latest != NULL)
+		{
+			p_fw_config->App_fw_resume_pages = p_latest->pages;
+			p_fw_config->App_fw_resume_crc = p_latest->crc;
+		}
 	}
 	else
 	{
+		return ETX_OTA_EC_OK;
+	}
+	if (etx_ota_checkpoint_log_count == 0U)
+	{
+		return ETX_OTA_EC_OK;
+	}
+
+	/* Erase the log, which is the only time that it is erased during the ETX OTA Transaction. */
+	flash_ret = flash_writer_begin();
+	if (flash_ret == FLASH_WRITER_EC_OK)
+	{
+		flash_ret = flash_writer_erase_page(ETX_OTA_CHECKPOINT_LOG_ADDR);
+	}
+	if (flash_ret != FLASH_WRITER_EC_OK)
+	{
+		ret = HAL_ret_handler((HAL_StatusTypeDef) flash_ret);
 		#if ETX_OTA_VERBOSE
-			printf("EXCEPTION CODE %d: The Firmware Image data was not successfully written into our MCU/MPU.\r\n", ret);
+			printf("ERROR: The Flash Memory page of the checkpoint log could not be erased; ETX OTA Exception code %d.\r\n", ret);
 		#endif
 		return ret;
 	}
+	etx_ota_checkpoint_log_count = 0U;
 
-	/* Lock the Flash Memory, just like it originally was before calling this @ref write_data_to_flash_app function. */
-	ret = HAL_FLASH_Lock();
-	ret = HAL_ret_handler(ret);
-	if(ret != HAL_OK)
+	return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status etx_ota_write_checkpoint()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable flash_ret:</b> Return value of a @ref FlashWriter_Status function type. */
+	FlashWriter_Status flash_ret;
+	/** <b>Local variable record:</b> Checkpoint record to be appended into the @ref ETX_OTA_CHECKPOINT_LOG_PAGE . */
+	etx_ota_checkpoint_record_t record;
+
+	if (etx_ota_checkpoint_log_count >= ETX_OTA_CHECKPOINT_LOG_RECORDS)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("WARNING: The checkpoint log is full, so no checkpoint was made.\r\n");
+		#endif
+		return ETX_OTA_EC_OK;
+	}
+	record.crc = etx_ota_fw_running_crc;
+	record.pages = etx_ota_fw_received_size / FLASH_PAGE_SIZE_IN_BYTES;
+	record.pages_inv = (uint16_t) ~record.pages;
+	flash_ret = flash_writer_program(ETX_OTA_CHECKPOINT_LOG_ADDR + etx_ota_checkpoint_log_count*sizeof(record), (uint8_t *) &record, sizeof(record));
+	/* The record takes its slot even if it failed, since its half-words may no longer be erased. */
+	etx_ota_checkpoint_log_count++;
+	if (flash_ret != FLASH_WRITER_EC_OK)
 	{
+		ret = HAL_ret_handler((HAL_StatusTypeDef) flash_ret);
 		#if ETX_OTA_VERBOSE
-			printf("ERROR: HAL Flash could not be locked; ETX OTA Exception code %d.\r\n", ret);
+			printf("EXCEPTION CODE %d: The checkpoint was not appended into the checkpoint log.\r\n", ret);
 		#endif
+		return ret;
 	}
+	#if ETX_OTA_VERBOSE
+		printf("Checkpoint made after %d Flash Memory pages of the Firmware Image.\r\n", record.pages);
+	#endif
 
-	return ret;
+	return ETX_OTA_EC_OK;
 }
+#endif
 
 static ETX_OTA_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 {
@@ -1284,7 +3342,7 @@ static ETX_OTA_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 	  case HAL_ERROR:
 		return ETX_OTA_EC_ERR;
 	  default:
-		return HAL_status;
+		return (ETX_OTA_Status) HAL_status;
     }
 }
 
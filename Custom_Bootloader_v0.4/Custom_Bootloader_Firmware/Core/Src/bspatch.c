@@ -0,0 +1,261 @@
+/** @addtogroup bspatch
+ * @{
+ */
+
+#include "bspatch.h"
+#include <string.h> // Library from which "memcpy()" is located at.
+
+/**@brief	Binary Patch Applier State definitions.
+ *
+ * @details	These definitions indicate which part of the binary patch is expected next by the @ref bspatch module.
+ */
+typedef enum
+{
+	BSPATCH_STATE_HEADER	= 0U,	//!< The header of the binary patch (i.e., @ref bspatch_header_t ) is expected next.
+	BSPATCH_STATE_CTRL		= 1U,	//!< The next Control Entry is expected next.
+	BSPATCH_STATE_DIFF		= 2U,	//!< The Diff bytes of the current Control Entry are expected next.
+	BSPATCH_STATE_EXTRA		= 3U,	//!< The Extra bytes of the current Control Entry are expected next.
+	BSPATCH_STATE_DONE		= 4U,	//!< The whole new Firmware Image has been rebuilt, so any remaining bytes are just padding.
+	BSPATCH_STATE_FAILED	= 5U	//!< The binary patch has failed to be applied, so any remaining bytes are rejected.
+} BsPatch_State;
+
+static const bspatch_io_t *p_bspatch_io = NULL;		/**< @brief Global pointer to the callbacks through which the binary patch is being applied. */
+static BsPatch_State bspatch_state = BSPATCH_STATE_FAILED;	/**< @brief Global variable used to hold the part of the binary patch that is expected next. */
+static uint8_t Field_Buffer[BSPATCH_HEADER_SIZE];	/**< @brief Global buffer in which the bytes of the header, or of a Control Entry, are gathered whenever they are split across several calls to @ref bspatch_feed . */
+static uint8_t field_len = 0U;						/**< @brief Global variable used to indicate the number of valid bytes in @ref Field_Buffer . */
+static bspatch_header_t bspatch_header;				/**< @brief Global struct holding the header of the binary patch that is being applied. */
+static uint32_t diff_left = 0U;						/**< @brief Global variable used to indicate the number of Diff bytes of the current Control Entry that are still pending to be applied. */
+static uint32_t extra_left = 0U;					/**< @brief Global variable used to indicate the number of Extra bytes of the current Control Entry that are still pending to be applied. */
+static bool is_copy = false;						/**< @brief Global flag used to indicate whether the current Control Entry has its Copy flag set (see @ref BSPATCH_CTRL_COPY_FLAG ) with a \c true , or otherwise with a \c false . */
+static int32_t seek = 0;							/**< @brief Global variable used to hold the Seek value of the current Control Entry. */
+static int64_t old_pos = 0;							/**< @brief Global variable used to hold the offset of the old Firmware Image from which the next Diff byte will be applied. */
+static uint32_t new_pos = 0U;						/**< @brief Global variable used to indicate the number of bytes of the new Firmware Image that have been written so far. */
+
+/**@brief	Gathers the bytes of a fixed-size field of the binary patch (i.e., its header or a Control Entry).
+ *
+ * @param[in, out] pp_data	Pointer to the pointer towards the next bytes of the binary patch, which will be advanced by
+ *                          the number of bytes that were taken from it.
+ * @param[in, out] p_length	Pointer to the number of bytes towards which \p pp_data points to, which will be decreased
+ *                          by the number of bytes that were taken from it.
+ * @param field_size		Length in bytes of the field that is being gathered.
+ *
+ * @return	\c true if the whole field is now held in @ref Field_Buffer , or otherwise \c false .
+ */
+static bool bspatch_gather_field(uint8_t **pp_data, uint32_t *p_length, uint8_t field_size);
+
+/**@brief	Applies some of the Diff bytes of the current Control Entry.
+ *
+ * @param[in] p_data	Pointer to the Diff bytes to be applied, or \c NULL to copy the old bytes as they are.
+ * @param length		Number of Diff bytes to be applied, which must not be greater than @ref diff_left .
+ *
+ * @retval	BSPATCH_EC_OK
+ * @retval	BSPATCH_EC_ERR
+ */
+static BsPatch_Status bspatch_apply_diff(uint8_t *p_data, uint32_t length);
+
+/**@brief	Moves on to the part of the binary patch that is expected next, according to the bytes of the current
+ *          Control Entry that are still pending to be applied.
+ *
+ * @details	Whenever the current Control Entry has been fully applied, its Seek value is added to @ref old_pos .
+ */
+static void bspatch_advance(void);
+
+void bspatch_init(const bspatch_io_t *p_io)
+{
+	p_bspatch_io = p_io;
+	bspatch_state = BSPATCH_STATE_HEADER;
+	field_len = 0U;
+	diff_left = 0U;
+	extra_left = 0U;
+	is_copy = false;
+	seek = 0;
+	old_pos = 0;
+	new_pos = 0U;
+}
+
+BsPatch_Status bspatch_feed(uint8_t *p_data, uint32_t length)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsPatch_Status function type. */
+	BsPatch_Status ret = BSPATCH_EC_OK;
+	/** <b>Local variable n:</b> Number of bytes of the binary patch that are applied in the current step. */
+	uint32_t n;
+
+	while ((length > 0U) && (ret == BSPATCH_EC_OK))
+	{
+		switch (bspatch_state)
+		{
+			case BSPATCH_STATE_HEADER:
+				if (!bspatch_gather_field(&p_data, &length, BSPATCH_HEADER_SIZE))
+				{
+					break;
+				}
+				memcpy(&bspatch_header, Field_Buffer, BSPATCH_HEADER_SIZE);
+				if (bspatch_header.magic != BSPATCH_MAGIC)
+				{
+					ret = BSPATCH_EC_ERR;
+					break;
+				}
+				ret = p_bspatch_io->check_header(&bspatch_header);
+				bspatch_state = (bspatch_header.new_size == 0U) ? BSPATCH_STATE_DONE : BSPATCH_STATE_CTRL;
+				break;
+
+			case BSPATCH_STATE_CTRL:
+				if (!bspatch_gather_field(&p_data, &length, BSPATCH_CTRL_SIZE))
+				{
+					break;
+				}
+				memcpy(&diff_left, &Field_Buffer[0], sizeof(diff_left));
+				memcpy(&extra_left, &Field_Buffer[4], sizeof(extra_left));
+				memcpy(&seek, &Field_Buffer[8], sizeof(seek));
+				is_copy = ((diff_left & BSPATCH_CTRL_COPY_FLAG) != 0U);
+				diff_left &= ~BSPATCH_CTRL_COPY_FLAG;
+
+				/* Validate that the Control Entry does not go beyond the new Firmware Image. */
+				if ((diff_left > (bspatch_header.new_size - new_pos)) || (extra_left > (bspatch_header.new_size - new_pos - diff_left)))
+				{
+					ret = BSPATCH_EC_ERR;
+					break;
+				}
+
+				/* The old bytes of a Copy Control Entry are copied right away, since no Diff bytes will follow. */
+				if (is_copy)
+				{
+					ret = bspatch_apply_diff(NULL, diff_left);
+				}
+				bspatch_advance();
+				break;
+
+			case BSPATCH_STATE_DIFF:
+				n = (length < diff_left) ? length : diff_left;
+				ret = bspatch_apply_diff(p_data, n);
+				p_data += n;
+				length -= n;
+				bspatch_advance();
+				break;
+
+			case BSPATCH_STATE_EXTRA:
+				/* Copy the Extra bytes as they are, in pieces that fit in the length parameter of the write callback. */
+				n = (length < extra_left) ? length : extra_left;
+				n = (n > UINT16_MAX) ? UINT16_MAX : n;
+				ret = p_bspatch_io->write_new(p_data, n);
+				p_data += n;
+				length -= n;
+				extra_left -= n;
+				new_pos += n;
+				bspatch_advance();
+				break;
+
+			case BSPATCH_STATE_DONE:
+				/* The remaining bytes are just padding. */
+				length = 0U;
+				break;
+
+			default:
+				ret = BSPATCH_EC_ERR;
+				break;
+		}
+	}
+
+	if (ret != BSPATCH_EC_OK)
+	{
+		bspatch_state = BSPATCH_STATE_FAILED;
+	}
+
+	return ret;
+}
+
+bool bspatch_is_done(void)
+{
+	return bspatch_state == BSPATCH_STATE_DONE;
+}
+
+static bool bspatch_gather_field(uint8_t **pp_data, uint32_t *p_length, uint8_t field_size)
+{
+	/** <b>Local variable n:</b> Number of bytes of the field that are taken from the given data. */
+	uint32_t n = field_size - field_len;
+
+	if (n > *p_length)
+	{
+		n = *p_length;
+	}
+	memcpy(&Field_Buffer[field_len], *pp_data, n);
+	field_len += n;
+	*pp_data += n;
+	*p_length -= n;
+	if (field_len < field_size)
+	{
+		return false;
+	}
+	field_len = 0U;
+
+	return true;
+}
+
+static void bspatch_advance(void)
+{
+	if (diff_left > 0U)
+	{
+		bspatch_state = BSPATCH_STATE_DIFF;
+	}
+	else if (extra_left > 0U)
+	{
+		bspatch_state = BSPATCH_STATE_EXTRA;
+	}
+	else
+	{
+		/* The Control Entry has been fully applied, so move the old offset by its Seek value. */
+		old_pos += seek;
+		seek = 0;
+		bspatch_state = (new_pos >= bspatch_header.new_size) ? BSPATCH_STATE_DONE : BSPATCH_STATE_CTRL;
+	}
+}
+
+static BsPatch_Status bspatch_apply_diff(uint8_t *p_data, uint32_t length)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsPatch_Status function type. */
+	BsPatch_Status ret;
+	/** <b>Local variable chunk:</b> Holds the bytes of the new Firmware Image that are being rebuilt. */
+	uint8_t chunk[BSPATCH_CHUNK_SIZE];
+	/** <b>Local variable n:</b> Number of bytes of the new Firmware Image that are rebuilt in the current chunk. */
+	uint16_t n;
+
+	while (length > 0U)
+	{
+		n = (length > BSPATCH_CHUNK_SIZE) ? BSPATCH_CHUNK_SIZE : length;
+
+		/* Validate that the old bytes to be read are within the old Firmware Image. */
+		if ((old_pos < 0) || ((old_pos + n) > bspatch_header.old_size))
+		{
+			return BSPATCH_EC_ERR;
+		}
+
+		/* Rebuild the chunk by adding the Diff bytes to the old bytes. */
+		ret = p_bspatch_io->read_old((uint32_t) old_pos, chunk, n);
+		if (ret != BSPATCH_EC_OK)
+		{
+			return ret;
+		}
+		if (p_data != NULL)
+		{
+			for (uint16_t i=0; i<n; i++)
+			{
+				chunk[i] += p_data[i];
+			}
+			p_data += n;
+		}
+		ret = p_bspatch_io->write_new(chunk, n);
+		if (ret != BSPATCH_EC_OK)
+		{
+			return ret;
+		}
+
+		length -= n;
+		diff_left -= n;
+		old_pos += n;
+		new_pos += n;
+	}
+
+	return BSPATCH_EC_OK;
+}
+
+/** @} */
@@ -14,7 +14,6 @@
 #define FIRMWARE_UPDATE_CONFIG_END_ADDR_PLUS_ONE	(FIRMWARE_UPDATE_CONFIG_PAGE_2_START_ADDR + FW_UPDT_CONFIG_PAGE_SIZE)             	/**< @brief Flash Memory address at which the start of the first page after the ones designated for the @ref firmware_update_config begins. @details For more information see @ref FIRMWARE_UPDATE_CONFIG_PAGE_2_START_ADDR . */
 #define FLASH_BLOCK_NOT_ERASED  					(0x00)                          			                            			/**< @brief Designated value to indicate that a Firmware Update Configurations block has not been erased via @ref firmware_update_config_flags_t::is_erased . */
 #define FLASH_BLOCK_ERASED              			(0xFF)                          			                            			/**< @brief Designated value to indicate that a Firmware Update Configurations block has been erased via @ref firmware_update_config_flags_t::is_erased . */
-#define DATA_BLOCK_16BIT_ERASED_VALUE				(0xFFFF)									                            			/**< @brief Designated value to indicate that a certain 16-bit field value of the @ref firmware_update_config_data_t structure has either been erased or that there is no data in it. */
 #define FIRMWARE_UPDATE_CONFIG_DATA_SIZE 			(sizeof(firmware_update_config_data_t))		                            			/**< @brief Length in bytes of the @ref firmware_update_config_data_t struct. */
 
 /**@brief	Firmware Update Configurations Flags parameters structure. This contains all the fields needed for the flags
@@ -239,8 +238,6 @@ FirmUpdConf_Status firmware_update_configurations_write(firmware_update_config_d
 
 	/* We pass the received data into a new Data Block structure and we calculate and also set its corresponding 32-bit CRC. */
     memcpy(&new_val_struct.data, p_data, FIRMWARE_UPDATE_CONFIG_DATA_SIZE);
-    new_val_struct.data.reserved1 = DATA_BLOCK_32BIT_ERASED_VALUE; // Make sure to keep reserved data's bits set to 1's.
-    new_val_struct.data.reserved2 = DATA_BLOCK_16BIT_ERASED_VALUE; // Make sure to keep reserved data's bits set to 1's.
     new_val_struct.flags.reserved2 = DATA_BLOCK_16BIT_ERASED_VALUE; // Make sure to keep reserved data's bits set to 1's.
     new_val_struct.flags.reserved1 = DATA_BLOCK_8BIT_ERASED_VALUE; // Make sure to keep reserved data's bits set to 1's.
     new_val_struct.flags.is_erased = FLASH_BLOCK_NOT_ERASED;
@@ -1783,7 +1783,7 @@ static HM10_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 	  case HAL_ERROR:
 		return HM10_EC_ERR;
 	  default:
-		return HAL_status;
+		return (HM10_Status) HAL_status;
     }
 }
 
@@ -0,0 +1,339 @@
+/** @addtogroup rs_decoder
+ * @{
+ */
+
+#include "rs_decoder.h"
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+#include <string.h> // Library from which "memcpy()" is located at.
+
+#define RS_DECODER_GF_ORDER				(255U)			/**< @brief Number of non-zero elements of GF(2^8), which is also the period of the powers of its primitive element. */
+
+/**@brief	Global table holding the powers of the primitive element of GF(2^8) (i.e., \c 2 with the primitive polynomial
+ *          \c 0x11D ), which is repeated twice so that the sum of two logarithms can be looked up without reducing it.
+ */
+static const uint8_t Rs_Gf_Exp[2U*RS_DECODER_GF_ORDER] =
+{
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+	0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+	0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+	0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+	0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+	0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+	0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+	0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+	0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+	0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+	0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+	0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+	0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+	0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+	0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+	0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C,
+	0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+	0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23, 0x46,
+	0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F,
+	0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+	0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2, 0xD9,
+	0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81,
+	0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+	0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54, 0xA8,
+	0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6,
+	0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+	0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41, 0x82,
+	0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51,
+	0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+	0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16, 0x2C,
+	0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E
+};
+
+/**@brief	Global table holding the logarithms, in base of the primitive element of GF(2^8), of its non-zero elements.
+ *
+ * @note	The logarithm of \c 0 is undefined, so its entry is just a placeholder that is never used.
+ */
+static const uint8_t Rs_Gf_Log[RS_DECODER_GF_ORDER + 1U] =
+{
+	0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+	0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+	0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+	0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+	0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+	0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+	0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+	0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+	0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+	0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+	0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+	0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+	0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+	0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+	0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+	0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF
+};
+
+/**@brief	Multiplies two elements of GF(2^8).
+ *
+ * @param a	The first element.
+ * @param b	The second element.
+ *
+ * @return	The product of \p a and \p b .
+ */
+static uint8_t rs_gf_mul(uint8_t a, uint8_t b);
+
+/**@brief	Divides two elements of GF(2^8).
+ *
+ * @param a	The dividend.
+ * @param b	The divisor, which must not be \c 0 .
+ *
+ * @return	The quotient of \p a and \p b .
+ */
+static uint8_t rs_gf_div(uint8_t a, uint8_t b);
+
+/**@brief	Repairs, in place, the corrupted bytes of a single Reed-Solomon codeword.
+ *
+ * @details	The syndromes of the codeword are calculated first, so that a codeword without corrupted bytes is given
+ *          back right away. Otherwise, the error locator polynomial is found with the Berlekamp-Massey algorithm, its
+ *          roots (i.e., the positions of the corrupted bytes) are found with a Chien search and the values of the
+ *          errors are found with the Forney algorithm.
+ *
+ * @param[in, out] p_codeword	Pointer to the codeword, whose first byte is the coefficient of its highest degree.
+ * @param len					Length in bytes of the codeword, including its @ref RS_DECODER_PARITY_SIZE parity bytes.
+ * @param[out] p_repaired		Pointer to where the number of bytes that have been repaired will be written into.
+ *
+ * @retval	RS_DECODER_EC_OK
+ * @retval	RS_DECODER_EC_ERR
+ */
+static RsDecoder_Status rs_decoder_repair_codeword(uint8_t *p_codeword, uint16_t len, uint8_t *p_repaired);
+
+uint16_t rs_decoder_get_codeword_count(uint16_t data_len)
+{
+	return (data_len + RS_DECODER_MAX_DATA_SIZE - 1U) / RS_DECODER_MAX_DATA_SIZE;
+}
+
+uint16_t rs_decoder_get_data_len(uint16_t total_len)
+{
+	/** <b>Local variable count:</b> Number of codewords that a block of data together with its parity bytes of \p total_len bytes must have been split into. */
+	uint16_t count = (total_len + RS_DECODER_BLOCK_SIZE - 1U) / RS_DECODER_BLOCK_SIZE;
+
+	/* Reject the lengths that fall in between the ones that a block of data of \c count codewords can give. */
+	if (total_len <= (count * RS_DECODER_PARITY_SIZE))
+	{
+		return 0U;
+	}
+	if (rs_decoder_get_codeword_count(total_len - count*RS_DECODER_PARITY_SIZE) != count)
+	{
+		return 0U;
+	}
+
+	return total_len - count*RS_DECODER_PARITY_SIZE;
+}
+
+RsDecoder_Status rs_decoder_repair(uint8_t *p_data, uint16_t data_len, uint16_t *p_repaired)
+{
+	/** <b>Local variable count:</b> Number of interleaved codewords into which the block of data is split. */
+	uint16_t count = rs_decoder_get_codeword_count(data_len);
+	/** <b>Local variable codeword:</b> Holds the bytes of the codeword that is currently being repaired, which are scattered across the block of data. */
+	uint8_t codeword[RS_DECODER_BLOCK_SIZE];
+	/** <b>Local variable codeword_data_len:</b> Number of data bytes of the codeword that is currently being repaired. */
+	uint16_t codeword_data_len;
+	/** <b>Local variable repaired:</b> Number of bytes that have been repaired in the codeword that is currently being repaired. */
+	uint8_t repaired;
+
+	*p_repaired = 0U;
+	for (uint16_t j=0; j<count; j++)
+	{
+		/* Gather the data bytes and then the parity bytes of the codeword. */
+		codeword_data_len = (data_len - j + count - 1U) / count;
+		for (uint16_t i=0; i<codeword_data_len; i++)
+		{
+			codeword[i] = p_data[j + i*count];
+		}
+		for (uint16_t i=0; i<RS_DECODER_PARITY_SIZE; i++)
+		{
+			codeword[codeword_data_len + i] = p_data[data_len + j*RS_DECODER_PARITY_SIZE + i];
+		}
+
+		/* Repair the codeword and, if any of its bytes was corrupted, scatter them back into the block of data. */
+		if (rs_decoder_repair_codeword(codeword, codeword_data_len + RS_DECODER_PARITY_SIZE, &repaired) != RS_DECODER_EC_OK)
+		{
+			return RS_DECODER_EC_ERR;
+		}
+		if (repaired == 0U)
+		{
+			continue;
+		}
+		*p_repaired += repaired;
+		for (uint16_t i=0; i<codeword_data_len; i++)
+		{
+			p_data[j + i*count] = codeword[i];
+		}
+		for (uint16_t i=0; i<RS_DECODER_PARITY_SIZE; i++)
+		{
+			p_data[data_len + j*RS_DECODER_PARITY_SIZE + i] = codeword[codeword_data_len + i];
+		}
+	}
+
+	return RS_DECODER_EC_OK;
+}
+
+static uint8_t rs_gf_mul(uint8_t a, uint8_t b)
+{
+	if ((a == 0U) || (b == 0U))
+	{
+		return 0U;
+	}
+	return Rs_Gf_Exp[Rs_Gf_Log[a] + Rs_Gf_Log[b]];
+}
+
+static uint8_t rs_gf_div(uint8_t a, uint8_t b)
+{
+	if (a == 0U)
+	{
+		return 0U;
+	}
+	return Rs_Gf_Exp[Rs_Gf_Log[a] + RS_DECODER_GF_ORDER - Rs_Gf_Log[b]];
+}
+
+static RsDecoder_Status rs_decoder_repair_codeword(uint8_t *p_codeword, uint16_t len, uint8_t *p_repaired)
+{
+	/** <b>Local variable syndromes:</b> Holds the syndromes of the codeword, where the syndrome number \c i is the value of the codeword at the \c i -th power of the primitive element. */
+	uint8_t syndromes[RS_DECODER_PARITY_SIZE];
+	/** <b>Local variable is_corrupted:</b> Flag used to indicate whether any of the syndromes is not zero with a \c true , or otherwise with a \c false . */
+	bool is_corrupted = false;
+	/** <b>Local variable lambda:</b> Holds the coefficients of the error locator polynomial, from the lowest degree up to the highest one. */
+	uint8_t lambda[RS_DECODER_PARITY_SIZE + 1U] = {1U};
+	/** <b>Local variable prev_lambda:</b> Holds the coefficients of the error locator polynomial prior to its latest change in length. */
+	uint8_t prev_lambda[RS_DECODER_PARITY_SIZE + 1U] = {1U};
+	/** <b>Local variable tmp_lambda:</b> Holds a copy of the error locator polynomial while it is being updated. */
+	uint8_t tmp_lambda[RS_DECODER_PARITY_SIZE + 1U];
+	/** <b>Local variable errors:</b> Number of corrupted bytes in the codeword (i.e., the degree of the error locator polynomial). */
+	uint8_t errors = 0U;
+	/** <b>Local variable shift:</b> Number of iterations since the latest change in length of the error locator polynomial. */
+	uint8_t shift = 1U;
+	/** <b>Local variable prev_discrepancy:</b> Discrepancy of the iteration of the latest change in length of the error locator polynomial. */
+	uint8_t prev_discrepancy = 1U;
+	/** <b>Local variable discrepancy:</b> Discrepancy of the current iteration of the Berlekamp-Massey algorithm. */
+	uint8_t discrepancy;
+	/** <b>Local variable omega:</b> Holds the coefficients of the error evaluator polynomial, from the lowest degree up to the highest one. */
+	uint8_t omega[RS_DECODER_PARITY_SIZE];
+	/** <b>Local variable positions:</b> Holds the indexes, within the codeword, of the corrupted bytes. */
+	uint8_t positions[RS_DECODER_MAX_ERRORS];
+	/** <b>Local variable found:</b> Number of corrupted bytes whose indexes have been found. */
+	uint8_t found = 0U;
+
+	*p_repaired = 0U;
+
+	/* Calculate the syndromes of the codeword. */
+	for (uint8_t i=0; i<RS_DECODER_PARITY_SIZE; i++)
+	{
+		syndromes[i] = 0U;
+		for (uint16_t k=0; k<len; k++)
+		{
+			syndromes[i] = rs_gf_mul(syndromes[i], Rs_Gf_Exp[i]) ^ p_codeword[k];
+		}
+		is_corrupted |= (syndromes[i] != 0U);
+	}
+	if (!is_corrupted)
+	{
+		return RS_DECODER_EC_OK;
+	}
+
+	/* Find the error locator polynomial with the Berlekamp-Massey algorithm. */
+	for (uint8_t r=0; r<RS_DECODER_PARITY_SIZE; r++)
+	{
+		discrepancy = syndromes[r];
+		for (uint8_t i=1; i<=errors; i++)
+		{
+			discrepancy ^= rs_gf_mul(lambda[i], syndromes[r - i]);
+		}
+		if (discrepancy == 0U)
+		{
+			shift++;
+			continue;
+		}
+		memcpy(tmp_lambda, lambda, sizeof(lambda));
+		for (uint8_t i=0; (i + shift)<=RS_DECODER_PARITY_SIZE; i++)
+		{
+			lambda[i + shift] ^= rs_gf_mul(rs_gf_div(discrepancy, prev_discrepancy), prev_lambda[i]);
+		}
+		if ((2U*errors) <= r)
+		{
+			errors = r + 1U - errors;
+			memcpy(prev_lambda, tmp_lambda, sizeof(prev_lambda));
+			prev_discrepancy = discrepancy;
+			shift = 1U;
+		}
+		else
+		{
+			shift++;
+		}
+	}
+	if (errors > RS_DECODER_MAX_ERRORS)
+	{
+		return RS_DECODER_EC_ERR;
+	}
+
+	/* Find the positions of the corrupted bytes with a Chien search, where the byte at index \c k stands for the power <tt>len-1-k</tt> . */
+	for (uint16_t k=0; k<len; k++)
+	{
+		/** <b>Local variable x_inv:</b> Inverse of the error locator of the byte at index \c k . */
+		uint8_t x_inv = Rs_Gf_Exp[RS_DECODER_GF_ORDER - (len - 1U - k)];
+		/** <b>Local variable value:</b> Value of the error locator polynomial at \c x_inv . */
+		uint8_t value = 0U;
+		for (uint8_t i=errors+1U; i>0U; i--)
+		{
+			value = rs_gf_mul(value, x_inv) ^ lambda[i - 1U];
+		}
+		if (value == 0U)
+		{
+			if (found == errors)
+			{
+				return RS_DECODER_EC_ERR;
+			}
+			positions[found++] = (uint8_t) k;
+		}
+	}
+	if (found != errors)
+	{
+		return RS_DECODER_EC_ERR;
+	}
+
+	/* Calculate the error evaluator polynomial and then correct each corrupted byte with the Forney algorithm. */
+	for (uint8_t i=0; i<RS_DECODER_PARITY_SIZE; i++)
+	{
+		omega[i] = 0U;
+		for (uint8_t j=0; (j<=i) && (j<=errors); j++)
+		{
+			omega[i] ^= rs_gf_mul(syndromes[i - j], lambda[j]);
+		}
+	}
+	for (uint8_t e=0; e<errors; e++)
+	{
+		/** <b>Local variable power:</b> Power of the primitive element that stands for the error locator of the current corrupted byte. */
+		uint8_t power = (uint8_t) (len - 1U - positions[e]);
+		/** <b>Local variable x_inv:</b> Inverse of the error locator of the current corrupted byte. */
+		uint8_t x_inv = Rs_Gf_Exp[RS_DECODER_GF_ORDER - power];
+		/** <b>Local variable numerator:</b> Value of the error evaluator polynomial at \c x_inv . */
+		uint8_t numerator = 0U;
+		/** <b>Local variable denominator:</b> Value of the formal derivative of the error locator polynomial at \c x_inv , whose odd-degree terms are the only ones that are left in GF(2^8). */
+		uint8_t denominator = 0U;
+		for (uint8_t i=RS_DECODER_PARITY_SIZE; i>0U; i--)
+		{
+			numerator = rs_gf_mul(numerator, x_inv) ^ omega[i - 1U];
+		}
+		for (uint8_t i=1; i<=errors; i+=2U)
+		{
+			denominator ^= rs_gf_mul(lambda[i], Rs_Gf_Exp[(RS_DECODER_GF_ORDER - power) * (i - 1U) % RS_DECODER_GF_ORDER]);
+		}
+		if (denominator == 0U)
+		{
+			return RS_DECODER_EC_ERR;
+		}
+		p_codeword[positions[e]] ^= rs_gf_mul(Rs_Gf_Exp[power], rs_gf_div(numerator, denominator));
+	}
+	*p_repaired = errors;
+
+	return RS_DECODER_EC_OK;
+}
+
+/** @} */
@@ -34,13 +34,15 @@
   // ########################################################## //
   // Initializing the HM-10 Bluetooth module.
   int comport = 3; // RS-232 Serial Port with which it is desired that the @ref hm10_ble module communicates with (the HM-10 device has to be connected to this port).
-  uint32_t send_packet_bytes_delay = 1000; // This is the delay in microseconds that the @ref hm10_module will apply before having send a byte of data through the TX of the RS-232 via the Teuniz Library.
+  uint32_t baudrate = 9600; // Baud rate of the RS-232 Serial Port, which is the default one of the HM-10 BT Device.
+  uint8_t bits_per_byte = 10; // Bits that the UART of our host machine shifts out for each byte of data (i.e., 8N1).
+  uint32_t send_packet_bytes_delay = 1000; // This is the additional delay in microseconds that the @ref hm10_module will apply after having send each burst of data through the TX of the RS-232 via the Teuniz Library, on top of the pacing given by the baudrate and bits_per_byte.
   uint32_t teuniz_lib_poll_comport_delay = 500000; // This is the delay in microseconds that the @ref hm10_module will apply each time before calling the @ref RS232_PollComport function of the Teuniz Library.
   uint32_t connect_to_address_timeout = 3000000; // This is the timeout in microseconds that the @ref hm10_module will apply whenever attempting to make a Bluetooth Connection between our end HM-10 BT Device and a desired Remote BT Device.
   uint8_t ret; // Local variable used to hold the exception code values returned by functions of the HM-10 Bluetooth module.
 
   // Initialize the @ref hm10_ble module with the Serial Port of your preference.
-  ret = init_hm10_module(comport, send_packet_bytes_delay, teuniz_lib_poll_comport_delay, connect_to_address_timeout);
+  ret = init_hm10_module(comport, baudrate, bits_per_byte, send_packet_bytes_delay, teuniz_lib_poll_comport_delay, connect_to_address_timeout);
 
   // Making sure to disconnect the HM-10 from a currently on-going Bluetooth Connection
   printf("DEBUG: Running the disconnect_hm10_from_bt_address() function.\r\n");
@@ -226,13 +228,15 @@
   // ############################################################# //
   // Initializing the HM-10 Bluetooth module.
   int comport = 3; // RS-232 Serial Port with which it is desired that the @ref hm10_ble module communicates with (the HM-10 device has to be connected to this port).
-  uint32_t send_packet_bytes_delay = 1000; // This is the delay in microseconds that the @ref hm10_module will apply before having send a byte of data through the TX of the RS-232 via the Teuniz Library.
+  uint32_t baudrate = 9600; // Baud rate of the RS-232 Serial Port, which is the default one of the HM-10 BT Device.
+  uint8_t bits_per_byte = 10; // Bits that the UART of our host machine shifts out for each byte of data (i.e., 8N1).
+  uint32_t send_packet_bytes_delay = 1000; // This is the additional delay in microseconds that the @ref hm10_module will apply after having send each burst of data through the TX of the RS-232 via the Teuniz Library, on top of the pacing given by the baudrate and bits_per_byte.
   uint32_t teuniz_lib_poll_comport_delay = 500000; // This is the delay in microseconds that the @ref hm10_module will apply each time before calling the @ref RS232_PollComport function of the Teuniz Library.
   uint32_t connect_to_address_timeout = 3000000; // This is the timeout in microseconds that the @ref hm10_module will apply whenever attempting to make a Bluetooth Connection between our end HM-10 BT Device and a desired Remote BT Device.
   uint8_t ret; // Local variable used to hold the exception code values returned by functions of the HM-10 Bluetooth module.
 
   // Initialize the @ref hm10_ble module with the Serial Port of your preference.
-  ret = init_hm10_module(comport, send_packet_bytes_delay, teuniz_lib_poll_comport_delay, connect_to_address_timeout);
+  ret = init_hm10_module(comport, baudrate, bits_per_byte, send_packet_bytes_delay, teuniz_lib_poll_comport_delay, connect_to_address_timeout);
 
   // Making sure to disconnect the HM-10 from a currently on-going Bluetooth Connection
   printf("DEBUG: Running the disconnect_hm10_from_bt_address() function.\r\n");
@@ -1064,6 +1068,8 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address();
 /**@brief   Sends one byte of data Over the Air (OTA) via the HM-10 BT Device to whatever other BT Device it is
  *          connected to Point-to-Point, if there is such a connection.
  *
+ * @details This is equivalent to calling @ref send_hm10_ota_data with a single byte of data.
+ *
  * @note    If there is no BT connection between the HM-10 BT Device and any other BT Device, the HM-10 BT Device
  *          will do nothing.
  *
@@ -1080,6 +1086,10 @@ HM10_Status send_hm10_ota_byte_of_data(uint8_t ble_ota_data);
 /**@brief   Sends some desired data Over the Air (OTA) via the HM-10 BT Device to whatever other BT Device it is
  *          connected to Point-to-Point, if there is such a connection.
  *
+ * @details The data is written in bursts of up to @ref HM10_MAX_PACKET_SIZE bytes, where after each burst, this
+ *          function waits for the time that the UART of our host machine takes to shift that burst out at the link
+ *          rate given to @ref init_hm10_module , plus the Delay persisted at @ref teuniz_send_bytes_delay .
+ *
  * @note    If there is no BT connection between the HM-10 BT Device and any other BT Device, the HM-10 BT Device
  *          will do nothing.
  *
@@ -1120,6 +1130,8 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
  * @details This function persists the following data:<br><br>
  *          - The @ref teuniz_rs232_lib_comport Global Variable of the @ref hm10_ble with the Teuniz equivalent Comport
  *            that is specified via the \p comport param.
+ *          - The @ref teuniz_baudrate and @ref teuniz_bits_per_byte Global Variables of the @ref hm10_ble with the
+ *            link rate specified via the \p baudrate and \p bits_per_byte params.
  *          - The @ref teuniz_send_bytes_delay Global Variable of the @ref hm10_ble with the Delay specified via the
  *            \p send_bytes_delay param.
  *          - The @ref teuniz_poll_delay Global Variable of the @ref hm10_ble with the Delay specified via the
@@ -1127,10 +1139,15 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
  *
  * @param comport                       Comport number from which it is desired that the @ref hm10_ble sends/receives
  *                                      data to/from the HM-10 BT Device.
- * @param send_bytes_delay              Delay in microseconds that is desired to request to the @ref hm10_ble to apply
- *                                      before having send a byte of data through the TX of the RS-232 via the Teuniz
- *                                      Library. Note that a suggested value that should work fine for param is 1000
- *                                      microseconds.
+ * @param baudrate                      Baud rate with which the RS-232 communication with the HM-10 BT Device is
+ *                                      made.
+ * @param bits_per_byte                 Number of bits that the UART of our host machine shifts out for each byte of
+ *                                      data, which are given by the Start bit, the Data-bits, the Parity bit (if any)
+ *                                      and the Stop-bit(s) (e.g., 10 for 8N1).
+ * @param send_bytes_delay              Additional delay in microseconds that is desired to request to the
+ *                                      @ref hm10_ble to apply after having send each burst of data through the TX of
+ *                                      the RS-232 via the Teuniz Library, where the bursts are already paced according
+ *                                      to the link rate given by the \p baudrate and \p bits_per_byte params.
  * @param poll_delay                    Delay in microseconds that is desired to request to the @ref hm10_ble to apply
  *                                      each time before calling the @ref RS232_PollComport function of the Teuniz
  *                                      Library. Note that a suggested value that should work fine for param is 500'000
@@ -1143,7 +1160,7 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	December 27, 2023
  */
-HM10_Status init_hm10_module(int comport, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout);
+HM10_Status init_hm10_module(int comport, uint32_t baudrate, uint8_t bits_per_byte, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout);
 
 #endif /* HM10_BLE_DRIVER_H_ */
 
@@ -42,9 +42,12 @@
 #define HM10_OK_RESPONSE_SIZE								(2)        /**< @brief	Length in bytes of a OK Response from the HM-10 BT device. */
 #define HM10_OK_LOST_RESPONSE_SIZE                          (7)        /**< @brief	Length in bytes of a whole OK+LOST Response from the HM-10 BT device. */
 #define HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART      (5)        /**< @brief	Length in bytes of a OK+LOST Response from the HM-10 BT device, but without the OK part. */
+#define HM10_TX_MAX_STALLS                                  (10)       /**< @brief Maximum number of consecutive times that the Serial Port can refuse to take any byte of the data to be sent to the HM-10 BT Device before giving up on sending it. */
 
 static int teuniz_rs232_lib_comport;												                                              /**< @brief Global variable that will hold the converted value of the actual comport that was requested by the user but into its equivalent for the @ref teuniz_rs232_library (For more details, see the Table from @ref teuniz_rs232_library ). */
-static uint32_t teuniz_send_bytes_delay;                                                                                          /**< @brief Global variable that will hold the desired delay value in microseconds that the @ref hm10_ble is to apply before having send a byte of data through the TX of the RS-232 via the Teuniz Library. @note A value that should work fine for this Global Variable is 1000 microseconds. */
+static uint32_t teuniz_baudrate;                                                                                                  /**< @brief Global variable that will hold the Baud rate with which the RS-232 communication with the HM-10 BT Device is made, which is used to pace the data sent to it according to the link rate. */
+static uint8_t teuniz_bits_per_byte;                                                                                              /**< @brief Global variable that will hold the number of bits that the UART of our host machine shifts out for each byte of data sent to the HM-10 BT Device (i.e., the Start bit, the Data-bits, the Parity bit, if any, and the Stop-bit(s)). */
+static uint32_t teuniz_send_bytes_delay;                                                                                          /**< @brief Global variable that will hold the desired delay value in microseconds that the @ref hm10_ble is to apply after having send each burst of data (of up to @ref HM10_MAX_PACKET_SIZE bytes) through the TX of the RS-232 via the Teuniz Library. @note A value that should work fine for this Global Variable is 0 microseconds, since the bursts are already paced according to the link rate. */
 static uint32_t teuniz_poll_delay;                                                                                                /**< @brief Global variable that will hold the desired delay value in microseconds that the @ref hm10_ble is to apply each time before calling the @ref RS232_PollComport function of the Teuniz Library. @note Although the @ref teuniz_rs232_library suggests to place an interval of 100 milliseconds, but it did not worked for me that way. Instead, it worked for me with 500ms. . */
 static uint32_t hm10_connect_to_address_timeout;                                                                                  /**< @brief Global variable that will hold the desired time in microseconds that our host machine will wait for the HM-10 BT device's Connect-To-Address Response after sending a Connect-To-Address Command to it. @note The maximum time that a Bluetooth Connection can be made with an HM-10 BT Device is 11 seconds. */
 static uint8_t TxRx_Buffer[HM10_MAX_AT_COMMAND_SIZE];					                                                          /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received response or a request to be send from/to the HM-10 BT Device. */
@@ -92,7 +95,7 @@ typedef enum
 	Number_9_in_ASCII	= 57U     //!< \f$9_{ASCII} = 57_d\f$.
 } Numbers_in_ASCII;
 
-HM10_Status init_hm10_module(int comport, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout)
+HM10_Status init_hm10_module(int comport, uint32_t baudrate, uint8_t bits_per_byte, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout)
 {
     /* Validate the given comport value. */
     #if ETX_OTA_VERBOSE
@@ -112,6 +115,17 @@ HM10_Status init_hm10_module(int comport, uint32_t send_bytes_delay, uint32_t po
     /* Persisting the equivalent Teuniz Comport with respect to the requested/given one. */
     teuniz_rs232_lib_comport = comport - 1;
 
+    /* Persisting the link rate with which the data sent to the HM-10 BT Device is to be paced. */
+    if ((baudrate==0) || (bits_per_byte==0))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("The given Baud rate and bits per byte must both be greater than zero.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+    teuniz_baudrate = baudrate;
+    teuniz_bits_per_byte = bits_per_byte;
+
     /* Persisting the equivalent Teuniz Send Bytes Delay with respect to the requested/given one. */
     teuniz_send_bytes_delay = send_bytes_delay;
 
@@ -1711,21 +1725,46 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
 HM10_Status send_hm10_ota_byte_of_data(uint8_t ble_ota_data)
 {
     /* Send the requested byte of data Over the Air (OTA) via the HM-10 BT Device. */
-    if (RS232_SendBuf(teuniz_rs232_lib_comport, &ble_ota_data, 1) != 1)
-    {
-        return HM10_EC_ERR;
-    }
-    usleep(teuniz_send_bytes_delay);
-
-    return HM10_EC_OK;
+    return send_hm10_ota_data(&ble_ota_data, 1);
 }
 
 HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size)
 {
-	/* Send the requested data Over the Air (OTA) via the HM-10 BT Device. */
-    if (RS232_SendBuf(teuniz_rs232_lib_comport, ble_ota_data, size) != size)
-    {
-        return HM10_EC_ERR;
+    /** <b>Local variable sent:</b> Number of bytes of the requested data that have been taken by the Serial Port so far. */
+    uint16_t sent = 0;
+    /** <b>Local variable stalls:</b> Number of consecutive times that the Serial Port did not take any byte of the requested data. */
+    uint8_t stalls = 0;
+    /** <b>Local variable burst:</b> Number of bytes of the requested data that will be written in the current burst. */
+    int burst;
+    /** <b>Local variable n:</b> Number of bytes that the Serial Port actually took from the current burst. */
+    int n;
+
+	/* Send the requested data Over the Air (OTA) via the HM-10 BT Device in bursts of up to the size of a single HM-10 BT Device request. */
+    while (sent < size)
+    {
+        burst = ((size-sent) > HM10_MAX_PACKET_SIZE) ? HM10_MAX_PACKET_SIZE : (size-sent);
+        n = RS232_SendBuf(teuniz_rs232_lib_comport, &ble_ota_data[sent], burst);
+        if (n < 0)
+        {
+            return HM10_EC_ERR;
+        }
+        if (n == 0)
+        {
+            /* The output buffer of the Serial Port is full, so wait for the time that one burst takes to be shifted out before trying again. */
+            if (++stalls > HM10_TX_MAX_STALLS)
+            {
+                return HM10_EC_ERR;
+            }
+            n = burst;
+        }
+        else
+        {
+            stalls = 0;
+            sent += n;
+        }
+
+        /* Pace the next burst according to the time that the current one takes to be transmitted at the link rate. */
+        usleep((uint32_t) (((uint64_t) n * teuniz_bits_per_byte * 1000000 + teuniz_baudrate - 1) / teuniz_baudrate) + teuniz_send_bytes_delay);
     }
 
 	return HM10_EC_OK;
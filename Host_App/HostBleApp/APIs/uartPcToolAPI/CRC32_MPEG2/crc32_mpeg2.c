@@ -0,0 +1,273 @@
+/** @addtogroup crc32_mpeg2
+ * @{
+ */
+
+#include "crc32_mpeg2.h"
+#include <stddef.h> // Library from which the "NULL" definition is located at.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h> // Library from which the SSSE3 and PCLMULQDQ intrinsics are located at.
+#define CRC32_MPEG2_IS_PCLMUL_BUILD     (1)             /**< @brief Flag used to indicate that the PCLMULQDQ folding engine is compiled with a \c 1 , which is only possible with GCC-compatible compilers for x86 CPUs. */
+#else
+#define CRC32_MPEG2_IS_PCLMUL_BUILD     (0)             /**< @brief Flag used to indicate that the PCLMULQDQ folding engine is compiled with a \c 1 , which is only possible with GCC-compatible compilers for x86 CPUs. */
+#endif
+
+#define CRC32_MPEG2_POLYNOMIAL          (0x04C11DB7)    /**< @brief Generator polynomial of the 32-bit CRC (MPEG-2), without its x^32 term. */
+#define CRC32_MPEG2_PCLMUL_MIN_LENGTH   (128U)          /**< @brief Minimum length in bytes of the data for which the PCLMULQDQ folding engine is used, since the Slicing-by-8 engine is faster on shorter data. */
+
+static const uint32_t crc_table[0x100] = {
+        0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005, 0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+        0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75, 0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+        0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5, 0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+        0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95, 0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+        0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072, 0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+        0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02, 0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+        0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692, 0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+        0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2, 0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+        0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB, 0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+        0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B, 0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+        0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B, 0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+        0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B, 0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+        0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C, 0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+        0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC, 0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+        0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C, 0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+        0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C, 0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+};												/**< @brief Global 32-bit CRC (MPEG-2) Lookup Table. */
+static uint32_t crc_slice_table[8][0x100];      /**< @brief Slicing-by-8 Lookup Tables, where the first one is @ref crc_table and where each of the next ones advances the entries of the previous one by one more byte of zeros. */
+static uint64_t crc_pclmul_fold_512[2];         /**< @brief Constants with which the PCLMULQDQ folding engine folds each 128-bit lane over the next 512 bits of data, which are x^576 mod P and x^512 mod P respectively. */
+static uint64_t crc_pclmul_fold_128[2];         /**< @brief Constants with which the PCLMULQDQ folding engine folds a 128-bit lane over the next 128 bits of data, which are x^192 mod P and x^128 mod P respectively. */
+static uint32_t (*crc_engine)(uint32_t, const uint8_t *, uint32_t) = NULL;      /**< @brief Engine that has been chosen to calculate the 32-bit CRCs with, or \c NULL if none has been chosen yet. */
+static const char *crc_engine_name = NULL;      /**< @brief Name of the engine that has been chosen to calculate the 32-bit CRCs with. */
+
+/**@brief   Multiplies two polynomials in GF(2) modulo the generator polynomial of the 32-bit CRC (MPEG-2).
+ *
+ * @param a The first polynomial, whose most significant bit stands for the x^31 coefficient.
+ * @param b The second polynomial, whose most significant bit stands for the x^31 coefficient.
+ *
+ * @return  The product of \p a and \p b modulo the generator polynomial.
+ */
+static uint32_t gf2_multiply_mod(uint32_t a, uint32_t b);
+
+/**@brief   Calculates x^n modulo the generator polynomial of the 32-bit CRC (MPEG-2).
+ *
+ * @param n The exponent of x.
+ *
+ * @return  x^n modulo the generator polynomial.
+ */
+static uint32_t gf2_x_pow_mod(uint64_t n);
+
+/**@brief   Generates the Lookup Tables and constants of the engines and chooses the fastest engine that the CPU of our
+ *          host machine supports.
+ */
+static void crc32_mpeg2_init(void);
+
+/**@brief   Slicing-by-8 engine, which continues the calculation of a 32-bit CRC over some more data.
+ *
+ * @param checksum      The 32-bit CRC of all the bytes that preceded the ones at \p p_data .
+ * @param[in] p_data    Pointer to the data with which it is desired to continue calculating the 32-bit CRC.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The calculated 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+static uint32_t crc32_mpeg2_slice_by_8(uint32_t checksum, const uint8_t *p_data, uint32_t data_length);
+
+#if CRC32_MPEG2_IS_PCLMUL_BUILD
+/**@brief   PCLMULQDQ folding engine, which continues the calculation of a 32-bit CRC over some more data.
+ *
+ * @details The data is folded 64 bytes at a time into four 128-bit lanes via carry-less multiplications, which are
+ *          then folded into a single 128-bit lane whose 32-bit CRC, together with the one of the remaining bytes, is
+ *          calculated with @ref crc32_mpeg2_slice_by_8 .
+ *
+ * @param checksum      The 32-bit CRC of all the bytes that preceded the ones at \p p_data .
+ * @param[in] p_data    Pointer to the data with which it is desired to continue calculating the 32-bit CRC.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The calculated 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+static uint32_t crc32_mpeg2_pclmul(uint32_t checksum, const uint8_t *p_data, uint32_t data_length);
+#endif
+
+static uint32_t gf2_multiply_mod(uint32_t a, uint32_t b)
+{
+    /** <b>Local variable product:</b> Accumulates the product of \p a and \p b via the Horner's method. */
+    uint32_t product = 0;
+
+    for (int i=31; i>=0; i--)
+    {
+        product = (product << 1) ^ ((product & 0x80000000) ? CRC32_MPEG2_POLYNOMIAL : 0);
+        if ((a >> i) & 1)
+        {
+            product ^= b;
+        }
+    }
+    return product;
+}
+
+static uint32_t gf2_x_pow_mod(uint64_t n)
+{
+    /** <b>Local variable result:</b> Accumulates x^n modulo the generator polynomial, starting from x^0. */
+    uint32_t result = 1;
+    /** <b>Local variable base:</b> Holds x^(2^i) modulo the generator polynomial for the i-th bit of \p n , starting from x^1. */
+    uint32_t base = 2;
+
+    while (n > 0)
+    {
+        if (n & 1)
+        {
+            result = gf2_multiply_mod(result, base);
+        }
+        base = gf2_multiply_mod(base, base);
+        n >>= 1;
+    }
+    return result;
+}
+
+static void crc32_mpeg2_init(void)
+{
+    /* Generate the Slicing-by-8 Lookup Tables. */
+    for (int i=0; i<0x100; i++)
+    {
+        crc_slice_table[0][i] = crc_table[i];
+    }
+    for (int k=1; k<8; k++)
+    {
+        for (int i=0; i<0x100; i++)
+        {
+            crc_slice_table[k][i] = (crc_slice_table[k-1][i] << 8) ^ crc_table[crc_slice_table[k-1][i] >> 24];
+        }
+    }
+
+    /* Choose the fastest engine that the CPU of our host machine supports. */
+    crc_engine_name = "slice-by-8";
+    #if CRC32_MPEG2_IS_PCLMUL_BUILD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3"))
+    {
+        crc_pclmul_fold_512[0] = gf2_x_pow_mod(512 + 64);
+        crc_pclmul_fold_512[1] = gf2_x_pow_mod(512);
+        crc_pclmul_fold_128[0] = gf2_x_pow_mod(128 + 64);
+        crc_pclmul_fold_128[1] = gf2_x_pow_mod(128);
+        crc_engine_name = "pclmul";
+        crc_engine = crc32_mpeg2_pclmul;
+        return;
+    }
+    #endif
+    crc_engine = crc32_mpeg2_slice_by_8;
+}
+
+static uint32_t crc32_mpeg2_slice_by_8(uint32_t checksum, const uint8_t *p_data, uint32_t data_length)
+{
+    /* Apply the 32-bit CRC Hash Function to 8 bytes at a time. */
+    while (data_length >= 8)
+    {
+        checksum ^= ((uint32_t) p_data[0] << 24) | ((uint32_t) p_data[1] << 16) | ((uint32_t) p_data[2] << 8) | p_data[3];
+        checksum = crc_slice_table[7][checksum >> 24] ^ crc_slice_table[6][(checksum >> 16) & 0xFF] ^
+                   crc_slice_table[5][(checksum >> 8) & 0xFF] ^ crc_slice_table[4][checksum & 0xFF] ^
+                   crc_slice_table[3][p_data[4]] ^ crc_slice_table[2][p_data[5]] ^
+                   crc_slice_table[1][p_data[6]] ^ crc_slice_table[0][p_data[7]];
+        p_data += 8;
+        data_length -= 8;
+    }
+
+    /* Apply the 32-bit CRC Hash Function to the remaining bytes one at a time. */
+    for (uint32_t i=0; i<data_length; i++)
+    {
+        checksum = (checksum << 8) ^ crc_table[(uint8_t) (checksum >> 24) ^ p_data[i]];
+    }
+    return checksum;
+}
+
+#if CRC32_MPEG2_IS_PCLMUL_BUILD
+__attribute__((target("pclmul,ssse3")))
+static uint32_t crc32_mpeg2_pclmul(uint32_t checksum, const uint8_t *p_data, uint32_t data_length)
+{
+    /** <b>Local variable byte_reverse:</b> Shuffle mask that reverses the order of the 16 bytes of a 128-bit lane, such that each bit of the lane stands for the coefficient of its polynomial with the same degree. */
+    const __m128i byte_reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    /** <b>Local variable fold_512:</b> Constants for folding a 128-bit lane over the next 512 bits of data. */
+    const __m128i fold_512 = _mm_set_epi64x(crc_pclmul_fold_512[0], crc_pclmul_fold_512[1]);
+    /** <b>Local variable fold_128:</b> Constants for folding a 128-bit lane over the next 128 bits of data. */
+    const __m128i fold_128 = _mm_set_epi64x(crc_pclmul_fold_128[0], crc_pclmul_fold_128[1]);
+    /** <b>Local variable lane:</b> The four 128-bit lanes into which the data is folded. */
+    __m128i lane[4];
+    /** <b>Local variable folded:</b> Holds the 128-bit lane that results from folding the four lanes into a single one. */
+    __m128i folded;
+    /** <b>Local variable bytes:</b> Holds the bytes of the folded 128-bit lane in the order in which they are to be given to @ref crc32_mpeg2_slice_by_8 . */
+    uint8_t bytes[16];
+
+    if (data_length < CRC32_MPEG2_PCLMUL_MIN_LENGTH)
+    {
+        return crc32_mpeg2_slice_by_8(checksum, p_data, data_length);
+    }
+
+    /* Load the first 64 bytes into the four lanes, where the current checksum is added into the first 32 bits of data. */
+    for (int i=0; i<4; i++)
+    {
+        lane[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) &p_data[16*i]), byte_reverse);
+    }
+    lane[0] = _mm_xor_si128(lane[0], _mm_set_epi32((int) checksum, 0, 0, 0));
+    p_data += 64;
+    data_length -= 64;
+
+    /* Fold each lane over the next 512 bits of data. */
+    while (data_length >= 64)
+    {
+        for (int i=0; i<4; i++)
+        {
+            lane[i] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane[i], fold_512, 0x11), _mm_clmulepi64_si128(lane[i], fold_512, 0x00)),
+                                    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) &p_data[16*i]), byte_reverse));
+        }
+        p_data += 64;
+        data_length -= 64;
+    }
+
+    /* Fold the four lanes into a single one, and then fold it over the next remaining blocks of 128 bits of data. */
+    folded = lane[0];
+    for (int i=1; i<4; i++)
+    {
+        folded = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(folded, fold_128, 0x11), _mm_clmulepi64_si128(folded, fold_128, 0x00)), lane[i]);
+    }
+    while (data_length >= 16)
+    {
+        folded = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(folded, fold_128, 0x11), _mm_clmulepi64_si128(folded, fold_128, 0x00)),
+                               _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) p_data), byte_reverse));
+        p_data += 16;
+        data_length -= 16;
+    }
+
+    /* Reduce the folded lane, which is congruent with all the data folded so far, and then the remaining bytes. */
+    _mm_storeu_si128((__m128i *) bytes, _mm_shuffle_epi8(folded, byte_reverse));
+    checksum = crc32_mpeg2_slice_by_8(0, bytes, sizeof(bytes));
+    return crc32_mpeg2_slice_by_8(checksum, p_data, data_length);
+}
+#endif
+
+uint32_t crc32_mpeg2(const uint8_t *p_data, uint32_t data_length)
+{
+    return crc32_mpeg2_update(CRC32_MPEG2_INIT_VALUE, p_data, data_length);
+}
+
+uint32_t crc32_mpeg2_update(uint32_t checksum, const uint8_t *p_data, uint32_t data_length)
+{
+    if (crc_engine == NULL)
+    {
+        crc32_mpeg2_init();
+    }
+    return crc_engine(checksum, p_data, data_length);
+}
+
+uint32_t crc32_mpeg2_combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
+{
+    /* Since this 32-bit CRC has no final XOR, continuing the one of the first block over the second block equals
+       shifting the difference between it and the initial value across the second block, plus the CRC of that block. */
+    return gf2_multiply_mod(crc1 ^ CRC32_MPEG2_INIT_VALUE, gf2_x_pow_mod(8 * (uint64_t) len2)) ^ crc2;
+}
+
+const char *crc32_mpeg2_engine(void)
+{
+    if (crc_engine == NULL)
+    {
+        crc32_mpeg2_init();
+    }
+    return crc_engine_name;
+}
+
+/** @} */
@@ -34,6 +34,10 @@
 #define PAYLOAD_PATH_OR_DATA_MAX_SIZE        (20*1024)          /**< @brief Designated maximum File Path length in bytes for the Payload that the user wants the @ref etx_ota_protocol_host program to send to the external device with which the Serial Port communication has been established with. */
 #endif
 
+#ifndef ETX_OTA_TX_BURST_SIZE
+#define ETX_OTA_TX_BURST_SIZE                (64)               /**< @brief Designated maximum number of bytes of a certain ETX OTA Packet that the host will write at once into the Serial Port, after which the host waits for the time that those bytes take to be transmitted at the link rate requested via the API before writing the next burst. */
+#endif
+
 #endif /* ETX_OTA_CONFIG_H_ */
 
 /** @} */
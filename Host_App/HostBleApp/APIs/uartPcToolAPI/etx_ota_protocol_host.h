@@ -131,7 +131,7 @@ typedef enum
     RS232_MODE_PARITY                   = 10U,   //!< Command Line Argument Index 10, which should contain the Parity with which we want the host to run the RS232 protocol.
     RS232_MODE_STOPBITS                 = 11U,   //!< Command Line Argument Index 11, which should contain the Stop-bits with which we want the host to run the RS232 protocol.
     RS232_IS_FLOW_CONTROL               = 12U,   //!< Command Line Argument Index 12, which should contain the Flag value to indicate whether we want the host to run the RS232 protocol with Flow Control with a \c "1" or otherwise with a \c "0" .
-    SEND_PACKET_BYTES_DELAY             = 13U,   //!< Command Line Argument Index 13, which should contain the desired delay in microseconds to be requested after having send a byte of data from a certain ETX OTA Packet that is in process of being sent to the slave device.
+    SEND_PACKET_BYTES_DELAY             = 13U,   //!< Command Line Argument Index 13, which should contain the desired additional delay in microseconds to be requested after having send each burst of bytes from a certain ETX OTA Packet that is in process of being sent to the slave device, where the pacing between those bursts is already given by the link rate.
     TEUNIZ_LIB_POLL_COMPORT_DELAY       = 14U,   //!< Command Line Argument Index 14, which should contain the desired delay in microseconds that is to be requested to apply each time before calling the @ref RS232_PollComport function.
     TRY_AGAIN_SENDING_FWI_DELAY         = 15U    //!< Command Line Argument Index 15, which should contain the desired delay in microseconds that it is to be requested to apply in case that starting an ETX OTA Transaction fails once only.
 } Command_Line_Arguments;
@@ -162,7 +162,7 @@ typedef struct {
     int comport;		                                       //!< The actual comport that wants to be used for the RS232 protocol to connect to a desired external device.
     ETX_OTA_Payload_t ETX_OTA_Payload_Type;			           //!< The Payload Type that the API received.
     uint32_t rs232_baudrate;                                   //!< Chosen Baudrate with which we want the host to run the RS232 protocol.
-    uint32_t send_packet_bytes_delay;                          //!< Delay in microseconds that is desired to request before having send a byte of data from a certain ETX OTA Packet that is in process of being sent to the MCU.
+    uint32_t send_packet_bytes_delay;                          //!< Additional delay in microseconds that is desired to request after having send each burst of bytes (see @ref ETX_OTA_TX_BURST_SIZE ) from a certain ETX OTA Packet that is in process of being sent to the MCU. @note The pacing between bursts is already given by the link rate, so this delay is only needed whenever the MCU cannot keep up with the link rate (e.g., if it has its verbose mode enabled).
     uint32_t teuniz_lib_poll_comport_delay;                    //!< Delay in microseconds that it is to be requested to apply each time before calling the @ref RS232_PollComport function. @details For all the calls to the @ref RS232_PollComport function, this definition is called once, except in the @ref send_etx_ota_data function, where this definition is called twice.  @note The @ref teuniz_rs232_library suggests to place an interval of 100 milliseconds, but it did not worked for me that way. Instead, it worked for me with 500ms.
     uint32_t try_again_sending_fwi_delay;                      //!< Delay in microseconds that it is to be requested to apply in case that starting an ETX OTA Transaction fails once only. @note The slave device sometimes does not get the start of an ETX OTA Transaction after its UART Timeout expires, which is expected since there is some code in the loop that the slave device has there that makes it do something else before waiting again for an ETX OTA Transaction, but that should be evaded by making a second attempt with the delay established in this variable.
     uint32_t payload_size;                                     //!< Length in bytes of specifically an ETX OTA Custom Data Payload. @note This field can have any value whenever not receiving an ETX OTA Custom Data Payload since the program will ignore this value in that case.
@@ -0,0 +1,652 @@
+/** @addtogroup bsdiff
+ * @{
+ */
+
+#include "bsdiff.h"
+#include "../CRC32_MPEG2/crc32_mpeg2.h" // Custom library that contains the 32-bit CRC (MPEG-2) with which the old Firmware Image is identified.
+#include <stdlib.h> // Library from which "malloc()", "realloc()" and "free()" are located at.
+#include <string.h> // Library from which "memcmp()" and "memset()" are located at.
+
+#define BSDIFF_MIN_MATCH_GAIN   (8)     /**< @brief Number of bytes by which a new exact match must beat the approximate match that is currently being extended in order for the bsdiff algorithm to start a new Control Entry at it. */
+#define BSDIFF_CTRL_COPY_FLAG   (0x80000000U)   /**< @brief Bit of the Diff Length of a Control Entry that indicates that its Diff bytes are all zeros and that they are therefore not sent. */
+#define BSDIFF_MIN_COPY_LEN     (32U)   /**< @brief Minimum number of consecutive Diff bytes that must be zeros in order to send them as a Copy Control Entry, which costs an extra Control Entry. */
+#define BSDIFF_MAX_COPY_LEN     (8192U) /**< @brief Maximum number of bytes rebuilt by a single Copy Control Entry, which bounds the Flash Memory work that the MCU/MPU does for a single ETX OTA Data Type Packet. */
+
+/**@brief	Binary patch buffer parameters structure.
+ *
+ * @details	This structure contains the binary patch that is being generated and the Control Entry that is still
+ *          pending to be written into it.
+ */
+typedef struct
+{
+    const uint8_t *p_old;   //!< Pointer to the old Firmware Image.
+    const uint8_t *p_new;   //!< Pointer to the new Firmware Image.
+    uint8_t *p_patch;       //!< Pointer to the binary patch that is being generated.
+    uint32_t patch_len;     //!< Number of bytes that have been written into @ref p_patch so far.
+    uint32_t patch_cap;     //!< Number of bytes that have been allocated for @ref p_patch .
+    int64_t old_cursor;     //!< Offset of the old Firmware Image at which the MCU/MPU will be when applying the pending Control Entry.
+    uint32_t diff_n;        //!< Offset of the new Firmware Image at which the pending Control Entry starts.
+    uint32_t diff_len;      //!< Diff Length of the pending Control Entry.
+    int is_copy;            //!< Indicates whether the pending Control Entry has its Copy flag set with a \c 1 , or otherwise with a \c 0 .
+    uint32_t extra_len;     //!< Extra Length of the pending Control Entry.
+} bsdiff_patch_t;
+
+/**@brief	Sorts a bucket of the suffix array by the next \p h characters of its suffixes, as in the Larsson-Sadakane
+ *          algorithm.
+ *
+ * @param[in, out] I    Suffix array being sorted.
+ * @param[in, out] V    Inverse suffix array (i.e., the group number of each suffix).
+ * @param start         Index of @p I at which the bucket starts.
+ * @param len           Number of suffixes in the bucket.
+ * @param h             Number of characters by which the suffixes are already sorted.
+ */
+static void bsdiff_split(int32_t *I, int32_t *V, int32_t start, int32_t len, int32_t h);
+
+/**@brief	Builds the suffix array of the old Firmware Image with the Larsson-Sadakane algorithm.
+ *
+ * @param[out] I        Suffix array, which must have room for \p old_size + 1 entries.
+ * @param[out] V        Work array, which must have room for \p old_size + 1 entries.
+ * @param[in] p_old     Pointer to the old Firmware Image.
+ * @param old_size      Length in bytes of the old Firmware Image.
+ */
+static void bsdiff_qsufsort(int32_t *I, int32_t *V, const uint8_t *p_old, int32_t old_size);
+
+/**@brief	Searches the longest exact match of some bytes of the new Firmware Image in the old one.
+ *
+ * @param[in] I         Suffix array of the old Firmware Image.
+ * @param[in] p_old     Pointer to the old Firmware Image.
+ * @param old_size      Length in bytes of the old Firmware Image.
+ * @param[in] p_new     Pointer to the bytes of the new Firmware Image to be searched.
+ * @param new_size      Number of bytes towards which \p p_new points to.
+ * @param[out] p_pos    Pointer to where the offset of the old Firmware Image at which the match starts will be
+ *                      written into.
+ *
+ * @return	The length in bytes of the match.
+ */
+static int32_t bsdiff_search(const int32_t *I, const uint8_t *p_old, int32_t old_size, const uint8_t *p_new,
+                             int32_t new_size, int32_t *p_pos);
+
+/**@brief	Appends some bytes to the binary patch that is being generated, growing its buffer whenever needed.
+ *
+ * @param[in, out] p_patch  Pointer to the binary patch that is being generated.
+ * @param[in] p_data        Pointer to the bytes to be appended, or \c NULL to just reserve them.
+ * @param length            Number of bytes to be appended.
+ *
+ * @return  Pointer to where the appended bytes are within the binary patch, or \c NULL if it ran out of memory.
+ */
+static uint8_t *bsdiff_append(bsdiff_patch_t *p_patch, const uint8_t *p_data, uint32_t length);
+
+/**@brief	Writes the pending Control Entry, followed by its Diff and Extra bytes, into the binary patch.
+ *
+ * @param[in, out] p_patch  Pointer to the binary patch that is being generated.
+ * @param next_old          Offset of the old Firmware Image from which the next Control Entry will read, which
+ *                          determines the Seek value of the pending one.
+ *
+ * @retval	BSDIFF_EC_OK
+ * @retval	BSDIFF_EC_ERR
+ */
+static BsDiff_Status bsdiff_flush(bsdiff_patch_t *p_patch, int64_t next_old);
+
+/**@brief	Adds a run of the new Firmware Image that is to be rebuilt from the old one into the binary patch, where
+ *          the bytes that the MCU/MPU could not read from the old Firmware Image anymore are sent literally instead.
+ *
+ * @param[in, out] p_patch  Pointer to the binary patch that is being generated.
+ * @param new_pos           Offset of the new Firmware Image at which the run starts.
+ * @param old_pos           Offset of the old Firmware Image from which the run is rebuilt.
+ * @param length            Length in bytes of the run.
+ * @param page_size         Flash Memory page size in bytes of the MCU/MPU.
+ * @param backlog_pages     Number of already overwritten old Flash Memory pages that the MCU/MPU keeps in RAM.
+ *
+ * @retval	BSDIFF_EC_OK
+ * @retval	BSDIFF_EC_ERR
+ */
+static BsDiff_Status bsdiff_add_diff(bsdiff_patch_t *p_patch, uint32_t new_pos, uint32_t old_pos, uint32_t length,
+                                     uint16_t page_size, uint8_t backlog_pages);
+
+/**@brief	Adds a run of Diff bytes, or of old bytes to be copied as they are, to the pending Control Entry, which is
+ *          written first into the binary patch if the run cannot be appended to it.
+ *
+ * @param[in, out] p_patch  Pointer to the binary patch that is being generated.
+ * @param old_pos           Offset of the old Firmware Image from which the run is rebuilt.
+ * @param length            Length in bytes of the run.
+ * @param is_copy           \c 1 if all the Diff bytes of the run are zeros and are to be sent as a Copy Control Entry,
+ *                          or otherwise \c 0 .
+ *
+ * @retval	BSDIFF_EC_OK
+ * @retval	BSDIFF_EC_ERR
+ */
+static BsDiff_Status bsdiff_add_run(bsdiff_patch_t *p_patch, uint32_t old_pos, uint32_t length, int is_copy);
+
+BsDiff_Status bsdiff_create(const uint8_t *p_old, uint32_t old_size, const uint8_t *p_new, uint32_t new_size,
+                            uint16_t page_size, uint8_t backlog_pages, uint8_t **pp_patch, uint32_t *p_patch_size)
+{
+    /** <b>Local variable patch:</b> Binary patch that is being generated. */
+    bsdiff_patch_t patch = {p_old, p_new, NULL, 0, 0, 0, 0, 0, 0, 0};
+    /** <b>Local variable header:</b> Header of the binary patch. */
+    uint8_t header[BSDIFF_HEADER_SIZE];
+    /** <b>Local variable I:</b> Suffix array of the old Firmware Image. */
+    int32_t *I;
+    /** <b>Local variable V:</b> Work array of the suffix sorting. */
+    int32_t *V;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsDiff_Status function type. */
+    BsDiff_Status ret = BSDIFF_EC_OK;
+    /* The following are the state variables of the bsdiff algorithm, where "scan" is the offset of the new Firmware Image being matched, "pos" and "len" are the offset and length of the exact match found at it, and the "last" ones describe the approximate match that was last written into the binary patch. */
+    int32_t scan = 0, pos = 0, len = 0, last_scan = 0, last_pos = 0, last_offset = 0, old_score, scsc;
+    int32_t s, sf, lenf, sb, lenb, ss, lens, overlap, i;
+    /** <b>Local variable n_old:</b> Length in bytes of the old Firmware Image, as a signed value. */
+    int32_t n_old = (int32_t) old_size;
+    /** <b>Local variable n_new:</b> Length in bytes of the new Firmware Image, as a signed value. */
+    int32_t n_new = (int32_t) new_size;
+
+    /* Validate the given arguments. */
+    if ((p_old == NULL && old_size > 0) || (p_new == NULL && new_size > 0) || (page_size == 0) || (backlog_pages == 0)
+            || (old_size > INT32_MAX - 1) || (new_size > INT32_MAX - 1) || (pp_patch == NULL) || (p_patch_size == NULL))
+    {
+        return BSDIFF_EC_ERR;
+    }
+
+    /* Sort the suffixes of the old Firmware Image. */
+    I = malloc((old_size + 1) * sizeof(int32_t));
+    V = malloc((old_size + 1) * sizeof(int32_t));
+    if ((I == NULL) || (V == NULL))
+    {
+        free(I);
+        free(V);
+        return BSDIFF_EC_ERR;
+    }
+    bsdiff_qsufsort(I, V, p_old, n_old);
+    free(V);
+
+    /* Write the header of the binary patch, whose fields are all little-endian. */
+    uint32_t header_fields[4] = {BSDIFF_MAGIC, old_size, crc32_mpeg2(p_old, old_size), new_size};
+    for (i=0; i<16; i++)
+    {
+        header[i] = (uint8_t) (header_fields[i/4] >> (8*(i%4)));
+    }
+    header[16] = (uint8_t) page_size;
+    header[17] = (uint8_t) (page_size >> 8);
+    header[18] = backlog_pages;
+    header[19] = 0x00;
+    if (bsdiff_append(&patch, header, BSDIFF_HEADER_SIZE) == NULL)
+    {
+        free(I);
+        return BSDIFF_EC_ERR;
+    }
+
+    /* Find the approximate matches of the new Firmware Image in the old one as in the bsdiff algorithm. */
+    while ((scan < n_new) && (ret == BSDIFF_EC_OK))
+    {
+        old_score = 0;
+        for (scsc = scan += len; scan < n_new; scan++)
+        {
+            len = bsdiff_search(I, p_old, n_old, p_new + scan, n_new - scan, &pos);
+            for (; scsc < scan + len; scsc++)
+            {
+                if ((scsc + last_offset < n_old) && (p_old[scsc + last_offset] == p_new[scsc]))
+                {
+                    old_score++;
+                }
+            }
+            if (((len == old_score) && (len != 0)) || (len > old_score + BSDIFF_MIN_MATCH_GAIN))
+            {
+                break;
+            }
+            if ((scan + last_offset < n_old) && (p_old[scan + last_offset] == p_new[scan]))
+            {
+                old_score--;
+            }
+        }
+        if ((len == old_score) && (scan != n_new))
+        {
+            continue;
+        }
+
+        /* Extend the last approximate match forwards and the new exact match backwards. */
+        s = 0; sf = 0; lenf = 0;
+        for (i=0; (last_scan + i < scan) && (last_pos + i < n_old); )
+        {
+            if (p_old[last_pos + i] == p_new[last_scan + i])
+            {
+                s++;
+            }
+            i++;
+            if (s*2 - i > sf*2 - lenf)
+            {
+                sf = s;
+                lenf = i;
+            }
+        }
+        lenb = 0;
+        if (scan < n_new)
+        {
+            s = 0; sb = 0;
+            for (i=1; (scan >= last_scan + i) && (pos >= i); i++)
+            {
+                if (p_old[pos - i] == p_new[scan - i])
+                {
+                    s++;
+                }
+                if (s*2 - i > sb*2 - lenb)
+                {
+                    sb = s;
+                    lenb = i;
+                }
+            }
+        }
+
+        /* If both extensions overlap, split the overlapping bytes where they match best. */
+        if (last_scan + lenf > scan - lenb)
+        {
+            overlap = (last_scan + lenf) - (scan - lenb);
+            s = 0; ss = 0; lens = 0;
+            for (i=0; i<overlap; i++)
+            {
+                if (p_new[last_scan + lenf - overlap + i] == p_old[last_pos + lenf - overlap + i])
+                {
+                    s++;
+                }
+                if (p_new[scan - lenb + i] == p_old[pos - lenb + i])
+                {
+                    s--;
+                }
+                if (s > ss)
+                {
+                    ss = s;
+                    lens = i + 1;
+                }
+            }
+            lenf += lens - overlap;
+            lenb -= lens;
+        }
+
+        /* Add the extended match as Diff bytes and the bytes up to the new exact match as Extra bytes. */
+        ret = bsdiff_add_diff(&patch, last_scan, last_pos, lenf, page_size, backlog_pages);
+        patch.extra_len += (scan - lenb) - (last_scan + lenf);
+        last_scan = scan - lenb;
+        last_pos = pos - lenb;
+        last_offset = pos - scan;
+    }
+    free(I);
+
+    /* Write the last Control Entry and pad the binary patch with zeros to a multiple of 4 bytes. */
+    if (ret == BSDIFF_EC_OK)
+    {
+        ret = bsdiff_flush(&patch, patch.old_cursor + patch.diff_len);
+    }
+    if ((ret == BSDIFF_EC_OK) && ((patch.patch_len % 4) != 0))
+    {
+        ret = (bsdiff_append(&patch, NULL, 4 - (patch.patch_len % 4)) == NULL) ? BSDIFF_EC_ERR : BSDIFF_EC_OK;
+    }
+    if (ret != BSDIFF_EC_OK)
+    {
+        free(patch.p_patch);
+        return ret;
+    }
+    *pp_patch = patch.p_patch;
+    *p_patch_size = patch.patch_len;
+
+    return BSDIFF_EC_OK;
+}
+
+static void bsdiff_split(int32_t *I, int32_t *V, int32_t start, int32_t len, int32_t h)
+{
+    int32_t i, j, k, x, tmp, jj, kk;
+
+    /* Sort the small buckets by selection. */
+    if (len < 16)
+    {
+        for (k=start; k<start+len; k+=j)
+        {
+            j = 1;
+            x = V[I[k] + h];
+            for (i=1; k+i<start+len; i++)
+            {
+                if (V[I[k+i] + h] < x)
+                {
+                    x = V[I[k+i] + h];
+                    j = 0;
+                }
+                if (V[I[k+i] + h] == x)
+                {
+                    tmp = I[k+j]; I[k+j] = I[k+i]; I[k+i] = tmp;
+                    j++;
+                }
+            }
+            for (i=0; i<j; i++)
+            {
+                V[I[k+i]] = k + j - 1;
+            }
+            if (j == 1)
+            {
+                I[k] = -1;
+            }
+        }
+        return;
+    }
+
+    /* Otherwise, do a three-way partition around the middle suffix and sort both sides. */
+    x = V[I[start + len/2] + h];
+    jj = 0;
+    kk = 0;
+    for (i=start; i<start+len; i++)
+    {
+        if (V[I[i] + h] < x)
+        {
+            jj++;
+        }
+        if (V[I[i] + h] == x)
+        {
+            kk++;
+        }
+    }
+    jj += start;
+    kk += jj;
+    i = start;
+    j = 0;
+    k = 0;
+    while (i < jj)
+    {
+        if (V[I[i] + h] < x)
+        {
+            i++;
+        }
+        else if (V[I[i] + h] == x)
+        {
+            tmp = I[i]; I[i] = I[jj+j]; I[jj+j] = tmp;
+            j++;
+        }
+        else
+        {
+            tmp = I[i]; I[i] = I[kk+k]; I[kk+k] = tmp;
+            k++;
+        }
+    }
+    while (jj + j < kk)
+    {
+        if (V[I[jj+j] + h] == x)
+        {
+            j++;
+        }
+        else
+        {
+            tmp = I[jj+j]; I[jj+j] = I[kk+k]; I[kk+k] = tmp;
+            k++;
+        }
+    }
+    if (jj > start)
+    {
+        bsdiff_split(I, V, start, jj - start, h);
+    }
+    for (i=0; i<kk-jj; i++)
+    {
+        V[I[jj+i]] = kk - 1;
+    }
+    if (jj == kk - 1)
+    {
+        I[jj] = -1;
+    }
+    if (start + len > kk)
+    {
+        bsdiff_split(I, V, kk, start + len - kk, h);
+    }
+}
+
+static void bsdiff_qsufsort(int32_t *I, int32_t *V, const uint8_t *p_old, int32_t old_size)
+{
+    /** <b>Local variable buckets:</b> Index of @p I at which the suffixes that start with each byte value end. */
+    int32_t buckets[256] = {0};
+    int32_t i, h, len;
+
+    /* Sort the suffixes by their first byte. */
+    for (i=0; i<old_size; i++)
+    {
+        buckets[p_old[i]]++;
+    }
+    for (i=1; i<256; i++)
+    {
+        buckets[i] += buckets[i-1];
+    }
+    for (i=255; i>0; i--)
+    {
+        buckets[i] = buckets[i-1];
+    }
+    buckets[0] = 0;
+    for (i=0; i<old_size; i++)
+    {
+        I[++buckets[p_old[i]]] = i;
+    }
+    I[0] = old_size;
+    for (i=0; i<old_size; i++)
+    {
+        V[i] = buckets[p_old[i]];
+    }
+    V[old_size] = 0;
+    for (i=1; i<256; i++)
+    {
+        if (buckets[i] == buckets[i-1] + 1)
+        {
+            I[buckets[i]] = -1;
+        }
+    }
+    I[0] = -1;
+
+    /* Double the number of sorted characters until every suffix is in a bucket of its own. */
+    for (h=1; I[0] != -(old_size + 1); h+=h)
+    {
+        len = 0;
+        for (i=0; i<old_size+1; )
+        {
+            if (I[i] < 0)
+            {
+                len -= I[i];
+                i -= I[i];
+            }
+            else
+            {
+                if (len)
+                {
+                    I[i - len] = -len;
+                }
+                len = V[I[i]] + 1 - i;
+                bsdiff_split(I, V, i, len, h);
+                i += len;
+                len = 0;
+            }
+        }
+        if (len)
+        {
+            I[i - len] = -len;
+        }
+    }
+    for (i=0; i<old_size+1; i++)
+    {
+        I[V[i]] = i;
+    }
+}
+
+static int32_t bsdiff_search(const int32_t *I, const uint8_t *p_old, int32_t old_size, const uint8_t *p_new,
+                             int32_t new_size, int32_t *p_pos)
+{
+    /** <b>Local variable st:</b> Lower index of @p I of the binary search. */
+    int32_t st = 0;
+    /** <b>Local variable en:</b> Upper index of @p I of the binary search. */
+    int32_t en = old_size;
+    int32_t x, y, mid;
+
+    /* Narrow down the suffixes between which the bytes of the new Firmware Image would be sorted. */
+    while (en - st >= 2)
+    {
+        mid = st + (en - st)/2;
+        x = old_size - I[mid];
+        if (memcmp(p_old + I[mid], p_new, (x < new_size) ? x : new_size) < 0)
+        {
+            st = mid;
+        }
+        else
+        {
+            en = mid;
+        }
+    }
+
+    /* The longest match is with either of the two remaining suffixes. */
+    for (x=0; (I[st] + x < old_size) && (x < new_size) && (p_old[I[st] + x] == p_new[x]); x++);
+    for (y=0; (I[en] + y < old_size) && (y < new_size) && (p_old[I[en] + y] == p_new[y]); y++);
+    if (x > y)
+    {
+        *p_pos = I[st];
+        return x;
+    }
+    *p_pos = I[en];
+    return y;
+}
+
+static uint8_t *bsdiff_append(bsdiff_patch_t *p_patch, const uint8_t *p_data, uint32_t length)
+{
+    /** <b>Local variable p_grown:</b> Pointer to the reallocated buffer of the binary patch. */
+    uint8_t *p_grown;
+    /** <b>Local variable p_dst:</b> Pointer to where the appended bytes are within the binary patch. */
+    uint8_t *p_dst;
+
+    if (p_patch->patch_len + length > p_patch->patch_cap)
+    {
+        p_patch->patch_cap = (p_patch->patch_cap < 4096) ? 4096 : p_patch->patch_cap;
+        while (p_patch->patch_len + length > p_patch->patch_cap)
+        {
+            p_patch->patch_cap *= 2;
+        }
+        p_grown = realloc(p_patch->p_patch, p_patch->patch_cap);
+        if (p_grown == NULL)
+        {
+            return NULL;
+        }
+        p_patch->p_patch = p_grown;
+    }
+    p_dst = p_patch->p_patch + p_patch->patch_len;
+    if (p_data != NULL)
+    {
+        memcpy(p_dst, p_data, length);
+    }
+    else
+    {
+        memset(p_dst, 0x00, length);
+    }
+    p_patch->patch_len += length;
+
+    return p_dst;
+}
+
+static BsDiff_Status bsdiff_flush(bsdiff_patch_t *p_patch, int64_t next_old)
+{
+    /** <b>Local variable ctrl:</b> Diff Length, Extra Length and Seek value of the pending Control Entry. */
+    uint32_t ctrl[3] = {p_patch->diff_len | (p_patch->is_copy ? BSDIFF_CTRL_COPY_FLAG : 0), p_patch->extra_len, (uint32_t) (int32_t) (next_old - (p_patch->old_cursor + p_patch->diff_len))};
+    /** <b>Local variable p_dst:</b> Pointer to where the pending Control Entry is being written into. */
+    uint8_t *p_dst;
+
+    /* Nothing is written if the pending Control Entry would not rebuild, nor seek, anything. */
+    if ((ctrl[0] == 0) && (ctrl[1] == 0) && (ctrl[2] == 0))
+    {
+        return BSDIFF_EC_OK;
+    }
+
+    /* Write the Control Entry, followed by its Diff bytes (unless it is a Copy one) and then by its Extra bytes. */
+    p_dst = bsdiff_append(p_patch, NULL, BSDIFF_CTRL_SIZE + (p_patch->is_copy ? 0 : p_patch->diff_len) + p_patch->extra_len);
+    if (p_dst == NULL)
+    {
+        return BSDIFF_EC_ERR;
+    }
+    for (uint32_t i=0; i<BSDIFF_CTRL_SIZE; i++)
+    {
+        *p_dst++ = (uint8_t) (ctrl[i/4] >> (8*(i%4)));
+    }
+    for (uint32_t i=0; (i<p_patch->diff_len) && !p_patch->is_copy; i++)
+    {
+        *p_dst++ = p_patch->p_new[p_patch->diff_n + i] - p_patch->p_old[p_patch->old_cursor + i];
+    }
+    memcpy(p_dst, p_patch->p_new + p_patch->diff_n + p_patch->diff_len, p_patch->extra_len);
+
+    /* Start a new pending Control Entry right where the written one left the MCU/MPU. */
+    p_patch->diff_n += p_patch->diff_len + p_patch->extra_len;
+    p_patch->old_cursor = next_old;
+    p_patch->diff_len = 0;
+    p_patch->is_copy = 0;
+    p_patch->extra_len = 0;
+
+    return BSDIFF_EC_OK;
+}
+
+static BsDiff_Status bsdiff_add_diff(bsdiff_patch_t *p_patch, uint32_t new_pos, uint32_t old_pos, uint32_t length,
+                                     uint16_t page_size, uint8_t backlog_pages)
+{
+    /** <b>Local variable run:</b> Length in bytes of the part of the run, starting at its current byte, that is either entirely readable or entirely unreadable by the MCU/MPU from the old Firmware Image. */
+    uint32_t run;
+    /** <b>Local variable zeros:</b> Number of consecutive Diff bytes that are zeros from the current byte of the run. */
+    uint32_t zeros;
+    /** <b>Local variable is_readable:</b> Indicates whether the current part of the run can be rebuilt from the old Firmware Image with a \c 1 , or otherwise has to be sent literally with a \c 0 . */
+    int is_readable;
+
+    while (length > 0)
+    {
+        /* An old byte can only be read while rebuilding a new Flash Memory page if it is not older than the backlog pages. */
+        is_readable = (old_pos/page_size + backlog_pages >= new_pos/page_size);
+        run = 1;
+        while ((run < length) && (((old_pos + run)/page_size + backlog_pages >= (new_pos + run)/page_size) == is_readable))
+        {
+            run++;
+        }
+
+        if (!is_readable)
+        {
+            p_patch->extra_len += run;
+        }
+        else
+        {
+            /* Send the long enough runs of unchanged bytes as Copy Control Entries and the rest as Diff bytes. */
+            for (uint32_t i=0; i<run; )
+            {
+                for (zeros=0; (i + zeros < run) && (p_patch->p_new[new_pos + i + zeros] == p_patch->p_old[old_pos + i + zeros]); zeros++);
+                if (zeros >= BSDIFF_MIN_COPY_LEN)
+                {
+                    for (uint32_t n; zeros > 0; i+=n, zeros-=n)
+                    {
+                        n = (zeros > BSDIFF_MAX_COPY_LEN) ? BSDIFF_MAX_COPY_LEN : zeros;
+                        if (bsdiff_add_run(p_patch, old_pos + i, n, 1) != BSDIFF_EC_OK)
+                        {
+                            return BSDIFF_EC_ERR;
+                        }
+                    }
+                    continue;
+                }
+                if (bsdiff_add_run(p_patch, old_pos + i, (zeros == 0) ? 1 : zeros, 0) != BSDIFF_EC_OK)
+                {
+                    return BSDIFF_EC_ERR;
+                }
+                i += (zeros == 0) ? 1 : zeros;
+            }
+        }
+        new_pos += run;
+        old_pos += run;
+        length -= run;
+    }
+
+    return BSDIFF_EC_OK;
+}
+
+static BsDiff_Status bsdiff_add_run(bsdiff_patch_t *p_patch, uint32_t old_pos, uint32_t length, int is_copy)
+{
+    /* A run can only be appended to the pending Control Entry if it has no Extra bytes, if it is of the same kind and if it reads old bytes right where the run does. */
+    if ((p_patch->extra_len != 0) || (p_patch->old_cursor + p_patch->diff_len != old_pos)
+            || ((p_patch->diff_len != 0) && (p_patch->is_copy != is_copy))
+            || (is_copy && (p_patch->diff_len + length > BSDIFF_MAX_COPY_LEN)))
+    {
+        if (bsdiff_flush(p_patch, old_pos) != BSDIFF_EC_OK)
+        {
+            return BSDIFF_EC_ERR;
+        }
+    }
+    p_patch->is_copy = is_copy;
+    p_patch->diff_len += length;
+
+    return BSDIFF_EC_OK;
+}
+
+/** @} */
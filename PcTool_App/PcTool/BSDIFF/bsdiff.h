@@ -0,0 +1,67 @@
+/** @file
+ * @brief	Binary Patch Generator header file for host machines.
+ *
+ * @defgroup bsdiff Binary Patch Generator module
+ * @{
+ *
+ * @brief	This module provides the functions required to generate, in the host machines, the binary patch
+ *          (bsdiff-style) with which an MCU/MPU can rebuild a new Firmware Image from the one that it has currently
+ *          installed, so that only the bytes that have actually changed need to be sent to it.
+ *
+ * @details	The matches between the new and the old Firmware Images are found with a suffix array of the old one,
+ *          which is sorted with the Larsson-Sadakane algorithm (i.e., in O(n log n) time), so that the patches of
+ *          Firmware Images of a few hundreds of kilobytes up to a few megabytes are generated in well under a second.
+ *          The approximate matches (i.e., the ones where only a few bytes differ, such as the ones of code whose
+ *          addresses have moved) are then extended as in the bsdiff algorithm of Colin Percival.
+ * @details	The resulting patch has the format that is described in the @ref bspatch module of the bootloader, in
+ *          which the new Firmware Image is rebuilt page by page over the old one. Therefore, the bytes of the new
+ *          Firmware Image that would have to read old bytes from a Flash Memory page that would have already been
+ *          overwritten by then (i.e., one older than the number of backlog pages that the MCU/MPU keeps in RAM) are
+ *          sent literally instead.
+ *
+ * @note	The patch is not compressed, so most of its size comes from the literal bytes and from the Diff bytes that
+ *          are not zeros.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef BSDIFF_H_
+#define BSDIFF_H_
+
+#define BSDIFF_MAGIC            (0x50585445)    /**< @brief Magic number with which every binary patch starts, which stands for the "ETXP" ASCII characters in little-endian. */
+#define BSDIFF_HEADER_SIZE      (20U)           /**< @brief Length in bytes of the header of a binary patch. */
+#define BSDIFF_CTRL_SIZE        (12U)           /**< @brief Length in bytes of each Control Entry of a binary patch. */
+
+/**@brief	Binary Patch Generator Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref bsdiff module to indicate the resulting
+ *          status of having executed the process contained in each of those functions.
+ */
+typedef enum
+{
+    BSDIFF_EC_OK    = 0U,   //!< Binary Patch Generator Process was successful.
+    BSDIFF_EC_ERR   = 1U    //!< Binary Patch Generator Process has failed, either because of invalid arguments or because it ran out of memory.
+} BsDiff_Status;
+
+/**@brief	Generates the binary patch with which a new Firmware Image can be rebuilt in place from an old one.
+ *
+ * @param[in] p_old         Pointer to the old Firmware Image (i.e., the one currently installed in the MCU/MPU).
+ * @param old_size          Length in bytes of the old Firmware Image.
+ * @param[in] p_new         Pointer to the new Firmware Image.
+ * @param new_size          Length in bytes of the new Firmware Image.
+ * @param page_size         Flash Memory page size in bytes of the MCU/MPU.
+ * @param backlog_pages     Number of already overwritten old Flash Memory pages that the MCU/MPU keeps in RAM while
+ *                          applying the binary patch, which must be at least \c 1 .
+ * @param[out] pp_patch     Pointer to where the pointer towards the generated binary patch will be written into, whose
+ *                          memory is allocated by this function and has to be freed by the caller with "free()".
+ * @param[out] p_patch_size Pointer to where the length in bytes of the generated binary patch will be written into,
+ *                          which is padded with zeros to a multiple of 4 bytes.
+ *
+ * @retval	BSDIFF_EC_OK
+ * @retval	BSDIFF_EC_ERR
+ */
+BsDiff_Status bsdiff_create(const uint8_t *p_old, uint32_t old_size, const uint8_t *p_new, uint32_t new_size,
+                            uint16_t page_size, uint8_t backlog_pages, uint8_t **pp_patch, uint32_t *p_patch_size);
+
+#endif /* BSDIFF_H_ */
+
+/** @} */
@@ -0,0 +1,79 @@
+/** @file
+ * @brief	CRC32/MPEG-2 Algorithm header file for host machines.
+ *
+ * @defgroup crc32_mpeg2 CRC32/MPEG-2 Algorithm module
+ * @{
+ *
+ * @brief	This module provides the functions required to calculate the CRC32/MPEG-2 Algorithm on one or more bytes
+ *          in the host machines, which is the 32-bit CRC used by all the ETX OTA Packets.
+ *
+ * @details	The 32-bit CRC is calculated with the fastest engine that the CPU of the host machine supports, which is
+ *          chosen at runtime the first time that any function of this module is called:
+ *          - PCLMULQDQ folding engine: On x86 CPUs that support the carry-less multiplication instruction, the data
+ *            is folded 64 bytes at a time with it.
+ *          - Slicing-by-8 engine: On any other CPU, the data is processed 8 bytes at a time with 8 Lookup Tables.
+ *
+ *          All the engines give the exact same results as the classic byte-at-a-time algorithm, which is the one
+ *          used by the MCU/MPU.
+ *
+ * @note    This module is shared by all the host programs of the ETX OTA Protocol, so any change to it must be copied
+ *          into all of them.
+ *
+ * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef CRC32_MPEG2_H_
+#define CRC32_MPEG2_H_
+
+#define CRC32_MPEG2_INIT_VALUE      (0xFFFFFFFF)    /**< @brief Initial value of the 32-bit CRC (MPEG-2), which is the one that @ref crc32_mpeg2_update has to be given in order to start calculating the 32-bit CRC of some data. */
+
+/**@brief   Calculates the 32-bit CRC of a given data.
+ *
+ * @param[in] p_data    Pointer to the data from which it is desired to calculate the 32-bit CRC.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The calculated 32-bit CRC Hash Function on the input data towards which the \p p_data param
+ *                      points to.
+ *
+ * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
+ */
+uint32_t crc32_mpeg2(const uint8_t *p_data, uint32_t data_length);
+
+/**@brief   Continues the calculation of a 32-bit CRC over some more data.
+ *
+ * @details This allows calculating the 32-bit CRC of some data that is not entirely held in memory at once, where
+ *          giving the checksum of its previous bytes, as returned by either @ref crc32_mpeg2 or this function, will
+ *          give the same result as if @ref crc32_mpeg2 had been applied to all of its bytes.
+ *
+ * @param checksum      The 32-bit CRC of all the bytes that preceded the ones at \p p_data , or
+ *                      @ref CRC32_MPEG2_INIT_VALUE if there are none.
+ * @param[in] p_data    Pointer to the data with which it is desired to continue calculating the 32-bit CRC.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The calculated 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+uint32_t crc32_mpeg2_update(uint32_t checksum, const uint8_t *p_data, uint32_t data_length);
+
+/**@brief   Combines the 32-bit CRCs of two consecutive blocks of data into the 32-bit CRC of both blocks together.
+ *
+ * @details This allows getting the 32-bit CRC of a whole data from the 32-bit CRCs of its chunks (e.g., from the
+ *          ones of each ETX OTA Data Type Packet) without having to read that data again.
+ *
+ * @param crc1          The 32-bit CRC of the first block, as returned by @ref crc32_mpeg2 .
+ * @param crc2          The 32-bit CRC of the second block, as returned by @ref crc32_mpeg2 .
+ * @param len2          Length in bytes of the second block.
+ *
+ * @return              The 32-bit CRC of the first block followed by the second block.
+ */
+uint32_t crc32_mpeg2_combine(uint32_t crc1, uint32_t crc2, uint32_t len2);
+
+/**@brief   Gets the name of the engine that this module has chosen to calculate the 32-bit CRCs with.
+ *
+ * @return  Either "pclmul" or "slice-by-8".
+ */
+const char *crc32_mpeg2_engine(void);
+
+#endif /* CRC32_MPEG2_H_ */
+
+/** @} */
@@ -0,0 +1,471 @@
+/** @addtogroup image_parser
+ * @{
+ */
+
+#include "image_parser.h"
+#include <stdlib.h> // Library from which "malloc()" and "free()" are located at.
+#include <string.h> // Library from which "memcpy()" and "memset()" are located at.
+
+#define IMAGE_PARSER_RECORD_MAX_SIZE    (5U + 255U) /**< @brief Maximum number of bytes that an Intel HEX or Motorola S-record record can hold, which is given by its byte count, its address, its type, its up to 255 bytes of data and its checksum. */
+#define IMAGE_PARSER_ELF_HEADER_SIZE    (52U)       /**< @brief Length in bytes of the ELF header of a 32-bit ELF File. */
+#define IMAGE_PARSER_ELF_PHDR_SIZE      (32U)       /**< @brief Length in bytes of a program header of a 32-bit ELF File. */
+#define IMAGE_PARSER_ELF_PT_LOAD        (1U)        /**< @brief Type of the program segments of an ELF File that are loaded into memory. */
+
+/**@brief	Firmware Image Parser context structure.
+ *
+ * @details	This structure holds the binary Firmware Image that is being built while the segments of a File are placed
+ *          into it.
+ */
+typedef struct {
+    uint8_t   *image;           //!< Binary Firmware Image, which holds \c max_size bytes that start as \c 0xFF bytes.
+    uint32_t  base_address;     //!< Flash Memory address from which the binary Firmware Image starts.
+    uint32_t  max_size;         //!< Length in bytes of the slot that is to receive the binary Firmware Image.
+    uint32_t  end;              //!< Offset of the binary Firmware Image right after its last populated byte so far.
+    uint32_t  last_address;     //!< Address right after the latest placed segment, which is used to tell whether the next segment continues it.
+    uint32_t  segment_count;    //!< Number of populated segments placed so far, where the contiguous ones are counted as one.
+} image_parser_ctx_t;
+
+/**@brief	Places an address-tagged segment into the binary Firmware Image.
+ *
+ * @param[in, out] p_ctx    Pointer to the context of the binary Firmware Image.
+ * @param address           Flash Memory address of the segment.
+ * @param[in] p_data        Pointer to the bytes of the segment.
+ * @param len               Length in bytes of the segment.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR if the segment is outside of the slot.
+ */
+static ImageParser_Status image_parser_place(image_parser_ctx_t *p_ctx, uint32_t address, const uint8_t *p_data, uint32_t len);
+
+/**@brief	Reads the hexadecimal digit pairs of an Intel HEX or Motorola S-record record as bytes, up to the end of
+ *          its line.
+ *
+ * @param[in] p_file        Pointer to the whole File.
+ * @param file_size         Length in bytes of the File.
+ * @param[in, out] p_pos    Pointer to the position of the File from which the digit pairs start, which will be
+ *                          advanced up to the end of the line.
+ * @param[out] p_record     Pointer to where the bytes of the record will be written into, which must hold at least
+ *                          @ref IMAGE_PARSER_RECORD_MAX_SIZE bytes.
+ * @param[out] p_len        Pointer to where the number of bytes of the record will be written into.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR if the line has an odd number of digits or too many of them.
+ */
+static ImageParser_Status image_parser_read_record(const uint8_t *p_file, uint32_t file_size, uint32_t *p_pos, uint8_t *p_record, uint32_t *p_len);
+
+/**@brief	Places the data records of an Intel HEX File into the binary Firmware Image.
+ *
+ * @param[in, out] p_ctx    Pointer to the context of the binary Firmware Image.
+ * @param[in] p_file        Pointer to the whole File.
+ * @param file_size         Length in bytes of the File.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR
+ */
+static ImageParser_Status image_parser_parse_ihex(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size);
+
+/**@brief	Places the data records of a Motorola S-record File into the binary Firmware Image.
+ *
+ * @param[in, out] p_ctx    Pointer to the context of the binary Firmware Image.
+ * @param[in] p_file        Pointer to the whole File.
+ * @param file_size         Length in bytes of the File.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR
+ */
+static ImageParser_Status image_parser_parse_srec(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size);
+
+/**@brief	Places the \c PT_LOAD program segments of a 32-bit little-endian ELF File into the binary Firmware Image.
+ *
+ * @param[in, out] p_ctx    Pointer to the context of the binary Firmware Image.
+ * @param[in] p_file        Pointer to the whole File.
+ * @param file_size         Length in bytes of the File.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR
+ */
+static ImageParser_Status image_parser_parse_elf(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size);
+
+/**@brief	Reads a little-endian value of up to 4 bytes.
+ *
+ * @param[in] p_data    Pointer to the value.
+ * @param len           Length in bytes of the value.
+ *
+ * @return	The value.
+ */
+static uint32_t image_parser_read_le(const uint8_t *p_data, uint8_t len);
+
+ImageParser_Format image_parser_get_format(const uint8_t *p_head, uint32_t len)
+{
+    if ((len >= 4) && (p_head[0] == 0x7F) && (p_head[1] == 'E') && (p_head[2] == 'L') && (p_head[3] == 'F'))
+    {
+        return IMAGE_PARSER_FORMAT_ELF;
+    }
+    if ((len >= 1) && (p_head[0] == ':'))
+    {
+        return IMAGE_PARSER_FORMAT_IHEX;
+    }
+    if ((len >= 2) && (p_head[0] == 'S') && (p_head[1] >= '0') && (p_head[1] <= '9'))
+    {
+        return IMAGE_PARSER_FORMAT_SREC;
+    }
+
+    return IMAGE_PARSER_FORMAT_BINARY;
+}
+
+ImageParser_Status image_parser_flatten(const uint8_t *p_file, uint32_t file_size, uint32_t base_address, uint32_t max_size,
+                                        uint8_t **pp_image, uint32_t *p_image_size, uint32_t *p_segment_count)
+{
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ImageParser_Status function type. */
+    ImageParser_Status ret;
+    /** <b>Local variable ctx:</b> Context of the binary Firmware Image that is being built. */
+    image_parser_ctx_t ctx;
+
+    if ((p_file == NULL) || (max_size == 0) || (pp_image == NULL) || (p_image_size == NULL) || (p_segment_count == NULL))
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+    ctx.image = malloc(max_size);
+    if (ctx.image == NULL)
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+    memset(ctx.image, 0xFF, max_size);
+    ctx.base_address = base_address;
+    ctx.max_size = max_size;
+    ctx.end = 0;
+    ctx.last_address = base_address;
+    ctx.segment_count = 0;
+
+    switch (image_parser_get_format(p_file, file_size))
+    {
+        case IMAGE_PARSER_FORMAT_IHEX:
+            ret = image_parser_parse_ihex(&ctx, p_file, file_size);
+            break;
+        case IMAGE_PARSER_FORMAT_SREC:
+            ret = image_parser_parse_srec(&ctx, p_file, file_size);
+            break;
+        case IMAGE_PARSER_FORMAT_ELF:
+            ret = image_parser_parse_elf(&ctx, p_file, file_size);
+            break;
+        default:
+            ret = IMAGE_PARSER_EC_ERR;
+            break;
+    }
+
+    /* Trim the trailing erased bytes, since the Flash Memory of the MCU/MPU already reads them as such. */
+    while ((ctx.end > 0) && (ctx.image[ctx.end - 1] == 0xFF))
+    {
+        ctx.end--;
+    }
+    if ((ret != IMAGE_PARSER_EC_OK) || (ctx.end == 0))
+    {
+        free(ctx.image);
+        return IMAGE_PARSER_EC_ERR;
+    }
+
+    /* Pad the binary Firmware Image with erased bytes to a multiple of 4 bytes. */
+    *p_image_size = (ctx.end + 3U) & ~3U;
+    *pp_image = ctx.image;
+    *p_segment_count = ctx.segment_count;
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+bool image_parser_is_blank(const uint8_t *p_data, uint32_t len)
+{
+    for (uint32_t i=0; i<len; i++)
+    {
+        if (p_data[i] != 0xFF)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static ImageParser_Status image_parser_place(image_parser_ctx_t *p_ctx, uint32_t address, const uint8_t *p_data, uint32_t len)
+{
+    /** <b>Local variable offset:</b> Offset of the binary Firmware Image at which the segment starts. */
+    uint32_t offset = address - p_ctx->base_address;
+
+    if (len == 0)
+    {
+        return IMAGE_PARSER_EC_OK;
+    }
+    if ((address < p_ctx->base_address) || (offset >= p_ctx->max_size) || (len > (p_ctx->max_size - offset)))
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+    memcpy(&p_ctx->image[offset], p_data, len);
+    if ((p_ctx->segment_count == 0) || (address != p_ctx->last_address))
+    {
+        p_ctx->segment_count++;
+    }
+    p_ctx->last_address = address + len;
+    if ((offset + len) > p_ctx->end)
+    {
+        p_ctx->end = offset + len;
+    }
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+static ImageParser_Status image_parser_read_record(const uint8_t *p_file, uint32_t file_size, uint32_t *p_pos, uint8_t *p_record, uint32_t *p_len)
+{
+    /** <b>Local variable nibble:</b> Value of the hexadecimal digit that is currently being read. */
+    uint8_t nibble;
+    /** <b>Local variable digits:</b> Number of hexadecimal digits read so far. */
+    uint32_t digits = 0;
+
+    for (; *p_pos<file_size; (*p_pos)++)
+    {
+        /** <b>Local variable c:</b> Character of the File that is currently being read. */
+        uint8_t c = p_file[*p_pos];
+        if ((c >= '0') && (c <= '9'))
+        {
+            nibble = c - '0';
+        }
+        else if ((c >= 'A') && (c <= 'F'))
+        {
+            nibble = c - 'A' + 10U;
+        }
+        else if ((c >= 'a') && (c <= 'f'))
+        {
+            nibble = c - 'a' + 10U;
+        }
+        else
+        {
+            break;
+        }
+        if ((digits / 2U) >= IMAGE_PARSER_RECORD_MAX_SIZE)
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+        p_record[digits / 2U] = ((digits % 2U) == 0U) ? (nibble << 4) : (p_record[digits / 2U] | nibble);
+        digits++;
+    }
+    if ((digits % 2U) != 0U)
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+    *p_len = digits / 2U;
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+static ImageParser_Status image_parser_parse_ihex(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size)
+{
+    /** <b>Local variable record:</b> Bytes of the record that is currently being parsed. */
+    uint8_t record[IMAGE_PARSER_RECORD_MAX_SIZE];
+    /** <b>Local variable len:</b> Number of bytes of the record that is currently being parsed. */
+    uint32_t len;
+    /** <b>Local variable upper_address:</b> Address given by the latest Extended Segment or Extended Linear Address record. */
+    uint32_t upper_address = 0;
+    /** <b>Local variable pos:</b> Position of the File that is currently being parsed. */
+    uint32_t pos = 0;
+
+    while (pos < file_size)
+    {
+        /* Skip the line endings and any blanks in between the records. */
+        if ((p_file[pos] == '\r') || (p_file[pos] == '\n') || (p_file[pos] == ' ') || (p_file[pos] == '\t'))
+        {
+            pos++;
+            continue;
+        }
+        if (p_file[pos++] != ':')
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+
+        /* Validate the byte count and the checksum of the record. */
+        if ((image_parser_read_record(p_file, file_size, &pos, record, &len) != IMAGE_PARSER_EC_OK) || (len < 5U) || ((record[0] + 5U) != len))
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+        /** <b>Local variable sum:</b> Sum of all the bytes of the record, which must be \c 0 in its lower byte. */
+        uint8_t sum = 0;
+        for (uint32_t i=0; i<len; i++)
+        {
+            sum += record[i];
+        }
+        if (sum != 0)
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+
+        switch (record[3])
+        {
+            case 0x00: // Data record.
+                if (image_parser_place(p_ctx, upper_address + ((record[1] << 8) | record[2]), &record[4], record[0]) != IMAGE_PARSER_EC_OK)
+                {
+                    return IMAGE_PARSER_EC_ERR;
+                }
+                break;
+            case 0x01: // End Of File record.
+                return IMAGE_PARSER_EC_OK;
+            case 0x02: // Extended Segment Address record.
+            case 0x04: // Extended Linear Address record.
+                if (record[0] != 2U)
+                {
+                    return IMAGE_PARSER_EC_ERR;
+                }
+                upper_address = ((uint32_t) ((record[4] << 8) | record[5])) << ((record[3] == 0x02) ? 4 : 16);
+                break;
+            case 0x03: // Start Segment Address record.
+            case 0x05: // Start Linear Address record.
+                break;
+            default:
+                return IMAGE_PARSER_EC_ERR;
+        }
+    }
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+static ImageParser_Status image_parser_parse_srec(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size)
+{
+    /** <b>Local variable record:</b> Bytes of the record that is currently being parsed, starting from its byte count. */
+    uint8_t record[IMAGE_PARSER_RECORD_MAX_SIZE];
+    /** <b>Local variable len:</b> Number of bytes of the record that is currently being parsed. */
+    uint32_t len;
+    /** <b>Local variable type:</b> Type of the record that is currently being parsed. */
+    uint8_t type;
+    /** <b>Local variable address_len:</b> Length in bytes of the address of the data record that is currently being parsed. */
+    uint8_t address_len;
+    /** <b>Local variable pos:</b> Position of the File that is currently being parsed. */
+    uint32_t pos = 0;
+
+    while (pos < file_size)
+    {
+        /* Skip the line endings and any blanks in between the records. */
+        if ((p_file[pos] == '\r') || (p_file[pos] == '\n') || (p_file[pos] == ' ') || (p_file[pos] == '\t'))
+        {
+            pos++;
+            continue;
+        }
+        if (((pos + 1U) >= file_size) || (p_file[pos] != 'S') || (p_file[pos + 1U] < '0') || (p_file[pos + 1U] > '9'))
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+        type = p_file[pos + 1U] - '0';
+        pos += 2U;
+
+        /* Validate the byte count and the checksum of the record. */
+        if ((image_parser_read_record(p_file, file_size, &pos, record, &len) != IMAGE_PARSER_EC_OK) || (len < 2U) || ((record[0] + 1U) != len))
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+        /** <b>Local variable sum:</b> Sum of all the bytes of the record, which must be \c 0xFF in its lower byte. */
+        uint8_t sum = 0;
+        for (uint32_t i=0; i<len; i++)
+        {
+            sum += record[i];
+        }
+        if (sum != 0xFF)
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+
+        switch (type)
+        {
+            case 1: // Data record with a 16-bit address.
+            case 2: // Data record with a 24-bit address.
+            case 3: // Data record with a 32-bit address.
+                address_len = type + 1U;
+                if (len < (2U + address_len))
+                {
+                    return IMAGE_PARSER_EC_ERR;
+                }
+                /** <b>Local variable address:</b> Big-endian address of the data record. */
+                uint32_t address = 0;
+                for (uint8_t i=0; i<address_len; i++)
+                {
+                    address = (address << 8) | record[1U + i];
+                }
+                if (image_parser_place(p_ctx, address, &record[1U + address_len], len - 2U - address_len) != IMAGE_PARSER_EC_OK)
+                {
+                    return IMAGE_PARSER_EC_ERR;
+                }
+                break;
+            case 7: // Termination records.
+            case 8:
+            case 9:
+                return IMAGE_PARSER_EC_OK;
+            case 0: // Header record.
+            case 5: // Count records.
+            case 6:
+                break;
+            default:
+                return IMAGE_PARSER_EC_ERR;
+        }
+    }
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+static ImageParser_Status image_parser_parse_elf(image_parser_ctx_t *p_ctx, const uint8_t *p_file, uint32_t file_size)
+{
+    /** <b>Local variable phoff:</b> Offset of the File at which the program headers start. */
+    uint32_t phoff;
+    /** <b>Local variable phentsize:</b> Length in bytes of each program header. */
+    uint16_t phentsize;
+    /** <b>Local variable phnum:</b> Number of program headers. */
+    uint16_t phnum;
+
+    /* Validate that this is a 32-bit little-endian ELF File, and that its program headers are within it. */
+    if ((file_size < IMAGE_PARSER_ELF_HEADER_SIZE) || (p_file[4] != 1U) || (p_file[5] != 1U))
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+    phoff = image_parser_read_le(&p_file[28], 4);
+    phentsize = image_parser_read_le(&p_file[42], 2);
+    phnum = image_parser_read_le(&p_file[44], 2);
+    if ((phnum == 0) || (phentsize < IMAGE_PARSER_ELF_PHDR_SIZE) || (phoff > file_size) || (((uint64_t) phentsize * phnum) > (file_size - phoff)))
+    {
+        return IMAGE_PARSER_EC_ERR;
+    }
+
+    /* Place each loadable program segment at its physical address. */
+    for (uint16_t i=0; i<phnum; i++)
+    {
+        /** <b>Local pointer p_phdr:</b> Points to the program header that is currently being parsed. */
+        const uint8_t *p_phdr = &p_file[phoff + (uint32_t) i*phentsize];
+        /** <b>Local variable p_offset:</b> Offset of the File at which the bytes of the program segment start. */
+        uint32_t p_offset = image_parser_read_le(&p_phdr[4], 4);
+        /** <b>Local variable p_filesz:</b> Number of bytes of the program segment that are held in the File. */
+        uint32_t p_filesz = image_parser_read_le(&p_phdr[16], 4);
+
+        if ((image_parser_read_le(&p_phdr[0], 4) != IMAGE_PARSER_ELF_PT_LOAD) || (p_filesz == 0))
+        {
+            continue;
+        }
+        if ((p_offset > file_size) || (p_filesz > (file_size - p_offset)))
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+        if (image_parser_place(p_ctx, image_parser_read_le(&p_phdr[12], 4), &p_file[p_offset], p_filesz) != IMAGE_PARSER_EC_OK)
+        {
+            return IMAGE_PARSER_EC_ERR;
+        }
+    }
+
+    return IMAGE_PARSER_EC_OK;
+}
+
+static uint32_t image_parser_read_le(const uint8_t *p_data, uint8_t len)
+{
+    /** <b>Local variable value:</b> The value that is being read. */
+    uint32_t value = 0;
+
+    while (len > 0)
+    {
+        len--;
+        value = (value << 8) | p_data[len];
+    }
+
+    return value;
+}
+
+/** @} */
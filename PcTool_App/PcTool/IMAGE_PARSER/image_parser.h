@@ -0,0 +1,87 @@
+/** @file
+ * @brief	Firmware Image Parser header file for host machines.
+ *
+ * @defgroup image_parser Firmware Image Parser module
+ * @{
+ *
+ * @brief	This module provides the functions required to load, in the host machines, the Firmware Images that are
+ *          given as Intel HEX, Motorola S-record or ELF Files, so that they can be sent to the MCUs/MPUs as the raw
+ *          binary Firmware Images that get programmed into their Flash Memory.
+ *
+ * @details	Each of those File formats describes the Firmware Image as a set of address-tagged segments, which are
+ *          placed into a single binary Firmware Image that starts at the Flash Memory address of the slot that is to
+ *          receive it. The gaps between the segments are filled with \c 0xFF bytes (i.e., erased Flash Memory), and
+ *          any trailing \c 0xFF bytes are trimmed, so that the binary Firmware Image only covers up to the last
+ *          populated byte.
+ * @details	The ELF Files are placed at the physical address (i.e., the load address) of their \c PT_LOAD program
+ *          segments, which is where the initial values of the initialized data are held in the Flash Memory.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+
+#ifndef IMAGE_PARSER_H_
+#define IMAGE_PARSER_H_
+
+/**@brief	Firmware Image Parser Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref image_parser module to indicate the
+ *          resulting status of having executed the process contained in each of those functions.
+ */
+typedef enum
+{
+    IMAGE_PARSER_EC_OK  = 0U,   //!< Firmware Image Parser Process was successful.
+    IMAGE_PARSER_EC_ERR = 1U    //!< Firmware Image Parser Process has failed, either because the File is malformed, because it has segments outside of the slot or because it ran out of memory.
+} ImageParser_Status;
+
+/**@brief	Firmware Image File format definitions.
+ */
+typedef enum
+{
+    IMAGE_PARSER_FORMAT_BINARY  = 0U,   //!< Raw binary Firmware Image, which is sent as it is.
+    IMAGE_PARSER_FORMAT_IHEX    = 1U,   //!< Intel HEX File.
+    IMAGE_PARSER_FORMAT_SREC    = 2U,   //!< Motorola S-record File.
+    IMAGE_PARSER_FORMAT_ELF     = 3U    //!< 32-bit little-endian ELF File.
+} ImageParser_Format;
+
+/**@brief	Gets the format of a Firmware Image File from its first bytes.
+ *
+ * @param[in] p_head    Pointer to the first bytes of the File.
+ * @param len           Number of bytes towards which the \p p_head param points to.
+ *
+ * @return	The format of the File, which is @ref IMAGE_PARSER_FORMAT_BINARY whenever it is none of the other ones.
+ */
+ImageParser_Format image_parser_get_format(const uint8_t *p_head, uint32_t len);
+
+/**@brief	Places the segments of an Intel HEX, Motorola S-record or ELF File into a single binary Firmware Image.
+ *
+ * @param[in] p_file            Pointer to the whole File.
+ * @param file_size             Length in bytes of the File.
+ * @param base_address          Flash Memory address from which the slot that is to receive the Firmware Image starts.
+ * @param max_size              Length in bytes of that slot, which no segment may go beyond.
+ * @param[out] pp_image         Pointer to where the pointer towards the binary Firmware Image will be written into,
+ *                              whose memory is allocated by this function and has to be freed by the caller with
+ *                              "free()".
+ * @param[out] p_image_size     Pointer to where the length in bytes of the binary Firmware Image will be written into,
+ *                              which is padded with \c 0xFF bytes to a multiple of 4 bytes.
+ * @param[out] p_segment_count  Pointer to where the number of populated segments found in the File will be written
+ *                              into.
+ *
+ * @retval	IMAGE_PARSER_EC_OK
+ * @retval	IMAGE_PARSER_EC_ERR
+ */
+ImageParser_Status image_parser_flatten(const uint8_t *p_file, uint32_t file_size, uint32_t base_address, uint32_t max_size,
+                                        uint8_t **pp_image, uint32_t *p_image_size, uint32_t *p_segment_count);
+
+/**@brief	Checks whether some bytes of a binary Firmware Image are blank (i.e., whether all of them are \c 0xFF ), which
+ *          is how the Flash Memory pages that can be erased instead of being sent are told apart.
+ *
+ * @param[in] p_data    Pointer to the bytes to be checked.
+ * @param len           Number of bytes towards which the \p p_data param points to.
+ *
+ * @return	\c true if all the bytes are \c 0xFF , or otherwise \c false .
+ */
+bool image_parser_is_blank(const uint8_t *p_data, uint32_t len);
+
+#endif /* IMAGE_PARSER_H_ */
+
+/** @} */
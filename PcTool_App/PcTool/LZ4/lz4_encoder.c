@@ -0,0 +1,203 @@
+/** @addtogroup lz4_encoder
+ * @{
+ */
+
+#include "lz4_encoder.h"
+#include <stdlib.h> // Library from which "malloc()", "calloc()" and "free()" are located at.
+#include <string.h> // Library from which "memcpy()" and "memset()" are located at.
+
+#define LZ4_ENCODER_MIN_MATCH   (4U)        /**< @brief Minimum length in bytes of an LZ4 match, which is subtracted from the match length given by each token. */
+#define LZ4_ENCODER_RUN_MASK    (15U)       /**< @brief Value of a nibble of an LZ4 token that indicates that its length continues in the next bytes. */
+#define LZ4_ENCODER_MAX_OFFSET  (65535U)    /**< @brief Greatest match offset that fits into the 2 bytes that LZ4 has for it. */
+#define LZ4_ENCODER_HASH_LOG    (16U)       /**< @brief Base 2 logarithm of the number of entries of the hash table with which the 4-byte sequences are looked up. */
+#define LZ4_ENCODER_MAX_CHAIN   (256U)      /**< @brief Number of previous occurrences of each 4-byte sequence that are looked at with @ref LZ4_ENCODER_MAX_LEVEL . */
+
+/**@brief	Gets the hash table entry of the 4-byte sequence that starts at some given data.
+ *
+ * @param[in] p_data    Pointer to the 4-byte sequence.
+ *
+ * @return	The index of the hash table entry of the 4-byte sequence.
+ */
+static uint32_t lz4_encoder_hash(const uint8_t *p_data);
+
+/**@brief	Writes the length that goes beyond a nibble of an LZ4 token as the extra bytes that follow it.
+ *
+ * @param[in, out] pp_dst   Pointer to the pointer towards where the extra bytes will be written into, which will be
+ *                          advanced by the number of bytes written.
+ * @param len               Length that goes beyond the nibble of the token (i.e., minus @ref LZ4_ENCODER_RUN_MASK ).
+ */
+static void lz4_encoder_write_len(uint8_t **pp_dst, uint32_t len);
+
+/**@brief	Writes an LZ4 sequence.
+ *
+ * @param[in, out] pp_dst   Pointer to the pointer towards where the LZ4 sequence will be written into, which will be
+ *                          advanced by the number of bytes written.
+ * @param[in] p_literals    Pointer to the literals of the LZ4 sequence.
+ * @param literals_len      Number of literals of the LZ4 sequence.
+ * @param offset            Match offset of the LZ4 sequence.
+ * @param match_len         Match length of the LZ4 sequence, or \c 0 if it is the last one and it has no match.
+ */
+static void lz4_encoder_write_sequence(uint8_t **pp_dst, const uint8_t *p_literals, uint32_t literals_len,
+                                       uint16_t offset, uint32_t match_len);
+
+Lz4Encoder_Status lz4_encoder_compress(const uint8_t *p_src, uint32_t src_size, uint32_t window_size, uint8_t level,
+                                       uint8_t **pp_dst, uint32_t *p_dst_size)
+{
+    /** <b>Local variable max_offset:</b> Greatest match offset that can be used. */
+    uint32_t max_offset;
+    /** <b>Local variable max_chain:</b> Number of previous occurrences of each 4-byte sequence that are looked at. */
+    uint32_t max_chain;
+    /** <b>Local pointer head:</b> Hash table holding the latest position of each 4-byte sequence, or \c -1 . */
+    int32_t *head;
+    /** <b>Local pointer prev:</b> Hash chain holding, for each position within the window, the previous position with the same hash, or \c -1 . */
+    int32_t *prev;
+    /** <b>Local pointer p_dst:</b> Points to the compressed data. */
+    uint8_t *p_dst;
+    /** <b>Local pointer p_out:</b> Points to where the next byte of compressed data will be written into. */
+    uint8_t *p_out;
+    /** <b>Local variable dst_cap:</b> Number of bytes allocated for the compressed data, which covers the worst case in which nothing is compressed. */
+    uint32_t dst_cap = src_size + (src_size / 255U) + 16U;
+    /** <b>Local variable pos:</b> Position of the data that is currently being looked at. */
+    uint32_t pos = 0;
+    /** <b>Local variable anchor:</b> Position of the data from which the literals of the next LZ4 sequence start. */
+    uint32_t anchor = 0;
+
+    if ((p_src == NULL && src_size > 0) || (window_size < 256U) || (window_size > 65536U) || ((window_size & (window_size - 1U)) != 0U)
+            || (level < LZ4_ENCODER_MIN_LEVEL) || (level > LZ4_ENCODER_MAX_LEVEL) || (pp_dst == NULL) || (p_dst_size == NULL))
+    {
+        return LZ4_ENCODER_EC_ERR;
+    }
+    max_offset = (window_size < LZ4_ENCODER_MAX_OFFSET) ? window_size : LZ4_ENCODER_MAX_OFFSET;
+    max_chain = 1U << (level - 1U);
+    max_chain = (max_chain < LZ4_ENCODER_MAX_CHAIN) ? max_chain : LZ4_ENCODER_MAX_CHAIN;
+
+    head = malloc(sizeof(int32_t) << LZ4_ENCODER_HASH_LOG);
+    prev = malloc(sizeof(int32_t) * window_size);
+    p_dst = calloc(dst_cap, 1);
+    if ((head == NULL) || (prev == NULL) || (p_dst == NULL))
+    {
+        free(head);
+        free(prev);
+        free(p_dst);
+        return LZ4_ENCODER_EC_ERR;
+    }
+    memset(head, 0xFF, sizeof(int32_t) << LZ4_ENCODER_HASH_LOG);
+    p_out = p_dst;
+
+    while ((pos + LZ4_ENCODER_MIN_MATCH) <= src_size)
+    {
+        /** <b>Local variable h:</b> Hash of the 4-byte sequence at the current position. */
+        uint32_t h = lz4_encoder_hash(&p_src[pos]);
+        /** <b>Local variable cand:</b> Previous position with the same hash that is currently being looked at. */
+        int32_t cand = head[h];
+        /** <b>Local variable best_len:</b> Length of the longest match found so far. */
+        uint32_t best_len = 0;
+        /** <b>Local variable best_pos:</b> Position at which the longest match found so far starts. */
+        uint32_t best_pos = 0;
+
+        /* Look for the longest match among the previous occurrences of the current 4-byte sequence that are within the window. */
+        for (uint32_t chain=0; (chain<max_chain) && (cand>=0) && ((pos - (uint32_t) cand) <= max_offset); chain++)
+        {
+            /** <b>Local variable len:</b> Length of the match at the current candidate. */
+            uint32_t len = 0;
+            while (((pos + len) < src_size) && (p_src[cand + len] == p_src[pos + len]))
+            {
+                len++;
+            }
+            if (len > best_len)
+            {
+                best_len = len;
+                best_pos = cand;
+                if ((pos + len) == src_size)
+                {
+                    break;
+                }
+            }
+            cand = prev[cand & (window_size - 1U)];
+        }
+
+        /* Add the current position into the hash chain. */
+        prev[pos & (window_size - 1U)] = head[h];
+        head[h] = pos;
+
+        if (best_len < LZ4_ENCODER_MIN_MATCH)
+        {
+            pos++;
+            continue;
+        }
+
+        /* Write the pending literals along with the match, and add the positions covered by the match into the hash chain. */
+        lz4_encoder_write_sequence(&p_out, &p_src[anchor], pos - anchor, (uint16_t) (pos - best_pos), best_len);
+        for (uint32_t end=pos+best_len, i=pos+1; i<end; i++)
+        {
+            if ((i + LZ4_ENCODER_MIN_MATCH) <= src_size)
+            {
+                h = lz4_encoder_hash(&p_src[i]);
+                prev[i & (window_size - 1U)] = head[h];
+                head[h] = i;
+            }
+        }
+        pos += best_len;
+        anchor = pos;
+    }
+
+    /* Write the remaining bytes as the literals of the last LZ4 sequence. */
+    if (anchor < src_size)
+    {
+        lz4_encoder_write_sequence(&p_out, &p_src[anchor], src_size - anchor, 0, 0);
+    }
+    free(head);
+    free(prev);
+
+    /* Pad the compressed data with zeros to a multiple of 4 bytes. */
+    *p_dst_size = ((uint32_t) (p_out - p_dst) + 3U) & ~3U;
+    *pp_dst = p_dst;
+
+    return LZ4_ENCODER_EC_OK;
+}
+
+static uint32_t lz4_encoder_hash(const uint8_t *p_data)
+{
+    /** <b>Local variable value:</b> The 4-byte sequence in little-endian. */
+    uint32_t value = p_data[0] | (p_data[1] << 8) | (p_data[2] << 16) | ((uint32_t) p_data[3] << 24);
+
+    return (value * 2654435761U) >> (32U - LZ4_ENCODER_HASH_LOG);
+}
+
+static void lz4_encoder_write_len(uint8_t **pp_dst, uint32_t len)
+{
+    while (len >= 255U)
+    {
+        *(*pp_dst)++ = 255U;
+        len -= 255U;
+    }
+    *(*pp_dst)++ = (uint8_t) len;
+}
+
+static void lz4_encoder_write_sequence(uint8_t **pp_dst, const uint8_t *p_literals, uint32_t literals_len,
+                                       uint16_t offset, uint32_t match_len)
+{
+    /** <b>Local variable match_code:</b> Match length as it is encoded in the LZ4 sequence. */
+    uint32_t match_code = (match_len > 0) ? (match_len - LZ4_ENCODER_MIN_MATCH) : 0;
+
+    *(*pp_dst)++ = (uint8_t) ((((literals_len < LZ4_ENCODER_RUN_MASK) ? literals_len : LZ4_ENCODER_RUN_MASK) << 4)
+                              | ((match_code < LZ4_ENCODER_RUN_MASK) ? match_code : LZ4_ENCODER_RUN_MASK));
+    if (literals_len >= LZ4_ENCODER_RUN_MASK)
+    {
+        lz4_encoder_write_len(pp_dst, literals_len - LZ4_ENCODER_RUN_MASK);
+    }
+    memcpy(*pp_dst, p_literals, literals_len);
+    *pp_dst += literals_len;
+    if (match_len == 0)
+    {
+        return;
+    }
+    *(*pp_dst)++ = (uint8_t) (offset & 0xFF);
+    *(*pp_dst)++ = (uint8_t) (offset >> 8);
+    if (match_code >= LZ4_ENCODER_RUN_MASK)
+    {
+        lz4_encoder_write_len(pp_dst, match_code - LZ4_ENCODER_RUN_MASK);
+    }
+}
+
+/** @} */
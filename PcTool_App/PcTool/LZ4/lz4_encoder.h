@@ -0,0 +1,60 @@
+/** @file
+ * @brief	LZ4 Encoder header file for host machines.
+ *
+ * @defgroup lz4_encoder LZ4 Encoder module
+ * @{
+ *
+ * @brief	This module provides the functions required to compress, in the host machines, the Payloads that are sent
+ *          to the MCUs/MPUs that are able to decompress them on the fly.
+ *
+ * @details	The compressed data is a single LZ4 block (i.e., a sequence of LZ4 sequences, each of which is made of a
+ *          token, its literals and, unless it is the last one, a 2-byte little-endian offset and the extra bytes of its
+ *          match length), which is the format that is described in the @ref lz4_decoder module of the MCU/MPU. Unlike
+ *          in the LZ4 format, the match offsets are limited to the window that the MCU/MPU keeps in RAM and the last
+ *          sequence may end with a match, since the MCU/MPU already knows the decompressed size from the ETX OTA
+ *          Header.
+ * @details	The matches are found with a hash chain of the 4-byte sequences within the window, where the compression
+ *          level sets how many of the previous occurrences of each sequence are looked at. Therefore, a higher level
+ *          takes more time of the host machine but gives a smaller compressed Payload, which is only worth it whenever
+ *          the link with the MCU/MPU is slow.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef LZ4_ENCODER_H_
+#define LZ4_ENCODER_H_
+
+#define LZ4_ENCODER_MIN_LEVEL   (1U)    /**< @brief Fastest compression level, which only looks at the latest previous occurrence of each 4-byte sequence. */
+#define LZ4_ENCODER_MAX_LEVEL   (9U)    /**< @brief Slowest compression level, which looks at up to the 256 latest previous occurrences of each 4-byte sequence. */
+
+/**@brief	LZ4 Encoder Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref lz4_encoder module to indicate the
+ *          resulting status of having executed the process contained in each of those functions.
+ */
+typedef enum
+{
+    LZ4_ENCODER_EC_OK   = 0U,   //!< LZ4 Encoder Process was successful.
+    LZ4_ENCODER_EC_ERR  = 1U    //!< LZ4 Encoder Process has failed, either because of invalid arguments or because it ran out of memory.
+} Lz4Encoder_Status;
+
+/**@brief	Compresses some data into a single LZ4 block whose match offsets fit into the window of the MCU/MPU.
+ *
+ * @param[in] p_src         Pointer to the data to be compressed.
+ * @param src_size          Length in bytes of the data to be compressed.
+ * @param window_size       Length in bytes of the window of the last decompressed bytes that the MCU/MPU keeps in RAM,
+ *                          which must be a power of 2 of at least 256 and at most 65536.
+ * @param level             Compression level, from @ref LZ4_ENCODER_MIN_LEVEL up to @ref LZ4_ENCODER_MAX_LEVEL .
+ * @param[out] pp_dst       Pointer to where the pointer towards the compressed data will be written into, whose memory
+ *                          is allocated by this function and has to be freed by the caller with "free()".
+ * @param[out] p_dst_size   Pointer to where the length in bytes of the compressed data will be written into, which is
+ *                          padded with zeros to a multiple of 4 bytes.
+ *
+ * @retval	LZ4_ENCODER_EC_OK
+ * @retval	LZ4_ENCODER_EC_ERR
+ */
+Lz4Encoder_Status lz4_encoder_compress(const uint8_t *p_src, uint32_t src_size, uint32_t window_size, uint8_t level,
+                                       uint8_t **pp_dst, uint32_t *p_dst_size);
+
+#endif /* LZ4_ENCODER_H_ */
+
+/** @} */
@@ -0,0 +1,107 @@
+/** @addtogroup rs_encoder
+ * @{
+ */
+
+#include "rs_encoder.h"
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+#include <string.h> // Library from which "memmove()" and "memset()" are located at.
+
+#define RS_ENCODER_GF_ORDER     (255U)      /**< @brief Number of non-zero elements of GF(2^8), which is also the period of the powers of its primitive element. */
+#define RS_ENCODER_GF_POLY      (0x11DU)    /**< @brief Primitive polynomial with which GF(2^8) is built. */
+
+static uint8_t Rs_Gf_Exp[2U*RS_ENCODER_GF_ORDER];           /**< @brief Global table holding the powers of the primitive element of GF(2^8), which is repeated twice so that the sum of two logarithms can be looked up without reducing it. */
+static uint8_t Rs_Gf_Log[RS_ENCODER_GF_ORDER + 1U];         /**< @brief Global table holding the logarithms, in base of the primitive element of GF(2^8), of its non-zero elements. */
+static uint8_t Rs_Generator[RS_ENCODER_PARITY_SIZE + 1U];   /**< @brief Global array holding the coefficients of the generator polynomial, which is the product of <tt>(x - 2^i)</tt> for \c i from \c 0 up to <tt>@ref RS_ENCODER_PARITY_SIZE - 1</tt> , from its highest degree (i.e., the leading \c 1 ) down to its lowest one. */
+static bool is_rs_encoder_ready = false;                    /**< @brief Global flag used to indicate whether @ref Rs_Gf_Exp , @ref Rs_Gf_Log and @ref Rs_Generator have already been built with a \c true , or otherwise with a \c false . */
+
+/**@brief	Multiplies two elements of GF(2^8).
+ *
+ * @param a	The first element.
+ * @param b	The second element.
+ *
+ * @return	The product of \p a and \p b .
+ */
+static uint8_t rs_gf_mul(uint8_t a, uint8_t b);
+
+/**@brief	Builds @ref Rs_Gf_Exp , @ref Rs_Gf_Log and @ref Rs_Generator , unless they have already been built.
+ */
+static void rs_encoder_init(void);
+
+uint16_t rs_encoder_get_codeword_count(uint16_t data_len)
+{
+    return (data_len + RS_ENCODER_MAX_DATA_SIZE - 1U) / RS_ENCODER_MAX_DATA_SIZE;
+}
+
+void rs_encoder_encode(const uint8_t *p_data, uint16_t data_len, uint8_t *p_parity)
+{
+    /** <b>Local variable count:</b> Number of interleaved codewords into which the block of data is split. */
+    uint16_t count = rs_encoder_get_codeword_count(data_len);
+
+    rs_encoder_init();
+    for (uint16_t j=0; j<count; j++)
+    {
+        /** <b>Local pointer parity:</b> Points to the parity bytes of the current codeword, which hold the remainder of the division of its data bytes, shifted by @ref RS_ENCODER_PARITY_SIZE , by the generator polynomial. */
+        uint8_t *parity = &p_parity[j*RS_ENCODER_PARITY_SIZE];
+        memset(parity, 0, RS_ENCODER_PARITY_SIZE);
+
+        /* Divide the data bytes of the codeword, which are every \c count -th byte of the block of data, by the generator polynomial. */
+        for (uint16_t i=j; i<data_len; i+=count)
+        {
+            /** <b>Local variable feedback:</b> Leading coefficient of the current remainder once the next data byte has been added to it. */
+            uint8_t feedback = p_data[i] ^ parity[0];
+            memmove(parity, &parity[1], RS_ENCODER_PARITY_SIZE - 1U);
+            parity[RS_ENCODER_PARITY_SIZE - 1U] = 0;
+            for (uint16_t k=0; k<RS_ENCODER_PARITY_SIZE; k++)
+            {
+                parity[k] ^= rs_gf_mul(feedback, Rs_Generator[k + 1U]);
+            }
+        }
+    }
+}
+
+static uint8_t rs_gf_mul(uint8_t a, uint8_t b)
+{
+    if ((a == 0) || (b == 0))
+    {
+        return 0;
+    }
+    return Rs_Gf_Exp[Rs_Gf_Log[a] + Rs_Gf_Log[b]];
+}
+
+static void rs_encoder_init(void)
+{
+    /** <b>Local variable x:</b> Current power of the primitive element of GF(2^8). */
+    uint16_t x = 1;
+
+    if (is_rs_encoder_ready)
+    {
+        return;
+    }
+
+    /* Build the tables of the powers and of the logarithms of the primitive element. */
+    for (uint16_t i=0; i<RS_ENCODER_GF_ORDER; i++)
+    {
+        Rs_Gf_Exp[i] = (uint8_t) x;
+        Rs_Gf_Exp[i + RS_ENCODER_GF_ORDER] = (uint8_t) x;
+        Rs_Gf_Log[x] = (uint8_t) i;
+        x <<= 1;
+        if (x & 0x100U)
+        {
+            x ^= RS_ENCODER_GF_POLY;
+        }
+    }
+
+    /* Multiply the generator polynomial by each <tt>(x - 2^i)</tt> . */
+    memset(Rs_Generator, 0, sizeof(Rs_Generator));
+    Rs_Generator[0] = 1;
+    for (uint16_t i=0; i<RS_ENCODER_PARITY_SIZE; i++)
+    {
+        for (uint16_t k=i+1; k>0; k--)
+        {
+            Rs_Generator[k] ^= rs_gf_mul(Rs_Generator[k - 1], Rs_Gf_Exp[i]);
+        }
+    }
+    is_rs_encoder_ready = true;
+}
+
+/** @} */
@@ -0,0 +1,46 @@
+/** @file
+ * @brief	Reed-Solomon Encoder header file for host machines.
+ *
+ * @defgroup rs_encoder Reed-Solomon Encoder module
+ * @{
+ *
+ * @brief	This module provides the functions required to calculate, in the host machines, the Reed-Solomon parity
+ *          bytes with which the MCUs/MPUs are able to repair the bytes of a block of data that get corrupted on their
+ *          way from the host machine.
+ *
+ * @details	The block of data is split into @ref rs_encoder_get_codeword_count interleaved RS(255,239) codewords over
+ *          GF(2^8) (with the primitive polynomial \c 0x11D and with the first consecutive root of the generator
+ *          polynomial being \c 1 ), such that the data byte number \c i belongs to the codeword number
+ *          <tt>i % count</tt> , which is the format that is described in the @ref rs_decoder module of the MCU/MPU.
+ *          Each codeword carries @ref RS_ENCODER_PARITY_SIZE parity bytes, which are given right after the whole block
+ *          of data in the order of the codewords.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef RS_ENCODER_H_
+#define RS_ENCODER_H_
+
+#define RS_ENCODER_BLOCK_SIZE       (255U)  /**< @brief Length in bytes of a whole (i.e., not shortened) Reed-Solomon codeword, including its parity bytes. */
+#define RS_ENCODER_PARITY_SIZE      (16U)   /**< @brief Number of parity bytes of each Reed-Solomon codeword, with which up to half of that many corrupted bytes can be repaired by the MCU/MPU in each of them. */
+#define RS_ENCODER_MAX_DATA_SIZE    (RS_ENCODER_BLOCK_SIZE - RS_ENCODER_PARITY_SIZE)    /**< @brief Maximum number of data bytes of each Reed-Solomon codeword. */
+
+/**@brief	Gets the number of interleaved codewords into which a block of data is split.
+ *
+ * @param data_len	Length in bytes of the block of data.
+ *
+ * @return	The number of codewords, which is <tt>ceil( \p data_len / @ref RS_ENCODER_MAX_DATA_SIZE )</tt> .
+ */
+uint16_t rs_encoder_get_codeword_count(uint16_t data_len);
+
+/**@brief	Calculates the parity bytes of a block of data.
+ *
+ * @param[in] p_data    Pointer to the block of data.
+ * @param data_len      Length in bytes of the block of data.
+ * @param[out] p_parity Pointer to where the parity bytes will be written into, which must be able to hold
+ *                      <tt>@ref rs_encoder_get_codeword_count ( \p data_len ) * @ref RS_ENCODER_PARITY_SIZE</tt> bytes.
+ */
+void rs_encoder_encode(const uint8_t *p_data, uint16_t data_len, uint8_t *p_parity);
+
+#endif /* RS_ENCODER_H_ */
+
+/** @} */
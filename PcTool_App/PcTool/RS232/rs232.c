@@ -284,6 +284,32 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 }
 
 
+int RS232_WaitForData(int comport_number, int timeout_ms)
+{
+  struct pollfd pfd;
+  int n;
+
+  pfd.fd = Cport[comport_number];
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+
+  n = poll(&pfd, 1, timeout_ms);
+  if(n < 0)
+  {
+    if(errno == EINTR)  return 0;
+
+    return(-1);
+  }
+
+  if((n > 0) && !(pfd.revents & POLLIN))
+  {
+    return(-1);
+  }
+
+  return(n > 0);
+}
+
+
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
   int n = write(Cport[comport_number], &byte, 1);
@@ -731,6 +757,34 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 }
 
 
+int RS232_WaitForData(int comport_number, int timeout_ms)
+{
+    COMSTAT status;
+    DWORD errors;
+    DWORD start = GetTickCount();
+
+    while(1)
+    {
+        if(!ClearCommError(Cport[comport_number], &errors, &status))
+        {
+            return(-1);
+        }
+
+        if(status.cbInQue > 0)
+        {
+            return(1);
+        }
+
+        if((int)(GetTickCount() - start) >= timeout_ms)
+        {
+            return(0);
+        }
+
+        Sleep(1);
+    }
+}
+
+
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
     int n;
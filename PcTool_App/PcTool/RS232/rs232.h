@@ -76,6 +76,7 @@ extern "C" {
 #include <limits.h>
 #include <sys/file.h>
 #include <errno.h>
+#include <poll.h>
 
 #else
 
@@ -122,6 +123,24 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode, int fl
  */
 int RS232_PollComport(int comport_number, unsigned char *buf, int size);
 
+/**@brief   Waits until there is some data received from the Serial Port that is ready to be read with
+ *          @ref RS232_PollComport or until a given timeout expires, whichever happens first.
+ *
+ * @details On Linux and FreeBSD, this is done with the @ref poll function over the file descriptor of the Serial Port,
+ *          such that this function returns the moment that data arrives. On Windows, the input queue of the Serial
+ *          Port is checked each millisecond instead.
+ *
+ * @param comport_number    The converted value of the actual comport that was requested by the user but into its
+ *                          equivalent for the @ref teuniz_rs232_library (For more details, see the Table from
+ *                          @ref teuniz_rs232_library ).
+ * @param timeout_ms        Maximum time in milliseconds to wait for data to be received.
+ *
+ * @retval                  1 If there is data ready to be read from the Serial Port.
+ * @retval                  0 If the timeout expired (or the wait was interrupted) without any data being received.
+ * @retval                  -1 If an error occurred on the Serial Port.
+ */
+int RS232_WaitForData(int comport_number, int timeout_ms);
+
 /**@brief   Sends a byte of data over the Serial Port using the RS232 protocol from the @ref teuniz_rs232_library .
  *
  * @param comport_number    The converted value of the actual comport that was requested by the user but into its
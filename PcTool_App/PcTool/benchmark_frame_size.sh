@@ -0,0 +1,31 @@
+#!/bin/bash
+# Run this bash file to measure the throughput with which the ETX OTA Data Type Packets are sent to the external device
+# at different frame sizes (i.e., the size of their "Data" field).
+# The etx_ota_protocol_host.c program is compiled once per frame size with "ETX_OTA_FRAME_SIZE" set to it, and with
+# the delta updates, the compression and the resume of interrupted transfers disabled so that every run sends the whole
+# Payload. Each run then prints the throughput that it got, as measured by the host.
+# NOTE: The external device limits the frame size to the one that it advertises (see "ETX_OTA_DATA_MAX_SIZE" in its
+#       "etx_ota_config.h" file), and the ones that do not negotiate it always receive frames of 1024 bytes.
+# Usage: ./benchmark_frame_size.sh COMPORT_NUM PAYLOAD_PATH ETX_OTA_Payload_t [FRAME_SIZE ...]
+if [ $# -lt 3 ]; then
+    echo "Usage: $0 COMPORT_NUM PAYLOAD_PATH ETX_OTA_Payload_t [FRAME_SIZE ...]"
+    exit 1
+fi
+COMPORT_NUM=$1
+PAYLOAD_PATH=$2
+PAYLOAD_TYPE=$3
+shift 3
+FRAME_SIZES=${*:-256 512 1024 2048 4096}
+
+RESULTS=""
+for FRAME_SIZE in $FRAME_SIZES; do
+    echo "Benchmarking ETX OTA Data Type Packets of $FRAME_SIZE bytes..."
+    gcc main.c etx_ota_protocol_host.c RS232/rs232.c CRC32_MPEG2/crc32_mpeg2.c BSDIFF/bsdiff.c LZ4/lz4_encoder.c IMAGE_PARSER/image_parser.c REED_SOLOMON/rs_encoder.c -IRS232 -O2 \
+        -DETX_OTA_FRAME_SIZE="$FRAME_SIZE" -DETX_OTA_DELTA_UPDATE=0 -DETX_OTA_COMPRESSION=0 -DETX_OTA_RESUME=0 -o etx_ota_benchmark || exit 1
+    RESULT=$(./etx_ota_benchmark "$COMPORT_NUM" "$PAYLOAD_PATH" "$PAYLOAD_TYPE" | grep "^Throughput = " | tail -n 1)
+    RESULTS="$RESULTS$FRAME_SIZE: ${RESULT:-the ETX OTA Process has failed}\n"
+done
+rm -f etx_ota_benchmark
+
+echo "Requested frame size (bytes): result"
+printf "%b" "$RESULTS"
@@ -35,15 +35,23 @@
 #endif
 
 #ifndef FLASH_PAGE_SIZE_IN_BYTES
-#define FLASH_PAGE_SIZE_IN_BYTES	        (1024U)			/**< @brief Flash Memory page size in bytes as defined by the MCU/MPU with which the Serial Port communication is to be established with. */
+#define FLASH_PAGE_SIZE_IN_BYTES	        (1024U)			/**< @brief Flash Memory page size in bytes as defined by the MCU/MPU with which the Serial Port communication is to be established with. @note This is only used with external devices that do not report their Flash Memory geometry in their response to the ETX OTA Start Command, whereas the one that they report is used otherwise. */
 #endif
 
 #ifndef ETX_BL_PAGE_SIZE
-#define ETX_BL_PAGE_SIZE                    (34)            /**< @brief Designated number of Flash Memory pages that have been designated for the Bootloader Firmware of the MCU/MPU with which the Serial Port communication has been established with. */
+#define ETX_BL_PAGE_SIZE                    (34)            /**< @brief Designated number of Flash Memory pages that have been designated for the Bootloader Firmware of the MCU/MPU with which the Serial Port communication has been established with. @note This is only used with external devices that do not report their Flash Memory geometry in their response to the ETX OTA Start Command, whereas the one that they report is used otherwise. */
 #endif
 
 #ifndef ETX_APP_PAGE_SIZE
-#define ETX_APP_PAGE_SIZE                   (86)            /**< @brief Designated number of Flash Memory pages that have been designated for the Application Firmware of the MCU/MPU with which the Serial Port communication has been established with. */
+#define ETX_APP_PAGE_SIZE                   (86)            /**< @brief Designated number of Flash Memory pages that have been designated for the Application Firmware of the MCU/MPU with which the Serial Port communication has been established with. @note This is only used with external devices that do not report their Flash Memory geometry in their response to the ETX OTA Start Command, whereas the one that they report is used otherwise. */
+#endif
+
+#ifndef FLASH_BASE_ADDRESS
+#define FLASH_BASE_ADDRESS                  (0x08000000U)   /**< @brief Address from which the Flash Memory of the MCU/MPU with which the Serial Port communication has been established with starts, where its Bootloader Firmware is placed and right after which its Application Firmware is placed. @details This is used to place the segments of the Firmware Images that are given as Intel HEX, Motorola S-record or ELF Files (see @ref image_parser ). @note This is only used with external devices that do not report their Flash Memory geometry in their response to the ETX OTA Start Command, whereas the addresses of the Bootloader and Application Firmware slots that they report are used otherwise. */
+#endif
+
+#ifndef ETX_OTA_PAGES_MAX_COUNT
+#define ETX_OTA_PAGES_MAX_COUNT             (512)           /**< @brief Designated maximum number of Flash Memory pages of a Firmware Image whose changed or blank pages the host can keep track of (see @ref ETX_OTA_DELTA_UPDATE ). @note Firmware Images that span more pages than these, as given by the Flash Memory geometry reported by the external device, are sent whole. */
 #endif
 
 #ifndef PAYLOAD_MAX_FILE_PATH_LENGTH
@@ -70,16 +78,104 @@
 #define RS232_IS_FLOW_CONTROL               (0)             /**< @brief Chosen Flow Control decimal value to indicate with a 1 that we want the host to run the RS232 protocol with Flow Control enabled, or otherwise with a decimal value of 0 to indicate to the host to not run the RS232 protocol with Flow Control. */
 #endif
 
+#ifndef ETX_OTA_TX_BURST_SIZE
+#define ETX_OTA_TX_BURST_SIZE               (64)            /**< @brief Designated maximum number of bytes of a certain ETX OTA Packet that the host will write at once into the Serial Port, after which the host waits for the time that those bytes take to be transmitted at the link rate given by @ref RS232_BAUDRATE before writing the next burst. */
+#endif
+
 #ifndef SEND_PACKET_BYTES_DELAY
-#define SEND_PACKET_BYTES_DELAY             (1000)          /**< @brief Designated delay in microseconds that is desired to request before having send a byte of data from a certain ETX OTA Packet that is in process of being send to the MCU. */
+#define SEND_PACKET_BYTES_DELAY             (0)             /**< @brief Designated additional delay in microseconds that is desired to request after having send each burst of bytes (see @ref ETX_OTA_TX_BURST_SIZE ) from a certain ETX OTA Packet that is in process of being send to the MCU. @note The pacing between bursts is already given by the link rate, so this delay is only needed whenever the MCU cannot keep up with the link rate (e.g., if it has its verbose mode enabled). */
+#endif
+
+#ifndef ETX_OTA_RESP_TIMEOUT
+#define ETX_OTA_RESP_TIMEOUT                (5000000)       /**< @brief Designated maximum time in microseconds that the host will wait for an ETX OTA Response Type Packet after having sent an ETX OTA Packet to the MCU, which is also the upper bound of the adaptive retransmission timeout. @details The host stops waiting the moment that a whole and valid ETX OTA Response Type Packet has been received, so this value only costs time whenever the MCU does not respond at all. @note This must give enough time for the MCU to erase the Flash Memory pages of the Firmware Image, which it does whenever it processes the first ETX OTA Data Type Packet. */
+#endif
+
+#ifndef ETX_OTA_INITIAL_RTO
+#define ETX_OTA_INITIAL_RTO                 (1000000)       /**< @brief Designated retransmission timeout in microseconds to be used before any round-trip time sample has been taken with the MCU. @details After that, the retransmission timeout is estimated from the measured round-trip times in the same way as TCP does (RFC 6298), so that fast wired links run at their real speed while slow radio links remain safe. */
+#endif
+
+#ifndef ETX_OTA_MIN_RTO
+#define ETX_OTA_MIN_RTO                     (100000)        /**< @brief Designated minimum value in microseconds that the adaptive retransmission timeout can take, which protects the ETX OTA Process from the jitter of the scheduler and of the USB-to-Serial converter of the host. */
 #endif
 
-#ifndef TEUNIZ_LIB_POLL_COMPORT_DELAY
-#define TEUNIZ_LIB_POLL_COMPORT_DELAY       (500000)        /**< @brief Designated delay in microseconds that it is to be requested to apply each time before calling the @ref RS232_PollComport function. @details For all the calls to the @ref RS232_PollComport function, this definition is called once, except in the @ref send_etx_ota_data function, where this definition is called twice.  @note The @ref teuniz_rs232_library suggests to place an interval of 100 milliseconds, but it did not worked for me that way. Instead, it worked for me with 500ms. */
+#ifndef ETX_OTA_RTT_PING_COUNT
+#define ETX_OTA_RTT_PING_COUNT              (3)             /**< @brief Designated number of ETX OTA Ping Commands that the host will send right after the ETX OTA Start Command in order to seed its round-trip time estimator. @note These are only sent if the MCU supports them (see @ref ETX_OTA_WINDOW_SIZE ). */
 #endif
 
 #ifndef TRY_AGAIN_SENDING_FWI_DELAY
-#define TRY_AGAIN_SENDING_FWI_DELAY         (9000000)       /**< @brief Designated delay in microseconds that it is to be requested to apply in case that starting an ETX OTA Transaction fails once only. @note The slave device sometimes does not get the start of an ETX OTA Transaction after its UART Timeout expires, which is expected since there is some code in the loop that the slave device has there that makes it do something else before waiting again for an ETX OTA Transaction, but that should be evaded by making a second attempt with the delay established in this variable. */
+#define TRY_AGAIN_SENDING_FWI_DELAY         (9000000)       /**< @brief Designated delay in microseconds that it is to be requested to apply in case that starting an ETX OTA Transaction fails once only. @note The slave device sometimes does not get the start of an ETX OTA Transaction after its UART Timeout expires, which is expected since there is some code in the loop that the slave device has there that makes it do something else before waiting again for an ETX OTA Transaction, but that should be evaded by making a second attempt with the delay established in this variable. @note This delay is only applied with external devices that do not support the ETX OTA Sync Command, since the others are synchronized with right away (see @ref ETX_OTA_SYNC_INTERVAL ). */
+#endif
+
+#ifndef ETX_OTA_SYNC_INTERVAL
+#define ETX_OTA_SYNC_INTERVAL               (100000)        /**< @brief Designated time in microseconds that the host will wait for the response to each ETX OTA Sync Command before sending the resync sequence and trying again. @details The external device answers that Command right away whenever it is listening for ETX OTA Packets, and it also sends a READY beacon each time that it starts to listen for them, upon which the host retries right away instead. */
+#endif
+
+#ifndef ETX_OTA_SYNC_MAX_TIME
+#define ETX_OTA_SYNC_MAX_TIME               (90000000)      /**< @brief Designated maximum time in microseconds that the host will keep trying to synchronize with the external device via the ETX OTA Sync Command before giving up. */
+#endif
+
+#ifndef ETX_OTA_WINDOW_SIZE
+#define ETX_OTA_WINDOW_SIZE                 (4)             /**< @brief Designated number of ETX OTA Data Type Packets that the host will request to send in a single burst (i.e., the window size) before waiting for a single cumulative ACK from the external device. @details The window size is negotiated via the ETX OTA Start Command, where the external device may grant a smaller window size, and where external devices that do not support the windowed transfer mode will make the host fall back to acknowledging each ETX OTA Data Type Packet individually. @note A value of \c 1 disables the windowed transfer mode altogether. */
+#endif
+
+#ifndef ETX_OTA_FRAME_SIZE
+#define ETX_OTA_FRAME_SIZE                  (0)             /**< @brief Designated size in bytes of the "Data" field of the ETX OTA Data Type Packets (i.e., the frame size) that the host will send to the external devices that negotiate it, which is limited to the one that they advertise and to @ref ETX_OTA_FRAME_SIZE_MAX . @details With a value of \c 0 , the host picks the frame size from its estimate of the link with the external device instead (see @ref ETX_OTA_FRAME_TARGET_TIME ). @note This is meant to compare the throughput given by different frame sizes (e.g., via the benchmark_frame_size.sh script), and it must be a multiple of 4. */
+#endif
+
+#ifndef ETX_OTA_FRAME_SIZE_MAX
+#define ETX_OTA_FRAME_SIZE_MAX              (4096U)         /**< @brief Designated maximum size in bytes of the "Data" field of the ETX OTA Data Type Packets that the host will send, which sizes its buffers. @note This must be a multiple of 4 of at least 1024, since that is the frame size of the external devices that do not negotiate it. */
+#endif
+
+#ifndef ETX_OTA_FRAME_TARGET_TIME
+#define ETX_OTA_FRAME_TARGET_TIME           (100000)        /**< @brief Designated maximum time in microseconds that each ETX OTA Data Type Packet should take over the link with the external device whenever the frame size is picked by the host (i.e., if @ref ETX_OTA_FRAME_SIZE is \c 0 ). @details The host picks the largest power of 2 frame size, of at least 256 bytes, that stays within this time at the effective link rate, so that fast links amortize the per-Packet overhead and round trips with large frames while slow or high-latency links (e.g., BLE) lose less data per corrupted Packet with small ones. */
+#endif
+
+#ifndef ETX_OTA_BAUD_RATE_UPGRADE
+#define ETX_OTA_BAUD_RATE_UPGRADE           (115200)        /**< @brief Designated Baud rate to which the host will request the external device to switch right after the ETX OTA Start Command via the ETX OTA Baud Rate Command, but only up to the one advertised by the external device, or \c 0 to keep @ref RS232_BAUDRATE for the whole ETX OTA Process. @details This defaults to @ref RS232_BAUDRATE , since the Custom Bootloader clocks its UARTs at 2MHz and therefore cannot go beyond 125000 (i.e., no faster Baud rate that the @ref teuniz_rs232_library supports can be reached). Raise this (e.g., to 921600) only if that clock has been raised as well. @details Both the host and the external device switch after the ACK to that Command and confirm the new Baud rate with an ETX OTA Ping Command, or otherwise both of them fall back to @ref RS232_BAUDRATE . @note This must be a Baud rate supported by the @ref teuniz_rs232_library . */
+#endif
+
+#ifndef ETX_OTA_BAUD_CONFIRM_PINGS
+#define ETX_OTA_BAUD_CONFIRM_PINGS          (3)             /**< @brief Designated number of ETX OTA Ping Commands that the host will send at the new Baud rate, within the confirmation time advertised by the external device, before giving up on it and falling back to @ref RS232_BAUDRATE . */
+#endif
+
+#ifndef ETX_OTA_WINDOW_ACK_TIMEOUT
+#define ETX_OTA_WINDOW_ACK_TIMEOUT          (5000000)       /**< @brief Designated maximum time in microseconds that the host will wait for the cumulative ACK of a windowed burst, counted from the moment that the whole burst has been sent. @note This must give enough time for the external device to program a whole burst into its Flash Memory, which includes erasing it on the first burst. */
+#endif
+
+#ifndef ETX_OTA_WINDOW_MAX_RETRIES
+#define ETX_OTA_WINDOW_MAX_RETRIES          (3)             /**< @brief Designated maximum number of consecutive windowed bursts that can be acknowledged by the external device without any progress before the host concludes the ETX OTA Process with an error. */
+#endif
+
+#ifndef ETX_OTA_DATA_MAX_RETRIES
+#define ETX_OTA_DATA_MAX_RETRIES            (3)             /**< @brief Designated maximum number of consecutive times that the host will re-send an ETX OTA Data Type Packet that the external device has NACKed before concluding the ETX OTA Process with an error. @details The host requests the external device, via the flags byte of the ETX OTA Start Command, to NACK the ETX OTA Data Type Packets that it rejects with their reason (e.g., a CRC mismatch) and with the offset of the Payload from which to re-send, so that only those are re-sent instead of starting the whole ETX OTA Transaction again. @note A value of \c 0 makes the host not request it, so that any NACK concludes the ETX OTA Process with an error, as it happens with the external devices that do not grant it. */
+#endif
+
+#ifndef ETX_OTA_DATA_V2
+#define ETX_OTA_DATA_V2                     (1)             /**< @brief Flag used to request the external device, via the flags byte of the ETX OTA Start Command, to receive the Payload via ETX OTA Data v2 Type Packets with a 1 or, otherwise, to keep the ETX OTA Data Type Packets with a 0. @details The ETX OTA Data v2 Type Packets carry the offset of the Payload at which their data starts, so that the external device acknowledges again, without writing them, the ones that it has already received. This allows the host to re-send an ETX OTA Data Type Packet as soon as its retransmission timeout expires, instead of waiting for the whole response timeout, since a lost ACK no longer makes the external device write the same data twice. @note The external devices that do not grant it keep receiving ETX OTA Data Type Packets. */
+#endif
+
+#ifndef ETX_OTA_FEC
+#define ETX_OTA_FEC                         (2)             /**< @brief Designated mode in which the host sends the Reed-Solomon parity bytes of the ETX OTA Data Type Packets to the external devices that accept them, with which those devices repair, in place, a few bytes that get corrupted on the way (e.g., over the radio link of the HM-10 BT Device) instead of having the host re-send the whole Packet plus a round trip. @details The following are the possible values:<br><br>* 0 = Never send the parity bytes.<br>* 1 = Send the parity bytes along with every ETX OTA Data Type Packet.<br>* 2 = Only start sending them once the measured rate of corrupted or lost ETX OTA Data Type Packets reaches @ref ETX_OTA_FEC_ERROR_RATE . @note The parity bytes take up to 16 bytes for every 239 bytes of the "Data" field, which is why the frame size is reduced accordingly whenever the external device accepts them (unless this is 0). */
+#endif
+
+#ifndef ETX_OTA_FEC_ERROR_RATE
+#define ETX_OTA_FEC_ERROR_RATE              (30)            /**< @brief Designated smoothed rate, in parts per thousand, of the responses that reveal corrupted or lost ETX OTA Data Type Packets from which the host starts sending their Reed-Solomon parity bytes whenever @ref ETX_OTA_FEC is 2. @note Each of those responses raises the smoothed rate by about 62 parts per thousand, and each clean one lowers it by a 1/16th. */
+#endif
+
+#ifndef ETX_OTA_DELTA_UPDATE
+#define ETX_OTA_DELTA_UPDATE                (1)             /**< @brief Flag used to make the host send only the Flash Memory pages of a Firmware Image that differ from the ones of the Firmware Image that is currently installed in the external device with a \c 1 , or otherwise the whole Firmware Image with a \c 0 . @details The host requests the 32-bit CRC of each installed page via the ETX OTA Page CRC Command, and then skips the unchanged ones via the ETX OTA Seek Command, while the external device still validates the 32-bit CRC of the whole Firmware Image at the end. @note This is only done with external devices that report supporting it in their response to the ETX OTA Start Command, whereas the whole Firmware Image is sent to any other one. */
+#endif
+
+#ifndef ETX_OTA_COMPRESSION
+#define ETX_OTA_COMPRESSION                 (1)             /**< @brief Flag used to make the host send the Payloads compressed with LZ4 (see @ref lz4_encoder ) with a \c 1 , or otherwise uncompressed with a \c 0 . @details The compression level is chosen from the effective link rate with the external device, and the Payload is only sent compressed if that makes it smaller than the bytes that would otherwise be sent (i.e., the changed Flash Memory pages whenever only those are sent). @note This is only done with external devices that report supporting it in their response to the ETX OTA Start Command, whereas the Payload is sent uncompressed to any other one. */
+#endif
+
+#ifndef ETX_OTA_RESUME
+#define ETX_OTA_RESUME                      (1)             /**< @brief Flag used to make the host resume an interrupted ETX OTA Transaction of an Application Firmware Image from the last Flash Memory page that the external device checkpointed with a \c 1 , or otherwise to always send it from the start with a \c 0 . @details The host keeps a Transfer Journal of each Application Firmware Image that it sends in a File next to it (see @ref ETX_OTA_JOURNAL_INTERVAL ), and it only resumes whenever both that Transfer Journal and the checkpoint reported by the external device belong to the same Application Firmware Image (i.e., same size and same 32-bit CRC). @note This is only done with external devices that report supporting it, along with the ETX OTA Page CRC and Seek Commands (see @ref ETX_OTA_DELTA_UPDATE ), in their response to the ETX OTA Start Command. */
+#endif
+
+#ifndef ETX_OTA_JOURNAL_INTERVAL
+#define ETX_OTA_JOURNAL_INTERVAL            (8192U)         /**< @brief Designated number of bytes of the Payload that have to be acknowledged by the external device before the host updates its Transfer Journal again (see @ref ETX_OTA_RESUME ). */
 #endif
 
 #ifndef CUSTOM_DATA_MAX_SIZE
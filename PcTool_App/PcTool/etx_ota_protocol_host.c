@@ -4,12 +4,25 @@
 
 #include "etx_ota_protocol_host.h"
 #include "RS232/rs232.h" // Library for using RS232 protocol.
+#include "CRC32_MPEG2/crc32_mpeg2.h" // Library for calculating the 32-bit CRC (MPEG-2) of the ETX OTA Packets.
+#include "BSDIFF/bsdiff.h" // Library for generating the binary patches of the Application Firmware Images.
+#include "LZ4/lz4_encoder.h" // Library for compressing the Payloads.
+#include "IMAGE_PARSER/image_parser.h" // Library for loading the Firmware Images that are given as Intel HEX, Motorola S-record or ELF Files.
+#include "REED_SOLOMON/rs_encoder.h" // Library for calculating the Reed-Solomon parity bytes of the ETX OTA Data Type Packets.
 #include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+#include "etx_ota_start_resp.h" // Library that defines the layout of the response of the external device to an ETX OTA Start Command, which is shared with its firmware.
 #include <stdlib.h>
 #include <stdio.h>	// Library from which "printf()" is located at.
 #include <stdbool.h> // Library from which the "bool" type is located at.
 #include <unistd.h> // Library for using the "usleep()" function.
 #include <stdarg.h>
+#include <time.h> // Library from which the "clock_gettime()" function is located at.
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <sys/mman.h> // Library from which the "mmap()" function is located at.
+#elif defined(_WIN32)
+#include <windows.h> // Library from which the "CreateFileMapping()" and "MapViewOfFile()" functions are located at.
+#include <io.h> // Library from which the "_get_osfhandle()" function is located at.
+#endif
 
 
 
@@ -60,7 +73,8 @@ typedef enum
     ETX_OTA_PACKET_TYPE_CMD       = 0U,   	//!< ETX OTA Command Type Packet. @details This Packet Type is expected to be send by the host to the external device (connected to it via @ref COMPORT_NUMBER ) to request a certain ETX OTA Command to that external device (see @ref ETX_OTA_Command ).
     ETX_OTA_PACKET_TYPE_DATA      = 1U,   	//!< ETX OTA Data Type Packet. @details This Packet Type will contain either the full or a part/chunk of a Payload being send from the host to our external device (connected to it via @ref COMPORT_NUMBER ).
     ETX_OTA_PACKET_TYPE_HEADER    = 2U,   	//!< ETX OTA Header Type Packet. @details This Packet Type will provide the size in bytes of the Payload that the external device (connected to it via @ref COMPORT_NUMBER ) will receive, its recorded 32-bits CRC and the Type of Pyaload data to be received (i.e., @ref ETX_OTA_Payload_t ).
-    ETX_OTA_PACKET_TYPE_RESPONSE  = 3U		//!< ETX OTA Response Type Packet. @details This Packet Type contains a response from the external device (connected to it via @ref COMPORT_NUMBER ) that is given to the host to indicate to it whether or not that external device was able to successfully process the latest request or Packet from the host.
+    ETX_OTA_PACKET_TYPE_RESPONSE  = 3U,		//!< ETX OTA Response Type Packet. @details This Packet Type contains a response from the external device (connected to it via @ref COMPORT_NUMBER ) that is given to the host to indicate to it whether or not that external device was able to successfully process the latest request or Packet from the host.
+    ETX_OTA_PACKET_TYPE_DATA_V2   = 4U      //!< ETX OTA Data v2 Type Packet. @details This Packet Type is the same as @ref ETX_OTA_PACKET_TYPE_DATA , except that its "Data" field starts with the 4-byte offset of the Payload at which its data starts, so that the external device (connected to it via @ref COMPORT_NUMBER ) acknowledges again, without writing them, the ones that it has already received. @note This Packet Type is only sent to external devices that set @ref ETX_OTA_EXT_FEATURE_DATA_V2 in their response to the ETX OTA Start Command.
 } ETX_OTA_Packet_t;
 
 /**@brief	ETX OTA Commands definitions.
@@ -70,9 +84,14 @@ typedef enum
  */
 typedef enum
 {
-    ETX_OTA_CMD_START = 0U,		    //!< ETX OTA Firmware Update Start Command. @details This command indicates to the MCU/MPU that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to start an ETX OTA Process.
+    ETX_OTA_CMD_START = 0U,		    //!< ETX OTA Firmware Update Start Command. @details This command indicates to the MCU/MPU that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to start an ETX OTA Process. @details If the host appends a second byte to the "Data" field of this Command, then that byte requests the windowed transfer mode with the given window size (see @ref ETX_OTA_WINDOW_SIZE ), to which an external device supporting it will respond with an ACK carrying the window size that it grants.
     ETX_OTA_CMD_END   = 1U,    		//!< ETX OTA Firmware Update End command. @details This command indicates to the MCU/MPU that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to end the current ETX OTA Process.
-    ETX_OTA_CMD_ABORT = 2U    		//!< ETX OTA Abort Command. @details This command is used by the host to request to the external device that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to abort whatever ETX OTA Process that external device is working on. @note Unlike the other Commands, this one can be legally requested to the external device at any time and as many times as the host wants to.
+    ETX_OTA_CMD_ABORT = 2U,    		//!< ETX OTA Abort Command. @details This command is used by the host to request to the external device that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to abort whatever ETX OTA Process that external device is working on. @note Unlike the other Commands, this one can be legally requested to the external device at any time and as many times as the host wants to.
+    ETX_OTA_CMD_PING  = 3U,    		//!< ETX OTA Ping Command. @details This command is used by the host to measure the round-trip time of its link with the external device that the host is connected to (connected to to it via @ref COMPORT_NUMBER ), to which that device will just respond with an ACK without changing the state of its current ETX OTA Process. @note This command is only sent to external devices that granted the windowed transfer mode in their response to the ETX OTA Start Command, since older firmwares would consider it an invalid command.
+    ETX_OTA_CMD_PAGE_CRC = 4U,      //!< ETX OTA Page CRC Command. @details This command is used by the host to request the 32-bit CRCs of up to @ref ETX_OTA_PAGE_CRC_MAX_COUNT Flash Memory pages of the Firmware Image that is currently installed in the external device (connected to it via @ref COMPORT_NUMBER ), to which that device will respond with an ACK carrying those 32-bit CRCs. @details The "Data" field of this Command holds the Command byte, followed by the 2-byte index of the first requested page and then by the 1-byte number of requested pages. @note This command is only sent to external devices that set @ref ETX_OTA_FEATURE_DELTA_UPDATE in their response to the ETX OTA Start Command.
+    ETX_OTA_CMD_SEEK  = 5U,         //!< ETX OTA Seek Command. @details This command is used by the host, during the ETX OTA Data State, to skip the Flash Memory pages that it found to be unchanged via the ETX OTA Page CRC Command, which the external device (connected to it via @ref COMPORT_NUMBER ) keeps in place instead of receiving them. @details The "Data" field of this Command holds the Command byte, followed by the 4-byte offset of the Payload from which the host continues and then by the 4-byte length of the run of the Payload that it will send from there. @note This command is only sent to external devices that set @ref ETX_OTA_FEATURE_DELTA_UPDATE in their response to the ETX OTA Start Command.
+    ETX_OTA_CMD_BAUD_RATE = 6U,     //!< ETX OTA Baud Rate Command. @details This command is used by the host, right after the ETX OTA Start Command, to request the external device that the host is connected to (connected to to it via @ref COMPORT_NUMBER ) to switch its UART to a faster Baud rate, to which both of them switch after the ACK to this Command (see @ref upgrade_etx_ota_baud_rate ). @details The "Data" field of this Command holds the Command byte, followed by the 4-byte Baud rate. @note The host only sends this command if the external device has set @ref ETX_OTA_FEATURE_BAUD_RATE in its response to the ETX OTA Start Command.
+    ETX_OTA_CMD_SYNC  = 7U          //!< ETX OTA Sync Command. @details This command is used by the host, before the ETX OTA Start Command, to synchronize with the external device that the host is connected to (connected to to it via @ref COMPORT_NUMBER ), which stops any ongoing ETX OTA Process there and answers right away with an ACK that echoes the sequence number of this Command (see @ref sync_etx_ota ). @details The "Data" field of this Command holds the Command byte, followed by the 1-byte sequence number. @note External devices that do not support this Command respond to it with a NACK, in which case the host falls back to the ETX OTA Abort Command.
 } ETX_OTA_Command;
 
 /**@brief	Response Status definitions available in the ETX OTA Protocol.
@@ -85,9 +104,25 @@ typedef enum
 typedef enum
 {
     ETX_OTA_ACK  = 0U,   		//!< Acknowledge (ACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has been processed successfully by the external device (connected to it via @ref COMPORT_NUMBER ).
-    ETX_OTA_NACK   = 1U   		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by the external device (connected to it via @ref COMPORT_NUMBER ).
+    ETX_OTA_NACK   = 1U,  		//!< Not Acknowledge (NACK) data byte used in an ETX OTA Response Type Packet to indicate to the host that the latest ETX OTA Packet has not been processed successfully by the external device (connected to it via @ref COMPORT_NUMBER ).
+    ETX_OTA_READY  = 2U         //!< READY beacon data byte used in an ETX OTA Response Type Packet that the external device (connected to it via @ref COMPORT_NUMBER ) sends, without being requested to, each time that it starts to listen for ETX OTA Packets. @details Receiving it means that any ETX OTA Packet that the host was waiting a response for has been lost, and that the external device will answer the next one right away.
 } ETX_OTA_Response_Status;
 
+/**@brief	NACK Reason definitions available in the ETX OTA Protocol.
+ *
+ * @details	Whenever the external device (connected to it via @ref COMPORT_NUMBER ) has granted the request of
+ *          @ref ETX_OTA_START_FLAG_NACK_REASON , the NACKs that it gives to the ETX OTA Data Type Packets carry one of
+ *          these reasons, followed by the offset of the Payload from which the host has to re-send. All of them let the
+ *          ETX OTA Transaction continue, except for @ref ETX_OTA_NACK_REASON_FLASH .
+ */
+typedef enum
+{
+    ETX_OTA_NACK_REASON_CRC       = 1U,     //!< The ETX OTA Packet got corrupted on its way to the external device, either in its 32-bit CRC or in any of its SOF, Packet Type or EOF fields.
+    ETX_OTA_NACK_REASON_LENGTH    = 2U,     //!< The external device rejected the "Data Length" field of the ETX OTA Packet.
+    ETX_OTA_NACK_REASON_FLASH     = 3U,     //!< The external device could not program its Flash Memory at the given offset, which ends the ETX OTA Transaction. This NACK may also come unsolicited, in place of the response to any later ETX OTA Packet, whenever the external device acknowledged the ETX OTA Data Type Packets before programming them.
+    ETX_OTA_NACK_REASON_SEQUENCE  = 4U      //!< The external device received an ETX OTA Packet other than an ETX OTA Data Type Packet in the middle of the ETX OTA Data State.
+} ETX_OTA_Nack_Reason;
+
 /**@brief	ETX OTA Command Type Packet's parameters structure.
  *
  * @details	This structure contains all the fields of an ETX OTA Packet of @ref ETX_OTA_PACKET_TYPE_CMD Type.
@@ -136,7 +171,7 @@ typedef struct __attribute__ ((__packed__)) {
 typedef struct __attribute__ ((__packed__)) {
     uint32_t 	package_size;		//!< Total length/size in bytes of the data expected to be received by our external device (connected to it via @ref COMPORT_NUMBER ) from the host via all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packet(s) (i.e., in a Data Type Packet or Packets) to be received.
     uint32_t 	package_crc;		//!< 32-bit CRC of the whole data to be obtained from all the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets).
-    uint32_t 	reserved1;			//!< 32-bits reserved for future changes on this firmware.
+    uint32_t 	reserved1;			//!< Size in bytes of the compressed Payload whenever @ref ETX_OTA_PAYLOAD_COMPRESSED_FLAG is set in the \c payload_type field, or otherwise 32-bits reserved for future changes on this firmware.
     uint16_t 	reserved2;			//!< 16-bits reserved for future changes on this firmware.
     uint8_t 	reserved3;			//!< 8-bits reserved for future changes on this firmware.
     uint8_t		payload_type;	    //!< Expected payload type to be received from the @ref ETX_OTA_PACKET_TYPE_DATA Type Packets (i.e., in a Data Type Packets). @note see @ref ETX_OTA_Payload_t to learn about the available Payload Types.
@@ -257,6 +292,11 @@ typedef struct __attribute__ ((__packed__)) {
  * </table>
  *
  * where B = byte(s).
+ *
+ * @note	Whenever the host has requested the windowed transfer mode, the "Status" field can be followed by additional
+ *          bytes within the "Data" field (i.e., the granted window size in the response to the Start Command, and the
+ *          4-byte offset of the next expected Payload byte in the cumulative ACK of each burst), in which case the
+ *          "Len" and "CRC" fields will take them into account as well.
  */
 typedef struct __attribute__ ((__packed__)) {
     uint8_t   sof;				//!< Start of Frame (SOF). @details All ETX OTA Packets must start with a SOF byte, whose value is @ref ETX_OTA_SOF .
@@ -268,36 +308,123 @@ typedef struct __attribute__ ((__packed__)) {
 } ETX_OTA_Response_Packet_t;
 
 #define ETX_OTA_DATA_OVERHEAD 		    (ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE + ETX_OTA_CRC32_SIZE + ETX_OTA_EOF_SIZE)  	/**< @brief Data overhead in bytes of an ETX OTA Packet, which represents the bytes of an ETX OTA Packet except for the ones that it has at the Data field. */
-#define ETX_OTA_PACKET_MAX_SIZE 	    (ETX_OTA_DATA_MAX_SIZE + ETX_OTA_DATA_OVERHEAD)	                                                                    /**< @brief Total bytes in an ETX OTA Packet. */
+#define ETX_OTA_PACKET_MAX_SIZE 	    (ETX_OTA_FRAME_SIZE_MAX + ETX_OTA_DATA_OVERHEAD)	                                                                    /**< @brief Total bytes in an ETX OTA Packet. */
 #define ETX_OTA_DATA_FIELD_INDEX	    (ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE)                                            /**< @brief Index position of where the Data field bytes of a ETX OTA Packet starts at. */
-#define ETX_OTA_BL_FW_SIZE              (FLASH_PAGE_SIZE_IN_BYTES * ETX_BL_PAGE_SIZE)   /**< @brief Maximum size allowable for a Bootloader Firmware Image to have. */
-#define ETX_OTA_APP_FW_SIZE             (FLASH_PAGE_SIZE_IN_BYTES * ETX_APP_PAGE_SIZE)  /**< @brief Maximum size allowable for an Application Firmware Image to have. */
-#define ETX_OTA_MAX_FW_SIZE             (ETX_OTA_APP_FW_SIZE)                           /**< @brief Maximum size allowable for a Firmware Image to have. */
+#define ETX_OTA_BL_FW_SIZE              (FLASH_PAGE_SIZE_IN_BYTES * ETX_BL_PAGE_SIZE)   /**< @brief Maximum size allowable for a Bootloader Firmware Image to have with external devices that do not report their Flash Memory geometry (see @ref etx_ota_bl_fw_size ). */
+#define ETX_OTA_APP_FW_SIZE             (FLASH_PAGE_SIZE_IN_BYTES * ETX_APP_PAGE_SIZE)  /**< @brief Maximum size allowable for an Application Firmware Image to have with external devices that do not report their Flash Memory geometry (see @ref etx_ota_app_fw_size ). */
 #define ETX_OTA_CMD_PACKET_T_SIZE       (sizeof(ETX_OTA_Command_Packet_t))              /**< @brief Length in bytes of the @ref ETX_OTA_Command_Packet_t struct. */
 #define ETX_OTA_HEADER_DATA_T_SIZE      (sizeof(header_data_t))                         /**< @brief Length in bytes of the @ref header_data_t struct. */
 #define ETX_OTA_HEADER_PACKET_T_SIZE    (sizeof(ETX_OTA_Header_Packet_t))               /**< @brief Length in bytes of the @ref ETX_OTA_Header_Packet_t struct. */
+#define RS232_BITS_PER_BYTE             (1 + (RS232_MODE_DATA_BITS-'0') + ((RS232_MODE_PARITY=='N') ? 0 : 1) + (RS232_MODE_STOPBITS-'0'))  /**< @brief Number of bits that the UART of our host machine shifts out for each byte of data, which are given by the Start bit, the Data-bits, the Parity bit (if any) and the Stop-bit(s). */
+#define ETX_OTA_TX_MAX_STALLS           (10U)                                           /**< @brief Maximum number of consecutive times that the Serial Port can refuse to take any byte of an ETX OTA Packet that is being sent before giving up on sending it. */
+#define ETX_OTA_PAYLOAD_CHUNK_SIZE      (ETX_OTA_WINDOW_SIZE * ETX_OTA_FRAME_SIZE_MAX)   /**< @brief Length in bytes of the chunks in which the Payload is read whenever it could not be memory-mapped, which holds a whole windowed burst of ETX OTA Data Type Packets. */
+#define ETX_OTA_PAGE_CRC_MAX_COUNT      (16U)                                           /**< @brief Maximum number of Flash Memory pages whose 32-bit CRCs can be requested to the external device in a single ETX OTA Page CRC Command. */
+#define ETX_OTA_FEATURE_DELTA_UPDATE    (0x01U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it supports the ETX OTA Page CRC and Seek Commands. */
+#define ETX_OTA_FEATURE_PATCH_UPDATE    (0x02U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it accepts the @ref ETX_OTA_Application_Firmware_Patch Payload Type, in which case the features byte is followed by the number of backlog pages with which that device applies the binary patches. */
+#define ETX_OTA_FEATURE_COMPRESSION     (0x04U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it accepts LZ4 compressed Payloads, in which case the features byte is followed by the number of backlog pages (see @ref ETX_OTA_FEATURE_PATCH_UPDATE ) and then by the base 2 logarithm of the window of decompressed bytes that that device keeps in RAM. */
+#define ETX_OTA_FEATURE_RESUME          (0x08U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it reports the checkpoint of its latest ETX OTA Transaction, in which case the 4-byte size, the 4-byte 32-bit CRC and the 4-byte resume offset of its Application Firmware Image are given from @ref etx_ota_start_resp_t::checkpoint_size . */
+#define ETX_OTA_FEATURE_SPARSE_IMAGE    (0x10U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it accepts the flags byte of the ETX OTA Seek Command, with which the host can skip the blank Flash Memory pages of the Firmware Image instead of sending them (see @ref ETX_OTA_SEEK_FLAG_ERASE ). */
+#define ETX_OTA_FEATURE_FRAME_SIZE      (0x20U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it gives, in @ref etx_ota_start_resp_t::max_data_size , the 2-byte maximum "Data" field's size of the ETX OTA Packets that it can receive, within which the host chooses the size of the ETX OTA Data Type Packets and gives it in the reserved2 field of the ETX OTA Header. */
+#define ETX_OTA_FEATURE_BAUD_RATE       (0x40U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it accepts the ETX OTA Baud Rate Command, in which case its 4-byte maximum Baud rate and the 2-byte time in milliseconds that it waits for the new Baud rate to be confirmed are given from @ref etx_ota_start_resp_t::baud_rate_max . */
+#define ETX_OTA_SEEK_FLAG_ERASE         (0x01U)                                         /**< @brief Bit of the flags byte of an ETX OTA Seek Command with which the host indicates that the Flash Memory pages that it is skipping are blank in the Firmware Image (i.e., all their bytes are \c 0xFF ), so that the external device erases them instead of keeping them in place. */
+#define ETX_OTA_START_FLAG_RESUME       (0x01U)                                         /**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests the external device to report the checkpoint of its latest ETX OTA Transaction (see @ref ETX_OTA_RESUME ). */
+#define ETX_OTA_START_FLAG_NACK_REASON  (0x02U)                                         /**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests the external device to NACK the ETX OTA Data Type Packets that it rejects with their reason and with the offset of the Payload from which the host has to re-send, instead of ending the ETX OTA Transaction (see @ref ETX_OTA_DATA_MAX_RETRIES ). */
+#define ETX_OTA_FEATURE_NACK_REASON     (0x80U)                                         /**< @brief Bit of the features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_NACK_REASON . */
+#define ETX_OTA_NACK_DATA_SIZE          (5U)                                            /**< @brief Number of bytes appended by the external device right after the Response Status of a NACK that carries its reason, which are given by the 1-byte @ref ETX_OTA_Nack_Reason and the 4-byte offset of the Payload from which the host has to re-send. */
+#define ETX_OTA_START_FLAG_DATA_V2      (0x04U)                                         /**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests to send the Payload via ETX OTA Data v2 Type Packets (see @ref ETX_OTA_DATA_V2 ). */
+#define ETX_OTA_START_FLAG_FEC          (0x08U)                                         /**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests to send ETX OTA Data Type Packets that carry Reed-Solomon parity bytes (see @ref ETX_OTA_FEC ). */
+#define ETX_OTA_EXT_FEATURE_DATA_V2     (0x01U)                                         /**< @brief Bit of the extended features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_DATA_V2 . */
+#define ETX_OTA_EXT_FEATURE_FEC         (0x02U)                                         /**< @brief Bit of the extended features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_FEC . */
+#define ETX_OTA_START_FLAG_GEOMETRY     (0x10U)                                         /**< @brief Bit of the flags byte of an ETX OTA Start Command with which the host requests the external device to report the geometry of its Flash Memory and the size of its receive buffer, so that the host does not have to rely on its own configuration of them. */
+#define ETX_OTA_EXT_FEATURE_GEOMETRY    (0x04U)                                         /**< @brief Bit of the extended features byte, appended by the external device to its response to an ETX OTA Start Command, that indicates that it has granted the request of @ref ETX_OTA_START_FLAG_GEOMETRY , in which case its geometry is given from @ref etx_ota_start_resp_t::page_size . */
+#define ETX_OTA_PACKET_TYPE_FEC_FLAG    (0x80U)                                         /**< @brief Bit of the Packet Type of an ETX OTA Data Type Packet, or of an ETX OTA Data v2 Type Packet, that indicates that its "Data" field is followed by the Reed-Solomon parity bytes of it (see @ref rs_encoder ), which are also counted by its "Data Length" field, whereas its 32-bit CRC is still the one of the "Data" field alone. */
+#define ETX_OTA_FEC_RATE_GAIN_LOG2      (4U)                                            /**< @brief Base 2 logarithm of the inverse of the gain with which each new sample is smoothed into @ref etx_ota_frame_error_rate . */
+#define ETX_OTA_DATA_OFFSET_SIZE        (4U)                                            /**< @brief Size in bytes of the offset of the Payload that comes at the beginning of the "Data" field of an ETX OTA Data v2 Type Packet, right before its data. */
+#define ETX_OTA_BAUD_RATE_CMD_SIZE      (5U)                                            /**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Baud Rate Command, which is given by the Command byte and the 4-byte Baud rate to which the host requests the external device to switch. */
+#define ETX_OTA_BAUD_FALLBACK_DELAY     (100000U)                                       /**< @brief Additional time in microseconds that the host waits, after the confirmation time advertised by the external device, before resuming at @ref RS232_BAUDRATE whenever a new Baud rate could not be confirmed, which covers the silence that the external device waits for before falling back. */
+#define ETX_OTA_SYNC_CMD_SIZE           (2U)                                            /**< @brief "Data" field's size in bytes of an ETX OTA Command Type Packet containing the Sync Command, which holds the Command byte followed by the 1-byte sequence number. */
+#define ETX_OTA_SYNC_LEGACY_NACKS       (2U)                                            /**< @brief Number of consecutive NACKs to the ETX OTA Sync Command after which the host considers that the external device does not support it, since a single NACK may also be the response to a resync sequence that completed an ETX OTA Packet that the external device was receiving. */
+#define ETX_OTA_FRAME_SIZE_MIN          (256U)                                          /**< @brief Smallest size in bytes of the "Data" field of the ETX OTA Data Type Packets that the host picks from its estimate of the link with the external device. */
+#define ETX_OTA_JOURNAL_EXTENSION       (".etxjournal")                                 /**< @brief Extension that is appended to the File Path of an Application Firmware Image to get the File Path of its Transfer Journal. */
+#define ETX_OTA_PAYLOAD_COMPRESSED_FLAG (0x80U)                                         /**< @brief Bit that is set in the @ref header_data_t::payload_type field whenever the Payload is sent compressed, in which case the @ref header_data_t::reserved1 field holds the size in bytes of the compressed Payload, while the @ref header_data_t::package_size and @ref header_data_t::package_crc fields still describe the decompressed one. */
+#define ETX_OTA_LZ4_FAST_LINK_RATE      (50000U)                                        /**< @brief Effective link rate in bytes per second from which the Payloads are compressed with @ref LZ4_ENCODER_MIN_LEVEL , since a slower compression would then cost more time than what it saves on the link. */
+#define ETX_OTA_LZ4_MEDIUM_LINK_RATE    (10000U)                                        /**< @brief Effective link rate in bytes per second from which the Payloads are compressed with a medium compression level, whereas slower links get @ref LZ4_ENCODER_MAX_LEVEL . */
+#define ETX_OTA_RESP_DATA_MAX_SIZE      (1U + 4U*ETX_OTA_PAGE_CRC_MAX_COUNT)            /**< @brief Maximum "Data" field's size in bytes of an ETX OTA Response Type Packet, which is given by its Response Status byte plus the 32-bit CRCs of the pages requested via an ETX OTA Page CRC Command, which is longer than the 4-byte offset of the cumulative ACKs received in the windowed transfer mode. */
+#if ((ETX_OTA_FRAME_SIZE_MAX % 4U) != 0U) || (ETX_OTA_FRAME_SIZE_MAX < ETX_OTA_DATA_MAX_SIZE) || (ETX_OTA_FRAME_SIZE_MAX > 0xFFFCU)
+#error "ETX_OTA_FRAME_SIZE_MAX must be a multiple of 4 from 1024 up to 65532."
+#endif
+#if (ETX_OTA_FRAME_SIZE % 4) != 0
+#error "ETX_OTA_FRAME_SIZE must be a multiple of 4."
+#endif
+
 uint8_t payload_send_attempts = 0;                                                      /**< @brief Attempts that have been made to send a Payload to the external device (connected to it via @ref COMPORT_NUMBER ). @note This variable is used only to count the attempts of sending that but only whenever receiving a NACK Response Status from sending an ETX OTA Packet Type Packet to that external device after having sent either an ETX OTA Start Command or an ETX OTA Header Type Command. The reason for this is because if that happens, it is highly possible that this is due to that the external device was doing something else aside waiting to receive an ETX OTA Request from the host at that moment to be able to receive the desired payload from the host. */
 
+/**@brief	ETX OTA Payload Source structure.
+ *
+ * @details	This structure is used to get the bytes of the Payload that are carried by each ETX OTA Data Type Packet,
+ *          without having to hold a copy of the whole Payload in memory. Whenever possible, the Payload File is
+ *          memory-mapped so that the ETX OTA Data Type Packets are populated directly from the mapped File.
+ *          Otherwise, the Payload File is read in chunks of @ref ETX_OTA_PAYLOAD_CHUNK_SIZE bytes into the \c chunk
+ *          parameter.
+ */
+typedef struct {
+    uint32_t  size;                                 //!< Length in bytes of the whole Payload.
+    uint32_t  crc;                                  //!< 32-bit CRC of the whole Payload.
+    uint8_t   *data;                                //!< Pointer to the whole Payload whenever it is held in memory (i.e., memory-mapped or generated), or otherwise \c NULL .
+    bool      is_mapped;                            //!< Flag used to indicate whether the \c data parameter points to a memory-mapped Payload File with a \c true or otherwise with a \c false .
+    bool      is_allocated;                         //!< Flag used to indicate whether the \c data parameter points to a Payload that was generated in dynamic memory (e.g., a binary patch) with a \c true or otherwise with a \c false .
+    FILE      *Fptr;                                //!< Stream of the Payload File, or \c NULL if no Payload File has been opened.
+    uint32_t  chunk_offset;                         //!< Offset of the Payload from which the bytes that are currently held by the \c chunk parameter start.
+    uint32_t  chunk_len;                            //!< Number of bytes of the Payload that are currently held by the \c chunk parameter.
+    uint8_t   chunk[ETX_OTA_PAYLOAD_CHUNK_SIZE];    //!< Holder of the latest chunk of the Payload File that has been read whenever it could not be memory-mapped.
+} ETX_OTA_Payload_Source_t;
+
+/**@brief	ETX OTA Transfer Journal structure.
+ *
+ * @details	This structure is used both for the Transfer Journal that the host keeps on disk while sending an
+ *          Application Firmware Image and for the checkpoint that the external device reports in its response to the
+ *          ETX OTA Start Command, so that the host can tell whether an interrupted ETX OTA Transaction of that same
+ *          Application Firmware Image can be resumed.
+ */
+typedef struct {
+    uint32_t  size;     //!< Length in bytes of the Application Firmware Image.
+    uint32_t  crc;      //!< 32-bit CRC of the Application Firmware Image.
+    uint32_t  offset;   //!< Number of bytes of the Payload that have been acknowledged so far in the Transfer Journal, or offset of the Application Firmware Image from which the external device can continue in its checkpoint.
+} ETX_OTA_Journal_t;
+
+static uint32_t etx_ota_srtt = 0;                                     /**< @brief Smoothed round-trip time in microseconds of the link with the external device (connected to it via @ref COMPORT_NUMBER ), which is measured from the moment that an ETX OTA Packet has been completely transmitted up to the moment that its whole ETX OTA Response Type Packet has been received. */
+static uint32_t etx_ota_rttvar = 0;                                   /**< @brief Smoothed mean deviation in microseconds of the round-trip time samples with respect to @ref etx_ota_srtt . */
+static uint32_t etx_ota_rto = ETX_OTA_INITIAL_RTO;                    /**< @brief Current retransmission timeout in microseconds, which is given by @ref etx_ota_srtt plus four times @ref etx_ota_rttvar and which is doubled each time that it expires. */
+static uint32_t etx_ota_rtt_samples = 0;                              /**< @brief Number of round-trip time samples that have been taken in the current ETX OTA Process. */
+static uint32_t etx_ota_sent_offset = 0;                              /**< @brief Offset of the Payload up to which ETX OTA Data Type Packets have been sent in the current ETX OTA Process, so that any ETX OTA Data Type Packet that starts below it is known to be a re-sent one whose round-trip time must not be sampled (Karn's algorithm). */
+static bool etx_ota_is_ping_supported = false;                        /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) understands the ETX OTA Ping Command with a \c true or otherwise with a \c false . */
+static bool etx_ota_is_delta_supported = false;                       /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) supports the ETX OTA Page CRC and Seek Commands with a \c true or otherwise with a \c false . @note This is only set if @ref ETX_OTA_DELTA_UPDATE is enabled. */
+static uint8_t etx_ota_patch_backlog_pages = 0;                       /**< @brief Number of backlog pages with which the external device (connected to it via @ref COMPORT_NUMBER ) applies the binary patches, or \c 0 if it does not accept the @ref ETX_OTA_Application_Firmware_Patch Payload Type. */
+static uint32_t etx_ota_lz4_window_size = 0;                          /**< @brief Length in bytes of the window of decompressed bytes that the external device (connected to it via @ref COMPORT_NUMBER ) keeps in RAM, which is the greatest match offset that the compressed Payloads can use, or \c 0 if that device does not accept compressed Payloads. @note This is only set if @ref ETX_OTA_COMPRESSION is enabled. */
+static bool etx_ota_is_sparse_supported = false;                      /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) erases the blank Flash Memory pages that the host skips via the ETX OTA Seek Command, whenever asked to, with a \c true or otherwise with a \c false . */
+static ETX_OTA_Journal_t etx_ota_checkpoint;                          /**< @brief Checkpoint of the latest ETX OTA Transaction that was reported by the external device (connected to it via @ref COMPORT_NUMBER ), whose \c offset parameter is \c 0 if there is nothing to resume. @note This is only set if @ref ETX_OTA_RESUME is enabled. */
+static uint16_t etx_ota_page_size = FLASH_PAGE_SIZE_IN_BYTES;         /**< @brief Flash Memory page size in bytes of the external device (connected to it via @ref COMPORT_NUMBER ), which is the one that it reports in its response to the ETX OTA Start Command or otherwise @ref FLASH_PAGE_SIZE_IN_BYTES . */
+static uint32_t etx_ota_bl_flash_addr = FLASH_BASE_ADDRESS;           /**< @brief Flash Memory address of the Bootloader Firmware slot of the external device (connected to it via @ref COMPORT_NUMBER ), which is the one that it reports in its response to the ETX OTA Start Command or otherwise @ref FLASH_BASE_ADDRESS . */
+static uint32_t etx_ota_bl_fw_size = ETX_OTA_BL_FW_SIZE;              /**< @brief Length in bytes of the Bootloader Firmware slot of the external device (connected to it via @ref COMPORT_NUMBER ), which is the one that it reports in its response to the ETX OTA Start Command or otherwise @ref ETX_OTA_BL_FW_SIZE . */
+static uint32_t etx_ota_app_flash_addr = FLASH_BASE_ADDRESS + ETX_OTA_BL_FW_SIZE; /**< @brief Flash Memory address of the Application Firmware slot of the external device (connected to it via @ref COMPORT_NUMBER ), which is the one that it reports in its response to the ETX OTA Start Command or otherwise the one right after @ref ETX_OTA_BL_FW_SIZE . */
+static uint32_t etx_ota_app_fw_size = ETX_OTA_APP_FW_SIZE;            /**< @brief Length in bytes of the Application Firmware slot of the external device (connected to it via @ref COMPORT_NUMBER ), which is the one that it reports in its response to the ETX OTA Start Command or otherwise @ref ETX_OTA_APP_FW_SIZE . */
+static bool Is_Page_Changed[ETX_OTA_PAGES_MAX_COUNT];                       /**< @brief Global flags used to indicate, for each Flash Memory page covered by the Payload, whether that page differs from the one that is currently installed in the external device (connected to it via @ref COMPORT_NUMBER ) with a \c true , or otherwise with a \c false . */
+static bool Is_Page_Erased[ETX_OTA_PAGES_MAX_COUNT];                        /**< @brief Global flags used to indicate, for each Flash Memory page covered by the Payload, whether that page is blank in the Firmware Image, and is therefore to be erased by the external device (connected to it via @ref COMPORT_NUMBER ) instead of being sent, with a \c true , or otherwise with a \c false . @note A page flagged in here is never flagged in @ref Is_Page_Changed . */
+static uint8_t etx_ota_window_size = 1;                               /**< @brief Window size that was negotiated with the external device (connected to it via @ref COMPORT_NUMBER ) via the ETX OTA Start Command, which stands for the number of ETX OTA Data Type Packets that the host will send in a single burst before waiting for a cumulative ACK. @details A value of \c 1 stands for the classic mode, in which each ETX OTA Data Type Packet is acknowledged individually. */
+static uint16_t etx_ota_max_frame_size = 0;                           /**< @brief Maximum "Data" field's size in bytes of the ETX OTA Packets that the external device (connected to it via @ref COMPORT_NUMBER ) can receive, as given in its response to the ETX OTA Start Command, or \c 0 if it does not negotiate the size of the ETX OTA Data Type Packets. */
+static uint16_t etx_ota_frame_size = ETX_OTA_DATA_MAX_SIZE;           /**< @brief Size in bytes of the "Data" field of the ETX OTA Data Type Packets (i.e., the frame size) that the host sends to the external device (connected to it via @ref COMPORT_NUMBER ) during the current ETX OTA Process, which is chosen via @ref negotiate_etx_ota_frame_size . @details Every ETX OTA Data Type Packet carries this many bytes of the Payload, except for the last one of each run. */
+static uint32_t etx_ota_max_baud_rate = 0;                            /**< @brief Maximum Baud rate to which the external device (connected to it via @ref COMPORT_NUMBER ) accepts to be switched via the ETX OTA Baud Rate Command, as given in its response to the ETX OTA Start Command, or \c 0 if it does not accept that Command. */
+static uint16_t etx_ota_baud_confirm_timeout = 0;                     /**< @brief Time in milliseconds, as given by the external device (connected to it via @ref COMPORT_NUMBER ) in its response to the ETX OTA Start Command, that it waits for a new Baud rate to be confirmed before falling back to the previous one. */
+static uint32_t etx_ota_baud_rate = RS232_BAUDRATE;                   /**< @brief Baud rate with which the Serial Port is currently opened, which is @ref RS232_BAUDRATE unless it has been switched via @ref upgrade_etx_ota_baud_rate . */
+static bool etx_ota_is_nack_reason_supported = false;                 /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) NACKs the ETX OTA Data Type Packets that it rejects with their reason and with the offset of the Payload from which the host has to re-send them with a \c true , or otherwise with a \c false . */
+static bool etx_ota_is_fec_supported = false;                         /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) accepts ETX OTA Data Type Packets that carry Reed-Solomon parity bytes with a \c true , or otherwise with a \c false . */
+static bool etx_ota_is_fec_active = false;                            /**< @brief Flag used to indicate whether the ETX OTA Data Type Packets are currently being sent along with their Reed-Solomon parity bytes with a \c true , or otherwise with a \c false . @details Once set, this stays set for the rest of the ETX OTA Process, since the external device silently repairs the corrupted bytes and @ref etx_ota_frame_error_rate can therefore no longer be measured. */
+static uint16_t etx_ota_frame_error_rate = 0;                         /**< @brief Smoothed rate, in parts per thousand, of the responses to ETX OTA Data Type Packets that reveal that some of them were corrupted or lost on their way to the external device (connected to it via @ref COMPORT_NUMBER ), which is compared against @ref ETX_OTA_FEC_ERROR_RATE . */
+static bool etx_ota_is_data_v2_supported = false;                     /**< @brief Flag used to indicate whether the Payload is sent to the external device (connected to it via @ref COMPORT_NUMBER ) via ETX OTA Data v2 Type Packets with a \c true , or otherwise via ETX OTA Data Type Packets with a \c false . */
+static bool etx_ota_is_sync_supported = false;                        /**< @brief Flag used to indicate whether the external device (connected to it via @ref COMPORT_NUMBER ) answered the ETX OTA Sync Command, in which case a failed attempt to start an ETX OTA Process is retried without waiting for @ref TRY_AGAIN_SENDING_FWI_DELAY . */
+static const uint32_t etx_ota_standard_baud_rates[] = {115200, 230400, 460800, 500000, 576000, 921600, 1000000, 1152000, 1500000, 2000000};  /**< @brief Baud rates above the default one, in ascending order, with which the @ref teuniz_rs232_library can open the Serial Port, and from which the one requested via the ETX OTA Baud Rate Command is picked. */
 static uint8_t ETX_OTA_Packet_Buffer[ETX_OTA_PACKET_MAX_SIZE];        /**< @brief Global buffer that will be used by our host machine to hold the whole data of either a received ETX OTA Packet from the external device (connected to it via @ref COMPORT_NUMBER ) or to populate in it the Packet's bytes to be send to that external device. */
-static uint8_t PAYLOAD_CONTENT[ETX_OTA_MAX_FW_SIZE];                  /**< @brief Global holder for the Firmware Update Image file contents. */
-static const uint32_t crc_table[0x100] = {
-        0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005, 0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
-        0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75, 0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
-        0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5, 0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
-        0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95, 0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
-        0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072, 0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
-        0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02, 0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
-        0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692, 0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
-        0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2, 0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
-        0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB, 0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
-        0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B, 0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
-        0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B, 0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
-        0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B, 0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
-        0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C, 0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
-        0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC, 0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
-        0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C, 0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
-        0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C, 0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
-};                                                                    /**< @brief Global 32-bit CRC (MPEG-2) Lookup Table. */
+static uint8_t CUSTOM_DATA_CONTENT[CUSTOM_DATA_MAX_SIZE];             /**< @brief Global holder for the ETX OTA Custom Data that is generated by our host machine whenever that is the requested Payload. */
 
 /**@brief   Logger Message function with Debug, Information, Done, Warning and Error types available.
  *
@@ -310,17 +437,88 @@ static const uint32_t crc_table[0x100] = {
  */
 static void LOG(LOG_t log_type, const char* msg, ...);
 
-/**@brief   Calculates the 32-bit CRC of a given data.
+/**@brief   Opens the Payload that the user requested to send to the external device (connected to it via
+ *          @ref COMPORT_NUMBER ) and gets its size.
  *
- * @param[in] p_data    Pointer to the data from which it is desired to calculate the 32-bit CRC.
- * @param DataLength    Length in bytes of the \p p_data param.
+ * @details In the case of a Firmware Image, the File at \p payload_path is memory-mapped whenever possible, or is
+ *          otherwise left open to be read later in chunks. Intel HEX, Motorola S-record and ELF Files are instead
+ *          replaced by the binary Firmware Image that they describe (see @ref parse_payload_image ). In the case of an ETX OTA Custom Data, it is generated in
+ *          @ref CUSTOM_DATA_CONTENT .
  *
- * @return              The calculated 32-bit CRC Hash Function on the input data towards which the \p p_data param
- *                      points to.
+ * @param[out] payload              Pointer to the Payload Source that is to be initialized.
+ * @param[in] payload_path          File Path of the Payload, which is only used for Firmware Images.
+ * @param ETX_OTA_Payload_Type      Type of the Payload.
  *
- * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ * @retval 	ETX_OTA_EC_NA
+ */
+static ETX_OTA_Status open_payload_source(ETX_OTA_Payload_Source_t *payload, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type);
+
+/**@brief   Replaces the Firmware Image File of a Payload Source with the binary Firmware Image that it describes,
+ *          whenever it is an Intel HEX, Motorola S-record or ELF File (see @ref image_parser ).
+ *
+ * @param[in, out] payload          Pointer to the Payload Source, which must have been opened with
+ *                                  @ref open_payload_source .
+ * @param[in] payload_path          File Path of the Firmware Image.
+ * @param ETX_OTA_Payload_Type      Type of the Payload, which tells the Flash Memory slot at which the Firmware Image
+ *                                  is to be placed (see @ref etx_ota_bl_flash_addr and @ref etx_ota_app_flash_addr ).
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status parse_payload_image(ETX_OTA_Payload_Source_t *payload, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type);
+
+/**@brief   Reads the whole Payload once in order to calculate its 32-bit CRC into \p payload .
+ *
+ * @details This is the only time that the whole Payload is read before sending it, where the Payload File is read
+ *          in chunks only whenever it could not be memory-mapped.
+ *
+ * @param[in, out] payload  Pointer to the Payload Source, which must have been opened with @ref open_payload_source .
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status read_payload_source(ETX_OTA_Payload_Source_t *payload);
+
+/**@brief   Gets some bytes of the Payload, which are meant to be carried by an ETX OTA Data Type Packet.
+ *
+ * @details Whenever the Payload is held in memory, this will just point to it. Otherwise, the chunk of the Payload
+ *          File that starts at \p offset will be read, unless the requested bytes are already held in it.
+ *
+ * @param[in, out] payload  Pointer to the Payload Source, which must have been opened with @ref open_payload_source .
+ * @param offset            Offset of the Payload from which the requested bytes start.
+ * @param len               Number of requested bytes, which must not be greater than
+ *                          @ref ETX_OTA_PAYLOAD_CHUNK_SIZE .
+ *
+ * @return  Pointer to the requested bytes of the Payload, or \c NULL if they could not be read.
+ */
+static uint8_t *get_payload_source_data(ETX_OTA_Payload_Source_t *payload, uint32_t offset, uint16_t len);
+
+/**@brief   Releases the resources of a Payload Source (i.e., it unmaps and/or closes its Payload File).
+ *
+ * @param[in, out] payload  Pointer to the Payload Source.
+ */
+static void close_payload_source(ETX_OTA_Payload_Source_t *payload);
+
+/**@brief   Sends the bytes of an ETX OTA Packet to the external device (connected to it via @ref COMPORT_NUMBER ) by
+ *          writing them in bursts of up to @ref ETX_OTA_TX_BURST_SIZE bytes each.
+ *
+ * @details After each burst is written, this function waits for the time that the UART of our host machine takes to
+ *          shift that burst out at the link rate given by @ref etx_ota_baud_rate and @ref RS232_BITS_PER_BYTE , plus the
+ *          additional delay of @ref SEND_PACKET_BYTES_DELAY , such that the next burst is not queued before the
+ *          previous one has actually been transmitted.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in] packet                Pointer to the bytes of the ETX OTA Packet to be sent.
+ * @param len                       Length in bytes of the ETX OTA Packet to be sent.
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_ERR
  */
-static uint32_t crc32_mpeg2(uint8_t *p_data, uint32_t DataLength);
+static ETX_OTA_Status send_etx_ota_packet_bytes(int teuniz_rs232_lib_comport, uint8_t *packet, uint16_t len);
 
 /**@brief   Indicates whether the external device (connected to it via @ref COMPORT_NUMBER ) responded to our host
  *          machine with an ACK or a NACK Response Status.
@@ -341,7 +539,93 @@ static uint32_t crc32_mpeg2(uint8_t *p_data, uint32_t DataLength);
  * @author  César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    October 06, 2023.
  */
-static bool is_ack_resp_received(int teuniz_rs232_lib_comport);
+static bool is_ack_resp_received(int teuniz_rs232_lib_comport, uint8_t rtt_frames, uint32_t max_timeout);
+
+/**@brief   Gets the current time of a monotonic clock of our host machine.
+ *
+ * @return  The current time in microseconds, which is only meaningful when compared against another value given by
+ *          this same function.
+ */
+static uint64_t get_monotonic_time();
+
+/**@brief   Receives the ETX OTA Response Type Packet with which the external device (connected to it via
+ *          @ref COMPORT_NUMBER ) responded to our host machine and gets any additional bytes that may have been
+ *          appended to its Response Status.
+ *
+ * @details This function waits with @ref RS232_WaitForData for the bytes of the ETX OTA Response Type Packet to
+ *          arrive and returns the moment that a whole and CRC-valid Packet has been received, or once \p timeout has
+ *          elapsed, whichever happens first. Partial reads are reassembled and the "Data Length" field of the received
+ *          Packet is used to know how many bytes are expected. Any byte received before a SOF, as well as any Packet
+ *          that turns out to be invalid, is discarded such that the reception resynchronizes on the next SOF.
+ * @details A READY beacon (see @ref ETX_OTA_READY ) ends the wait right away, since it means that the external device
+ *          has just started to listen for ETX OTA Packets and that it will therefore not respond to the latest one.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param rtt_frames                Number of ETX OTA Packets whose processing is acknowledged by the expected ETX OTA
+ *                                  Response Type Packet, such that the initial wait will last \p rtt_frames times
+ *                                  @ref etx_ota_rto and such that the measured round-trip time, divided by
+ *                                  \p rtt_frames , is given to @ref etx_ota_update_rtt . A value of \c 0 is meant
+ *                                  for exchanges that involve a long work on the external device (e.g., erasing its
+ *                                  Flash Memory), in which case the wait will last \p max_timeout and no round-trip
+ *                                  time will be sampled.
+ * @param is_rtt_sampled            Flag used to indicate whether the round-trip time is to be sampled with a \c true ,
+ *                                  or otherwise with a \c false , which must be given whenever the ETX OTA Packet has
+ *                                  been re-sent, since it is then unknown which of its transmissions is being
+ *                                  acknowledged (Karn's algorithm).
+ * @param max_timeout               Maximum time in microseconds to wait for the whole ETX OTA Response Type Packet. If
+ *                                  the initial wait given by @ref etx_ota_rto expires, then @ref etx_ota_rto will be
+ *                                  backed off and this function will keep waiting up to this time, since the ETX OTA
+ *                                  Packet cannot be safely re-sent. A value of \c 0 is meant for ETX OTA Packets that
+ *                                  can be safely re-sent (i.e., the Abort and Ping Commands), in which case this
+ *                                  function will give up as soon as the initial wait expires.
+ * @param[out] resp_data            Pointer to the buffer into which the bytes that come after the Response Status will
+ *                                  be written into, which must be able to hold \c ETX_OTA_RESP_DATA_MAX_SIZE-1 bytes.
+ *                                  A \c NULL value can be given if these are not needed.
+ * @param[out] resp_data_len        Pointer into which the number of bytes written into \p resp_data will be written
+ *                                  into. A \c NULL value can be given if it is not needed.
+ *
+ * @retval  ETX_OTA_EC_OK   if a valid ETX OTA Response Type Packet containing an ACK Response Status was received.
+ * @retval  ETX_OTA_EC_ERR  if a valid ETX OTA Response Type Packet containing a NACK Response Status was received, or
+ *                          if the Serial Port reported an error.
+ * @retval  ETX_OTA_EC_NR   if no valid ETX OTA Response Type Packet was received before the timeout.
+ * @retval  ETX_OTA_EC_NA   if a READY beacon was received instead.
+ */
+static ETX_OTA_Status receive_etx_ota_resp(int teuniz_rs232_lib_comport, uint8_t rtt_frames, bool is_rtt_sampled, uint32_t max_timeout, uint8_t *resp_data, uint16_t *resp_data_len);
+
+/**@brief   Indicates whether the external device (connected to it via @ref COMPORT_NUMBER ) responded to our host
+ *          machine with an ACK or a NACK Response Status and gets any additional bytes that may have been appended to
+ *          that Response Status.
+ *
+ * @note    The params are the same as those of @ref receive_etx_ota_resp , where the round-trip time is always
+ *          sampled whenever \p rtt_frames is not zero.
+ *
+ * @return  \c true if a valid ETX OTA Response Type Packet containing an ACK Response Status was received. Otherwise,
+ *          \c false .
+ */
+static bool is_ack_resp_with_data_received(int teuniz_rs232_lib_comport, uint8_t rtt_frames, uint32_t max_timeout, uint8_t *resp_data, uint16_t *resp_data_len);
+
+/**@brief   Resets the round-trip time estimator of the link with the external device (connected to it via
+ *          @ref COMPORT_NUMBER ), which is done at the beginning of each ETX OTA Process.
+ */
+static void etx_ota_reset_rtt();
+
+/**@brief   Updates the round-trip time estimator of the link with the external device (connected to it via
+ *          @ref COMPORT_NUMBER ) with a new sample, in the same way as the retransmission timer of TCP (RFC 6298).
+ *
+ * @details The first sample initializes @ref etx_ota_srtt with its value and @ref etx_ota_rttvar with half of its
+ *          value, while the next ones are smoothed with gains of 1/8 and 1/4 respectively. Then, @ref etx_ota_rto is
+ *          recalculated as @ref etx_ota_srtt plus four times @ref etx_ota_rttvar , but bounded between
+ *          @ref ETX_OTA_MIN_RTO and @ref ETX_OTA_RESP_TIMEOUT .
+ *
+ * @param rtt   Round-trip time sample in microseconds.
+ */
+static void etx_ota_update_rtt(uint32_t rtt);
+
+/**@brief   Doubles @ref etx_ota_rto , but up to @ref ETX_OTA_RESP_TIMEOUT , after it has expired.
+ */
+static void etx_ota_backoff_rto();
 
 /**@brief   Sends an ETX OTA Command Type Packet containing the Abort Command in it to the external device (connected to
  *          it via @ref COMPORT_NUMBER ).
@@ -361,10 +645,56 @@ static bool is_ack_resp_received(int teuniz_rs232_lib_comport);
  */
 static ETX_OTA_Status send_etx_ota_abort(int teuniz_rs232_lib_comport);
 
+/**@brief   Sends an ETX OTA Command Type Packet containing the Sync Command in it to the external device (connected to
+ *          it via @ref COMPORT_NUMBER ) and waits up to @ref ETX_OTA_SYNC_INTERVAL for the ACK that echoes its
+ *          sequence number.
+ *
+ * @details Any ACK that echoes a different sequence number is the late response to a previous ETX OTA Sync Command,
+ *          which is skipped. Since the external device answers each Command in order, no response to a previous one
+ *          can arrive after the expected ACK.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param seq                       Sequence number of the ETX OTA Sync Command.
+ *
+ * @retval  ETX_OTA_EC_OK   if the expected ACK was received.
+ * @retval  ETX_OTA_EC_ERR  if a NACK was received or if the ETX OTA Sync Command could not be sent.
+ * @retval  ETX_OTA_EC_NR   if no response was received.
+ * @retval  ETX_OTA_EC_NA   if a READY beacon was received instead.
+ */
+static ETX_OTA_Status send_etx_ota_sync(int teuniz_rs232_lib_comport, uint8_t seq);
+
+/**@brief   Synchronizes our host machine with the external device (connected to it via @ref COMPORT_NUMBER ) so that
+ *          it is ready to receive an ETX OTA Start Command, which also stops any ongoing ETX OTA Process there.
+ *
+ * @details The ETX OTA Sync Command is sent, via @ref send_etx_ota_sync , until the external device answers it or up
+ *          to @ref ETX_OTA_SYNC_MAX_TIME . Whenever no response is received, the resync sequence is sent before trying
+ *          again, which is a whole ETX OTA Packet worth of \c 0xFF bytes (i.e., never a SOF) that completes any ETX
+ *          OTA Packet that the external device may have been receiving, which it then rejects and which makes it
+ *          listen again, while the remaining bytes are discarded by it while waiting for the ETX OTA Start Command.
+ *          However, whenever a READY beacon is received instead, the ETX OTA Sync Command is sent again right away.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ *
+ * @retval  ETX_OTA_EC_OK   if the external device answered the ETX OTA Sync Command.
+ * @retval  ETX_OTA_EC_NA   if the external device does not support the ETX OTA Sync Command (see
+ *                          @ref ETX_OTA_SYNC_LEGACY_NACKS ).
+ * @retval  ETX_OTA_EC_NR   if the external device did not answer within @ref ETX_OTA_SYNC_MAX_TIME .
+ * @retval  ETX_OTA_EC_ERR  if the Serial Port reported an error.
+ */
+static ETX_OTA_Status sync_etx_ota(int teuniz_rs232_lib_comport);
+
 /**@brief   Sends an ETX OTA Command Type Packet containing the Start Command in it to the external device (connected to
  *          it via @ref COMPORT_NUMBER ).
  *
  * @details Sending a Start Command to that external device will request to start an ETX OTA Protocol process.
+ * @details If @ref ETX_OTA_WINDOW_SIZE is greater than \c 1 , then the windowed transfer mode will also be requested
+ *          and the window size granted by the external device will be stored at @ref etx_ota_window_size . External
+ *          devices that do not support that mode will just respond with a plain ACK, in which case the window size
+ *          will be set to \c 1 .
  *
  * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
  *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
@@ -379,6 +709,70 @@ static ETX_OTA_Status send_etx_ota_abort(int teuniz_rs232_lib_comport);
  */
 static ETX_OTA_Status send_etx_ota_start(int teuniz_rs232_lib_comport);
 
+/**@brief   Sends an ETX OTA Command Type Packet containing the Ping Command in it to the external device (connected to
+ *          it via @ref COMPORT_NUMBER ) in order to take a round-trip time sample of the link with it.
+ *
+ * @note    This function must only be called if @ref etx_ota_is_ping_supported is \c true .
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param timeout                   Maximum time in microseconds to wait for the ACK, in which case no round-trip time
+ *                                  sample is taken (e.g., to confirm a new Baud rate), or \c 0 to wait for up to
+ *                                  @ref etx_ota_rto and take a round-trip time sample.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status send_etx_ota_ping(int teuniz_rs232_lib_comport, uint32_t timeout);
+
+/**@brief   Requests the external device (connected to it via @ref COMPORT_NUMBER ) to switch to the Baud rate given by
+ *          @ref ETX_OTA_BAUD_RATE_UPGRADE , but up to @ref etx_ota_max_baud_rate and rounded down to one of
+ *          @ref etx_ota_standard_baud_rates , via the ETX OTA Baud Rate Command and then reopens the Serial Port at that
+ *          Baud rate.
+ *
+ * @details The new Baud rate is confirmed with up to @ref ETX_OTA_BAUD_CONFIRM_PINGS ETX OTA Ping Commands within
+ *          @ref etx_ota_baud_confirm_timeout . If none of them is acknowledged, then the host waits for the external
+ *          device to fall back as well and reopens the Serial Port at @ref RS232_BAUDRATE , where it makes sure that
+ *          the external device is still responding before continuing the ETX OTA Process. If it is not, then the
+ *          external device may have received one of those ETX OTA Ping Commands and committed to the new Baud rate
+ *          even though all of its ACKs got lost, so the host tries the new Baud rate once more before giving up.
+ *          Either way, the Baud rate with which the Serial Port ends up opened is stored at @ref etx_ota_baud_rate .
+ *
+ * @note    This function must only be called right after the ETX OTA Start Command and only if
+ *          @ref etx_ota_max_baud_rate is not \c 0 .
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in] mode                  Databits, Parity and Stopbit with which the Serial Port was opened, as given to the
+ *                                  @ref teuniz_rs232_library .
+ *
+ * @retval  ETX_OTA_EC_OK whether the new Baud rate was confirmed or the host fell back to @ref RS232_BAUDRATE , in
+ *          which case the Serial Port is left open.
+ * @retval 	ETX_OTA_EC_ERR if the external device does not respond at either Baud rate, in which case the Serial Port
+ *          has already been closed.
+ */
+static ETX_OTA_Status upgrade_etx_ota_baud_rate(int teuniz_rs232_lib_comport, char mode[]);
+
+/**@brief   Opens the Serial Port, which must be closed, at a given Baud rate and then makes sure that the external
+ *          device (connected to it via @ref COMPORT_NUMBER ) responds at it with up to @ref ETX_OTA_BAUD_CONFIRM_PINGS
+ *          ETX OTA Ping Commands.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param baud_rate                 Baud rate at which the Serial Port is to be opened.
+ * @param[in] mode                  Databits, Parity and Stopbit with which the Serial Port is to be opened, as given to
+ *                                  the @ref teuniz_rs232_library .
+ * @param ping_timeout              Time in microseconds that the host waits for the ACK to each ETX OTA Ping Command.
+ *
+ * @retval  ETX_OTA_EC_OK if one of the ETX OTA Ping Commands was acknowledged, in which case the Serial Port is left
+ *          open and \p baud_rate is stored at @ref etx_ota_baud_rate .
+ * @retval 	ETX_OTA_EC_ERR otherwise, in which case the Serial Port is left closed.
+ */
+static ETX_OTA_Status reopen_etx_ota_comport(int teuniz_rs232_lib_comport, uint32_t baud_rate, char mode[], uint32_t ping_timeout);
+
 /**@brief   Sends an ETX OTA Header Type Packet to the external device (connected to it via @ref COMPORT_NUMBER ) that
  *          contains the general information of the Payload to be sent to that external device.
  *
@@ -398,12 +792,24 @@ static ETX_OTA_Status send_etx_ota_header(int teuniz_rs232_lib_comport, header_d
 /**@brief   Sends an ETX OTA Data Type Packet to the external device (connected to it via @ref COMPORT_NUMBER ) that
  *          contains some desired Payload Data.
  *
+ * @details If the Payload is being sent via ETX OTA Data v2 Type Packets, then the Packet is re-sent each time that
+ *          @ref etx_ota_rto expires, for up to @ref ETX_OTA_RESP_TIMEOUT , since the external device just acknowledges
+ *          again the ones that it has already received. For the same reason, the ACKs that carry an offset that is
+ *          behind the one of the Packet are skipped, since they are the late ones of the Packets that were re-sent.
+ *          The first Packet of the Payload is never re-sent, since it also makes the external device erase its Flash
+ *          Memory.
+ *
  * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
  *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
  *                                  from @ref teuniz_rs232_library ).
  * @param[in] payload               Pointer to the Payload Data that wants to be send in the current ETX OTA Data Type
  *                                  Packet.
  * @param data_len                  Length in bytes of the Payload Data.
+ * @param[in, out] offset           Pointer to the offset of the Payload at which the Payload Data starts, where an offset
+ *                                  of \c 0 makes the external device also erase its Flash Memory before responding. This
+ *                                  will be advanced by \p data_len if the ETX OTA Data Type Packet is acknowledged, or
+ *                                  else set to the offset from which to re-send if the external device NACKs it with a
+ *                                  reason that allows it (see @ref get_etx_ota_nack_offset ).
  *
  * @retval 					ETX_OTA_EC_OK
  * @retval 					ETX_OTA_EC_ERR
@@ -412,7 +818,266 @@ static ETX_OTA_Status send_etx_ota_header(int teuniz_rs232_lib_comport, header_d
  * @author  César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    October 07, 2023.
  */
-static ETX_OTA_Status send_etx_ota_data(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len);
+static ETX_OTA_Status send_etx_ota_data(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len, uint32_t *offset);
+
+/**@brief   Populates and sends an ETX OTA Data Type Packet to the external device (connected to it via
+ *          @ref COMPORT_NUMBER ) without waiting for any response from it.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in] payload               Pointer to the Payload Data that wants to be send in the current ETX OTA Data Type
+ *                                  Packet.
+ * @param data_len                  Length in bytes of the Payload Data.
+ * @param offset                    Offset of the Payload at which the Payload Data starts, which is given at the
+ *                                  beginning of the "Data" field if the Payload is being sent via ETX OTA Data v2 Type
+ *                                  Packets (see @ref etx_ota_is_data_v2_supported ).
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status send_etx_ota_data_packet(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len, uint32_t offset);
+
+/**@brief   Sends a burst of up to @ref etx_ota_window_size ETX OTA Data Type Packets to the external device (connected
+ *          to it via @ref COMPORT_NUMBER ) and then waits for the single cumulative ACK of that whole burst.
+ *
+ * @details Each ETX OTA Data Type Packet of the burst will carry @ref etx_ota_frame_size bytes of the Payload,
+ *          except for the last Packet of the whole Payload (or of the run being sent), since this is what the external
+ *          device expects in order to know how many Packets are in each burst.
+ * @details The cumulative ACK carries the offset of the next Payload byte that the external device expects, which
+ *          will be written into \p offset . If that offset is lower than the one at which the burst concluded, then
+ *          the external device did not receive some of its Packets and the next burst must start from that offset.
+ * @details If the external device NACKs the burst instead, with a reason that allows it, then the offset from which to
+ *          re-send is taken from that NACK (see @ref get_etx_ota_nack_offset ).
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in, out] payload          Pointer to the Payload Source from which the Payload Data will be taken.
+ * @param[in, out] offset           Pointer to the offset of the Payload from which the burst will start, which will be
+ *                                  updated with the offset acknowledged by the external device.
+ * @param end                       Offset of the Payload at which the burst must stop, which is the end of the
+ *                                  Payload unless only a run of it is being sent (see @ref send_etx_ota_seek ).
+ *
+ * @retval 					ETX_OTA_EC_OK
+ * @retval 					ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status send_etx_ota_data_window(int teuniz_rs232_lib_comport, ETX_OTA_Payload_Source_t *payload, uint32_t *offset, uint32_t end);
+
+/**@brief   Gets, from a NACK given by the external device (connected to it via @ref COMPORT_NUMBER ) to some ETX OTA
+ *          Data Type Packets, the offset of the Payload from which they have to be re-sent.
+ *
+ * @details This is only possible if the external device has granted the request of
+ *          @ref ETX_OTA_START_FLAG_NACK_REASON and the NACK carries a reason other than
+ *          @ref ETX_OTA_NACK_REASON_FLASH , in which case the external device stays at the ETX OTA Data State waiting
+ *          for the Payload from that offset. Otherwise, the external device has ended the ETX OTA Transaction.
+ *
+ * @param[in] resp_data         Pointer to the bytes that the external device appended to the Response Status of its
+ *                              NACK.
+ * @param resp_data_len         Number of bytes held in \p resp_data .
+ * @param first_offset          Offset of the Payload from which the NACKed ETX OTA Data Type Packets were sent.
+ * @param last_offset           Offset of the Payload up to which the NACKed ETX OTA Data Type Packets were sent.
+ * @param[out] p_offset         Pointer into which the offset of the Payload from which to re-send will be written into,
+ *                              which is validated to be from \p first_offset up to \p last_offset .
+ *
+ * @retval 	ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status get_etx_ota_nack_offset(uint8_t *resp_data, uint16_t resp_data_len, uint32_t first_offset, uint32_t last_offset, uint32_t *p_offset);
+
+/**@brief   Smooths the latest response to the ETX OTA Data Type Packets into @ref etx_ota_frame_error_rate and, if
+ *          @ref ETX_OTA_FEC is \c 2 , starts sending their Reed-Solomon parity bytes once that rate reaches
+ *          @ref ETX_OTA_FEC_ERROR_RATE .
+ *
+ * @param is_corrupted  \c true if the latest response revealed that an ETX OTA Data Type Packet was corrupted or lost
+ *                      (i.e., a NACK due to a CRC mismatch or a missing response), or otherwise \c false .
+ */
+static void update_etx_ota_frame_error_rate(bool is_corrupted);
+
+/**@brief   Populates and sends an ETX OTA Command Type Packet containing a given Command, together with its arguments,
+ *          to the external device (connected to it via @ref COMPORT_NUMBER ) without waiting for any response from it.
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in] cmd_data              Pointer to the "Data" field of the ETX OTA Command Type Packet to be sent, which
+ *                                  holds the Command byte followed by its arguments.
+ * @param data_len                  Length in bytes of the \p cmd_data param.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status send_etx_ota_cmd_packet(int teuniz_rs232_lib_comport, uint8_t *cmd_data, uint16_t data_len);
+
+/**@brief   Gets the 32-bit CRCs of some Flash Memory pages of the Firmware Image that is currently installed in the
+ *          external device (connected to it via @ref COMPORT_NUMBER ) via an ETX OTA Page CRC Command.
+ *
+ * @note    This function must only be called if @ref etx_ota_is_delta_supported is \c true .
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param first_page                Index of the first Flash Memory page whose 32-bit CRC is requested.
+ * @param page_count                Number of Flash Memory pages whose 32-bit CRCs are requested, which must not be
+ *                                  greater than @ref ETX_OTA_PAGE_CRC_MAX_COUNT .
+ * @param[out] p_crcs               Pointer to where the \p page_count 32-bit CRCs will be written into.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status get_etx_ota_page_crcs(int teuniz_rs232_lib_comport, uint16_t first_page, uint8_t page_count, uint32_t *p_crcs);
+
+/**@brief   Finds out which Flash Memory pages covered by the Payload differ from the ones of the Firmware Image that is
+ *          currently installed in the external device (connected to it via @ref COMPORT_NUMBER ), and writes the
+ *          result into @ref Is_Page_Changed .
+ *
+ * @details The 32-bit CRC of each page of the Payload is calculated with its last page padded with \c 0xFF bytes,
+ *          which is how the external device writes it, and it is then compared with the one reported by that device.
+ *
+ * @note    This function must only be called if @ref etx_ota_is_delta_supported is \c true .
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param[in, out] payload          Pointer to the Payload Source from which the Payload Data will be taken.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status find_etx_ota_changed_pages(int teuniz_rs232_lib_comport, ETX_OTA_Payload_Source_t *payload);
+
+/**@brief   Sends an ETX OTA Command Type Packet containing the Seek Command to the external device (connected to it
+ *          via @ref COMPORT_NUMBER ), so that it keeps in place (or erases) the Flash Memory pages from the offset
+ *          that it has received so far up to the given one.
+ *
+ * @note    This function must only be called if @ref etx_ota_is_delta_supported is \c true , and with \p is_erase
+ *          only if @ref etx_ota_is_sparse_supported is \c true .
+ *
+ * @param teuniz_rs232_lib_comport  The converted value of the actual comport that was requested by the user but into
+ *                                  its equivalent for the @ref teuniz_rs232_library (For more details, see the Table
+ *                                  from @ref teuniz_rs232_library ).
+ * @param offset                    Offset of the Payload from which the host will continue.
+ * @param run_len                   Length in bytes of the run of the Payload that the host will send from \p offset .
+ * @param is_erase                  \c true if the skipped Flash Memory pages are blank and are to be erased, or
+ *                                  otherwise \c false if they are to be kept in place.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status send_etx_ota_seek(int teuniz_rs232_lib_comport, uint32_t offset, uint32_t run_len, bool is_erase);
+
+/**@brief   Loads a whole File into dynamic memory.
+ *
+ * @param[in] file_path     File Path towards the File to be loaded.
+ * @param[out] pp_data      Pointer to where the pointer towards the loaded File will be written into, which has to be
+ *                          freed by the caller with "free()".
+ * @param[out] p_size       Pointer to where the length in bytes of the loaded File will be written into.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status load_etx_ota_file(char file_path[], uint8_t **pp_data, uint32_t *p_size);
+
+/**@brief   Replaces the Application Firmware Image of a Payload Source with the binary patch that rebuilds it from the
+ *          one that is currently installed in the external device (connected to it via @ref COMPORT_NUMBER ), but only
+ *          if that binary patch is smaller than the Application Firmware Image itself.
+ *
+ * @details The \c crc parameter of the Payload Source is kept as the 32-bit CRC of the Application Firmware Image,
+ *          since that is the one that the external device validates after having rebuilt it.
+ *
+ * @note    This function must only be called if @ref etx_ota_patch_backlog_pages is not \c 0 .
+ *
+ * @param[in, out] payload      Pointer to the Payload Source of the Application Firmware Image, which must have been
+ *                              read with @ref read_payload_source .
+ * @param[in] payload_path      File Path towards the Application Firmware Image.
+ * @param[in] base_image_path   File Path towards the Application Firmware Image that is currently installed in the
+ *                              external device.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval  ETX_OTA_EC_NA if the binary patch would not be smaller than the Application Firmware Image, in which case
+ *          the Payload Source is left untouched.
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status create_etx_ota_patch(ETX_OTA_Payload_Source_t *payload, char payload_path[], char base_image_path[]);
+
+/**@brief   Gets the effective link rate with the external device (connected to it via @ref COMPORT_NUMBER ).
+ *
+ * @details The effective link rate is given by @ref etx_ota_baud_rate , but it is bounded by how many bytes of windowed
+ *          bursts of ETX OTA Data Type Packets get acknowledged per round-trip time, as measured via the ETX OTA Ping
+ *          Commands, which is what limits the high-latency links (e.g., BLE).
+ *
+ * @param frame_size    Size in bytes of the "Data" field of the ETX OTA Data Type Packets that would be sent.
+ *
+ * @return  The effective link rate in bytes per second.
+ */
+static uint32_t get_etx_ota_link_rate(uint16_t frame_size);
+
+/**@brief   Chooses the size of the "Data" field of the ETX OTA Data Type Packets (i.e., the frame size) that will be
+ *          sent to the external device (connected to it via @ref COMPORT_NUMBER ) and stores it at
+ *          @ref etx_ota_frame_size .
+ *
+ * @details The frame size is @ref ETX_OTA_DATA_MAX_SIZE for the external devices that do not negotiate it. Otherwise,
+ *          it is @ref ETX_OTA_FRAME_SIZE whenever that is not \c 0 , or else the largest power of 2 of at least
+ *          @ref ETX_OTA_FRAME_SIZE_MIN bytes whose ETX OTA Data Type Packets take up to @ref ETX_OTA_FRAME_TARGET_TIME
+ *          at the effective link rate (see @ref get_etx_ota_link_rate ). Either way, it is limited to the one advertised
+ *          by the external device (see @ref etx_ota_max_frame_size ) and to @ref ETX_OTA_FRAME_SIZE_MAX , minus the
+ *          room taken by the offset of the ETX OTA Data v2 Type Packets and by the Reed-Solomon parity bytes, if used.
+ *
+ * @note    This function must be called after the round-trip time estimator has been seeded.
+ */
+static void negotiate_etx_ota_frame_size();
+
+/**@brief   Compresses the Payload with LZ4 into the window that the external device (connected to it via
+ *          @ref COMPORT_NUMBER ) keeps in RAM, but only if the compressed Payload is smaller than the bytes that would
+ *          otherwise be sent.
+ *
+ * @details The compression level is chosen from the effective link rate with the external device, which is given by
+ *          @ref etx_ota_baud_rate and by the round-trip time that was measured via the ETX OTA Ping Commands, so that
+ *          the host only spends time on a thorough compression whenever the link is slow enough to pay for it.
+ * @details The \c crc parameter of the Payload Source is kept as the 32-bit CRC of the decompressed Payload, since
+ *          that is the one that the external device validates after having decompressed it.
+ *
+ * @note    This function must only be called if @ref etx_ota_lz4_window_size is not \c 0 .
+ *
+ * @param[in, out] payload      Pointer to the Payload Source, which must have been read with @ref read_payload_source .
+ * @param[in] payload_path      File Path towards the Payload, which is only used if the Payload is not held in memory.
+ * @param sent_size             Number of bytes of the Payload that would be sent if it was not compressed.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval  ETX_OTA_EC_NA if the compressed Payload would not be smaller than \p sent_size , in which case the Payload
+ *          Source is left untouched.
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status compress_etx_ota_payload(ETX_OTA_Payload_Source_t *payload, char payload_path[], uint32_t sent_size);
+
+/**@brief   Gets the File Path of the Transfer Journal of an Application Firmware Image.
+ *
+ * @param[in] payload_path      File Path towards the Application Firmware Image.
+ * @param[out] journal_path     Pointer to where the File Path of the Transfer Journal will be written into, which must
+ *                              hold at least <tt>@ref PAYLOAD_MAX_FILE_PATH_LENGTH + sizeof( @ref ETX_OTA_JOURNAL_EXTENSION )</tt>
+ *                              bytes.
+ */
+static void get_etx_ota_journal_path(char payload_path[], char journal_path[]);
+
+/**@brief   Reads the Transfer Journal of an Application Firmware Image.
+ *
+ * @param[in] payload_path  File Path towards the Application Firmware Image.
+ * @param[out] p_journal    Pointer to where the Transfer Journal will be written into.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR if there is no Transfer Journal or if it could not be read.
+ */
+static ETX_OTA_Status read_etx_ota_journal(char payload_path[], ETX_OTA_Journal_t *p_journal);
+
+/**@brief   Writes the Transfer Journal of an Application Firmware Image.
+ *
+ * @param[in] payload_path  File Path towards the Application Firmware Image.
+ * @param[in] p_journal     Pointer to the Transfer Journal to be written.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval 	ETX_OTA_EC_ERR
+ */
+static ETX_OTA_Status write_etx_ota_journal(char payload_path[], ETX_OTA_Journal_t *p_journal);
 
 /**@brief   Sends an ETX OTA Command Type Packet containing the End Command in it to the external device (connected to
  *          it via @ref COMPORT_NUMBER ).
@@ -496,7 +1161,7 @@ static void LOG(LOG_t log_type, const char* msg, ...)
                         }
                         // for integers
                         if (ch1 == 'i' || ch1 == 'd' || ch1 == 'u'
-                            || ch1 == 'h') {
+                            || ch1 == 'h' || ch1 == 'x' || ch1 == 'X') {
                             fprintf(stdout, token,
                                     va_arg(ptr, int));
                         }
@@ -566,74 +1231,485 @@ static void LOG(LOG_t log_type, const char* msg, ...)
 }
 
 
-static uint32_t crc32_mpeg2(uint8_t *p_data, uint32_t DataLength)
+static ETX_OTA_Status send_etx_ota_packet_bytes(int teuniz_rs232_lib_comport, uint8_t *packet, uint16_t len)
 {
-    /** <b>Local variable checksum:</b> Will hold the resulting checksum of the 32-bit CRC Hash Function to be calculated. @note A checksum is any sort of mathematical operation that it is performed on data to represent its number of bits in a transmission message. This is usually used by programmers to detect high-level errors within data transmissions. The way this is used is prior to transmission, such that every piece of data or file can be assigned a checksum value after running a cryptographic has function, which in this particular case, the has function is 32-bit CRC. */
-    uint32_t checksum = 0xFFFFFFFF;
-
-    /* Apply the 32-bit CRC Hash Function to the given input data (i.e., The data towards which the \p p_data pointer points to). */
-    for (unsigned int i=0; i<DataLength; i++)
+    /** <b>Local variable sent:</b> Number of bytes of the ETX OTA Packet that have been taken by the Serial Port so far. */
+    uint16_t sent = 0;
+    /** <b>Local variable stalls:</b> Number of consecutive times that the Serial Port did not take any byte of the ETX OTA Packet. */
+    uint8_t stalls = 0;
+    /** <b>Local variable burst:</b> Number of bytes of the ETX OTA Packet that will be requested to be written in the current burst. */
+    int burst;
+    /** <b>Local variable n:</b> Number of bytes that the Serial Port actually took from the current burst. */
+    int n;
+
+    while (sent < len)
     {
-        uint8_t top = (uint8_t) (checksum >> 24);
-        top ^= p_data[i];
-        checksum = (checksum << 8) ^ crc_table[top];
+        burst = ((len-sent) > ETX_OTA_TX_BURST_SIZE) ? ETX_OTA_TX_BURST_SIZE : (len-sent);
+        n = RS232_SendBuf(teuniz_rs232_lib_comport, &packet[sent], burst);
+        if (n < 0)
+        {
+            return ETX_OTA_EC_ERR;
+        }
+        if (n == 0)
+        {
+            /* The output buffer of the Serial Port is full, so wait for the time that one burst takes to be shifted out before trying again. */
+            if (++stalls > ETX_OTA_TX_MAX_STALLS)
+            {
+                return ETX_OTA_EC_ERR;
+            }
+            n = burst;
+        }
+        else
+        {
+            stalls = 0;
+            sent += n;
+        }
+
+        /* Pace the next burst according to the time that the current one takes to be transmitted at the link rate. */
+        usleep((uint32_t) (((uint64_t) n * RS232_BITS_PER_BYTE * 1000000 + etx_ota_baud_rate - 1) / etx_ota_baud_rate) + SEND_PACKET_BYTES_DELAY);
     }
-    return checksum;
+
+    return ETX_OTA_EC_OK;
 }
 
-static bool is_ack_resp_received(int teuniz_rs232_lib_comport)
+static ETX_OTA_Status open_payload_source(ETX_OTA_Payload_Source_t *payload, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type)
 {
-    /* Reset the data contained inside the ETX OTA Packet Buffer. */
-    LOG(INFO_t, "Waiting for receiving an ETX OTA Response type Packet from Serial Port...");
-    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
-
-    /* Get the bytes available in the Serial Port if there is any. */
-    usleep(TEUNIZ_LIB_POLL_COMPORT_DELAY);
-    uint16_t len =  RS232_PollComport(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, sizeof(ETX_OTA_Response_Packet_t));
+    /* Reset the Payload Source. */
+    payload->size = 0;
+    payload->crc = 0;
+    payload->data = NULL;
+    payload->is_mapped = false;
+    payload->is_allocated = false;
+    payload->Fptr = NULL;
+    payload->chunk_offset = 0;
+    payload->chunk_len = 0;
 
-    if (len > 0)
+    switch (ETX_OTA_Payload_Type)
     {
-        /** <b>Local pointer etx_ota_resp:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Response_Packet_t type. */
-        ETX_OTA_Response_Packet_t *etx_ota_resp = (ETX_OTA_Response_Packet_t *) ETX_OTA_Packet_Buffer;
-        if (etx_ota_resp->packet_type == ETX_OTA_PACKET_TYPE_RESPONSE)
-        {
-            if (etx_ota_resp->crc == crc32_mpeg2(&etx_ota_resp->status, 1))
-            {
-                LOG(DONE_t, "ETX OTA Response Type Packet successfully received and processed.");
-                if (etx_ota_resp->status == ETX_OTA_ACK)
-                {
-                    LOG(INFO_t, "Received ACK Status Response.");
-                    return true;
+        case ETX_OTA_Bootloader_Firmware_Image:
+        case ETX_OTA_Application_Firmware_Image:
+            /* Open the File at the File Path that the user gave via \c payload_path in the case that a Firmware Image request to send to the MCU/MPU. */
+            LOG(INFO_t, "Opening Payload File with File Path: %s...", payload_path);
+            /** <b>Local variable error_code:</b> Stores the return value of the @ref fopen_s function. */
+            errno_t error_code;
+            error_code = fopen_s(&payload->Fptr, payload_path,"rb");
+            if (error_code != 0)
+            {
+                LOG(ERROR_t, "Could not open %s (errno code = %d)", payload_path, error_code);
+                payload->Fptr = NULL;
+                return ETX_OTA_EC_ERR;
+            }
+            LOG(DONE_t, "Payload File was opened successfully.");
+
+            /* Get the Payload size. */
+            LOG(INFO_t, "Getting Payload File...");
+            fseek(payload->Fptr, 0L, SEEK_END); // Set File position of the Stream at the end of the File.
+            payload->size = ftell(payload->Fptr);
+            fseek(payload->Fptr, 0L, SEEK_SET); // Reset File position of the Stream.
+
+            /* Memory-map the Payload File whenever possible, or otherwise fall back to reading it in chunks. */
+            #if defined(__linux__) || defined(__FreeBSD__)
+            if (payload->size > 0)
+            {
+                /** <b>Local pointer mapping:</b> Points to the memory-mapped Payload File, or holds @ref MAP_FAILED if it could not be memory-mapped. */
+                void *mapping = mmap(NULL, payload->size, PROT_READ, MAP_PRIVATE, fileno(payload->Fptr), 0);
+                if (mapping != MAP_FAILED)
+                {
+                    madvise(mapping, payload->size, MADV_SEQUENTIAL);
+                    payload->data = (uint8_t *) mapping;
+                    payload->is_mapped = true;
                 }
-                #if ETX_OTA_VERBOSE
-                else
+            }
+            #elif defined(_WIN32)
+            if (payload->size > 0)
+            {
+                /** <b>Local variable mapping_handle:</b> Handle of the File Mapping Object of the Payload File, which is no longer needed once its view has been mapped. */
+                HANDLE mapping_handle = CreateFileMapping((HANDLE) _get_osfhandle(_fileno(payload->Fptr)), NULL, PAGE_READONLY, 0, 0, NULL);
+                if (mapping_handle != NULL)
                 {
-                    LOG(INFO_t, "Received NACK Status Response.");
+                    /** <b>Local pointer mapping:</b> Points to the mapped view of the Payload File, or holds \c NULL if it could not be mapped. */
+                    void *mapping = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+                    CloseHandle(mapping_handle);
+                    if (mapping != NULL)
+                    {
+                        payload->data = (uint8_t *) mapping;
+                        payload->is_mapped = true;
+                    }
                 }
-                #endif
             }
-            #if ETX_OTA_VERBOSE
-            else
+            #endif
+            if (!payload->is_mapped)
+            {
+                LOG(WARNING_t, "The Payload File could not be memory-mapped, so it will be read in chunks of %d bytes instead.", ETX_OTA_PAYLOAD_CHUNK_SIZE);
+            }
+            return parse_payload_image(payload, payload_path, ETX_OTA_Payload_Type);
+        case ETX_OTA_Custom_Data:
+            // Generating some Custom Data.
+            for (uint32_t i=0; i<CUSTOM_DATA_MAX_SIZE; i++)
             {
-                LOG(ERROR_t, "CRC mismatch: [Calculated CRC = 0x%08lX] [Recorded CRC = 0x%08lX]", crc32_mpeg2(&etx_ota_resp->status, 1), etx_ota_resp->crc);
+                CUSTOM_DATA_CONTENT[i] = i;
             }
+            payload->data = CUSTOM_DATA_CONTENT;
+            payload->size = CUSTOM_DATA_MAX_SIZE;
+            break;
+        default:
+            LOG(ERROR_t, "The Payload Type indicated by the user is not recognized by the current ETX OTA Protocol.");
+            return ETX_OTA_EC_NA;
+    }
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status parse_payload_image(ETX_OTA_Payload_Source_t *payload, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type)
+{
+    /** <b>Local variable head:</b> First bytes of the Firmware Image File, which tell its format. */
+    uint8_t head[4] = {0};
+    /** <b>Local variable head_len:</b> Number of bytes held in \c head . */
+    size_t head_len;
+    /** <b>Local pointer p_file:</b> Points to the whole Firmware Image File. */
+    uint8_t *p_file = payload->data;
+    /** <b>Local variable file_size:</b> Length in bytes of the Firmware Image File. */
+    uint32_t file_size = payload->size;
+    /** <b>Local pointer p_image:</b> Points to the binary Firmware Image. */
+    uint8_t *p_image;
+    /** <b>Local variable image_size:</b> Length in bytes of the binary Firmware Image. */
+    uint32_t image_size;
+    /** <b>Local variable segment_count:</b> Number of populated segments found in the Firmware Image File. */
+    uint32_t segment_count;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ImageParser_Status function type. */
+    ImageParser_Status ret;
+    /** <b>Local variable base_address:</b> Flash Memory address of the slot at which the Firmware Image is to be placed. */
+    uint32_t base_address = (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? etx_ota_bl_flash_addr : etx_ota_app_flash_addr;
+    /** <b>Local variable max_size:</b> Length in bytes of the slot at which the Firmware Image is to be placed. */
+    uint32_t max_size = (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? etx_ota_bl_fw_size : etx_ota_app_fw_size;
+
+    /* Get the format of the Firmware Image File, which is sent as it is if it is a raw binary one. */
+    if (p_file != NULL)
+    {
+        head_len = (file_size < sizeof(head)) ? file_size : sizeof(head);
+        memcpy(head, p_file, head_len);
+    }
+    else
+    {
+        head_len = fread(head, 1, sizeof(head), payload->Fptr);
+        fseek(payload->Fptr, 0L, SEEK_SET);
+    }
+    if (image_parser_get_format(head, head_len) == IMAGE_PARSER_FORMAT_BINARY)
+    {
+        return ETX_OTA_EC_OK;
+    }
+
+    /* Place the segments of the Firmware Image File into a binary Firmware Image. */
+    LOG(INFO_t, "Placing the segments of the Firmware Image File at address 0x%08X...", base_address);
+    if ((p_file == NULL) && (load_etx_ota_file(payload_path, &p_file, &file_size) != ETX_OTA_EC_OK))
+    {
+        close_payload_source(payload);
+        return ETX_OTA_EC_ERR;
+    }
+    ret = image_parser_flatten(p_file, file_size, base_address, max_size, &p_image, &image_size, &segment_count);
+    if (p_file != payload->data)
+    {
+        free(p_file);
+    }
+    close_payload_source(payload);
+    if (ret != IMAGE_PARSER_EC_OK)
+    {
+        LOG(ERROR_t, "The Firmware Image File is either malformed or has segments outside of the %d bytes from address 0x%08X.", max_size, base_address);
+        return ETX_OTA_EC_ERR;
+    }
+    payload->data = p_image;
+    payload->size = image_size;
+    payload->is_allocated = true;
+    LOG(DONE_t, "The %d segments of the Firmware Image File were placed into a %d bytes Firmware Image.", segment_count, image_size);
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status read_payload_source(ETX_OTA_Payload_Source_t *payload)
+{
+    /** <b>Local variable n:</b> Number of bytes of the Payload File that were read into the chunk on the latest read. */
+    size_t n;
+
+    /* Calculate the 32-bit CRC directly from the Payload whenever it is held in memory. */
+    if (payload->data != NULL)
+    {
+        payload->crc = crc32_mpeg2(payload->data, payload->size);
+        return ETX_OTA_EC_OK;
+    }
+
+    /* Otherwise, read the whole Payload File in chunks while calculating its 32-bit CRC. */
+    payload->crc = CRC32_MPEG2_INIT_VALUE;
+    payload->chunk_len = 0;
+    fseek(payload->Fptr, 0L, SEEK_SET);
+    for (uint32_t i=0; i<payload->size; i+=n)
+    {
+        // NOTE: The "fread()" function returns the total number of elements that were successfully read.
+        n = fread(payload->chunk, 1, ((payload->size-i) >= ETX_OTA_PAYLOAD_CHUNK_SIZE) ? ETX_OTA_PAYLOAD_CHUNK_SIZE : (payload->size-i), payload->Fptr);
+        if (n == 0)
+        {
+            return ETX_OTA_EC_ERR;
+        }
+        payload->crc = crc32_mpeg2_update(payload->crc, payload->chunk, n);
+        payload->chunk_offset = i;
+        payload->chunk_len = n;
+    }
+
+    return ETX_OTA_EC_OK;
+}
+
+static uint8_t *get_payload_source_data(ETX_OTA_Payload_Source_t *payload, uint32_t offset, uint16_t len)
+{
+    /** <b>Local variable chunk_len:</b> Number of bytes of the Payload File that are to be read into the chunk. */
+    uint32_t chunk_len;
+
+    /* Point directly to the requested bytes whenever the Payload is held in memory. */
+    if (payload->data != NULL)
+    {
+        return &payload->data[offset];
+    }
+
+    /* Otherwise, read the chunk of the Payload File that starts at the requested bytes, unless they are already held in the current chunk. */
+    if ((offset < payload->chunk_offset) || ((offset + len) > (payload->chunk_offset + payload->chunk_len)))
+    {
+        chunk_len = ((payload->size-offset) >= ETX_OTA_PAYLOAD_CHUNK_SIZE) ? ETX_OTA_PAYLOAD_CHUNK_SIZE : (payload->size-offset);
+        payload->chunk_len = 0;
+        if ((fseek(payload->Fptr, offset, SEEK_SET) != 0) || (fread(payload->chunk, 1, chunk_len, payload->Fptr) != chunk_len))
+        {
+            return NULL;
+        }
+        payload->chunk_offset = offset;
+        payload->chunk_len = chunk_len;
+    }
+
+    return &payload->chunk[offset - payload->chunk_offset];
+}
+
+static void close_payload_source(ETX_OTA_Payload_Source_t *payload)
+{
+    #if defined(__linux__) || defined(__FreeBSD__)
+    if (payload->is_mapped)
+    {
+        munmap(payload->data, payload->size);
+    }
+    #elif defined(_WIN32)
+    if (payload->is_mapped)
+    {
+        UnmapViewOfFile(payload->data);
+    }
+    #endif
+    if (payload->is_allocated)
+    {
+        free(payload->data);
+    }
+    payload->data = NULL;
+    payload->is_mapped = false;
+    payload->is_allocated = false;
+    if (payload->Fptr)
+    {
+        fclose(payload->Fptr);
+        payload->Fptr = NULL;
+    }
+}
+
+static uint64_t get_monotonic_time()
+{
+    #if defined(__linux__) || defined(__FreeBSD__)
+    /** <b>Local variable ts:</b> Holds the current time of the monotonic clock of our host machine. */
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+    #else
+    return (uint64_t) GetTickCount64() * 1000;
+    #endif
+}
+
+static void etx_ota_reset_rtt()
+{
+    etx_ota_srtt = 0;
+    etx_ota_rttvar = 0;
+    etx_ota_rto = ETX_OTA_INITIAL_RTO;
+    etx_ota_rtt_samples = 0;
+    etx_ota_sent_offset = 0;
+}
+
+static void etx_ota_update_rtt(uint32_t rtt)
+{
+    /** <b>Local variable rto:</b> Holds the newly calculated retransmission timeout in microseconds before being bounded. */
+    uint64_t rto;
+
+    if (etx_ota_rtt_samples++ == 0)
+    {
+        etx_ota_srtt = rtt;
+        etx_ota_rttvar = rtt / 2;
+    }
+    else
+    {
+        etx_ota_rttvar = (3*(uint64_t)etx_ota_rttvar + ((etx_ota_srtt > rtt) ? (etx_ota_srtt - rtt) : (rtt - etx_ota_srtt))) / 4;
+        etx_ota_srtt = (7*(uint64_t)etx_ota_srtt + rtt) / 8;
+    }
+    rto = (uint64_t) etx_ota_srtt + 4*(uint64_t)etx_ota_rttvar;
+    if (rto < ETX_OTA_MIN_RTO)
+    {
+        rto = ETX_OTA_MIN_RTO;
+    }
+    if (rto > ETX_OTA_RESP_TIMEOUT)
+    {
+        rto = ETX_OTA_RESP_TIMEOUT;
+    }
+    etx_ota_rto = (uint32_t) rto;
+}
+
+static void etx_ota_backoff_rto()
+{
+    etx_ota_rto = ((2*(uint64_t)etx_ota_rto) > ETX_OTA_RESP_TIMEOUT) ? ETX_OTA_RESP_TIMEOUT : (2*etx_ota_rto);
+}
+
+static bool is_ack_resp_received(int teuniz_rs232_lib_comport, uint8_t rtt_frames, uint32_t max_timeout)
+{
+    return is_ack_resp_with_data_received(teuniz_rs232_lib_comport, rtt_frames, max_timeout, NULL, NULL);
+}
+
+static bool is_ack_resp_with_data_received(int teuniz_rs232_lib_comport, uint8_t rtt_frames, uint32_t max_timeout, uint8_t *resp_data, uint16_t *resp_data_len)
+{
+    return (receive_etx_ota_resp(teuniz_rs232_lib_comport, rtt_frames, true, max_timeout, resp_data, resp_data_len) == ETX_OTA_EC_OK);
+}
+
+static ETX_OTA_Status receive_etx_ota_resp(int teuniz_rs232_lib_comport, uint8_t rtt_frames, bool is_rtt_sampled, uint32_t max_timeout, uint8_t *resp_data, uint16_t *resp_data_len)
+{
+    /** <b>Local variable start:</b> Time, as given by @ref get_monotonic_time , at which our host machine started waiting for the ETX OTA Response Type Packet. */
+    uint64_t start = get_monotonic_time();
+    /** <b>Local variable deadline:</b> Time, as given by @ref get_monotonic_time , at which our host machine will stop waiting for the ETX OTA Response Type Packet, which is initially given by @ref etx_ota_rto unless \p rtt_frames is zero. */
+    uint64_t deadline = start + ((rtt_frames == 0) ? max_timeout : ((uint64_t) rtt_frames * etx_ota_rto));
+    /** <b>Local variable is_rto_expired:</b> Flag used to indicate whether @ref etx_ota_rto has already expired while waiting for the current ETX OTA Response Type Packet. */
+    bool is_rto_expired = (rtt_frames == 0);
+    /** <b>Local variable now:</b> Holds the latest time given by @ref get_monotonic_time . */
+    uint64_t now;
+    /** <b>Local variable len:</b> Number of bytes of the ETX OTA Response Type Packet that have been received so far. */
+    uint16_t len = 0;
+    /** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Response Type Packet being received. */
+    uint16_t data_len;
+    /** <b>Local variable rec_crc:</b> Value holder of the "Recorded CRC" contained in the received ETX OTA Response Type Packet. */
+    uint32_t rec_crc;
+    /** <b>Local variable n:</b> Number of bytes that were received from the Serial Port on its latest read. */
+    int n;
+
+    /* Reset the data contained inside the ETX OTA Packet Buffer. */
+    LOG(INFO_t, "Waiting for receiving an ETX OTA Response type Packet from Serial Port...");
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    if (resp_data_len != NULL)
+    {
+        *resp_data_len = 0;
+    }
+
+    while (true)
+    {
+        /* Resynchronize on the next SOF by discarding any bytes that were received before it. */
+        /** <b>Local variable sof_index:</b> Index of the first SOF found within the received bytes. */
+        uint16_t sof_index = 0;
+        while ((sof_index<len) && (ETX_OTA_Packet_Buffer[sof_index]!=ETX_OTA_SOF))
+        {
+            sof_index++;
+        }
+        if (sof_index > 0)
+        {
+            #if ETX_OTA_VERBOSE
+            LOG(WARNING_t, "Discarding %d received byte(s) that were not part of an ETX OTA Response Type Packet.", sof_index);
             #endif
+            len -= sof_index;
+            memmove(ETX_OTA_Packet_Buffer, &ETX_OTA_Packet_Buffer[sof_index], len);
         }
-        #if ETX_OTA_VERBOSE
-        else
+
+        /* Validate the ETX OTA Response Type Packet once all of its bytes have been received. */
+        if (len >= ETX_OTA_DATA_FIELD_INDEX)
+        {
+            /** <b>Local pointer etx_ota_resp:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Response_Packet_t type. */
+            ETX_OTA_Response_Packet_t *etx_ota_resp = (ETX_OTA_Response_Packet_t *) ETX_OTA_Packet_Buffer;
+            data_len = etx_ota_resp->data_len;
+            if ((etx_ota_resp->packet_type!=ETX_OTA_PACKET_TYPE_RESPONSE) || (data_len==0) || (data_len>ETX_OTA_RESP_DATA_MAX_SIZE))
+            {
+                #if ETX_OTA_VERBOSE
+                LOG(ERROR_t, "Expected an ETX OTA Response Type Packet, but received something else.");
+                #endif
+                ETX_OTA_Packet_Buffer[0] = 0; // Drop this SOF so that the reception resynchronizes on the next one.
+                continue;
+            }
+            if (len >= (ETX_OTA_DATA_OVERHEAD + data_len))
+            {
+                memcpy(&rec_crc, &ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX + data_len], ETX_OTA_CRC32_SIZE);
+                if ((ETX_OTA_Packet_Buffer[ETX_OTA_DATA_OVERHEAD + data_len - ETX_OTA_EOF_SIZE] != ETX_OTA_EOF) || (rec_crc != crc32_mpeg2(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], data_len)))
+                {
+                    #if ETX_OTA_VERBOSE
+                    LOG(ERROR_t, "CRC mismatch: [Calculated CRC = 0x%08lX] [Recorded CRC = 0x%08lX]", crc32_mpeg2(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], data_len), rec_crc);
+                    #endif
+                    ETX_OTA_Packet_Buffer[0] = 0; // Drop this SOF so that the reception resynchronizes on the next one.
+                    continue;
+                }
+                if (etx_ota_resp->status == ETX_OTA_READY)
+                {
+                    LOG(WARNING_t, "Received a READY beacon instead of the expected ETX OTA Response Type Packet.");
+                    return ETX_OTA_EC_NA;
+                }
+
+                LOG(DONE_t, "ETX OTA Response Type Packet successfully received and processed.");
+                if ((rtt_frames > 0) && is_rtt_sampled)
+                {
+                    etx_ota_update_rtt((uint32_t) ((get_monotonic_time() - start) / rtt_frames));
+                }
+                if ((resp_data != NULL) && (resp_data_len != NULL))
+                {
+                    *resp_data_len = data_len - 1;
+                    memcpy(resp_data, &ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX + 1], *resp_data_len);
+                }
+                if (etx_ota_resp->status == ETX_OTA_ACK)
+                {
+                    LOG(INFO_t, "Received ACK Status Response.");
+                    return ETX_OTA_EC_OK;
+                }
+                #if ETX_OTA_VERBOSE
+                LOG(INFO_t, "Received NACK Status Response.");
+                #endif
+                return ETX_OTA_EC_ERR;
+            }
+        }
+
+        /* Wait for more bytes to arrive at the Serial Port, but only until the deadline is reached. */
+        now = get_monotonic_time();
+        if ((now >= deadline) && !is_rto_expired)
+        {
+            /* Back off the retransmission timeout and, if the ETX OTA Packet cannot be re-sent, keep waiting up to the maximum timeout. */
+            is_rto_expired = true;
+            etx_ota_backoff_rto();
+            LOG(WARNING_t, "The retransmission timeout has expired, which has now been backed off to %d microseconds.", etx_ota_rto);
+            deadline = start + max_timeout;
+        }
+        if (now >= deadline)
+        {
+            break;
+        }
+        if (RS232_WaitForData(teuniz_rs232_lib_comport, (int) ((deadline - now + 999) / 1000)) < 0)
+        {
+            LOG(ERROR_t, "The Serial Port has reported an error while waiting for an ETX OTA Response Type Packet.");
+            return ETX_OTA_EC_ERR;
+        }
+        n = RS232_PollComport(teuniz_rs232_lib_comport, &ETX_OTA_Packet_Buffer[len], (ETX_OTA_DATA_OVERHEAD+ETX_OTA_RESP_DATA_MAX_SIZE) - len);
+        if (n > 0)
         {
-            LOG(ERROR_t, "Expected an ETX OTA Response Type Packet, but received something else.");
+            len += n;
         }
-        #endif
     }
+
     #if ETX_OTA_VERBOSE
-    else
+    if (len == 0)
     {
         LOG(ERROR_t, "No data was received from the Serial Port.");
     }
+    else
+    {
+        LOG(ERROR_t, "Only %d byte(s) of an ETX OTA Response Type Packet were received before the timeout.", len);
+    }
     #endif
 
-    return false;
+    return ETX_OTA_EC_NR;
 }
 
 static ETX_OTA_Status send_etx_ota_abort(int teuniz_rs232_lib_comport)
@@ -652,18 +1728,14 @@ static ETX_OTA_Status send_etx_ota_abort(int teuniz_rs232_lib_comport)
 
     /* Send the ETX OTA Command Type Packet containing the Abort Command. */
     LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the Abort Command...");
-    for (uint8_t i = 0; i<ETX_OTA_CMD_PACKET_T_SIZE; i++)
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, ETX_OTA_CMD_PACKET_T_SIZE) != ETX_OTA_EC_OK)
     {
-        usleep(SEND_PACKET_BYTES_DELAY);
-        if (RS232_SendByte(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer[i]))
-        {
-            LOG(ERROR_t, "A byte of the ETX OTA Command Type Packet containing the Abort Command could not be send over the Serial Port.");
-            return ETX_OTA_EC_ERR;
-        }
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Abort Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
     }
 
     /* Validate receiving back an ACK Status Response from the MCU. */
-    if (!is_ack_resp_received(teuniz_rs232_lib_comport))
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, 1, 0))
     {
         LOG(ERROR_t, "The host machine has received a NACK from the external device.");
         return ETX_OTA_EC_ERR;
@@ -673,182 +1745,1105 @@ static ETX_OTA_Status send_etx_ota_abort(int teuniz_rs232_lib_comport)
     return ETX_OTA_EC_OK;
 }
 
+static ETX_OTA_Status send_etx_ota_sync(int teuniz_rs232_lib_comport, uint8_t seq)
+{
+    /** <b>Local variable sync_cmd_data:</b> "Data" field of the ETX OTA Command Type Packet to be sent, which holds the Sync Command followed by its sequence number. */
+    uint8_t sync_cmd_data[ETX_OTA_SYNC_CMD_SIZE] = {ETX_OTA_CMD_SYNC, seq};
+    /** <b>Local variable resp_data:</b> Bytes that the external device appended to its Response Status, which should be the echoed sequence number. */
+    uint8_t resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];
+    /** <b>Local variable resp_data_len:</b> Number of valid bytes in \c resp_data . */
+    uint16_t resp_data_len;
+    /** <b>Local variable deadline:</b> Time, as given by @ref get_monotonic_time , at which our host machine will stop waiting for the expected ACK. */
+    uint64_t deadline;
+    /** <b>Local variable now:</b> Holds the latest time given by @ref get_monotonic_time . */
+    uint64_t now;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+    ETX_OTA_Status ret;
+
+    /* Discard any stale bytes and then send the ETX OTA Command Type Packet containing the Sync Command. */
+    RS232_flushRX(teuniz_rs232_lib_comport);
+    LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the Sync Command (sequence number = %d)...", seq);
+    if (send_etx_ota_cmd_packet(teuniz_rs232_lib_comport, sync_cmd_data, ETX_OTA_SYNC_CMD_SIZE) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Sync Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Wait for the ACK that echoes the sequence number, while skipping the late ACKs to the previous ETX OTA Sync Commands. */
+    deadline = get_monotonic_time() + ETX_OTA_SYNC_INTERVAL;
+    while ((now = get_monotonic_time()) < deadline)
+    {
+        ret = receive_etx_ota_resp(teuniz_rs232_lib_comport, 0, false, (uint32_t) (deadline - now), resp_data, &resp_data_len);
+        if ((ret != ETX_OTA_EC_OK) || ((resp_data_len >= 1) && (resp_data[0] == seq)))
+        {
+            return ret;
+        }
+        LOG(WARNING_t, "Skipping a late ACK to a previous ETX OTA Sync Command.");
+    }
+
+    return ETX_OTA_EC_NR;
+}
+
+static ETX_OTA_Status sync_etx_ota(int teuniz_rs232_lib_comport)
+{
+    /** <b>Local variable deadline:</b> Time, as given by @ref get_monotonic_time , at which our host machine will give up on synchronizing with the external device. */
+    uint64_t deadline = get_monotonic_time() + ETX_OTA_SYNC_MAX_TIME;
+    /** <b>Local variable seq:</b> Sequence number of the latest ETX OTA Sync Command. */
+    uint8_t seq = 0;
+    /** <b>Local variable nacks:</b> Number of consecutive NACKs that have been received in response to the ETX OTA Sync Command. */
+    uint8_t nacks = 0;
+
+    etx_ota_is_sync_supported = false;
+    do
+    {
+        switch (send_etx_ota_sync(teuniz_rs232_lib_comport, ++seq))
+        {
+            case ETX_OTA_EC_OK:
+                LOG(DONE_t, "The external device has been synchronized with after %d ETX OTA Sync Command(s).", seq);
+                etx_ota_is_sync_supported = true;
+                return ETX_OTA_EC_OK;
+            case ETX_OTA_EC_ERR:
+                if (++nacks >= ETX_OTA_SYNC_LEGACY_NACKS)
+                {
+                    LOG(WARNING_t, "The external device does not support the ETX OTA Sync Command.");
+                    return ETX_OTA_EC_NA;
+                }
+                break;
+            case ETX_OTA_EC_NA:
+                /* The external device has just started to listen for ETX OTA Packets, so send the ETX OTA Sync Command again right away. */
+                nacks = 0;
+                break;
+            default:
+                /* Send the resync sequence so that the external device rejects any ETX OTA Packet that it may have been receiving. */
+                nacks = 0;
+                memset(ETX_OTA_Packet_Buffer, 0xFF, ETX_OTA_PACKET_MAX_SIZE);
+                if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, ETX_OTA_PACKET_MAX_SIZE) != ETX_OTA_EC_OK)
+                {
+                    LOG(ERROR_t, "The resync sequence could not be send over the Serial Port.");
+                    return ETX_OTA_EC_ERR;
+                }
+        }
+    }
+    while (get_monotonic_time() < deadline);
+
+    return ETX_OTA_EC_NR;
+}
+
 static ETX_OTA_Status send_etx_ota_start(int teuniz_rs232_lib_comport)
 {
-    /** <b>Local pointer etx_ota_start:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
-    ETX_OTA_Command_Packet_t *etx_ota_start = (ETX_OTA_Command_Packet_t *) ETX_OTA_Packet_Buffer;
+    /** <b>Local variable start_cmd_data:</b> "Data" field of the ETX OTA Command Type Packet to be sent, which holds the Start Command followed by the requested window size and by the flags byte. */
+    uint8_t start_cmd_data[] = {ETX_OTA_CMD_START, ETX_OTA_WINDOW_SIZE, (ETX_OTA_RESUME ? ETX_OTA_START_FLAG_RESUME : 0) | ((ETX_OTA_DATA_MAX_RETRIES > 0) ? ETX_OTA_START_FLAG_NACK_REASON : 0) | (ETX_OTA_DATA_V2 ? ETX_OTA_START_FLAG_DATA_V2 : 0) | (ETX_OTA_FEC ? ETX_OTA_START_FLAG_FEC : 0) | ETX_OTA_START_FLAG_GEOMETRY};
+    /** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Command Type Packet to be sent, which will only include the requested window size if the windowed transfer mode is enabled via @ref ETX_OTA_WINDOW_SIZE , and the flags byte if any of its flags is set. */
+    uint16_t data_len = (start_cmd_data[2] != 0) ? sizeof(start_cmd_data) : ((ETX_OTA_WINDOW_SIZE > 1) ? 2 : 1);
+    /** <b>Local variable offset_index:</b> Indicates the index value for a certain field contained in the current ETX OTA Command Type Packet. */
+    uint16_t offset_index = 0;
+    /** <b>Local variable crc:</b> Holds the Calculated 32-bit CRC of the "Data" field of the ETX OTA Command Type Packet to be sent. */
+    uint32_t crc = crc32_mpeg2(start_cmd_data, data_len);
+    /** <b>Local variable resp_data:</b> Holds the bytes that the external device appended to its Response Status, if any. */
+    uint8_t resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];
+    /** <b>Local variable resp_data_len:</b> Number of bytes held in \c resp_data . */
+    uint16_t resp_data_len;
+    /** <b>Local pointer start_resp:</b> Points to \c resp_data but in @ref etx_ota_start_resp_t type, whose fields are only read if \c resp_data_len reaches them. */
+    const etx_ota_start_resp_t *start_resp = (const etx_ota_start_resp_t *) resp_data;
 
     /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Start Command. */
     memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
-    etx_ota_start->sof          = ETX_OTA_SOF;
-    etx_ota_start->packet_type  = ETX_OTA_PACKET_TYPE_CMD;
-    etx_ota_start->data_len     = 1;
-    etx_ota_start->cmd          = ETX_OTA_CMD_START;
-    etx_ota_start->crc          = crc32_mpeg2(&etx_ota_start->cmd, 1);
-    etx_ota_start->eof          = ETX_OTA_EOF;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_SOF; // Populate SOF field.
+    offset_index += ETX_OTA_SOF_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_PACKET_TYPE_CMD; // Populate Packet Type field.
+    offset_index += ETX_OTA_PACKET_TYPE_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &data_len, ETX_OTA_DATA_LENGTH_SIZE); // Populate Data Length field.
+    offset_index += ETX_OTA_DATA_LENGTH_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], start_cmd_data, data_len); // Populate Data field.
+    offset_index += data_len;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &crc, ETX_OTA_CRC32_SIZE); // Populate CRC field.
+    offset_index += ETX_OTA_CRC32_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_EOF; // Populate EOF field.
+    offset_index += ETX_OTA_EOF_SIZE;
 
     /* Send the ETX OTA Command Type Packet containing the Start Command. */
     LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the Start Command...");
-    for (uint8_t i = 0; i<ETX_OTA_CMD_PACKET_T_SIZE; i++)
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, offset_index) != ETX_OTA_EC_OK)
     {
-        usleep(SEND_PACKET_BYTES_DELAY);
-        if (RS232_SendByte(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer[i]))
-        {
-            LOG(ERROR_t, "A byte of the ETX OTA Command Type Packet containing the Start Command START could not be send over the Serial Port.");
-            return ETX_OTA_EC_ERR;
-        }
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Start Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
     }
 
     /* Validate receiving back an ACK Status Response from the MCU. */
-    if (!is_ack_resp_received(teuniz_rs232_lib_comport))
+    if (!is_ack_resp_with_data_received(teuniz_rs232_lib_comport, 1, ETX_OTA_RESP_TIMEOUT, resp_data, &resp_data_len))
     {
         LOG(ERROR_t, "The host machine has received a NACK from the external device.");
         return ETX_OTA_EC_ERR;
     }
 
+    /* Get the window size granted by the external device, where a plain ACK means that it does not support the windowed transfer mode (nor the Ping Command). */
+    etx_ota_window_size = 1;
+    etx_ota_is_ping_supported = (data_len > 1) && (resp_data_len >= 1);
+    etx_ota_is_delta_supported = ETX_OTA_DELTA_UPDATE && etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(features)) && (start_resp->features & ETX_OTA_FEATURE_DELTA_UPDATE);
+    etx_ota_patch_backlog_pages = (etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(patch_backlog_pages)) && (start_resp->features & ETX_OTA_FEATURE_PATCH_UPDATE)) ? start_resp->patch_backlog_pages : 0;
+    etx_ota_is_sparse_supported = etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(features)) && (start_resp->features & ETX_OTA_FEATURE_DELTA_UPDATE) && (start_resp->features & ETX_OTA_FEATURE_SPARSE_IMAGE);
+    etx_ota_is_nack_reason_supported = etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(features)) && (start_resp->features & ETX_OTA_FEATURE_NACK_REASON);
+    etx_ota_is_data_v2_supported = ETX_OTA_DATA_V2 && etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(ext_features)) && (start_resp->ext_features & ETX_OTA_EXT_FEATURE_DATA_V2);
+    etx_ota_is_fec_supported = ETX_OTA_FEC && etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(ext_features)) && (start_resp->features & ETX_OTA_FEATURE_FRAME_SIZE) && (start_resp->ext_features & ETX_OTA_EXT_FEATURE_FEC);
+    etx_ota_is_fec_active = etx_ota_is_fec_supported && (ETX_OTA_FEC == 1);
+    etx_ota_frame_error_rate = 0;
+    etx_ota_lz4_window_size = (ETX_OTA_COMPRESSION && etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(lz4_window_log2)) && (start_resp->features & ETX_OTA_FEATURE_COMPRESSION) && (start_resp->lz4_window_log2 >= 8) && (start_resp->lz4_window_log2 <= 16)) ? (1UL << start_resp->lz4_window_log2) : 0;
+    if (etx_ota_is_ping_supported && (start_resp->window_size > 1))
+    {
+        etx_ota_window_size = (start_resp->window_size < ETX_OTA_WINDOW_SIZE) ? start_resp->window_size : ETX_OTA_WINDOW_SIZE;
+    }
+    etx_ota_max_frame_size = 0;
+    if (etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(max_data_size)) && (start_resp->features & ETX_OTA_FEATURE_FRAME_SIZE))
+    {
+        etx_ota_max_frame_size = start_resp->max_data_size;
+        LOG(INFO_t, "The external device can receive ETX OTA Data Type Packets of up to %d bytes.", etx_ota_max_frame_size);
+    }
+    etx_ota_max_baud_rate = 0;
+    if (etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(baud_confirm_timeout)) && (start_resp->features & ETX_OTA_FEATURE_BAUD_RATE))
+    {
+        etx_ota_max_baud_rate = start_resp->baud_rate_max;
+        etx_ota_baud_confirm_timeout = start_resp->baud_confirm_timeout;
+        LOG(INFO_t, "The external device can be switched to a Baud rate of up to %d.", etx_ota_max_baud_rate);
+    }
+    memset(&etx_ota_checkpoint, 0, sizeof(etx_ota_checkpoint));
+    if (ETX_OTA_RESUME && etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(checkpoint_offset)) && (start_resp->features & ETX_OTA_FEATURE_RESUME))
+    {
+        etx_ota_checkpoint.size = start_resp->checkpoint_size;
+        etx_ota_checkpoint.crc = start_resp->checkpoint_crc;
+        etx_ota_checkpoint.offset = start_resp->checkpoint_offset;
+        LOG(INFO_t, "Checkpoint of the external device: %d bytes out of a %d bytes Firmware Image with 32-bit CRC 0x%08X.", etx_ota_checkpoint.offset, etx_ota_checkpoint.size, etx_ota_checkpoint.crc);
+    }
+    if (etx_ota_is_ping_supported && (resp_data_len >= ETX_OTA_START_RESP_LEN(rx_ring_size)) && (start_resp->ext_features & ETX_OTA_EXT_FEATURE_GEOMETRY))
+    {
+        if (start_resp->page_size == 0)
+        {
+            LOG(WARNING_t, "The external device has reported a Flash Memory page size of 0 bytes, so the Flash Memory geometry of the host configuration will be used instead.");
+        }
+        else
+        {
+            etx_ota_page_size = start_resp->page_size;
+            etx_ota_bl_flash_addr = start_resp->bl_flash_addr;
+            etx_ota_bl_fw_size = (uint32_t) start_resp->bl_flash_pages * start_resp->page_size;
+            etx_ota_app_flash_addr = start_resp->app_flash_addr;
+            etx_ota_app_fw_size = (uint32_t) start_resp->app_flash_pages * start_resp->page_size;
+            LOG(INFO_t, "Flash Memory geometry of the external device: pages of %d bytes, Bootloader Firmware slot of %d pages at 0x%08X, Application Firmware slot of %d pages at 0x%08X, and a receive buffer of %d bytes.", start_resp->page_size, start_resp->bl_flash_pages, etx_ota_bl_flash_addr, start_resp->app_flash_pages, etx_ota_app_flash_addr, start_resp->rx_ring_size);
+        }
+    }
+    LOG(INFO_t, "Negotiated window size = %d ETX OTA Data Type Packet(s).", etx_ota_window_size);
+
     LOG(DONE_t, "ETX OTA Command Type Packet containing the Start Command was send successfully.");
     return ETX_OTA_EC_OK;
 }
 
-static ETX_OTA_Status send_etx_ota_header(int teuniz_rs232_lib_comport, header_data_t *etx_ota_header_info)
+static ETX_OTA_Status send_etx_ota_ping(int teuniz_rs232_lib_comport, uint32_t timeout)
 {
-    /** <b>Local pointer etx_ota_start:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
-    ETX_OTA_Header_Packet_t *etx_ota_header = (ETX_OTA_Header_Packet_t *) ETX_OTA_Packet_Buffer;
+    /** <b>Local pointer etx_ota_ping:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+    ETX_OTA_Command_Packet_t *etx_ota_ping = (ETX_OTA_Command_Packet_t *) ETX_OTA_Packet_Buffer;
 
-    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Start Command. */
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Ping Command. */
     memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
-    etx_ota_header->sof          = ETX_OTA_SOF;
-    etx_ota_header->packet_type  = ETX_OTA_PACKET_TYPE_HEADER;
-    etx_ota_header->data_len     = ETX_OTA_HEADER_DATA_T_SIZE;
-    memcpy(&etx_ota_header->meta_data, etx_ota_header_info, ETX_OTA_HEADER_DATA_T_SIZE);
-    etx_ota_header->crc          = crc32_mpeg2((uint8_t *) &(etx_ota_header->meta_data), ETX_OTA_HEADER_DATA_T_SIZE);
-    etx_ota_header->eof          = ETX_OTA_EOF;
+    etx_ota_ping->sof          = ETX_OTA_SOF;
+    etx_ota_ping->packet_type  = ETX_OTA_PACKET_TYPE_CMD;
+    etx_ota_ping->data_len     = 1;
+    etx_ota_ping->cmd          = ETX_OTA_CMD_PING;
+    etx_ota_ping->crc          = crc32_mpeg2(&etx_ota_ping->cmd, 1);
+    etx_ota_ping->eof          = ETX_OTA_EOF;
+
+    /* Send the ETX OTA Command Type Packet containing the Ping Command. */
+    LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the Ping Command...");
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, ETX_OTA_CMD_PACKET_T_SIZE) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Ping Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Validate receiving back an ACK Status Response from the MCU, which also takes a round-trip time sample unless a fixed timeout was given. */
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, (timeout == 0) ? 1 : 0, timeout))
+    {
+        LOG(WARNING_t, "No ACK was received from the external device for the Ping Command.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    LOG(DONE_t, "Round-trip time sample taken (SRTT = %d us, RTTVAR = %d us, RTO = %d us).", etx_ota_srtt, etx_ota_rttvar, etx_ota_rto);
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status upgrade_etx_ota_baud_rate(int teuniz_rs232_lib_comport, char mode[])
+{
+    /** <b>Local variable baud_rate_max:</b> Fastest Baud rate that both the host and the external device allow. */
+    uint32_t baud_rate_max = (ETX_OTA_BAUD_RATE_UPGRADE < etx_ota_max_baud_rate) ? ETX_OTA_BAUD_RATE_UPGRADE : etx_ota_max_baud_rate;
+    /** <b>Local variable baud_rate:</b> Baud rate that will be requested to the external device, which is the fastest of @ref etx_ota_standard_baud_rates up to \c baud_rate_max . */
+    uint32_t baud_rate = 0;
+    /** <b>Local variable baud_cmd_data:</b> Holds the "Data" field of the ETX OTA Command Type Packet carrying the Baud Rate Command, which is given by the Command byte and the 4-byte Baud rate. */
+    uint8_t baud_cmd_data[ETX_OTA_BAUD_RATE_CMD_SIZE] = {ETX_OTA_CMD_BAUD_RATE};
+    /** <b>Local variable data_len:</b> "Data Length" field value of the ETX OTA Command Type Packet to be sent. */
+    uint16_t data_len = ETX_OTA_BAUD_RATE_CMD_SIZE;
+    /** <b>Local variable offset_index:</b> Indicates the index value for a certain field contained in the current ETX OTA Command Type Packet. */
+    uint16_t offset_index = 0;
+    /** <b>Local variable crc:</b> Holds the Calculated 32-bit CRC of the "Data" field of the ETX OTA Command Type Packet to be sent. */
+    uint32_t crc;
+    /** <b>Local variable ping_timeout:</b> Time in microseconds that the host waits for the ACK to each ETX OTA Ping Command sent at the new Baud rate, so that all of them fit into the confirmation time of the external device. */
+    uint32_t ping_timeout = (uint32_t) etx_ota_baud_confirm_timeout * 1000 / (ETX_OTA_BAUD_CONFIRM_PINGS + 1);
+
+    /* Pick the fastest standard Baud rate within the advertised one, since the latter is derived from the clock of the UART of the external device and is therefore seldom a standard one. */
+    for (size_t i=0; i<(sizeof(etx_ota_standard_baud_rates)/sizeof(etx_ota_standard_baud_rates[0])); i++)
+    {
+        if (etx_ota_standard_baud_rates[i] <= baud_rate_max)
+        {
+            baud_rate = etx_ota_standard_baud_rates[i];
+        }
+    }
+    if (baud_rate <= RS232_BAUDRATE)
+    {
+        LOG(INFO_t, "The Baud rate will be kept at %d, since the external device cannot go any faster.", RS232_BAUDRATE);
+        return ETX_OTA_EC_OK;
+    }
+
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Baud Rate Command. */
+    memcpy(&baud_cmd_data[1], &baud_rate, sizeof(baud_rate));
+    crc = crc32_mpeg2(baud_cmd_data, data_len);
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_SOF; // Populate SOF field.
+    offset_index += ETX_OTA_SOF_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_PACKET_TYPE_CMD; // Populate Packet Type field.
+    offset_index += ETX_OTA_PACKET_TYPE_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &data_len, ETX_OTA_DATA_LENGTH_SIZE); // Populate Data Length field.
+    offset_index += ETX_OTA_DATA_LENGTH_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], baud_cmd_data, data_len); // Populate Data field.
+    offset_index += data_len;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &crc, ETX_OTA_CRC32_SIZE); // Populate CRC field.
+    offset_index += ETX_OTA_CRC32_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_EOF; // Populate EOF field.
+    offset_index += ETX_OTA_EOF_SIZE;
+
+    /* Send the ETX OTA Command Type Packet containing the Baud Rate Command, whose ACK is still received at the current Baud rate. */
+    LOG(INFO_t, "Requesting the external device to switch to a Baud rate of %d...", baud_rate);
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, offset_index) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Baud Rate Command could not be send over the Serial Port.");
+        RS232_CloseComport(teuniz_rs232_lib_comport);
+        return ETX_OTA_EC_ERR;
+    }
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, 0, ETX_OTA_RESP_TIMEOUT))
+    {
+        LOG(ERROR_t, "The external device did not acknowledge the Baud Rate Command.");
+        RS232_CloseComport(teuniz_rs232_lib_comport);
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Reopen the Serial Port at the new Baud rate and confirm it with some ETX OTA Ping Commands, the first acknowledged of which makes the switch final. */
+    RS232_CloseComport(teuniz_rs232_lib_comport);
+    if (reopen_etx_ota_comport(teuniz_rs232_lib_comport, baud_rate, mode, ping_timeout) == ETX_OTA_EC_OK)
+    {
+        LOG(DONE_t, "The Baud rate has been switched to %d.", etx_ota_baud_rate);
+        return ETX_OTA_EC_OK;
+    }
+
+    /* Since the new Baud rate could not be confirmed, wait for the external device to fall back and then continue at the previous one. */
+    LOG(WARNING_t, "The Baud rate of %d could not be confirmed, so the ETX OTA Process will continue at %d.", baud_rate, RS232_BAUDRATE);
+    usleep((uint32_t) etx_ota_baud_confirm_timeout * 1000 + ETX_OTA_BAUD_FALLBACK_DELAY);
+    if (reopen_etx_ota_comport(teuniz_rs232_lib_comport, RS232_BAUDRATE, mode, ETX_OTA_RESP_TIMEOUT) == ETX_OTA_EC_OK)
+    {
+        return ETX_OTA_EC_OK;
+    }
+
+    /* The external device may have committed to the new Baud rate on a Ping Command whose ACKs all got lost, in which case it is still there. */
+    LOG(WARNING_t, "The external device is not responding at %d, so trying again at %d...", RS232_BAUDRATE, baud_rate);
+    if (reopen_etx_ota_comport(teuniz_rs232_lib_comport, baud_rate, mode, ETX_OTA_RESP_TIMEOUT) == ETX_OTA_EC_OK)
+    {
+        LOG(DONE_t, "The Baud rate has been switched to %d.", etx_ota_baud_rate);
+        return ETX_OTA_EC_OK;
+    }
+    LOG(ERROR_t, "The external device is responding neither at a Baud rate of %d nor of %d.", baud_rate, RS232_BAUDRATE);
+
+    return ETX_OTA_EC_ERR;
+}
+
+static ETX_OTA_Status reopen_etx_ota_comport(int teuniz_rs232_lib_comport, uint32_t baud_rate, char mode[], uint32_t ping_timeout)
+{
+    if (RS232_OpenComport(teuniz_rs232_lib_comport, baud_rate, mode, RS232_IS_FLOW_CONTROL))
+    {
+        LOG(WARNING_t, "The Serial Port could not be reopened at a Baud rate of %d.", baud_rate);
+        return ETX_OTA_EC_ERR;
+    }
+    for (uint8_t i=0; i<ETX_OTA_BAUD_CONFIRM_PINGS; i++)
+    {
+        if (send_etx_ota_ping(teuniz_rs232_lib_comport, ping_timeout) == ETX_OTA_EC_OK)
+        {
+            RS232_flushRX(teuniz_rs232_lib_comport); // Discard any late response to a Ping Command that timed out.
+            etx_ota_baud_rate = baud_rate;
+            return ETX_OTA_EC_OK;
+        }
+    }
+    RS232_CloseComport(teuniz_rs232_lib_comport);
+
+    return ETX_OTA_EC_ERR;
+}
+
+static ETX_OTA_Status send_etx_ota_header(int teuniz_rs232_lib_comport, header_data_t *etx_ota_header_info)
+{
+    /** <b>Local pointer etx_ota_start:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+    ETX_OTA_Header_Packet_t *etx_ota_header = (ETX_OTA_Header_Packet_t *) ETX_OTA_Packet_Buffer;
+
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Start Command. */
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    etx_ota_header->sof          = ETX_OTA_SOF;
+    etx_ota_header->packet_type  = ETX_OTA_PACKET_TYPE_HEADER;
+    etx_ota_header->data_len     = ETX_OTA_HEADER_DATA_T_SIZE;
+    memcpy(&etx_ota_header->meta_data, etx_ota_header_info, ETX_OTA_HEADER_DATA_T_SIZE);
+    etx_ota_header->crc          = crc32_mpeg2((uint8_t *) &(etx_ota_header->meta_data), ETX_OTA_HEADER_DATA_T_SIZE);
+    etx_ota_header->eof          = ETX_OTA_EOF;
+
+    /* Send the ETX OTA Header Type Packet. */
+    LOG(INFO_t, "Sending an ETX OTA Header Type Packet containing the general information of the Payload to be sent...");
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, ETX_OTA_HEADER_PACKET_T_SIZE) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Header Type Packet could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Validate receiving back an ACK Status Response from the MCU. */
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, 1, ETX_OTA_RESP_TIMEOUT))
+    {
+        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    LOG(DONE_t, "ETX OTA Header Type Packet has been sent successfully.");
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status send_etx_ota_data(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len, uint32_t *offset)
+{
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+    ETX_OTA_Status ret;
+    /** <b>Local variable resp_data:</b> Holds the bytes that the external device appended to its Response Status, if any. */
+    uint8_t resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];
+    /** <b>Local variable resp_data_len:</b> Number of bytes held in \c resp_data . */
+    uint16_t resp_data_len;
+    /** <b>Local variable acked_offset:</b> Offset of the Payload given in the ACKs to the ETX OTA Data v2 Type Packets. */
+    uint32_t acked_offset;
+    /** <b>Local variable is_resendable:</b> Flag used to indicate whether the ETX OTA Data Type Packet can be re-sent as soon as @ref etx_ota_rto expires with a \c true , or otherwise with a \c false . */
+    bool is_resendable = etx_ota_is_data_v2_supported && (*offset != 0);
+    /** <b>Local variable deadline:</b> Time, as given by @ref get_monotonic_time , after which the ETX OTA Data Type Packet will no longer be re-sent. */
+    uint64_t deadline = get_monotonic_time() + ETX_OTA_RESP_TIMEOUT;
+    /** <b>Local variable is_rtt_sampled:</b> Flag used to indicate whether the round-trip time of the ETX OTA Data Type Packet is to be sampled with a \c true , which stops being the case as soon as it turns out to be a re-sent one or as soon as a late ACK is received while waiting for its own, or otherwise with a \c false . */
+    bool is_rtt_sampled = (*offset >= etx_ota_sent_offset);
+    /** <b>Local variable sent_time:</b> Time, as given by @ref get_monotonic_time , at which the ETX OTA Data Type Packet was completely sent. */
+    uint64_t sent_time;
+
+    /* Send an ETX OTA Data Type Packet. */
+    ret = send_etx_ota_data_packet(teuniz_rs232_lib_comport, payload, data_len, *offset);
+    if (ret != ETX_OTA_EC_OK)
+    {
+        return ret;
+    }
+    sent_time = get_monotonic_time();
+    if ((*offset + data_len) > etx_ota_sent_offset)
+    {
+        etx_ota_sent_offset = *offset + data_len;
+    }
+
+    /* Validate receiving back an ACK Status Response from the MCU, where the round-trip time is sampled here only once the ACK to this very transmission has been received, and where the first ETX OTA Data Type Packet is not sampled since it also makes the MCU erase its Flash Memory. */
+    while (true)
+    {
+        ret = receive_etx_ota_resp(teuniz_rs232_lib_comport, (*offset == 0) ? 0 : 1, false, is_resendable ? 0 : ETX_OTA_RESP_TIMEOUT, resp_data, &resp_data_len);
+        if ((ret == ETX_OTA_EC_OK) && etx_ota_is_data_v2_supported)
+        {
+            if (resp_data_len != sizeof(acked_offset))
+            {
+                LOG(ERROR_t, "Expected an ACK carrying an offset from the external device, but received a plain ACK instead.");
+                return ETX_OTA_EC_ERR;
+            }
+            memcpy(&acked_offset, resp_data, sizeof(acked_offset));
+            if (acked_offset < (*offset + data_len))
+            {
+                LOG(WARNING_t, "Skipping a late ACK up to offset %d of the Payload.", acked_offset);
+                is_rtt_sampled = false;
+                continue;
+            }
+            if (acked_offset > (*offset + data_len))
+            {
+                LOG(ERROR_t, "The external device acknowledged an offset (%d) that is beyond the ETX OTA Data Type Packet sent (up to %d).", acked_offset, *offset + data_len);
+                return ETX_OTA_EC_ERR;
+            }
+        }
+        if (ret == ETX_OTA_EC_OK)
+        {
+            if (is_rtt_sampled && (*offset != 0))
+            {
+                etx_ota_update_rtt((uint32_t) (get_monotonic_time() - sent_time));
+            }
+            break;
+        }
+        if ((ret == ETX_OTA_EC_NR) && is_resendable && (get_monotonic_time() < deadline))
+        {
+            /* The ETX OTA Data Type Packet or its ACK got lost, so re-send it, which the MCU will just acknowledge again if it already got it. */
+            LOG(WARNING_t, "No response to the ETX OTA Data Type Packet at offset %d of the Payload. Re-sending it...", *offset);
+            update_etx_ota_frame_error_rate(true);
+            is_rtt_sampled = false;
+            ret = send_etx_ota_data_packet(teuniz_rs232_lib_comport, payload, data_len, *offset);
+            if (ret != ETX_OTA_EC_OK)
+            {
+                return ret;
+            }
+            continue;
+        }
+        if (ret != ETX_OTA_EC_ERR)
+        {
+            LOG(ERROR_t, "The external device did not respond to the ETX OTA Data Type Packet at offset %d of the Payload.", *offset);
+            return ETX_OTA_EC_ERR;
+        }
+        return get_etx_ota_nack_offset(resp_data, resp_data_len, *offset, *offset, offset);
+    }
+    *offset += data_len;
+    update_etx_ota_frame_error_rate(false);
+
+    LOG(DONE_t, "ETX OTA Data Type Packet has been sent successfully.");
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status send_etx_ota_data_packet(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len, uint32_t offset)
+{
+    /** <b>Local pointer etx_ota_data:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Data_Packet_t type. */
+    ETX_OTA_Data_Packet_t *etx_ota_data = (ETX_OTA_Data_Packet_t *) ETX_OTA_Packet_Buffer;
+
+    /** <b>Local variable header_len:</b> Number of bytes that come before the Payload Data in the "Data" field, which are the ones of its offset in ETX OTA Data v2 Type Packets. */
+    uint16_t header_len = etx_ota_is_data_v2_supported ? ETX_OTA_DATA_OFFSET_SIZE : 0;
+
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Data Type Packet carrying the requested Payload data. */
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    etx_ota_data->sof          = ETX_OTA_SOF;
+    etx_ota_data->packet_type  = etx_ota_is_data_v2_supported ? ETX_OTA_PACKET_TYPE_DATA_V2 : ETX_OTA_PACKET_TYPE_DATA;
+    etx_ota_data->data_len     = header_len + data_len;
+    memcpy(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], (uint8_t *) &offset, header_len); // Populate the offset of the Payload Data, if any.
+    memcpy(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX + header_len], payload, data_len); // Populate Payload Data field.
+    /** <b>Local variable offset_index:</b> Indicates the index value for a certain field contained in the current ETX OTA Data Type Packet. */
+    uint16_t offset_index = ETX_OTA_DATA_FIELD_INDEX + header_len + data_len;
+    /** <b>Local variable crc:</b> Holds the Calculated 32-bit CRC of the whole "Data" field. */
+    uint32_t crc = crc32_mpeg2(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], header_len + data_len);
+    if (etx_ota_is_fec_active)
+    {
+        /* Append the Reed-Solomon parity bytes of the "Data" field, with which the external device repairs the bytes that get corrupted on the way. */
+        rs_encoder_encode(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], header_len + data_len, &ETX_OTA_Packet_Buffer[offset_index]);
+        offset_index += rs_encoder_get_codeword_count(header_len + data_len) * RS_ENCODER_PARITY_SIZE;
+        etx_ota_data->packet_type |= ETX_OTA_PACKET_TYPE_FEC_FLAG;
+        etx_ota_data->data_len = offset_index - ETX_OTA_DATA_FIELD_INDEX;
+    }
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &crc, ETX_OTA_CRC32_SIZE); // Populate CRC field.
+    offset_index += ETX_OTA_CRC32_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_EOF; // Populate EOF field.
+    offset_index += ETX_OTA_EOF_SIZE;
+
+    /* Send an ETX OTA Data Type Packet. */
+    LOG(INFO_t, "Sending an ETX OTA Data Type Packet containing %d bytes of Payload Data (at offset %d)...", data_len, offset);
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, offset_index) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The current ETX OTA Data Type Packet could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status send_etx_ota_data_window(int teuniz_rs232_lib_comport, ETX_OTA_Payload_Source_t *payload, uint32_t *offset, uint32_t end)
+{
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
+    ETX_OTA_Status ret;
+    /** <b>Local variable burst_offset:</b> Offset of the Payload up to which the current burst has been sent. */
+    uint32_t burst_offset = *offset;
+    /** <b>Local variable size:</b> Length in bytes of the Payload Data of the ETX OTA Data Type Packet being sent. */
+    uint16_t size;
+    /** <b>Local variable resp_data:</b> Holds the bytes that the external device appended to its Response Status. */
+    uint8_t resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];
+    /** <b>Local variable resp_data_len:</b> Number of bytes held in \c resp_data . */
+    uint16_t resp_data_len;
+    /** <b>Local variable next_offset:</b> Offset of the next Payload byte that the external device expects to receive. */
+    uint32_t next_offset;
+    /** <b>Local variable frames:</b> Number of ETX OTA Data Type Packets that have been sent in the current burst. */
+    uint8_t frames;
+    /** <b>Local pointer data:</b> Points to the Payload Data of the ETX OTA Data Type Packet being sent. */
+    uint8_t *data;
+    /** <b>Local variable is_rtt_sampled:</b> Flag used to indicate whether the round-trip time of the burst is to be sampled with a \c true , or otherwise with a \c false whenever the burst re-sends any Payload Data that was already sent. */
+    bool is_rtt_sampled = (*offset >= etx_ota_sent_offset);
+
+    /* Send the ETX OTA Data Type Packets of the burst back-to-back, without waiting for any response in between them. */
+    LOG(INFO_t, "Sending a burst of up to %d ETX OTA Data Type Packets...", etx_ota_window_size);
+    for (frames=0; (frames<etx_ota_window_size) && (burst_offset<end); frames++)
+    {
+        size = ((end-burst_offset) >= etx_ota_frame_size) ? etx_ota_frame_size : (end-burst_offset);
+        data = get_payload_source_data(payload, burst_offset, size);
+        if (data == NULL)
+        {
+            LOG(ERROR_t, "Could not read the Payload Data from offset %d.", burst_offset);
+            return ETX_OTA_EC_ERR;
+        }
+        ret = send_etx_ota_data_packet(teuniz_rs232_lib_comport, data, size, burst_offset);
+        if (ret != ETX_OTA_EC_OK)
+        {
+            return ret;
+        }
+        burst_offset += size;
+    }
+    if (burst_offset > etx_ota_sent_offset)
+    {
+        etx_ota_sent_offset = burst_offset;
+    }
+
+    /* Wait for the cumulative ACK of the whole burst, which the external device sends either before or after programming all of its Packets depending on whether it acknowledges them early, in which case a failure to program them comes as a NACK with ETX_OTA_NACK_REASON_FLASH while waiting for the ACK of the next burst (the first burst is not sampled since it also makes the MCU erase its Flash Memory, and neither is any burst that re-sends Payload Data). */
+    if (receive_etx_ota_resp(teuniz_rs232_lib_comport, (*offset == 0) ? 0 : frames, is_rtt_sampled, ETX_OTA_WINDOW_ACK_TIMEOUT, resp_data, &resp_data_len) != ETX_OTA_EC_OK)
+    {
+        return get_etx_ota_nack_offset(resp_data, resp_data_len, *offset, burst_offset, offset);
+    }
+    if (resp_data_len != sizeof(next_offset))
+    {
+        LOG(ERROR_t, "Expected a cumulative ACK from the external device, but received a plain ACK instead.");
+        return ETX_OTA_EC_ERR;
+    }
+    memcpy(&next_offset, resp_data, sizeof(next_offset));
+    if ((next_offset < *offset) || (next_offset > burst_offset))
+    {
+        LOG(ERROR_t, "The external device acknowledged an offset (%d) that is out of the current burst (from %d up to %d).", next_offset, *offset, burst_offset);
+        return ETX_OTA_EC_ERR;
+    }
+    if (next_offset < burst_offset)
+    {
+        LOG(WARNING_t, "The external device has only received up to byte %d out of the %d bytes sent so far. Re-sending from there...", next_offset, burst_offset);
+    }
+    *offset = next_offset;
+    update_etx_ota_frame_error_rate(false);
+
+    LOG(DONE_t, "The current burst of ETX OTA Data Type Packets has been acknowledged.");
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status get_etx_ota_nack_offset(uint8_t *resp_data, uint16_t resp_data_len, uint32_t first_offset, uint32_t last_offset, uint32_t *p_offset)
+{
+    /** <b>Local variable nack_offset:</b> Offset of the Payload that the external device gave along with the reason of its NACK. */
+    uint32_t nack_offset;
+
+    if (!etx_ota_is_nack_reason_supported || (resp_data_len != ETX_OTA_NACK_DATA_SIZE))
+    {
+        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        return ETX_OTA_EC_ERR;
+    }
+    memcpy(&nack_offset, &resp_data[1], sizeof(nack_offset));
+    switch (resp_data[0])
+    {
+        case ETX_OTA_NACK_REASON_CRC:
+            LOG(WARNING_t, "The external device has received a corrupted ETX OTA Packet while expecting the Payload from offset %d.", nack_offset);
+            update_etx_ota_frame_error_rate(true);
+            break;
+        case ETX_OTA_NACK_REASON_LENGTH:
+            LOG(WARNING_t, "The external device has rejected the length of an ETX OTA Data Type Packet while expecting the Payload from offset %d.", nack_offset);
+            break;
+        case ETX_OTA_NACK_REASON_SEQUENCE:
+            LOG(WARNING_t, "The external device has received an out of sequence ETX OTA Packet while expecting the Payload from offset %d.", nack_offset);
+            break;
+        case ETX_OTA_NACK_REASON_FLASH:
+            LOG(ERROR_t, "The external device could not program its Flash Memory at offset %d of the Payload.", nack_offset);
+            return ETX_OTA_EC_ERR;
+        default:
+            LOG(ERROR_t, "The host machine has received a NACK with an unknown reason (%d) from the external device.", resp_data[0]);
+            return ETX_OTA_EC_ERR;
+    }
+    if ((nack_offset < first_offset) || (nack_offset > last_offset))
+    {
+        LOG(ERROR_t, "The external device has given an offset (%d) that is out of the ETX OTA Data Type Packets that it NACKed (from %d up to %d).", nack_offset, first_offset, last_offset);
+        return ETX_OTA_EC_ERR;
+    }
+    *p_offset = nack_offset;
+
+    LOG(INFO_t, "Re-sending the Payload from offset %d...", nack_offset);
+    return ETX_OTA_EC_OK;
+}
+
+static void update_etx_ota_frame_error_rate(bool is_corrupted)
+{
+    etx_ota_frame_error_rate -= etx_ota_frame_error_rate >> ETX_OTA_FEC_RATE_GAIN_LOG2;
+    if (is_corrupted)
+    {
+        etx_ota_frame_error_rate += 1000U >> ETX_OTA_FEC_RATE_GAIN_LOG2;
+    }
+
+    /* Start protecting the ETX OTA Data Type Packets with their Reed-Solomon parity bytes once they are getting corrupted too often. */
+    if ((ETX_OTA_FEC == 2) && etx_ota_is_fec_supported && !etx_ota_is_fec_active && (etx_ota_frame_error_rate >= ETX_OTA_FEC_ERROR_RATE))
+    {
+        etx_ota_is_fec_active = true;
+        LOG(WARNING_t, "The ETX OTA Data Type Packets are getting corrupted at a rate of %d per thousand, so their Reed-Solomon parity bytes will be sent from now on.", etx_ota_frame_error_rate);
+    }
+}
+
+static ETX_OTA_Status send_etx_ota_cmd_packet(int teuniz_rs232_lib_comport, uint8_t *cmd_data, uint16_t data_len)
+{
+    /** <b>Local variable offset_index:</b> Indicates the index value for a certain field contained in the current ETX OTA Command Type Packet. */
+    uint16_t offset_index = 0;
+    /** <b>Local variable crc:</b> Holds the Calculated 32-bit CRC of the "Data" field of the ETX OTA Command Type Packet to be sent. */
+    uint32_t crc = crc32_mpeg2(cmd_data, data_len);
+
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the given Command. */
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_SOF; // Populate SOF field.
+    offset_index += ETX_OTA_SOF_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_PACKET_TYPE_CMD; // Populate Packet Type field.
+    offset_index += ETX_OTA_PACKET_TYPE_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &data_len, ETX_OTA_DATA_LENGTH_SIZE); // Populate Data Length field.
+    offset_index += ETX_OTA_DATA_LENGTH_SIZE;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], cmd_data, data_len); // Populate Data field.
+    offset_index += data_len;
+    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &crc, ETX_OTA_CRC32_SIZE); // Populate CRC field.
+    offset_index += ETX_OTA_CRC32_SIZE;
+    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_EOF; // Populate EOF field.
+    offset_index += ETX_OTA_EOF_SIZE;
+
+    return send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, offset_index);
+}
+
+static ETX_OTA_Status get_etx_ota_page_crcs(int teuniz_rs232_lib_comport, uint16_t first_page, uint8_t page_count, uint32_t *p_crcs)
+{
+    /** <b>Local variable cmd_data:</b> "Data" field of the ETX OTA Command Type Packet to be sent, which holds the Page CRC Command followed by the index of the first requested page and by the number of requested pages. */
+    uint8_t cmd_data[1 + sizeof(first_page) + sizeof(page_count)];
+    /** <b>Local variable resp_data:</b> Holds the bytes that the external device appended to its Response Status. */
+    uint8_t resp_data[ETX_OTA_RESP_DATA_MAX_SIZE-1];
+    /** <b>Local variable resp_data_len:</b> Number of bytes held in \c resp_data . */
+    uint16_t resp_data_len;
+
+    /* Send the ETX OTA Command Type Packet containing the Page CRC Command. */
+    cmd_data[0] = ETX_OTA_CMD_PAGE_CRC;
+    memcpy(&cmd_data[1], &first_page, sizeof(first_page));
+    cmd_data[1 + sizeof(first_page)] = page_count;
+    LOG(INFO_t, "Requesting the 32-bit CRCs of %d Flash Memory pages starting from page %d...", page_count, first_page);
+    if (send_etx_ota_cmd_packet(teuniz_rs232_lib_comport, cmd_data, sizeof(cmd_data)) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Page CRC Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Validate receiving back an ACK Status Response carrying the requested 32-bit CRCs, which is not sampled since the MCU reads its Flash Memory before responding. */
+    if (!is_ack_resp_with_data_received(teuniz_rs232_lib_comport, 0, ETX_OTA_RESP_TIMEOUT, resp_data, &resp_data_len))
+    {
+        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        return ETX_OTA_EC_ERR;
+    }
+    if (resp_data_len != (page_count * sizeof(uint32_t)))
+    {
+        LOG(ERROR_t, "Expected %d 32-bit CRCs from the external device, but received %d bytes instead.", page_count, resp_data_len);
+        return ETX_OTA_EC_ERR;
+    }
+    memcpy(p_crcs, resp_data, resp_data_len);
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status find_etx_ota_changed_pages(int teuniz_rs232_lib_comport, ETX_OTA_Payload_Source_t *payload)
+{
+    /** <b>Local variable pages:</b> Number of Flash Memory pages covered by the Payload. */
+    uint32_t pages = (payload->size + etx_ota_page_size - 1) / etx_ota_page_size;
+    /** <b>Local variable page_crcs:</b> Holds the 32-bit CRCs of the Flash Memory pages reported by the external device in the latest ETX OTA Page CRC Command. */
+    uint32_t page_crcs[ETX_OTA_PAGE_CRC_MAX_COUNT];
+    /** <b>Local variable blank:</b> Holds the \c 0xFF bytes with which the Payload Data of the last Flash Memory page is padded. */
+    uint8_t blank[64];
+    /** <b>Local variable crc:</b> 32-bit CRC of the Flash Memory page being compared, padded with \c 0xFF bytes. */
+    uint32_t crc;
+    /** <b>Local variable pad:</b> Number of \c 0xFF bytes that are still to be added into \c crc . */
+    uint32_t pad;
+    /** <b>Local variable count:</b> Number of Flash Memory pages whose 32-bit CRCs are requested in the current ETX OTA Page CRC Command. */
+    uint8_t count;
+    /** <b>Local variable changed_pages:</b> Number of Flash Memory pages that were found to be changed. */
+    uint16_t changed_pages = 0;
+    /** <b>Local variable len:</b> Number of Payload bytes in the Flash Memory page being compared. */
+    uint32_t len;
+    /** <b>Local pointer data:</b> Points to the Payload Data of the Flash Memory page being compared. */
+    uint8_t *data;
+
+    if (pages > ETX_OTA_PAGES_MAX_COUNT)
+    {
+        return ETX_OTA_EC_ERR;
+    }
+    memset(blank, 0xFF, sizeof(blank));
+    for (uint16_t first=0; first<pages; first+=count)
+    {
+        count = ((pages-first) > ETX_OTA_PAGE_CRC_MAX_COUNT) ? ETX_OTA_PAGE_CRC_MAX_COUNT : (pages-first);
+        if (get_etx_ota_page_crcs(teuniz_rs232_lib_comport, first, count, page_crcs) != ETX_OTA_EC_OK)
+        {
+            return ETX_OTA_EC_ERR;
+        }
+        for (uint8_t i=0; i<count; i++)
+        {
+            len = payload->size - (uint32_t) (first+i) * etx_ota_page_size;
+            len = (len > etx_ota_page_size) ? etx_ota_page_size : len;
+            data = get_payload_source_data(payload, (uint32_t) (first+i) * etx_ota_page_size, (uint16_t) len);
+            if (data == NULL)
+            {
+                LOG(ERROR_t, "Could not read the Payload Data of the Flash Memory page %d.", first+i);
+                return ETX_OTA_EC_ERR;
+            }
+            crc = crc32_mpeg2(data, len);
+            pad = etx_ota_page_size - len;
+            while (pad > 0)
+            {
+                crc = crc32_mpeg2_update(crc, blank, (pad > sizeof(blank)) ? sizeof(blank) : pad);
+                pad -= (pad > sizeof(blank)) ? sizeof(blank) : pad;
+            }
+            Is_Page_Changed[first+i] = (crc != page_crcs[i]);
+            if (Is_Page_Changed[first+i])
+            {
+                changed_pages++;
+            }
+        }
+    }
+    LOG(INFO_t, "%d out of the %d Flash Memory pages covered by the Payload have changed.", changed_pages, pages);
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status send_etx_ota_seek(int teuniz_rs232_lib_comport, uint32_t offset, uint32_t run_len, bool is_erase)
+{
+    /** <b>Local variable cmd_data:</b> "Data" field of the ETX OTA Command Type Packet to be sent, which holds the Seek Command followed by the offset, by the run length and, only if the skipped pages are to be erased, by the flags byte. */
+    uint8_t cmd_data[1 + sizeof(offset) + sizeof(run_len) + 1];
+
+    /* Send the ETX OTA Command Type Packet containing the Seek Command. */
+    cmd_data[0] = ETX_OTA_CMD_SEEK;
+    memcpy(&cmd_data[1], &offset, sizeof(offset));
+    memcpy(&cmd_data[1 + sizeof(offset)], &run_len, sizeof(run_len));
+    cmd_data[1 + sizeof(offset) + sizeof(run_len)] = ETX_OTA_SEEK_FLAG_ERASE;
+    LOG(INFO_t, "Sending a Seek Command to continue from offset %d with a run of %d bytes%s...", offset, run_len, is_erase ? ", erasing the skipped pages" : "");
+    if (send_etx_ota_cmd_packet(teuniz_rs232_lib_comport, cmd_data, is_erase ? sizeof(cmd_data) : (sizeof(cmd_data) - 1)) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the Seek Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Validate receiving back an ACK Status Response, which is not sampled since the MCU reads back the skipped pages before responding. */
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, 0, ETX_OTA_RESP_TIMEOUT))
+    {
+        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status send_etx_ota_end(int teuniz_rs232_lib_comport)
+{
+    /** <b>Local pointer etx_ota_end:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
+    ETX_OTA_Command_Packet_t *etx_ota_end = (ETX_OTA_Command_Packet_t*)ETX_OTA_Packet_Buffer;
+
+    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Start Command. */
+    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
+    etx_ota_end->sof          = ETX_OTA_SOF;
+    etx_ota_end->packet_type  = ETX_OTA_PACKET_TYPE_CMD;
+    etx_ota_end->data_len     = 1;
+    etx_ota_end->cmd          = ETX_OTA_CMD_END;
+    etx_ota_end->crc          = crc32_mpeg2(&etx_ota_end->cmd, 1);
+    etx_ota_end->eof          = ETX_OTA_EOF;
+
+    /* Send the ETX OTA Command Type Packet containing the End Command. */
+    LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the End Command...");
+    if (send_etx_ota_packet_bytes(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer, ETX_OTA_CMD_PACKET_T_SIZE) != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "The ETX OTA Command Type Packet containing the End Command could not be send over the Serial Port.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    /* Validate receiving back an ACK Status Response from the MCU, which is not sampled since the MCU validates the whole Payload before responding. */
+    if (!is_ack_resp_received(teuniz_rs232_lib_comport, 0, ETX_OTA_RESP_TIMEOUT))
+    {
+        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        return ETX_OTA_EC_ERR;
+    }
+
+    LOG(DONE_t, "ETX OTA Command Type Packet containing the End Command was send successfully.");
+    return ETX_OTA_EC_OK;
+}
+
+static ETX_OTA_Status load_etx_ota_file(char file_path[], uint8_t **pp_data, uint32_t *p_size)
+{
+    /** <b>Local variable Fptr:</b> Stream of the File to be loaded. */
+    FILE *Fptr;
+    /** <b>Local variable size:</b> Length in bytes of the File to be loaded. */
+    long size;
+
+    if (fopen_s(&Fptr, file_path, "rb") != 0)
+    {
+        LOG(ERROR_t, "Could not open %s.", file_path);
+        return ETX_OTA_EC_ERR;
+    }
+    fseek(Fptr, 0L, SEEK_END);
+    size = ftell(Fptr);
+    fseek(Fptr, 0L, SEEK_SET);
+    *pp_data = malloc((size > 0) ? size : 1);
+    if ((size < 0) || (*pp_data == NULL) || (fread(*pp_data, 1, size, Fptr) != (size_t) size))
+    {
+        LOG(ERROR_t, "Could not read File %s.", file_path);
+        free(*pp_data);
+        *pp_data = NULL;
+        fclose(Fptr);
+        return ETX_OTA_EC_ERR;
+    }
+    fclose(Fptr);
+    *p_size = (uint32_t) size;
+
+    return ETX_OTA_EC_OK;
+}
+
+static void get_etx_ota_journal_path(char payload_path[], char journal_path[])
+{
+    snprintf(journal_path, PAYLOAD_MAX_FILE_PATH_LENGTH + sizeof(ETX_OTA_JOURNAL_EXTENSION), "%s%s", payload_path, ETX_OTA_JOURNAL_EXTENSION);
+}
+
+static ETX_OTA_Status read_etx_ota_journal(char payload_path[], ETX_OTA_Journal_t *p_journal)
+{
+    /** <b>Local variable journal_path:</b> File Path of the Transfer Journal. */
+    char journal_path[PAYLOAD_MAX_FILE_PATH_LENGTH + sizeof(ETX_OTA_JOURNAL_EXTENSION)];
+    /** <b>Local variable Fptr:</b> Stream of the Transfer Journal. */
+    FILE *Fptr;
+    /** <b>Local variable read_count:</b> Number of Transfer Journals that were read. */
+    size_t read_count;
+
+    get_etx_ota_journal_path(payload_path, journal_path);
+    if (fopen_s(&Fptr, journal_path, "rb") != 0)
+    {
+        return ETX_OTA_EC_ERR;
+    }
+    read_count = fread(p_journal, sizeof(ETX_OTA_Journal_t), 1, Fptr);
+    fclose(Fptr);
+
+    return (read_count == 1) ? ETX_OTA_EC_OK : ETX_OTA_EC_ERR;
+}
+
+static ETX_OTA_Status write_etx_ota_journal(char payload_path[], ETX_OTA_Journal_t *p_journal)
+{
+    /** <b>Local variable journal_path:</b> File Path of the Transfer Journal. */
+    char journal_path[PAYLOAD_MAX_FILE_PATH_LENGTH + sizeof(ETX_OTA_JOURNAL_EXTENSION)];
+    /** <b>Local variable Fptr:</b> Stream of the Transfer Journal. */
+    FILE *Fptr;
+    /** <b>Local variable write_count:</b> Number of Transfer Journals that were written. */
+    size_t write_count;
+
+    get_etx_ota_journal_path(payload_path, journal_path);
+    if (fopen_s(&Fptr, journal_path, "wb") != 0)
+    {
+        LOG(WARNING_t, "Could not open the Transfer Journal %s.", journal_path);
+        return ETX_OTA_EC_ERR;
+    }
+    write_count = fwrite(p_journal, sizeof(ETX_OTA_Journal_t), 1, Fptr);
+    if ((fclose(Fptr) != 0) || (write_count != 1))
+    {
+        LOG(WARNING_t, "Could not write the Transfer Journal %s.", journal_path);
+        return ETX_OTA_EC_ERR;
+    }
+
+    return ETX_OTA_EC_OK;
+}
 
-    /* Send the ETX OTA Header Type Packet. */
-    LOG(INFO_t, "Sending an ETX OTA Header Type Packet containing the general information of the Payload to be sent...");
-    for (uint8_t i = 0; i<ETX_OTA_HEADER_PACKET_T_SIZE; i++)
+static ETX_OTA_Status create_etx_ota_patch(ETX_OTA_Payload_Source_t *payload, char payload_path[], char base_image_path[])
+{
+    /** <b>Local pointer p_base:</b> Points to the loaded Application Firmware Image that is currently installed in the external device. */
+    uint8_t *p_base = NULL;
+    /** <b>Local variable base_size:</b> Length in bytes of the Application Firmware Image that is currently installed in the external device. */
+    uint32_t base_size = 0;
+    /** <b>Local pointer p_image:</b> Points to the new Application Firmware Image, which is either the memory-mapped Payload File or a loaded copy of it. */
+    uint8_t *p_image = payload->data;
+    /** <b>Local variable image_size:</b> Length in bytes of the new Application Firmware Image. */
+    uint32_t image_size = payload->size;
+    /** <b>Local pointer p_patch:</b> Points to the generated binary patch. */
+    uint8_t *p_patch = NULL;
+    /** <b>Local variable patch_size:</b> Length in bytes of the generated binary patch. */
+    uint32_t patch_size = 0;
+    /** <b>Local variable crc:</b> 32-bit CRC of the new Application Firmware Image. */
+    uint32_t crc = payload->crc;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsDiff_Status function type. */
+    BsDiff_Status ret;
+
+    /* Load the Application Firmware Images, unless the new one is already held in memory. */
+    LOG(INFO_t, "Generating the binary patch from the Base Image File %s...", base_image_path);
+    if (load_etx_ota_file(base_image_path, &p_base, &base_size) != ETX_OTA_EC_OK)
     {
-        usleep(SEND_PACKET_BYTES_DELAY);
-        if (RS232_SendByte(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer[i]))
-        {
-            LOG(ERROR_t, "A byte of the ETX OTA Header Type Packet could not be send over the Serial Port.");
-            return ETX_OTA_EC_ERR;
-        }
+        return ETX_OTA_EC_ERR;
+    }
+    if ((p_image == NULL) && (load_etx_ota_file(payload_path, &p_image, &image_size) != ETX_OTA_EC_OK))
+    {
+        free(p_base);
+        return ETX_OTA_EC_ERR;
     }
 
-    /* Validate receiving back an ACK Status Response from the MCU. */
-    if (!is_ack_resp_received(teuniz_rs232_lib_comport))
+    /* Generate the binary patch with the page size and backlog pages with which the external device will apply it. */
+    ret = bsdiff_create(p_base, base_size, p_image, image_size, etx_ota_page_size, etx_ota_patch_backlog_pages, &p_patch, &patch_size);
+    free(p_base);
+    if (p_image != payload->data)
     {
-        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        free(p_image);
+    }
+    if (ret != BSDIFF_EC_OK)
+    {
+        LOG(ERROR_t, "The binary patch could not be generated (Binary Patch Generator Exception code = %d).", ret);
         return ETX_OTA_EC_ERR;
     }
+    LOG(INFO_t, "Binary patch size = %d bytes (Application Firmware Image size = %d bytes).", patch_size, image_size);
+    if (patch_size >= image_size)
+    {
+        free(p_patch);
+        return ETX_OTA_EC_NA;
+    }
+
+    /* Replace the Application Firmware Image with the binary patch as the Payload to be sent. */
+    close_payload_source(payload);
+    payload->data = p_patch;
+    payload->size = patch_size;
+    payload->crc = crc;
+    payload->is_allocated = true;
+    LOG(DONE_t, "The binary patch was generated successfully.");
 
-    LOG(DONE_t, "ETX OTA Header Type Packet has been sent successfully.");
     return ETX_OTA_EC_OK;
 }
 
-static ETX_OTA_Status send_etx_ota_data(int teuniz_rs232_lib_comport, uint8_t *payload, uint16_t data_len)
+static uint32_t get_etx_ota_link_rate(uint16_t frame_size)
 {
-    /** <b>Local pointer etx_ota_data:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Data_Packet_t type. */
-    ETX_OTA_Data_Packet_t *etx_ota_data = (ETX_OTA_Data_Packet_t *) ETX_OTA_Packet_Buffer;
+    /** <b>Local variable link_rate:</b> Effective link rate in bytes per second with the external device. */
+    uint32_t link_rate = etx_ota_baud_rate / RS232_BITS_PER_BYTE;
 
-    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Data Type Packet carrying the requested Payload data. */
-    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
-    etx_ota_data->sof          = ETX_OTA_SOF;
-    etx_ota_data->packet_type  = ETX_OTA_PACKET_TYPE_DATA;
-    etx_ota_data->data_len     = data_len;
-    memcpy(&ETX_OTA_Packet_Buffer[ETX_OTA_DATA_FIELD_INDEX], payload, data_len); // Populate Payload Data field.
-    /** <b>Local variable offset_index:</b> Indicates the index value for a certain field contained in the current ETX OTA Data Type Packet. */
-    uint16_t offset_index = ETX_OTA_DATA_FIELD_INDEX + data_len;
-    /** <b>Local variable crc:</b> Holds the Calculated 32-bit CRC of the given Payload Data. */
-    uint32_t crc = crc32_mpeg2(payload, data_len);
-    memcpy(&ETX_OTA_Packet_Buffer[offset_index], (uint8_t *) &crc, ETX_OTA_CRC32_SIZE); // Populate CRC field.
-    offset_index += ETX_OTA_CRC32_SIZE;
-    ETX_OTA_Packet_Buffer[offset_index] = ETX_OTA_EOF; // Populate EOF field.
-    offset_index += ETX_OTA_EOF_SIZE;
+    /* Bound the link rate by how many windowed bursts of ETX OTA Data Type Packets get acknowledged per round-trip time. */
+    if ((etx_ota_srtt > 0) && (((uint64_t) frame_size * etx_ota_window_size * 1000000ULL / etx_ota_srtt) < link_rate))
+    {
+        link_rate = (uint32_t) ((uint64_t) frame_size * etx_ota_window_size * 1000000ULL / etx_ota_srtt);
+    }
 
-    /* Send an ETX OTA Data Type Packet. */
-    LOG(INFO_t, "Sending an ETX OTA Data Type Packet containing %d bytes of Payload Data...", data_len);
-    for (uint16_t i=0; i<offset_index; i++)
+    return (link_rate > 0) ? link_rate : 1;
+}
+
+static void negotiate_etx_ota_frame_size()
+{
+    /** <b>Local variable max_size:</b> Largest frame size that both the external device and the host can handle. */
+    uint32_t max_size;
+    /** <b>Local variable frame_size:</b> Frame size that is currently being considered. */
+    uint32_t frame_size;
+
+    /* Keep the frame size of the ETX OTA Protocol with the external devices that do not negotiate it. */
+    etx_ota_frame_size = ETX_OTA_DATA_MAX_SIZE;
+    if (etx_ota_max_frame_size == 0)
+    {
+        LOG(INFO_t, "The external device does not negotiate the frame size, so ETX OTA Data Type Packets of %d bytes will be sent.", etx_ota_frame_size);
+        return;
+    }
+    max_size = (etx_ota_max_frame_size < ETX_OTA_FRAME_SIZE_MAX) ? (etx_ota_max_frame_size & ~3U) : ETX_OTA_FRAME_SIZE_MAX;
+    /** <b>Local variable data_field_limit:</b> Largest "Data" field that both the external device and the host can handle. */
+    uint32_t data_field_limit = max_size;
+    /** <b>Local variable header_len:</b> Number of bytes that come before the Payload Data in the "Data" field, which are the ones of its offset in ETX OTA Data v2 Type Packets. */
+    uint32_t header_len = etx_ota_is_data_v2_supported ? ETX_OTA_DATA_OFFSET_SIZE : 0;
+    if (etx_ota_is_data_v2_supported)
     {
-        usleep(SEND_PACKET_BYTES_DELAY);
-        if (RS232_SendByte(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer[i]))
+        /* Leave room for the offset that comes before the Payload Data in the ETX OTA Data v2 Type Packets. */
+        max_size = (max_size - ETX_OTA_DATA_OFFSET_SIZE) & ~3U;
+    }
+    if (etx_ota_is_fec_supported)
+    {
+        /* Leave room for the Reed-Solomon parity bytes as well, since they may start being sent at any point of the ETX OTA Process. */
+        while ((max_size + header_len + rs_encoder_get_codeword_count(max_size + header_len)*RS_ENCODER_PARITY_SIZE) > data_field_limit)
         {
-            LOG(ERROR_t, "A byte of the current ETX OTA Data Type Packet could not be send over the Serial Port.");
-            return ETX_OTA_EC_ERR;
+            max_size -= 4;
         }
     }
 
-    /* Validate receiving back an ACK Status Response from the MCU. */
-    /*
-     NOTE:  For the cases where packs of 1024 bytes of payload data are send in this function, more delay time for the
-            "RS232_PollComport()" function will be required so that we can guarantee that our external device receives
-            the data and is able to respond back to our host machine within a time at which both programs (i.e., the
-            one for our host machine and the one for the external device) work as expected.
-            Therefore, the following additional line of code (i.e., "usleep(TEUNIZ_LIB_POLL_COMPORT_DELAY);") is used
-            to address this problem.
-     */
-    usleep(TEUNIZ_LIB_POLL_COMPORT_DELAY);
-    if (!is_ack_resp_received(teuniz_rs232_lib_comport))
+    /* Use the frame size requested by the user, if any, within the one that the external device can receive. */
+    if (ETX_OTA_FRAME_SIZE != 0)
     {
-        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
-        return ETX_OTA_EC_ERR;
+        etx_ota_frame_size = (ETX_OTA_FRAME_SIZE < max_size) ? ETX_OTA_FRAME_SIZE : max_size;
+        if (etx_ota_frame_size != ETX_OTA_FRAME_SIZE)
+        {
+            LOG(WARNING_t, "The requested frame size of %d bytes exceeds the one that can be used with the external device.", ETX_OTA_FRAME_SIZE);
+        }
+        LOG(INFO_t, "Negotiated frame size = %d bytes.", etx_ota_frame_size);
+        return;
     }
 
-    LOG(DONE_t, "ETX OTA Data Type Packet has been sent successfully.");
-    return ETX_OTA_EC_OK;
+    /* Otherwise, pick the largest power of 2 whose ETX OTA Data Type Packets stay within the target time at the effective link rate. */
+    for (frame_size=ETX_OTA_FRAME_SIZE_MIN; (frame_size*2) <= max_size; frame_size*=2);
+    while ((frame_size > ETX_OTA_FRAME_SIZE_MIN) && (((uint64_t) frame_size * 1000000ULL / get_etx_ota_link_rate(frame_size)) > ETX_OTA_FRAME_TARGET_TIME))
+    {
+        frame_size /= 2;
+    }
+    etx_ota_frame_size = (frame_size <= max_size) ? frame_size : max_size;
+    LOG(INFO_t, "Negotiated frame size = %d bytes for an effective link rate of %d bytes/s.", etx_ota_frame_size, get_etx_ota_link_rate(etx_ota_frame_size));
 }
 
-static ETX_OTA_Status send_etx_ota_end(int teuniz_rs232_lib_comport)
+static ETX_OTA_Status compress_etx_ota_payload(ETX_OTA_Payload_Source_t *payload, char payload_path[], uint32_t sent_size)
 {
-    /** <b>Local pointer etx_ota_end:</b> Points to the data of the latest ETX OTA Packet but in @ref ETX_OTA_Command_Packet_t type. */
-    ETX_OTA_Command_Packet_t *etx_ota_end = (ETX_OTA_Command_Packet_t*)ETX_OTA_Packet_Buffer;
-
-    /* Reset and then Populate the ETX OTA Packet Buffer with a ETX OTA Command Type Packet carrying the Start Command. */
-    memset(ETX_OTA_Packet_Buffer, 0, ETX_OTA_PACKET_MAX_SIZE);
-    etx_ota_end->sof          = ETX_OTA_SOF;
-    etx_ota_end->packet_type  = ETX_OTA_PACKET_TYPE_CMD;
-    etx_ota_end->data_len     = 1;
-    etx_ota_end->cmd          = ETX_OTA_CMD_END;
-    etx_ota_end->crc          = crc32_mpeg2(&etx_ota_end->cmd, 1);
-    etx_ota_end->eof          = ETX_OTA_EOF;
+    /** <b>Local pointer p_data:</b> Points to the Payload, which is either held by the Payload Source or a loaded copy of it. */
+    uint8_t *p_data = payload->data;
+    /** <b>Local variable data_size:</b> Length in bytes of the Payload. */
+    uint32_t data_size = payload->size;
+    /** <b>Local pointer p_lz4:</b> Points to the compressed Payload. */
+    uint8_t *p_lz4 = NULL;
+    /** <b>Local variable lz4_size:</b> Length in bytes of the compressed Payload, padded to a multiple of 4 bytes. */
+    uint32_t lz4_size = 0;
+    /** <b>Local variable crc:</b> 32-bit CRC of the decompressed Payload. */
+    uint32_t crc = payload->crc;
+    /** <b>Local variable link_rate:</b> Effective link rate in bytes per second with the external device. */
+    uint32_t link_rate = get_etx_ota_link_rate(etx_ota_frame_size);
+    /** <b>Local variable level:</b> Compression level chosen for the effective link rate. */
+    uint8_t level;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref Lz4Encoder_Status function type. */
+    Lz4Encoder_Status ret;
+
+    /* Choose the compression level from the effective link rate. */
+    if (link_rate >= ETX_OTA_LZ4_FAST_LINK_RATE)
+    {
+        level = LZ4_ENCODER_MIN_LEVEL;
+    }
+    else if (link_rate >= ETX_OTA_LZ4_MEDIUM_LINK_RATE)
+    {
+        level = (LZ4_ENCODER_MIN_LEVEL + LZ4_ENCODER_MAX_LEVEL) / 2;
+    }
+    else
+    {
+        level = LZ4_ENCODER_MAX_LEVEL;
+    }
+    LOG(INFO_t, "Compressing the Payload with level %d for an effective link rate of %d bytes/s...", level, link_rate);
 
-    /* Send the ETX OTA Command Type Packet containing the End Command. */
-    LOG(INFO_t, "Sending an ETX OTA Command Type Packet containing the End Command...");
-    for (uint8_t i=0; i<ETX_OTA_CMD_PACKET_T_SIZE; i++)
+    /* Load the Payload, unless it is already held in memory. */
+    if ((p_data == NULL) && (load_etx_ota_file(payload_path, &p_data, &data_size) != ETX_OTA_EC_OK))
     {
-        usleep(SEND_PACKET_BYTES_DELAY);
-        if (RS232_SendByte(teuniz_rs232_lib_comport, ETX_OTA_Packet_Buffer[i]))
-        {
-            LOG(ERROR_t, "A byte of the ETX OTA Command Type Packet containing the End Command START could not be send over the Serial Port.");
-            return ETX_OTA_EC_ERR;
-        }
+        return ETX_OTA_EC_ERR;
     }
 
-    /* Validate receiving back an ACK Status Response from the MCU. */
-    /*
-     NOTE:  Apparently, after the ETX OTA Data Type Packets, here it is also required more delay time so that the
-     "RS232_PollComport()" function works as expected.
-     */
-    usleep(TEUNIZ_LIB_POLL_COMPORT_DELAY);
-    if (!is_ack_resp_received(teuniz_rs232_lib_comport))
+    /* Compress the Payload with the window of decompressed bytes that the external device keeps in RAM. */
+    ret = lz4_encoder_compress(p_data, data_size, etx_ota_lz4_window_size, level, &p_lz4, &lz4_size);
+    if (p_data != payload->data)
     {
-        LOG(ERROR_t, "The host machine has received a NACK from the external device.");
+        free(p_data);
+    }
+    if (ret != LZ4_ENCODER_EC_OK)
+    {
+        LOG(ERROR_t, "The Payload could not be compressed (LZ4 Encoder Exception code = %d).", ret);
         return ETX_OTA_EC_ERR;
     }
+    LOG(INFO_t, "Compressed Payload size = %d bytes (bytes to be sent otherwise = %d bytes).", lz4_size, sent_size);
+    if (lz4_size >= sent_size)
+    {
+        free(p_lz4);
+        return ETX_OTA_EC_NA;
+    }
+
+    /* Replace the Payload with the compressed one as the Payload to be sent. */
+    close_payload_source(payload);
+    payload->data = p_lz4;
+    payload->size = lz4_size;
+    payload->crc = crc;
+    payload->is_allocated = true;
+    LOG(DONE_t, "The Payload was compressed successfully.");
 
-    LOG(DONE_t, "ETX OTA Command Type Packet containing the End Command was send successfully.");
     return ETX_OTA_EC_OK;
 }
 
-ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type)
+ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type, char base_image_path[])
 {
     /** <b>Local variable teuniz_rs232_lib_comport:</b> Should hold the converted value of the actual comport that was requested by the user but into its equivalent for the @ref teuniz_rs232_library (For more details, see the Table from @ref teuniz_rs232_library ). */
     int teuniz_rs232_lib_comport;
     /** <b>Local variable mode:</b> Used to hold the character values for defining the desired Databits, Parity, Stopbit and to enable/disable the Flow Control, in that orderly fashion, in order to use them for the RS232 Protocol configuration process. @note The additional last value of 0 is required by the @ref teuniz_rs232_library to mark the end of the array. */
     char mode[] = {RS232_MODE_DATA_BITS, RS232_MODE_PARITY, RS232_MODE_STOPBITS, 0};
-    /** <b>Local @ref FILE type pointer Fptr:</b> Used to point to a struct that contains all the information necessary to control a File I/O stream. */
-    FILE *Fptr = NULL;
+    /** <b>Local variable payload:</b> Payload Source from which the Payload size, its 32-bit CRC and its data are taken. */
+    ETX_OTA_Payload_Source_t payload;
     /** <b>Local variable payload_size:</b> Holds the size in bytes of the whole Payload. */
     uint32_t payload_size = 0;
     /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
@@ -864,111 +2859,97 @@ ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_P
         LOG(ERROR_t, "Can not open Requested Comport %d .", comport);
         return ETX_OTA_EC_ERR;
     }
+    etx_ota_baud_rate = RS232_BAUDRATE;
     LOG(DONE_t, "COM Port has been successfully opened.");
 
-    /* Open the File at the File Path that the user gave via \c payload_path in the case that a Firmware Image request to send to the MCU/MPU, and get the Payload size. */
-    switch (ETX_OTA_Payload_Type)
-    {
-        case ETX_OTA_Bootloader_Firmware_Image:
-        case ETX_OTA_Application_Firmware_Image:
-            /* Open the File at the File Path that the user gave via \c payload_path in the case that a Firmware Image request to send to the MCU/MPU. */
-            LOG(INFO_t, "Opening Payload File with File Path: %s...", payload_path);
-            /** <b>Local variable error_code:</b> Stores the return value of the @ref fopen_s function. */
-            errno_t error_code;
-            error_code = fopen_s(&Fptr, payload_path,"rb");
-            if (error_code != 0)
-            {
-                LOG(ERROR_t, "Could not open %s (errno code = %d)", payload_path, error_code);
-                return ETX_OTA_EC_ERR;
-            }
-            LOG(DONE_t, "Payload File was opened successfully.");
+    /* Start from the Flash Memory geometry of the host configuration, which is replaced by the one that the external device reports in its response to the ETX OTA Start Command, if any. */
+    etx_ota_page_size = FLASH_PAGE_SIZE_IN_BYTES;
+    etx_ota_bl_flash_addr = FLASH_BASE_ADDRESS;
+    etx_ota_bl_fw_size = ETX_OTA_BL_FW_SIZE;
+    etx_ota_app_flash_addr = FLASH_BASE_ADDRESS + ETX_OTA_BL_FW_SIZE;
+    etx_ota_app_fw_size = ETX_OTA_APP_FW_SIZE;
 
-            /* Get the Payload size. */
-            LOG(INFO_t, "Getting Payload File...");
-            fseek(Fptr, 0L, SEEK_END); // Set File position of the Stream at the end of the File.
-            payload_size = ftell(Fptr);
-            fseek(Fptr, 0L, SEEK_SET); // Reset File position of the Stream.
-            break;
-        case ETX_OTA_Custom_Data:
-            // Defining the size of the Custom Data that will be later generated in this function.
-            payload_size = CUSTOM_DATA_MAX_SIZE;
-            break;
-        default:
-            LOG(ERROR_t, "The Payload Type indicated by the user is not recognized by the current ETX OTA Protocol.");
-            return ETX_OTA_EC_NA;
+    /* Open the Payload that the user requested to send to the MCU/MPU, and get the Payload size. */
+    ret = open_payload_source(&payload, payload_path, ETX_OTA_Payload_Type);
+    if (ret != ETX_OTA_EC_OK)
+    {
+        goto etx_ota_process_cleanup;
     }
+    payload_size = payload.size;
+    /** <b>Local variable slot_address:</b> Flash Memory address of the slot at which the segments of the Firmware Image File, if any, have been placed. */
+    uint32_t slot_address = (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? etx_ota_bl_flash_addr : etx_ota_app_flash_addr;
 
-    /* Validate Payload size. */
+    /* Validate the Payload Type, whereas the size of the Firmware Images is validated once the Flash Memory geometry of the external device is known. */
     switch (ETX_OTA_Payload_Type)
     {
         case ETX_OTA_Bootloader_Firmware_Image:
             LOG(INFO_t, "The Payload Type indicated by the user is that of a Bootloader Firmware Update Image.");
-            if (payload_size > ETX_OTA_BL_FW_SIZE)
-            {
-                LOG(ERROR_t, "The given Firmware Update Image exceeds the maximum bytes designated to the Bootloader Firmware.");
-                return ETX_OTA_EC_NA;
-            }
             break;
         case ETX_OTA_Application_Firmware_Image:
             LOG(INFO_t, "The Payload Type indicated by the user is that of an Application Firmware Update Image.");
-            if (payload_size > ETX_OTA_APP_FW_SIZE)
-            {
-                LOG(ERROR_t, "The given Firmware Update Image exceeds the maximum bytes designated to the Application Firmware.");
-                return ETX_OTA_EC_NA;
-            }
             break;
         case ETX_OTA_Custom_Data:
             LOG(INFO_t, "The Payload Type indicated by the user is that of an ETX OTA Custom Data.");
             if (payload_size > CUSTOM_DATA_MAX_SIZE)
             {
                 LOG(ERROR_t, "The given ETX OTA Custom Data exceeds the maximum bytes allows by the application.");
-                return ETX_OTA_EC_NA;
+                ret = ETX_OTA_EC_NA;
+                goto etx_ota_process_cleanup;
             }
             break;
         default:
             LOG(ERROR_t, "The Payload Type indicated by the user is not recognized by the current ETX OTA Protocol.");
-            return ETX_OTA_EC_NA;
+            ret = ETX_OTA_EC_NA;
+            goto etx_ota_process_cleanup;
     }
     LOG(INFO_t, "Payload File size = %d bytes.", payload_size);
 
-    /* Read Payload file/data. */
-    switch (ETX_OTA_Payload_Type)
+    /* Read the Payload file/data once to calculate its 32-bit CRC. */
+    if (read_payload_source(&payload) != ETX_OTA_EC_OK)
     {
-        case ETX_OTA_Bootloader_Firmware_Image:
-        case ETX_OTA_Application_Firmware_Image:
-            // NOTE: The "fread()" function returns the total number of elements that were successfully read.
-            if (fread(PAYLOAD_CONTENT, 1, payload_size, Fptr) != payload_size)
-            {
-                LOG(ERROR_t, "Could not read File %s.", payload_path);
-                return ETX_OTA_EC_ERR;
-            }
-            LOG(DONE_t, "Payload File was read successfully.");
-            break;
-        case ETX_OTA_Custom_Data:
-            // Generating some Custom Data.
-            for (uint32_t i=0; i<CUSTOM_DATA_MAX_SIZE; i++)
-            {
-                PAYLOAD_CONTENT[i] = i;
-            }
-            break;
-        default:
-            LOG(ERROR_t, "The Payload Type indicated by the user is not recognized by the current ETX OTA Protocol.");
-            return ETX_OTA_EC_NA;
+        LOG(ERROR_t, "Could not read File %s.", payload_path);
+        ret = ETX_OTA_EC_ERR;
+        goto etx_ota_process_cleanup;
     }
-
-    /* Send ETX OTA Abort Command to stop any ongoing transaction before starting this new one. */
-    // NOTE:    Empirical measurements of an approximate of how much the following do-while loop can last is around 75
-    //          seconds, but probably a safe value would be 90 seconds.
-    if (payload_send_attempts == 0)
+    LOG(DONE_t, "Payload File was read successfully.");
+
+    /* Reset the round-trip time estimator, which will be seeded by the following ETX OTA Start and Ping Commands. */
+    etx_ota_reset_rtt();
+    etx_ota_is_ping_supported = false;
+    etx_ota_is_delta_supported = false;
+    etx_ota_is_sparse_supported = false;
+    etx_ota_patch_backlog_pages = 0;
+    etx_ota_lz4_window_size = 0;
+    etx_ota_max_frame_size = 0;
+    etx_ota_max_baud_rate = 0;
+    etx_ota_is_fec_supported = false;
+    etx_ota_is_fec_active = false;
+
+    /* Synchronize with the external device, which also stops any ongoing transaction there, before starting this new one. */
+    LOG(INFO_t, "Synchronizing with the external device...");
+    ret = sync_etx_ota(teuniz_rs232_lib_comport);
+    if (ret == ETX_OTA_EC_NA)
     {
-        LOG(INFO_t, "Aborting any ongoing ETX OTA current Process...");
-        LOG(INFO_t, "Sending Abort Command to external device...");
-        do
+        /* Send ETX OTA Abort Command to stop any ongoing transaction, since the external device does not support the ETX OTA Sync Command. */
+        // NOTE:    Empirical measurements of an approximate of how much the following do-while loop can last is around 75
+        //          seconds, but probably a safe value would be 90 seconds.
+        if (payload_send_attempts == 0)
         {
-            ret = send_etx_ota_abort(teuniz_rs232_lib_comport);
+            LOG(INFO_t, "Aborting any ongoing ETX OTA current Process...");
+            LOG(INFO_t, "Sending Abort Command to external device...");
+            do
+            {
+                ret = send_etx_ota_abort(teuniz_rs232_lib_comport);
+            }
+            while (ret != ETX_OTA_EC_OK);
+            LOG(DONE_t, "Abort Command has been successfully send to the external device.");
         }
-        while (ret != ETX_OTA_EC_OK);
-        LOG(DONE_t, "Abort Command has been successfully send to the external device.");
+    }
+    else if (ret != ETX_OTA_EC_OK)
+    {
+        LOG(ERROR_t, "Could not synchronize with the external device (ETX OTA Exception code = %d).", ret);
+        ret = ETX_OTA_EC_ERR;
+        goto etx_ota_process_cleanup;
     }
 
     /* Send OTA Start Command. */
@@ -979,110 +2960,403 @@ ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_P
     {
         if (payload_send_attempts++ == 0)
         {
+            /** <b>Local variable retry_delay:</b> Delay in microseconds before trying again, which is only needed with external devices that do not support the ETX OTA Sync Command since the others are synchronized with right away. */
+            uint32_t retry_delay = etx_ota_is_sync_supported ? 0 : TRY_AGAIN_SENDING_FWI_DELAY;
             if (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image)
             {
-                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Start Command Packet, then our host machine will try again to send the desired Bootloader Firmware Image once after %.2f seconds.\n", ((float)(TRY_AGAIN_SENDING_FWI_DELAY))/1000000.0);
+                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Start Command Packet, then our host machine will try again to send the desired Bootloader Firmware Image once after %.2f seconds.\n", ((float)(retry_delay))/1000000.0);
             }
             else
             {
-                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Start Command Packet, then our host machine will try again to send the desired Application Firmware Image once after %.2f seconds.\n", ((float)(TRY_AGAIN_SENDING_FWI_DELAY))/1000000.0);
-            }
-            if (Fptr)
-            {
-                fclose(Fptr);
+                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Start Command Packet, then our host machine will try again to send the desired Application Firmware Image once after %.2f seconds.\n", ((float)(retry_delay))/1000000.0);
             }
+            close_payload_source(&payload);
             RS232_CloseComport(teuniz_rs232_lib_comport);
-            usleep(TRY_AGAIN_SENDING_FWI_DELAY);
-            ret = start_etx_ota_process(comport, payload_path, ETX_OTA_Payload_Type);
+            usleep(retry_delay);
+            ret = start_etx_ota_process(comport, payload_path, ETX_OTA_Payload_Type, base_image_path);
             return ret;
         }
         LOG(ERROR_t, "Sending Start Command to MCU failed (ETX OTA Exception code = %d).", ret);
-        return ETX_OTA_EC_ERR;
+        ret = ETX_OTA_EC_ERR;
+        goto etx_ota_process_cleanup;
     }
     LOG(DONE_t, "Start Command has been successfully send to the external device.");
 
+    /* Place the segments of the Firmware Image File again whenever the external device has reported a Flash Memory slot other than the one at which they were placed, and then validate the Payload size against that slot. */
+    if (ETX_OTA_Payload_Type != ETX_OTA_Custom_Data)
+    {
+        /** <b>Local variable slot_size:</b> Length in bytes of the Flash Memory slot of the external device at which the Firmware Image is to be placed. */
+        uint32_t slot_size = (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? etx_ota_bl_fw_size : etx_ota_app_fw_size;
+        if (payload.is_allocated && (slot_address != ((ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? etx_ota_bl_flash_addr : etx_ota_app_flash_addr)))
+        {
+            close_payload_source(&payload);
+            if ((open_payload_source(&payload, payload_path, ETX_OTA_Payload_Type) != ETX_OTA_EC_OK) || (read_payload_source(&payload) != ETX_OTA_EC_OK))
+            {
+                LOG(ERROR_t, "The Firmware Image File could not be placed at the Flash Memory slot of the external device.");
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+            payload_size = payload.size;
+        }
+        if (payload_size > slot_size)
+        {
+            LOG(ERROR_t, "The given Firmware Update Image exceeds the %d bytes designated to the %s Firmware of the external device.", slot_size, (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image) ? "Bootloader" : "Application");
+            ret = ETX_OTA_EC_NA;
+            goto etx_ota_process_cleanup;
+        }
+        if (((payload_size + etx_ota_page_size - 1) / etx_ota_page_size) > ETX_OTA_PAGES_MAX_COUNT)
+        {
+            LOG(WARNING_t, "The given Firmware Update Image spans more than %d Flash Memory pages of the external device, so it will be sent whole.", ETX_OTA_PAGES_MAX_COUNT);
+            etx_ota_is_delta_supported = false;
+            etx_ota_is_sparse_supported = false;
+        }
+    }
+
+    /* Switch to a faster Baud rate whenever the external device allows it, which is not attempted again when retrying. */
+    if ((ETX_OTA_BAUD_RATE_UPGRADE > RS232_BAUDRATE) && (etx_ota_max_baud_rate != 0) && (payload_send_attempts == 0))
+    {
+        if (upgrade_etx_ota_baud_rate(teuniz_rs232_lib_comport, mode) != ETX_OTA_EC_OK)
+        {
+            /* The Serial Port has already been closed, so only the Payload Source is left to be released. */
+            LOG(ERROR_t, "The Baud rate could not be switched, nor kept, with the external device.");
+            close_payload_source(&payload);
+            return ETX_OTA_EC_ERR;
+        }
+    }
+
+    /* Seed the round-trip time estimator with some ETX OTA Ping Commands, if the external device supports them. */
+    if (etx_ota_is_ping_supported)
+    {
+        for (uint8_t i=0; i<ETX_OTA_RTT_PING_COUNT; i++)
+        {
+            send_etx_ota_ping(teuniz_rs232_lib_comport, 0);
+        }
+        RS232_flushRX(teuniz_rs232_lib_comport); // Discard any late response to a Ping Command that timed out.
+    }
+    LOG(INFO_t, "Round-trip time estimation: SRTT = %d us, RTTVAR = %d us, RTO = %d us.", etx_ota_srtt, etx_ota_rttvar, etx_ota_rto);
+
+    /* Choose the size of the ETX OTA Data Type Packets from the estimate of the link with the external device. */
+    negotiate_etx_ota_frame_size();
+
+    /* Resume the interrupted ETX OTA Transaction of this same Application Firmware Image whenever both the external device and the Transfer Journal of the host have kept track of it. */
+    /** <b>Local variable journal:</b> Transfer Journal of the Application Firmware Image, which describes that Firmware Image instead of the Payload that is actually sent (e.g., a binary patch). */
+    ETX_OTA_Journal_t journal = {payload.size, payload.crc, 0};
+    /** <b>Local variable is_journaled:</b> Flag used to indicate whether the Transfer Journal is kept for this ETX OTA Transaction with a \c true , or otherwise with a \c false . */
+    bool is_journaled = ETX_OTA_RESUME && (ETX_OTA_Payload_Type == ETX_OTA_Application_Firmware_Image);
+    /** <b>Local variable resume_offset:</b> Offset of the Application Firmware Image from which it is sent, which is \c 0 unless an interrupted ETX OTA Transaction is being resumed. */
+    uint32_t resume_offset = 0;
+    if (is_journaled && etx_ota_is_delta_supported && (etx_ota_checkpoint.offset > 0) && (etx_ota_checkpoint.size == payload.size) && (etx_ota_checkpoint.crc == payload.crc))
+    {
+        /** <b>Local variable last_journal:</b> Transfer Journal of the interrupted ETX OTA Transaction. */
+        ETX_OTA_Journal_t last_journal;
+        if ((read_etx_ota_journal(payload_path, &last_journal) == ETX_OTA_EC_OK) && (last_journal.size == payload.size) && (last_journal.crc == payload.crc))
+        {
+            resume_offset = etx_ota_checkpoint.offset;
+            LOG(INFO_t, "Resuming the interrupted ETX OTA Transaction from byte %d (the host had sent up to byte %d of its Payload).", resume_offset, last_journal.offset);
+        }
+        else
+        {
+            LOG(WARNING_t, "The external device has a checkpoint of this Application Firmware Image, but there is no Transfer Journal of it, so it will be sent from the start.");
+        }
+    }
+
+    /* Send the Application Firmware Image as a binary patch against the installed one whenever the user gave it, the external device supports it and the binary patch is smaller. */
+    /** <b>Local variable header_payload_type:</b> Payload Type with which the Payload is announced to the external device in the ETX OTA Header Type Packet. */
+    ETX_OTA_Payload_t header_payload_type = ETX_OTA_Payload_Type;
+    if ((base_image_path != NULL) && (ETX_OTA_Payload_Type == ETX_OTA_Application_Firmware_Image) && (resume_offset == 0))
+    {
+        if (etx_ota_patch_backlog_pages == 0)
+        {
+            LOG(WARNING_t, "The external device does not support binary patches, so the whole Application Firmware Image will be sent instead.");
+        }
+        else
+        {
+            ret = create_etx_ota_patch(&payload, payload_path, base_image_path);
+            if (ret == ETX_OTA_EC_OK)
+            {
+                header_payload_type = ETX_OTA_Application_Firmware_Patch;
+                payload_size = payload.size;
+            }
+            else if (ret == ETX_OTA_EC_NA)
+            {
+                LOG(WARNING_t, "The binary patch is not smaller than the Application Firmware Image, so the whole Application Firmware Image will be sent instead.");
+            }
+            else
+            {
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+        }
+    }
+
+    /* Find out which Flash Memory pages of the Firmware Image have changed, if the external device can tell, so that only those are sent. */
+    /** <b>Local variable is_delta:</b> Flag used to indicate whether only the changed Flash Memory pages of the Payload will be sent with a \c true , or otherwise the whole Payload with a \c false . */
+    bool is_delta = false;
+    if (resume_offset > 0)
+    {
+        /* Only the Flash Memory pages from the resume offset onwards are sent, since the external device has already verified the ones before it. */
+        for (uint32_t i=0; i<payload_size; i+=etx_ota_page_size)
+        {
+            Is_Page_Changed[i/etx_ota_page_size] = (i >= resume_offset);
+        }
+        is_delta = true;
+    }
+    else if (etx_ota_is_delta_supported && (header_payload_type != ETX_OTA_Custom_Data) && (header_payload_type != ETX_OTA_Application_Firmware_Patch))
+    {
+        is_delta = (find_etx_ota_changed_pages(teuniz_rs232_lib_comport, &payload) == ETX_OTA_EC_OK);
+        if (!is_delta)
+        {
+            LOG(ERROR_t, "The Flash Memory pages that have changed could not be found out.");
+            ret = ETX_OTA_EC_ERR;
+            goto etx_ota_process_cleanup;
+        }
+    }
+
+    /* Erase the blank Flash Memory pages of the Firmware Image that would otherwise be sent, instead of sending them, whenever the external device supports it. */
+    memset(Is_Page_Erased, 0, sizeof(Is_Page_Erased));
+    if (etx_ota_is_sparse_supported && (header_payload_type == ETX_OTA_Application_Firmware_Image))
+    {
+        /** <b>Local variable erased_pages:</b> Number of blank Flash Memory pages that will be erased instead of being sent. */
+        uint16_t erased_pages = 0;
+        for (uint32_t i=0; i<payload_size; i+=etx_ota_page_size)
+        {
+            /** <b>Local variable len:</b> Number of bytes of the Payload that are in the current Flash Memory page. */
+            uint16_t len = ((payload_size-i) > etx_ota_page_size) ? etx_ota_page_size : (payload_size-i);
+            /** <b>Local pointer page:</b> Points to the bytes of the Payload that are in the current Flash Memory page. */
+            uint8_t *page = get_payload_source_data(&payload, i, len);
+            if (page == NULL)
+            {
+                LOG(ERROR_t, "Could not read the Payload Data from offset %d.", i);
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+            if (is_delta && !Is_Page_Changed[i/etx_ota_page_size])
+            {
+                continue;
+            }
+            Is_Page_Erased[i/etx_ota_page_size] = image_parser_is_blank(page, len);
+            erased_pages += Is_Page_Erased[i/etx_ota_page_size];
+        }
+        if (erased_pages > 0)
+        {
+            for (uint32_t i=0; i<payload_size; i+=etx_ota_page_size)
+            {
+                Is_Page_Changed[i/etx_ota_page_size] = (is_delta ? Is_Page_Changed[i/etx_ota_page_size] : true) && !Is_Page_Erased[i/etx_ota_page_size];
+            }
+            is_delta = true;
+            LOG(INFO_t, "%d blank Flash Memory pages of the Firmware Image will be erased instead of being sent.", erased_pages);
+        }
+    }
+
+    /* Send the Payload compressed whenever the external device supports it and the compressed Payload is smaller than the bytes that would otherwise be sent, in which case the whole compressed Payload is sent. */
+    /** <b>Local variable decoded_size:</b> Size in bytes of the Payload once it has been decompressed by the external device, which is the one given in the ETX OTA Header Type Packet. */
+    uint32_t decoded_size = payload_size;
+    /** <b>Local variable is_compressed:</b> Flag used to indicate whether the Payload is sent compressed with a \c true , or otherwise with a \c false . */
+    bool is_compressed = false;
+    if ((etx_ota_lz4_window_size != 0) && (resume_offset == 0))
+    {
+        /** <b>Local variable sent_size:</b> Number of bytes of the Payload that would be sent if it was not compressed. */
+        uint32_t sent_size = payload_size;
+        if (is_delta)
+        {
+            sent_size = 0;
+            for (uint32_t i=0; i<payload_size; i+=etx_ota_page_size)
+            {
+                if (Is_Page_Changed[i/etx_ota_page_size])
+                {
+                    sent_size += ((payload_size-i) > etx_ota_page_size) ? etx_ota_page_size : (payload_size-i);
+                }
+            }
+        }
+        ret = compress_etx_ota_payload(&payload, payload_path, sent_size);
+        if (ret == ETX_OTA_EC_OK)
+        {
+            is_compressed = true;
+            is_delta = false;
+            memset(Is_Page_Erased, 0, sizeof(Is_Page_Erased));
+            payload_size = payload.size;
+        }
+        else if (ret == ETX_OTA_EC_NA)
+        {
+            LOG(WARNING_t, "The compressed Payload is not smaller than the bytes that would otherwise be sent, so it will be sent uncompressed instead.");
+        }
+        else
+        {
+            ret = ETX_OTA_EC_ERR;
+            goto etx_ota_process_cleanup;
+        }
+    }
+
     /* Send ETX OTA Header Type Packet. */
     /** <b>Local variable etx_ota_header_info:</b> Holds the general information of the Payload, which are its size, its 32-bit CRC and its payload type. */
     header_data_t etx_ota_header_info;
-    etx_ota_header_info.package_size = payload_size;
-    etx_ota_header_info.package_crc  = crc32_mpeg2(PAYLOAD_CONTENT, payload_size);
-    etx_ota_header_info.reserved1 = ETX_OTA_32BITS_RESET_VALUE;
-    etx_ota_header_info.reserved2 = ETX_OTA_16BITS_RESET_VALUE;
+    etx_ota_header_info.package_size = decoded_size;
+    etx_ota_header_info.package_crc  = payload.crc;
+    etx_ota_header_info.reserved1 = is_compressed ? payload_size : ETX_OTA_32BITS_RESET_VALUE;
+    etx_ota_header_info.reserved2 = (etx_ota_max_frame_size != 0) ? etx_ota_frame_size : ETX_OTA_16BITS_RESET_VALUE;
     etx_ota_header_info.reserved3 = ETX_OTA_8BITS_RESET_VALUE;
-    etx_ota_header_info.payload_type = ETX_OTA_Payload_Type;
+    etx_ota_header_info.payload_type = is_compressed ? (header_payload_type | ETX_OTA_PAYLOAD_COMPRESSED_FLAG) : header_payload_type;
     LOG(INFO_t, "Sending ETX OTA Header Type Packet...");
     ret = send_etx_ota_header(teuniz_rs232_lib_comport, &etx_ota_header_info);
     if (ret != ETX_OTA_EC_OK)
     {
         if (payload_send_attempts++ == 0)
         {
+            /** <b>Local variable retry_delay:</b> Delay in microseconds before trying again, which is only needed with external devices that do not support the ETX OTA Sync Command since the others are synchronized with right away. */
+            uint32_t retry_delay = etx_ota_is_sync_supported ? 0 : TRY_AGAIN_SENDING_FWI_DELAY;
             if (ETX_OTA_Payload_Type == ETX_OTA_Bootloader_Firmware_Image)
             {
-                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired Bootloader Firmware Image once after %.2f seconds.\n", ((float)(TRY_AGAIN_SENDING_FWI_DELAY))/1000000.0);
+                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired Bootloader Firmware Image once after %.2f seconds.\n", ((float)(retry_delay))/1000000.0);
             }
             else if (ETX_OTA_Payload_Type == ETX_OTA_Application_Firmware_Image)
             {
-                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired Application Firmware Image once after %.2f seconds.\n", ((float)(TRY_AGAIN_SENDING_FWI_DELAY))/1000000.0);
+                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired Application Firmware Image once after %.2f seconds.\n", ((float)(retry_delay))/1000000.0);
             }
             else
             {
-                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired ETX OTA Custom Data once after %.2f seconds.\n", ((float)(TRY_AGAIN_SENDING_FWI_DELAY))/1000000.0);
-            }
-            if (Fptr)
-            {
-                fclose(Fptr);
+                printf("Since a NACK Status Response was received after attempting to send an ETX OTA Header Type Packet, then our host machine will try again to send the desired ETX OTA Custom Data once after %.2f seconds.\n", ((float)(retry_delay))/1000000.0);
             }
+            close_payload_source(&payload);
             RS232_CloseComport(teuniz_rs232_lib_comport);
-            usleep(TRY_AGAIN_SENDING_FWI_DELAY);
-            ret = start_etx_ota_process(comport, payload_path, ETX_OTA_Payload_Type);
+            usleep(retry_delay);
+            ret = start_etx_ota_process(comport, payload_path, ETX_OTA_Payload_Type, base_image_path);
             return ret;
         }
         LOG(ERROR_t, "The ETX OTA Header Type Packet could not not be send (ETX OTA Exception code = %d).", ret);
-        return ETX_OTA_EC_ERR;
+        ret = ETX_OTA_EC_ERR;
+        goto etx_ota_process_cleanup;
     }
     LOG(DONE_t, "The ETX OTA Header Type Packet was send successfully.");
+    if (is_journaled)
+    {
+        journal.offset = resume_offset;
+        is_journaled = (write_etx_ota_journal(payload_path, &journal) == ETX_OTA_EC_OK);
+    }
 
     /* Sending Payload Data via one or more ETX OTA Data Type Packets correspondingly. */
+    /** <b>Local variable run_end:</b> Offset of the Payload at which the run that is currently being sent ends, which is the end of the whole Payload unless only its changed Flash Memory pages are being sent. */
+    uint32_t run_end = is_delta ? 0 : payload_size;
     /** <b>Local variable size:</b> Indicates the number of bytes from the Payload that have been send to the external device (i.e., the device that is desired to connect to via the \p comport param) via ETX OTA Data Type Packets. */
     uint16_t size = 0;
+    /** <b>Local variable data_retries:</b> Number of consecutive ETX OTA Data Type Packets, or windowed bursts of them, that have been responded to by the external device without any progress. */
+    uint8_t data_retries = 0;
+    /** <b>Local variable data_start_time:</b> Time in microseconds at which the host started to send the Payload Data, which is used to measure the throughput of the ETX OTA Data Type Packets. */
+    uint64_t data_start_time = get_monotonic_time();
     printf("Sending Payload Data via ETX OTA Protocol...\n");
     for (uint32_t i=0; i<payload_size; )
     {
-        LOG(INFO_t, "Sending an ETX OTA Data Type Packet...");
-        if ((payload_size-i) >= ETX_OTA_DATA_MAX_SIZE)
+        if (payload_size%etx_ota_frame_size == 0)
         {
-            size = ETX_OTA_DATA_MAX_SIZE;
+            printf("[%d/%d]\r\n", i/etx_ota_frame_size, payload_size/etx_ota_frame_size);
         }
         else
         {
-            size = payload_size - i;
+            printf("[%d/%d]\r\n", i/etx_ota_frame_size, payload_size/etx_ota_frame_size+1);
+        }
+        if (is_journaled && ((i - journal.offset) >= ETX_OTA_JOURNAL_INTERVAL))
+        {
+            journal.offset = i;
+            write_etx_ota_journal(payload_path, &journal);
         }
-        if (payload_size%ETX_OTA_DATA_MAX_SIZE == 0)
+        if (i >= run_end)
         {
-            printf("[%d/%d]\r\n", i/ETX_OTA_DATA_MAX_SIZE, payload_size/ETX_OTA_DATA_MAX_SIZE);
+            /* Skip the unchanged Flash Memory pages, or else the blank ones that are to be erased, and announce the next run of changed ones, which may be empty if the rest of the Payload is unchanged or if blank pages follow. */
+            /** <b>Local variable run_start:</b> Offset of the Payload at which the next run of changed Flash Memory pages starts. */
+            uint32_t run_start = i;
+            /** <b>Local variable is_erase:</b> Flag used to indicate whether the skipped Flash Memory pages are blank ones that are to be erased with a \c true , or otherwise unchanged ones with a \c false . */
+            bool is_erase = (i < payload_size) && Is_Page_Erased[i/etx_ota_page_size];
+            while ((run_start < payload_size) && !Is_Page_Changed[run_start/etx_ota_page_size] && (Is_Page_Erased[run_start/etx_ota_page_size] == is_erase))
+            {
+                run_start += etx_ota_page_size;
+            }
+            run_start = (run_start < payload_size) ? run_start : payload_size;
+            run_end = run_start;
+            while ((run_end < payload_size) && Is_Page_Changed[run_end/etx_ota_page_size])
+            {
+                run_end += etx_ota_page_size;
+            }
+            run_end = (run_end < payload_size) ? run_end : payload_size;
+            ret = send_etx_ota_seek(teuniz_rs232_lib_comport, run_start, run_end - run_start, is_erase);
+            if (ret != ETX_OTA_EC_OK)
+            {
+                LOG(ERROR_t, "The ETX OTA Seek Command could not not be send (ETX OTA Exception code = %d).", ret);
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+            i = run_start;
+            continue;
+        }
+        if (etx_ota_window_size > 1)
+        {
+            /** <b>Local variable burst_start:</b> Offset of the Payload from which the current windowed burst starts. */
+            uint32_t burst_start = i;
+            ret = send_etx_ota_data_window(teuniz_rs232_lib_comport, &payload, &i, run_end);
+            if (ret != ETX_OTA_EC_OK)
+            {
+                LOG(ERROR_t, "The current burst of ETX OTA Data Type Packets could not not be send (ETX OTA Exception code = %d).", ret);
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+            data_retries = (i == burst_start) ? (data_retries + 1) : 0;
+            if (data_retries > ETX_OTA_WINDOW_MAX_RETRIES)
+            {
+                LOG(ERROR_t, "The external device has not received any of the last %d bursts of ETX OTA Data Type Packets.", data_retries);
+                ret = ETX_OTA_EC_ERR;
+                goto etx_ota_process_cleanup;
+            }
+            continue;
+        }
+
+        LOG(INFO_t, "Sending an ETX OTA Data Type Packet...");
+        if ((run_end-i) >= etx_ota_frame_size)
+        {
+            size = etx_ota_frame_size;
         }
         else
         {
-            printf("[%d/%d]\r\n", i/ETX_OTA_DATA_MAX_SIZE, payload_size/ETX_OTA_DATA_MAX_SIZE+1);
+            size = run_end - i;
         }
-        ret = send_etx_ota_data(teuniz_rs232_lib_comport, &PAYLOAD_CONTENT[i], size);
+        /** <b>Local pointer data:</b> Points to the Payload Data of the ETX OTA Data Type Packet being sent. */
+        uint8_t *data = get_payload_source_data(&payload, i, size);
+        if (data == NULL)
+        {
+            LOG(ERROR_t, "Could not read the Payload Data from offset %d.", i);
+            ret = ETX_OTA_EC_ERR;
+            goto etx_ota_process_cleanup;
+        }
+        /** <b>Local variable frame_start:</b> Offset of the Payload from which the current ETX OTA Data Type Packet starts. */
+        uint32_t frame_start = i;
+        ret = send_etx_ota_data(teuniz_rs232_lib_comport, data, size, &i);
         if (ret != ETX_OTA_EC_OK)
         {
             LOG(ERROR_t, "The current ETX OTA Data Type Packet could not not be send (ETX OTA Exception code = %d).", ret);
-            return ETX_OTA_EC_ERR;
+            ret = ETX_OTA_EC_ERR;
+            goto etx_ota_process_cleanup;
+        }
+        data_retries = (i == frame_start) ? (data_retries + 1) : 0;
+        if (data_retries > ETX_OTA_DATA_MAX_RETRIES)
+        {
+            LOG(ERROR_t, "The external device has rejected the last %d ETX OTA Data Type Packets that were sent.", data_retries);
+            ret = ETX_OTA_EC_ERR;
+            goto etx_ota_process_cleanup;
+        }
+        if (data_retries == 0)
+        {
+            LOG(DONE_t, "The current ETX OTA Data Type Packet was send successfully.");
         }
-        LOG(DONE_t, "The current ETX OTA Data Type Packet was send successfully.");
-        i += size;
     }
-    if (payload_size%ETX_OTA_DATA_MAX_SIZE == 0)
+    if (payload_size%etx_ota_frame_size == 0)
     {
-        printf("[%d/%d]\r\n", payload_size/ETX_OTA_DATA_MAX_SIZE, payload_size/ETX_OTA_DATA_MAX_SIZE);
+        printf("[%d/%d]\r\n", payload_size/etx_ota_frame_size, payload_size/etx_ota_frame_size);
     }
     else
     {
-        printf("[%d/%d]\r\n", payload_size/ETX_OTA_DATA_MAX_SIZE+1, payload_size/ETX_OTA_DATA_MAX_SIZE+1);
+        printf("[%d/%d]\r\n", payload_size/etx_ota_frame_size+1, payload_size/etx_ota_frame_size+1);
     }
     LOG(DONE_t, "The Payload Data was send successfully.");
+    /** <b>Local variable data_time:</b> Time in microseconds that the host took to send the Payload Data. */
+    uint64_t data_time = get_monotonic_time() - data_start_time;
+    printf("Throughput = %u bytes/s with ETX OTA Data Type Packets of %u bytes (%u bytes in %u ms).\n", (unsigned int) ((uint64_t) payload_size * 1000000ULL / ((data_time > 0) ? data_time : 1)), (unsigned int) etx_ota_frame_size, (unsigned int) payload_size, (unsigned int) (data_time / 1000));
 
     /* Send OTA End Command. */
     LOG(INFO_t, "Sending End Command to external device...");
@@ -1090,18 +3364,25 @@ ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_P
     if (ret != ETX_OTA_EC_OK)
     {
         LOG(ERROR_t, "Sending End Command to the external device failed (ETX OTA Exception code = %d).", ret);
-        return ETX_OTA_EC_ERR;
+        ret = ETX_OTA_EC_ERR;
+        goto etx_ota_process_cleanup;
     }
-    LOG(DONE_t, "Start Command has been successfully send to the external device.");
-
-    if (Fptr)
+    LOG(DONE_t, "End Command has been successfully send to the external device.");
+    if (is_journaled)
     {
-        fclose(Fptr);
+        /** <b>Local variable journal_path:</b> File Path of the Transfer Journal, which is no longer needed. */
+        char journal_path[PAYLOAD_MAX_FILE_PATH_LENGTH + sizeof(ETX_OTA_JOURNAL_EXTENSION)];
+        get_etx_ota_journal_path(payload_path, journal_path);
+        remove(journal_path);
     }
-    RS232_CloseComport(teuniz_rs232_lib_comport);
-
     LOG(DONE_t, "ETX OTA Process has concluded successfully.");
-    return ETX_OTA_EC_OK;
+    ret = ETX_OTA_EC_OK;
+
+etx_ota_process_cleanup:
+    /* Release the Payload Source and the COM port on every exit of the ETX OTA Process. */
+    close_payload_source(&payload);
+    RS232_CloseComport(teuniz_rs232_lib_comport);
+    return ret;
 }
 
 /** @} */
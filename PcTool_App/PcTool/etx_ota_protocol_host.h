@@ -64,7 +64,7 @@
 #define ETX_OTA_SOF_SIZE			(1U)			/**< @brief	Designated SOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_PACKET_TYPE_SIZE	(1U)			/**< @brief	Designated Packet Type field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_DATA_LENGTH_SIZE	(2U)			/**< @brief	Designated Data Length field size in bytes in a ETX OTA Packet. */
-#define ETX_OTA_DATA_MAX_SIZE 		(1024U)  		/**< @brief Designated maximum expected "Data" field's size in the General Data Format of an ETX OTA Packet. @note This definition's value does not stand for the size of the entire ETX OTA Packet. Instead, it represents the size of the "Data" field that is inside the General Data Format of an ETX OTA Packet. */
+#define ETX_OTA_DATA_MAX_SIZE 		(1024U)  		/**< @brief Designated "Data" field's size in the General Data Format of the ETX OTA Data Type Packets that are sent to the external devices that do not negotiate it via the ETX OTA Start Command. @note This definition's value does not stand for the size of the entire ETX OTA Packet. Instead, it represents the size of the "Data" field that is inside the General Data Format of an ETX OTA Packet. @note The external devices that negotiate it can receive up to @ref ETX_OTA_FRAME_SIZE_MAX bytes instead. */
 #define ETX_OTA_CRC32_SIZE			(4U)			/**< @brief	Designated 32-bit CRC field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_EOF_SIZE			(1U)			/**< @brief	Designated EOF field size in bytes in a ETX OTA Packet. */
 #define ETX_OTA_32BITS_RESET_VALUE  (0xFFFFFFFF)    /**< @brief Designated value to represent a 32-bit value in reset mode on the Flash Memory of the external device (connected to it via @ref COMPORT_NUMBER ). */
@@ -99,7 +99,8 @@ typedef enum
     TERMINAL_WINDOW_EXECUTION_COMMAND   = 0U,   //!< Command Line Argument Index 0, which should contain the string of the literal terminal window command used by the user to execute the @ref etx_ota_protocol_host program.
     COMPORT_NUMBER                      = 1U,   //!< Command Line Argument Index 1, which should contain the Comport with which the user wants the @ref etx_ota_protocol_host program to establish a connection with via RS232 protocol.
     PAYLOAD_PATH                        = 2U,   //!< Command Line Argument Index 2, which should contain the File Path, with respect to the File Location of the executed compiled file of the @ref etx_ota_protocol_host program, to the Payload file that the user wants this program to load and send towards the desired external device that is chosen via the @ref COMPORT_NUMBER .
-    ETX_OTA_PAYLOAD_TYPE                = 3U    //!< Command Line Argument Index 3, which should contain the ETX OTA Payload Type to indicate to the @ref etx_ota_protocol_host program the type of Payload data that will be given. @note To see the available ETX OTA Payload Types, see @ref ETX_OTA_Payload_t .
+    ETX_OTA_PAYLOAD_TYPE                = 3U,   //!< Command Line Argument Index 3, which should contain the ETX OTA Payload Type to indicate to the @ref etx_ota_protocol_host program the type of Payload data that will be given. @note To see the available ETX OTA Payload Types, see @ref ETX_OTA_Payload_t .
+    BASE_IMAGE_PATH                     = 4U    //!< Optional Command Line Argument Index 4, which may contain the File Path towards the Application Firmware Image that is currently installed in the external device, in which case the @ref etx_ota_protocol_host program will send the Application Firmware Image given via @ref PAYLOAD_PATH as a binary patch against it (see @ref ETX_OTA_Application_Firmware_Patch ) whenever that is smaller and the external device supports it.
 } Command_Line_Arguments;
 
 /**@brief	Payload Type definitions available in the ETX OTA Protocol.
@@ -114,7 +115,8 @@ typedef enum
 {
     ETX_OTA_Application_Firmware_Image  = 0U,   	//!< ETX OTA Application Firmware Image Data Packet Type.
     ETX_OTA_Bootloader_Firmware_Image   = 1U,  		//!< ETX OTA Bootloader Firmware Image Data Packet Type.
-    ETX_OTA_Custom_Data                 = 2U   		//!< ETX OTA Custom Data Packet Type.
+    ETX_OTA_Custom_Data                 = 2U,   	//!< ETX OTA Custom Data Packet Type.
+    ETX_OTA_Application_Firmware_Patch  = 3U   		//!< ETX OTA Application Firmware Patch Data Packet Type. @details The Payload is a binary patch (see @ref bsdiff ) that rebuilds the Application Firmware Image from the one that is currently installed in the external device. @note This Payload Type is not meant to be given by the user, since the host chooses it by itself whenever an Application Firmware Image is given together with a @ref BASE_IMAGE_PATH .
 } ETX_OTA_Payload_t;
 
 /**@brief   Sends some desired ETX OTA Payload Data to a specified device by using the ETX OTA Protocol.
@@ -125,6 +127,9 @@ typedef enum
  *                              device (i.e., the device that is desired to connect to via the \p comport param) so that
  *                              it processes it correspondingly.
  * @param ETX_OTA_Payload_Type  The Payload Type.
+ * @param[in] base_image_path   File Path towards the Application Firmware Image that is currently installed in the
+ *                              external device, against which an Application Firmware Image is sent as a binary patch
+ *                              whenever possible, or \c NULL to always send the whole Payload.
  *
  * @retval  ETX_OTA_EC_OK
  * @retval 	ETX_OTA_EC_ERR
@@ -133,7 +138,7 @@ typedef enum
  * @author  César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 24, 2023.
  */
-ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type);
+ETX_OTA_Status start_etx_ota_process(int comport, char payload_path[], ETX_OTA_Payload_t ETX_OTA_Payload_Type, char base_image_path[]);
 
 #endif /* INC_ETX_OTA_PROTOCOL_HOST_H_ */
 
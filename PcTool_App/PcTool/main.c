@@ -42,6 +42,7 @@
  *              <li>Command Line Argument index 1 = @ref COMPORT_NUMBER </li>
  *              <li>Command Line Argument index 2 = @ref PAYLOAD_PATH </li>
  *              <li>Command Line Argument index 3 = @ref ETX_OTA_Payload_t </li>
+ *              <li>Command Line Argument index 4 (optional) = @ref BASE_IMAGE_PATH </li>
  *          </ul>
  * @note    Although this @ref main function requires the user to always populate a value for the Command Line Argument
  *          2, its value will only be used by this program whenever the value of the Command Line Argument index 3 is
@@ -63,6 +64,8 @@ int main(int argc, char *argv[])
     int comport;
     /** <b>Local variable firmware_image_path:</b> File Path towards the Firmware Update Image that the user requested to load and send to the desired MCU for it to install that Image to itself. */
     char firmware_image_path[PAYLOAD_MAX_FILE_PATH_LENGTH];
+    /** <b>Local variable base_image_path:</b> File Path towards the Application Firmware Image that is currently installed in the desired MCU, which is only populated if the user gave the optional @ref BASE_IMAGE_PATH Command Line Argument. */
+    char base_image_path[PAYLOAD_MAX_FILE_PATH_LENGTH];
     /** <b>Local variable ETX_OTA_Payload_Type:</b> Used to hold the Payload Type that is to be given by the user. */
     ETX_OTA_Payload_t ETX_OTA_Payload_Type;
     /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref ETX_OTA_Status function type. */
@@ -70,10 +73,10 @@ int main(int argc, char *argv[])
 
     /* Validate the Command Line Arguments given by the user. */
     printf("Getting Command Line Arguments given by the user...\n");
-    if (argc != 4)
+    if ((argc != 4) && (argc != 5))
     {
-        printf("ERROR: Expected 4 Command Line Argument definitions, but received %d instead.\n", argc);
-        printf("Please feed the Terminal Window Execution Command, the COM PORT number, the Application Image and the ETX_OTA_Payload_t in that order...!!!\n");
+        printf("ERROR: Expected 4 or 5 Command Line Argument definitions, but received %d instead.\n", argc);
+        printf("Please feed the Terminal Window Execution Command, the COM PORT number, the Application Image, the ETX_OTA_Payload_t and optionally the currently installed Application Image in that order...!!!\n");
         printf("Example: .\\etx_ota_app.exe 8 ..\\..\\Application\\Debug\\Blinky.bin 0");
         return ETX_OTA_EC_ERR;
     }
@@ -87,11 +90,17 @@ int main(int argc, char *argv[])
 
     /* Get the Payload Type of the Data that is going to be requested to our host machine to send to the desired MCU. */
     ETX_OTA_Payload_Type = atoi(argv[ETX_OTA_PAYLOAD_TYPE]);
+
+    /* Get the File Path towards the currently installed Application Firmware Image, if the user gave it. */
+    if (argc == 5)
+    {
+        strcpy_s(base_image_path, PAYLOAD_MAX_FILE_PATH_LENGTH, argv[BASE_IMAGE_PATH]);
+    }
     printf("Command Line Arguments have been successfully obtained.\n");
 
     /* Start ETX OTA Process to send the requested Payload to the specified external device by the user. */
     printf("Starting the ETX OTA Process with the requested Payload and the specified external device by the user...\n");
-    ret = start_etx_ota_process(comport, firmware_image_path, ETX_OTA_Payload_Type);
+    ret = start_etx_ota_process(comport, firmware_image_path, ETX_OTA_Payload_Type, (argc == 5) ? base_image_path : NULL);
     if (ret != ETX_OTA_EC_OK)
     {
         printf("ERROR: The ETX OTA Process has failed (ETX OTA Exception Code = %d).\n", ret);
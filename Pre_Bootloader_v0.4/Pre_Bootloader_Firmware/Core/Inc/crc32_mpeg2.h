@@ -4,7 +4,15 @@
  * @defgroup crc32_mpeg2 CRC32/MPEG-2 Algorithm module
  * @{
  *
- * @brief	This module provides the function required to calculate the CRC32/MPEG-2 Algorithm on one or more bytes.
+ * @brief	This module provides the functions required to calculate the CRC32/MPEG-2 Algorithm on one or more bytes.
+ *
+ * @details	Whenever @ref CRC32_MPEG2_HW_ACCELERATION is enabled, the word-aligned bulk of the data is fed into the CRC
+ *          peripheral of the STM32F1 MCUs, which calculates this exact same 32-bit CRC one word at a time, while any
+ *          unaligned leading and trailing bytes are processed via the Lookup Table in software. Otherwise, all of the
+ *          data is processed in software, which allows using this module in host builds as well.
+ *
+ * @note	The CRC peripheral is reset each time it is used by this module, so it must not be used by anything else at
+ *          the same time (e.g., from an interrupt).
  *
  * @author 	EmbeTronicX (<a href=https://github.com/Embetronicx/STM32-Bootloader/tree/ETX_Bootloader_3.0>STM32-Bootloader GitHub Repository under ETX_Bootloader_3.0 branch</a>)
  * @author	César Miranda Meza
@@ -15,6 +23,16 @@
 #ifndef CRC32_MPEG2_H_
 #define CRC32_MPEG2_H_
 
+#ifndef CRC32_MPEG2_HW_ACCELERATION
+#ifdef USE_HAL_DRIVER
+#define CRC32_MPEG2_HW_ACCELERATION		(1)				/**< @brief Flag used to enable the use of the CRC peripheral of our MCU/MPU to calculate the 32-bit CRCs with a \c 1 , or otherwise to calculate them only in software with a \c 0 . @details By default, this is enabled only whenever this module is compiled together with the STM32 HAL Drivers. */
+#else
+#define CRC32_MPEG2_HW_ACCELERATION		(0)				/**< @brief Flag used to enable the use of the CRC peripheral of our MCU/MPU to calculate the 32-bit CRCs with a \c 1 , or otherwise to calculate them only in software with a \c 0 . @details By default, this is enabled only whenever this module is compiled together with the STM32 HAL Drivers. */
+#endif
+#endif
+
+#define CRC32_MPEG2_INIT_VALUE			(0xFFFFFFFF)	/**< @brief Initial value of the 32-bit CRC (MPEG-2), which is the one that @ref crc32_mpeg2_update has to be given in order to start calculating the 32-bit CRC of some data. @note Since this 32-bit CRC has no final XOR, the value returned by @ref crc32_mpeg2_update is already the final 32-bit CRC of all the data given to it so far. */
+
 /**@brief   Calculates the 32-bit CRC of a given data.
  *
  * @note	If the length in bytes of the data from which it is being requested to calculate the 32-bit CRC is either
@@ -33,6 +51,22 @@
  */
 uint32_t crc32_mpeg2(uint8_t *p_data, uint32_t data_length);
 
+/**@brief   Continues the calculation of a 32-bit CRC over some more data.
+ *
+ * @details This allows calculating the 32-bit CRC of some data incrementally (e.g., as its chunks are received),
+ *          where starting with @ref CRC32_MPEG2_INIT_VALUE and then giving each chunk together with the checksum
+ *          returned for the previous one will give the same result as if @ref crc32_mpeg2 had been applied to all of
+ *          the data.
+ *
+ * @param checksum		The 32-bit CRC of all the bytes that preceded the ones at \p p_data , or
+ *                      @ref CRC32_MPEG2_INIT_VALUE if there are none.
+ * @param[in] p_data    Pointer to the data with which it is desired to continue calculating the 32-bit CRC.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The calculated 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+uint32_t crc32_mpeg2_update(uint32_t checksum, uint8_t *p_data, uint32_t data_length);
+
 #endif /* CRC32_MPEG2_H_ */
 
 /** @} */
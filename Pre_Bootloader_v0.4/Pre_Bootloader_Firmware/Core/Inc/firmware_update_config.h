@@ -102,6 +102,7 @@
 #include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
 
 #define DATA_BLOCK_8BIT_ERASED_VALUE	(0xFF)			/**< @brief Designated value to indicate that a certain 8-bit field value of the @ref firmware_update_config_data_t structure has either been erased or that there is no data in it. */
+#define DATA_BLOCK_16BIT_ERASED_VALUE	(0xFFFF)		/**< @brief Designated value to indicate that a certain 16-bit field value of the @ref firmware_update_config_data_t structure has either been erased or that there is no data in it. */
 #define DATA_BLOCK_32BIT_ERASED_VALUE	(0xFFFFFFFF)	/**< @brief Designated value to indicate that a certain 32-bit field value of the @ref firmware_update_config_data_t structure has either been erased or that there is no data in it. */
 
 /*!@brief	Firmware Update Configurations Exception Codes.
@@ -156,8 +157,8 @@ typedef struct __attribute__ ((__packed__))
     uint32_t BL_fw_rec_crc;               //!< Recorded CRC of the Bootloader Firmware Image currently being run by our MCU/MPU.
     uint32_t App_fw_size;                 //!< Size in bytes of the Application Firmware Image currently being run by our MCU/MPU.
     uint32_t App_fw_rec_crc;              //!< Recorded CRC of the Application Firmware Image currently being run by our MCU/MPU.
-    uint32_t reserved1;                   //!< 32-bits reserved for future possible uses for the Firmware Update Configurations sub-module.
-    uint16_t reserved2;                   //!< 16-bits reserved for future possible uses for the Firmware Update Configurations sub-module.
+    uint32_t App_fw_resume_crc;           //!< 32-bit CRC of the first @ref firmware_update_config_data_t::App_fw_resume_pages Flash Memory pages of the Firmware Image that is being received into the Flash Memory designated for the Application Firmware Image, as they were when the latest checkpoint of its ETX OTA Transaction was made.
+    uint16_t App_fw_resume_pages;         //!< Number of Flash Memory pages, counted from the start of the Flash Memory designated for the Application Firmware Image, that had already been written with the Firmware Image given by the \c App_fw_size and \c App_fw_rec_crc fields when the latest checkpoint of its ETX OTA Transaction was made, or @ref DATA_BLOCK_16BIT_ERASED_VALUE if there is no such checkpoint. @details This allows the Bootloader Firmware to resume an interrupted ETX OTA Transaction of that same Firmware Image from that checkpoint.
     uint8_t is_bl_fw_stored_in_app_fw;    //!< Flag that indicates whether our MCU/MPU has a Bootloader Firmware Image stored in the Flash Memory designated for its Application Firmware Image or not. @note For more details on the available values/states of this field, see @ref IsBlFwStoredInAppFw_Status .
     uint8_t is_bl_fw_install_pending;     //!< Flag that indicates whether our MCU/MPU is still pending to install the Bootloader Firmware Image that it has temporarily stored in the Flash Memory designated for the Application Firmware Image or not. @note For more details on the available values/states of this field, see @ref IsBlFwPending_Status .
 } firmware_update_config_data_t;
@@ -220,7 +221,8 @@ FirmUpdConf_Status  firmware_update_configurations_read(firmware_update_config_d
  * @param[in] p_data	Pointer to the desired data that we want to write into the designated Flash Memory pages of the
  * 						@ref firmware_update_config .
  *
- * @note	The reserved bits, of the data that the \p param points to, will be set to 1 after calling this function.
+ * @note	The reserved bits, of the data that the \p param points to, will be set to 1 after calling this function, and so
+ * 			will the checkpoint of any interrupted ETX OTA Transaction, since only the Bootloader Firmware can resume them.
  *
  * @retval				FIRM_UPDT_CONF_EC_OK
  * @retval				FIRM_UPDT_CONF_EC_NR
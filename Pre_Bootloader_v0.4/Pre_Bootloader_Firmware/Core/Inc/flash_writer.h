@@ -0,0 +1,198 @@
+/** @file
+ * @brief	Flash Writer header file
+ *
+ * @defgroup flash_writer Flash Writer module
+ * @{
+ *
+ * @brief	This module provides the functions required to erase and program the Flash Memory of our MCU/MPU directly
+ *          through the registers of its Flash Program and Erase Controller (FPEC).
+ *
+ * @details	Unlike the HAL Flash functions, which unlock, wait and lock the Flash Memory around every single word, this
+ *          module lets its user unlock the Flash Memory once via @ref flash_writer_begin , then program any number of
+ *          bytes by writing them directly into the Flash Memory one half-word at a time (which is the native
+ *          programming width of the STM32F1 MCUs) and finally lock it back via @ref flash_writer_end . In addition:
+ *          - Half-words that are meant to be left as \c 0xFFFF in a Flash Memory location that is already erased are
+ *            not programmed at all.
+ *          - Each programmed half-word is read back and compared against the requested value.
+ * @details	Whenever @ref FLASH_WRITER_SIMULATED is enabled, the FPEC is replaced by a simulated Flash Memory held in
+ *          RAM that behaves just like the real one, which allows using this module in host builds as well:
+ *          - Programming a non-erased half-word to anything but \c 0x0000 sets the \c PGERR flag of the simulated
+ *            FPEC and leaves the half-word untouched, and erasing a page sets all its bytes to \c 0xFF .
+ *          - Each program and page erase operation keeps the simulated FPEC busy for
+ *            @ref FLASH_WRITER_SIM_PROGRAM_TIME and @ref FLASH_WRITER_SIM_ERASE_TIME respectively, which is counted
+ *            in a simulated time (see @ref flash_writer_sim_time ) that host tests can use to order their events.
+ *          - Faults can be injected into a page via @ref flash_writer_sim_inject_fault , which make the simulated
+ *            FPEC flag \c PGERR or \c WRPRTERR , stay busy or silently leave the half-words unprogrammed.
+ *          - The simulated Flash Memory is held in a static array, unless \c FLASH_WRITER_SIM_MEMORY is defined with
+ *            the host address of the @ref FLASH_WRITER_SIM_SIZE bytes that are to hold it. Host tests of modules that
+ *            read the Flash Memory through pointers define it as @ref FLASH_WRITER_SIM_BASE_ADDR after mapping host
+ *            memory at that very address, so that those pointers read the simulated Flash Memory.
+ *          The flags of the simulated FPEC are then mapped into the @ref FlashWriter_Status by the very same code
+ *          that maps the ones of the real FPEC.
+ *
+ * @note	The values of @ref FlashWriter_Status match the ones of @ref HAL_StatusTypeDef , so that the Status
+ *          returned by the functions of this module can be given to the \c HAL_ret_handler() functions of the ETX OTA
+ *          Protocol as if they had been returned by the HAL Flash functions.
+ */
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+
+#ifndef FLASH_WRITER_H_
+#define FLASH_WRITER_H_
+
+#ifndef FLASH_WRITER_SIMULATED
+#ifdef USE_HAL_DRIVER
+#define FLASH_WRITER_SIMULATED				(0)				/**< @brief Flag used to make this module work with a simulated Flash Memory held in RAM with a \c 1 , or otherwise with the real Flash Memory of our MCU/MPU with a \c 0 . @details By default, the simulated Flash Memory is used only whenever this module is compiled without the STM32 HAL Drivers. */
+#else
+#define FLASH_WRITER_SIMULATED				(1)				/**< @brief Flag used to make this module work with a simulated Flash Memory held in RAM with a \c 1 , or otherwise with the real Flash Memory of our MCU/MPU with a \c 0 . @details By default, the simulated Flash Memory is used only whenever this module is compiled without the STM32 HAL Drivers. */
+#endif
+#endif
+
+#ifndef FLASH_WRITER_TIMEOUT
+#define FLASH_WRITER_TIMEOUT				(100U)			/**< @brief Maximum time in milliseconds that a single program or page erase operation of the FPEC is waited for before giving up on it. @note A page erase of the STM32F1 MCUs takes up to 40ms, and programming a half-word up to 70us. */
+#endif
+
+#if FLASH_WRITER_SIMULATED
+#ifndef FLASH_WRITER_SIM_BASE_ADDR
+#define FLASH_WRITER_SIM_BASE_ADDR			(0x08000000U)	/**< @brief Address at which the simulated Flash Memory starts. */
+#endif
+#ifndef FLASH_WRITER_SIM_SIZE
+#define FLASH_WRITER_SIM_SIZE				(0x10000U)		/**< @brief Size in bytes of the simulated Flash Memory. */
+#endif
+#ifndef FLASH_WRITER_SIM_PAGE_SIZE
+#define FLASH_WRITER_SIM_PAGE_SIZE			(1024U)			/**< @brief Size in bytes of each page of the simulated Flash Memory. */
+#endif
+#ifndef FLASH_WRITER_SIM_PROGRAM_TIME
+#define FLASH_WRITER_SIM_PROGRAM_TIME		(52U)			/**< @brief Time in microseconds that the simulated FPEC takes to program a half-word, which is the typical one of the STM32F1 MCUs. */
+#endif
+#ifndef FLASH_WRITER_SIM_ERASE_TIME
+#define FLASH_WRITER_SIM_ERASE_TIME			(20000U)		/**< @brief Time in microseconds that the simulated FPEC takes to erase a page, which is the typical one of the STM32F1 MCUs. */
+#endif
+#endif
+
+/**@brief	Flash Writer Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref flash_writer module to indicate the
+ *          resulting status of having executed the process contained in each of those functions.
+ */
+typedef enum
+{
+	FLASH_WRITER_EC_OK		= 0U,	//!< Flash Writer Process was successful. @note The code from the \c HAL_ret_handler() functions contemplates that this value will match the one given for \c HAL_OK from @ref HAL_StatusTypeDef .
+	FLASH_WRITER_EC_ERR		= 1U,	//!< Flash Writer Process has failed because the FPEC flagged a programming or write protection error, the Flash Memory could not be unlocked, or a programmed half-word did not read back as expected. @note Matches \c HAL_ERROR from @ref HAL_StatusTypeDef .
+	FLASH_WRITER_EC_BUSY	= 2U,	//!< Flash Writer Process could not be started because the Flash Memory was not unlocked via @ref flash_writer_begin . @note Matches \c HAL_BUSY from @ref HAL_StatusTypeDef .
+	FLASH_WRITER_EC_TIMEOUT	= 3U	//!< Flash Writer Process did not complete within @ref FLASH_WRITER_TIMEOUT . @note Matches \c HAL_TIMEOUT from @ref HAL_StatusTypeDef .
+} FlashWriter_Status;
+
+#if FLASH_WRITER_SIMULATED
+/**@brief	Faults that can be injected into a page of the simulated Flash Memory via
+ *          @ref flash_writer_sim_inject_fault .
+ */
+typedef enum
+{
+	FLASH_WRITER_SIM_FAULT_NONE				= 0U,	//!< The simulated FPEC works normally.
+	FLASH_WRITER_SIM_FAULT_PGERR			= 1U,	//!< The simulated FPEC flags \c PGERR on every program operation, as if the half-words were not erased.
+	FLASH_WRITER_SIM_FAULT_WRPRTERR			= 2U,	//!< The simulated FPEC flags \c WRPRTERR on every program and page erase operation, as if the page was write protected.
+	FLASH_WRITER_SIM_FAULT_STUCK_BUSY		= 3U,	//!< The simulated FPEC never finishes its operations, which therefore time out.
+	FLASH_WRITER_SIM_FAULT_NOT_PROGRAMMED	= 4U	//!< The simulated FPEC finishes its program operations without flagging any error, but leaves the half-words untouched.
+} FlashWriter_Sim_Fault;
+#endif
+
+/**@brief	Unlocks the Flash Memory of our MCU/MPU so that it can be erased and programmed via this module.
+ *
+ * @details	The unlock keys are only written if the Flash Memory is currently locked, so this function can be called
+ *          as many times as needed during a session without any significant overhead.
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ * @retval	FLASH_WRITER_EC_ERR
+ */
+FlashWriter_Status flash_writer_begin(void);
+
+/**@brief	Locks the Flash Memory of our MCU/MPU back, which ends the session started via @ref flash_writer_begin .
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ */
+FlashWriter_Status flash_writer_end(void);
+
+/**@brief	Erases a single page of the Flash Memory of our MCU/MPU.
+ *
+ * @note	The Flash Memory must have been unlocked via @ref flash_writer_begin first.
+ *
+ * @param page_address	Start address of the Flash Memory page to be erased.
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ * @retval	FLASH_WRITER_EC_ERR
+ * @retval	FLASH_WRITER_EC_BUSY
+ * @retval	FLASH_WRITER_EC_TIMEOUT
+ */
+FlashWriter_Status flash_writer_erase_page(uint32_t page_address);
+
+/**@brief	Programs some data into the Flash Memory of our MCU/MPU, one half-word at a time.
+ *
+ * @details	Each half-word is read back right after it is programmed, and any half-word that is to be left as
+ *          \c 0xFFFF in a location that already holds \c 0xFFFF is skipped.
+ *
+ * @note	The Flash Memory must have been unlocked via @ref flash_writer_begin first, and the locations to be
+ *          programmed must have been erased.
+ * @note	If \p length is odd, the last byte is programmed together with a \c 0xFF padding byte.
+ *
+ * @param address		Half-word aligned address of the Flash Memory from which the data is to be programmed.
+ * @param[in] p_data	Pointer to the data to be programmed, which does not need to be aligned in any way.
+ * @param length		Length in bytes of the data towards which the \p p_data param points to.
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ * @retval	FLASH_WRITER_EC_ERR
+ * @retval	FLASH_WRITER_EC_BUSY
+ * @retval	FLASH_WRITER_EC_TIMEOUT
+ */
+FlashWriter_Status flash_writer_program(uint32_t address, const uint8_t *p_data, uint32_t length);
+
+/**@brief	Checks whether a region of the Flash Memory of our MCU/MPU is blank (i.e., all its bytes are \c 0xFF ).
+ *
+ * @param address	Word aligned start address of the Flash Memory region to be checked.
+ * @param length	Length in bytes of the Flash Memory region to be checked, which must be a multiple of 4.
+ *
+ * @return	\c true if the region is blank, or otherwise \c false .
+ */
+bool flash_writer_is_blank(uint32_t address, uint32_t length);
+
+#if FLASH_WRITER_SIMULATED
+/**@brief	Gets the simulated Flash Memory, so that host tests can inspect it or give it an initial content.
+ *
+ * @details	The simulated Flash Memory holds @ref FLASH_WRITER_SIM_SIZE bytes, where its first byte corresponds to the
+ *          address @ref FLASH_WRITER_SIM_BASE_ADDR , and it starts fully erased.
+ *
+ * @return	Pointer to the first byte of the simulated Flash Memory.
+ */
+uint8_t *flash_writer_sim_memory(void);
+
+/**@brief	Resets the simulated Flash Memory back to its initial state, which is fully erased and locked, with its
+ *          simulated time at zero and without any injected fault.
+ */
+void flash_writer_sim_reset(void);
+
+/**@brief	Injects a fault into a single page of the simulated Flash Memory, which replaces any fault that was
+ *          injected before.
+ *
+ * @param fault		Fault to be injected, or @ref FLASH_WRITER_SIM_FAULT_NONE to remove the injected one.
+ * @param address	Any address of the page of the simulated Flash Memory into which the fault is to be injected.
+ */
+void flash_writer_sim_inject_fault(FlashWriter_Sim_Fault fault, uint32_t address);
+
+/**@brief	Gets the simulated time, which passes while the simulated FPEC is busy and via
+ *          @ref flash_writer_sim_advance_time .
+ *
+ * @return	The simulated time in microseconds.
+ */
+uint64_t flash_writer_sim_time(void);
+
+/**@brief	Lets some simulated time pass, so that host tests can account for the time spent outside of this module
+ *          (e.g., receiving data).
+ *
+ * @param duration	Time in microseconds that is to pass.
+ */
+void flash_writer_sim_advance_time(uint32_t duration);
+#endif
+
+#endif /* FLASH_WRITER_H_ */
+
+/** @} */
@@ -3,6 +3,9 @@
  */
 
 #include "crc32_mpeg2.h"
+#if CRC32_MPEG2_HW_ACCELERATION
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices, from which the CRC peripheral registers are located at.
+#endif
 
 static const uint32_t crc_table[0x100] = {
         0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005, 0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
@@ -25,17 +28,52 @@ static const uint32_t crc_table[0x100] = {
 
 uint32_t crc32_mpeg2(uint8_t *p_data, uint32_t data_length)
 {
-    /** <b>Local variable checksum:</b> Will hold the resulting checksum of the 32-bit CRC Hash Function to be calculated. @note A checksum is any sort of mathematical operation that it is performed on data to represent its number of bits in a transmission message. This is usually used by programmers to detect high-level errors within data transmissions. The way this is used is prior to transmission, such that every piece of data or file can be assigned a checksum value after running a cryptographic has function, which in this particular case, the has function is 32-bit CRC. */
-    uint32_t checksum = 0xFFFFFFFF;
-
     /* Validate the length of the data from which it is being requested to calculate the 32-bit CRC. */
     if (data_length == 0xFFFFFFFF)
     {
-    	return checksum;
+    	return CRC32_MPEG2_INIT_VALUE;
     }
 
-    /* Apply the 32-bit CRC Hash Function to the given input data (i.e., The data towards which the \p p_data pointer points to). */
-    for (unsigned int i=0; i<data_length; i++)
+    return crc32_mpeg2_update(CRC32_MPEG2_INIT_VALUE, p_data, data_length);
+}
+
+uint32_t crc32_mpeg2_update(uint32_t checksum, uint8_t *p_data, uint32_t data_length)
+{
+	#if CRC32_MPEG2_HW_ACCELERATION
+	/* Apply the 32-bit CRC Hash Function in software to the leading bytes that are not word-aligned, if any. */
+	while ((((uintptr_t) p_data) & 0x3) && (data_length > 0))
+	{
+        checksum = (checksum << 8) ^ crc_table[(uint8_t) (checksum >> 24) ^ *p_data++];
+        data_length--;
+	}
+
+	/* Feed the word-aligned bulk of the data into the CRC peripheral. */
+	if (data_length >= 4)
+	{
+		/** <b>Local pointer p_words:</b> Points to the word-aligned data that is to be fed into the CRC peripheral. */
+		uint32_t *p_words = (uint32_t *) p_data;
+		/** <b>Local variable words:</b> Number of words that are to be fed into the CRC peripheral. */
+		uint32_t words = data_length >> 2;
+
+		/* Reset the CRC peripheral, which makes it start from @ref CRC32_MPEG2_INIT_VALUE . */
+		__HAL_RCC_CRC_CLK_ENABLE();
+		CRC->CR = CRC_CR_RESET;
+
+		/* Feed the words, where their bytes are reversed since the CRC peripheral processes each word from its most
+		   significant bit, and where the first one is also XORed so that the CRC peripheral continues from \p checksum . */
+		CRC->DR = __REV(p_words[0]) ^ checksum ^ CRC32_MPEG2_INIT_VALUE;
+		for (uint32_t i=1; i<words; i++)
+		{
+			CRC->DR = __REV(p_words[i]);
+		}
+		checksum = CRC->DR;
+		p_data += words << 2;
+		data_length &= 0x3;
+	}
+	#endif
+
+    /* Apply the 32-bit CRC Hash Function in software to the remaining input data (i.e., The data towards which the \p p_data pointer points to). */
+    for (uint32_t i=0; i<data_length; i++)
     {
         uint8_t top = (uint8_t) (checksum >> 24);
         top ^= p_data[i];
@@ -0,0 +1,421 @@
+/** @addtogroup flash_writer
+ * @{
+ */
+
+#include "flash_writer.h"
+#if FLASH_WRITER_SIMULATED
+#include <string.h> // Library from which "memset()" is located at.
+#else
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices, from which the FPEC registers and "HAL_GetTick()" are located at.
+#endif
+
+#if FLASH_WRITER_SIMULATED
+#define FLASH_SR_BSY						(0x01U)			/**< @brief Busy flag of the Status Register of the simulated FPEC, which has the same value as in the real one. */
+#define FLASH_SR_PGERR						(0x04U)			/**< @brief Programming Error flag of the Status Register of the simulated FPEC, which has the same value as in the real one. */
+#define FLASH_SR_WRPRTERR					(0x10U)			/**< @brief Write Protection Error flag of the Status Register of the simulated FPEC, which has the same value as in the real one. */
+#define FLASH_SR_EOP						(0x20U)			/**< @brief End of Operation flag of the Status Register of the simulated FPEC, which has the same value as in the real one. */
+#define FLASH_WRITER_SIM_TICK				(1000U)			/**< @brief Time in microseconds that passes each time the Status Register of the simulated FPEC is polled while it is busy, which is the period of the simulated HAL tick. */
+
+#ifdef FLASH_WRITER_SIM_MEMORY
+#define sim_flash							((uint8_t *) (uintptr_t) (FLASH_WRITER_SIM_MEMORY))	/**< @brief Host memory holding the simulated Flash Memory, as given by @ref FLASH_WRITER_SIM_MEMORY , where its first byte corresponds to the address @ref FLASH_WRITER_SIM_BASE_ADDR . */
+#else
+static uint8_t sim_flash[FLASH_WRITER_SIM_SIZE];	/**< @brief Global array holding the simulated Flash Memory, where its first byte corresponds to the address @ref FLASH_WRITER_SIM_BASE_ADDR . */
+#endif
+static bool is_sim_flash_erased = false;			/**< @brief Global flag used to indicate whether @ref sim_flash has already been given its initial erased content with a \c true , or otherwise with a \c false . */
+static bool is_sim_flash_unlocked = false;			/**< @brief Global flag used to indicate whether the simulated Flash Memory is unlocked with a \c true , or otherwise with a \c false . */
+static uint32_t sim_fpec_sr = 0;					/**< @brief Global variable holding the error and End of Operation flags of the Status Register of the simulated FPEC. */
+static uint64_t sim_time = 0;						/**< @brief Global variable holding the simulated time in microseconds, which only passes while the simulated FPEC is busy. */
+static uint64_t sim_busy_until = 0;					/**< @brief Global variable holding the simulated time in microseconds at which the current operation of the simulated FPEC will finish. */
+static FlashWriter_Sim_Fault sim_fault = FLASH_WRITER_SIM_FAULT_NONE;	/**< @brief Global variable holding the fault that has been injected into the simulated FPEC. */
+static uint32_t sim_fault_page = 0;					/**< @brief Global variable holding the start address of the page of the simulated Flash Memory to which @ref sim_fault applies. */
+#endif
+
+/**@brief	Checks whether the Flash Memory of our MCU/MPU is currently unlocked.
+ *
+ * @return	\c true if it is unlocked, or otherwise \c false .
+ */
+static bool is_flash_unlocked(void);
+
+/**@brief	Reads a half-word from the Flash Memory of our MCU/MPU.
+ *
+ * @param address	Half-word aligned address of the Flash Memory to be read.
+ *
+ * @return	The half-word held at \p address .
+ */
+static uint16_t flash_read_half_word(uint32_t address);
+
+/**@brief	Programs a single half-word into the Flash Memory of our MCU/MPU and waits for the FPEC to finish doing so.
+ *
+ * @note	The \c PG bit of the FPEC must have been set already.
+ *
+ * @param address	Half-word aligned address of the Flash Memory to be programmed.
+ * @param value		Half-word to be programmed.
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ * @retval	FLASH_WRITER_EC_ERR
+ * @retval	FLASH_WRITER_EC_TIMEOUT
+ */
+static FlashWriter_Status flash_program_half_word(uint32_t address, uint16_t value);
+
+/**@brief	Waits for the FPEC to finish its current operation and then gets, and clears, its resulting flags.
+ *
+ * @retval	FLASH_WRITER_EC_OK
+ * @retval	FLASH_WRITER_EC_ERR			if the FPEC flagged a programming (\c PGERR ) or write protection
+ *										(\c WRPRTERR ) error.
+ * @retval	FLASH_WRITER_EC_TIMEOUT		if the FPEC was still busy after @ref FLASH_WRITER_TIMEOUT .
+ */
+static FlashWriter_Status fpec_wait_for_last_operation(void);
+
+/**@brief	Reads the Status Register of the FPEC.
+ *
+ * @return	The value of the Status Register of the FPEC.
+ */
+static uint32_t fpec_read_sr(void);
+
+/**@brief	Gets the current time in milliseconds, as given by the HAL tick.
+ *
+ * @return	The current time in milliseconds.
+ */
+static uint32_t fpec_get_tick(void);
+
+#if FLASH_WRITER_SIMULATED
+/**@brief	Checks whether an address lies within the simulated Flash Memory.
+ *
+ * @param address	Address to be checked.
+ *
+ * @return	\c true if \p address lies within the simulated Flash Memory, or otherwise \c false .
+ */
+static bool is_sim_address_valid(uint32_t address);
+
+/**@brief	Checks whether @ref sim_fault is a given fault and applies to the page that contains a given address.
+ *
+ * @param fault		Fault to be checked.
+ * @param address	Address of the simulated Flash Memory that is being erased or programmed.
+ *
+ * @return	\c true if \p fault has been injected into the page that contains \p address , or otherwise \c false .
+ */
+static bool is_sim_fault_injected(FlashWriter_Sim_Fault fault, uint32_t address);
+
+/**@brief	Starts an operation of the simulated FPEC that will keep it busy for a given time.
+ *
+ * @param duration	Time in microseconds that the operation takes, which is ignored whenever the
+ *					@ref FLASH_WRITER_SIM_FAULT_STUCK_BUSY fault applies to \p address .
+ * @param address	Address of the simulated Flash Memory that is being erased or programmed.
+ */
+static void sim_fpec_start(uint32_t duration, uint32_t address);
+#endif
+
+FlashWriter_Status flash_writer_begin(void)
+{
+	if (is_flash_unlocked())
+	{
+		return FLASH_WRITER_EC_OK;
+	}
+
+	#if FLASH_WRITER_SIMULATED
+	flash_writer_sim_memory();
+	is_sim_flash_unlocked = true;
+	sim_fpec_sr = 0;
+	#else
+	/* Write the unlock key sequence and clear any flags left over by a previous operation of the FPEC. */
+	FLASH->KEYR = FLASH_KEY1;
+	FLASH->KEYR = FLASH_KEY2;
+	FLASH->SR = FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPRTERR;
+	#endif
+
+	return is_flash_unlocked() ? FLASH_WRITER_EC_OK : FLASH_WRITER_EC_ERR;
+}
+
+FlashWriter_Status flash_writer_end(void)
+{
+	#if FLASH_WRITER_SIMULATED
+	is_sim_flash_unlocked = false;
+	#else
+	FLASH->CR |= FLASH_CR_LOCK;
+	#endif
+
+	return FLASH_WRITER_EC_OK;
+}
+
+FlashWriter_Status flash_writer_erase_page(uint32_t page_address)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref FlashWriter_Status function type. */
+	FlashWriter_Status ret;
+
+	if (!is_flash_unlocked())
+	{
+		return FLASH_WRITER_EC_BUSY;
+	}
+
+	#if FLASH_WRITER_SIMULATED
+	if (!is_sim_address_valid(page_address))
+	{
+		return FLASH_WRITER_EC_ERR;
+	}
+	page_address -= (page_address - FLASH_WRITER_SIM_BASE_ADDR) % FLASH_WRITER_SIM_PAGE_SIZE;
+
+	/* Just like the FPEC, refuse to erase a write protected page. */
+	if (is_sim_fault_injected(FLASH_WRITER_SIM_FAULT_WRPRTERR, page_address))
+	{
+		sim_fpec_sr |= FLASH_SR_WRPRTERR;
+	}
+	else
+	{
+		memset(&sim_flash[page_address - FLASH_WRITER_SIM_BASE_ADDR], 0xFF, FLASH_WRITER_SIM_PAGE_SIZE);
+	}
+	sim_fpec_start(FLASH_WRITER_SIM_ERASE_TIME, page_address);
+	ret = fpec_wait_for_last_operation();
+	#else
+	/* Request the FPEC to erase the page that contains the given address. */
+	FLASH->CR |= FLASH_CR_PER;
+	FLASH->AR = page_address;
+	FLASH->CR |= FLASH_CR_STRT;
+	ret = fpec_wait_for_last_operation();
+	FLASH->CR &= ~FLASH_CR_PER;
+	#endif
+
+	return ret;
+}
+
+FlashWriter_Status flash_writer_program(uint32_t address, const uint8_t *p_data, uint32_t length)
+{
+	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref FlashWriter_Status function type. */
+	FlashWriter_Status ret = FLASH_WRITER_EC_OK;
+	/** <b>Local variable value:</b> Half-word of the data that is currently being programmed. */
+	uint16_t value;
+
+	if (!is_flash_unlocked())
+	{
+		return FLASH_WRITER_EC_BUSY;
+	}
+	if (address & 0x1U)
+	{
+		return FLASH_WRITER_EC_ERR;
+	}
+
+	#if !FLASH_WRITER_SIMULATED
+	/* Keep the FPEC in programming mode for all the half-words instead of entering it once per half-word. */
+	FLASH->CR |= FLASH_CR_PG;
+	#endif
+	for (uint32_t i=0; i<length; i+=2, address+=2)
+	{
+		/* Compose the half-word byte by byte, which allows the given data to be unaligned, and pad an odd last byte with 0xFF. */
+		value = p_data[i];
+		value |= (uint16_t) (((i+1) < length) ? p_data[i+1] : 0xFFU) << 8;
+
+		/* Leave the half-words that are meant to be 0xFFFF untouched whenever they are already erased. */
+		if ((value == 0xFFFFU) && (flash_read_half_word(address) == 0xFFFFU))
+		{
+			continue;
+		}
+
+		ret = flash_program_half_word(address, value);
+		if (ret != FLASH_WRITER_EC_OK)
+		{
+			break;
+		}
+		if (flash_read_half_word(address) != value)
+		{
+			ret = FLASH_WRITER_EC_ERR;
+			break;
+		}
+	}
+	#if !FLASH_WRITER_SIMULATED
+	FLASH->CR &= ~FLASH_CR_PG;
+	#endif
+
+	return ret;
+}
+
+bool flash_writer_is_blank(uint32_t address, uint32_t length)
+{
+	#if FLASH_WRITER_SIMULATED
+	for (uint32_t i=0; i<length; i+=2)
+	{
+		if (flash_read_half_word(address + i) != 0xFFFFU)
+		{
+			return false;
+		}
+	}
+	#else
+	/** <b>Local pointer p_word:</b> Points to the words of the Flash Memory region that is being checked. */
+	volatile uint32_t *p_word = (volatile uint32_t *) address;
+
+	for (uint32_t i=0; i<(length/4U); i++)
+	{
+		if (p_word[i] != 0xFFFFFFFFU)
+		{
+			return false;
+		}
+	}
+	#endif
+
+	return true;
+}
+
+#if FLASH_WRITER_SIMULATED
+uint8_t *flash_writer_sim_memory(void)
+{
+	if (!is_sim_flash_erased)
+	{
+		memset(sim_flash, 0xFF, FLASH_WRITER_SIM_SIZE);
+		is_sim_flash_erased = true;
+	}
+
+	return sim_flash;
+}
+
+void flash_writer_sim_reset(void)
+{
+	memset(sim_flash, 0xFF, FLASH_WRITER_SIM_SIZE);
+	is_sim_flash_erased = true;
+	is_sim_flash_unlocked = false;
+	sim_fpec_sr = 0;
+	sim_time = 0;
+	sim_busy_until = 0;
+	sim_fault = FLASH_WRITER_SIM_FAULT_NONE;
+}
+
+void flash_writer_sim_inject_fault(FlashWriter_Sim_Fault fault, uint32_t address)
+{
+	sim_fault = fault;
+	sim_fault_page = address - ((address - FLASH_WRITER_SIM_BASE_ADDR) % FLASH_WRITER_SIM_PAGE_SIZE);
+}
+
+uint64_t flash_writer_sim_time(void)
+{
+	return sim_time;
+}
+
+void flash_writer_sim_advance_time(uint32_t duration)
+{
+	sim_time += duration;
+}
+#endif
+
+static bool is_flash_unlocked(void)
+{
+	#if FLASH_WRITER_SIMULATED
+	return is_sim_flash_unlocked;
+	#else
+	return (FLASH->CR & FLASH_CR_LOCK) == 0U;
+	#endif
+}
+
+static uint16_t flash_read_half_word(uint32_t address)
+{
+	#if FLASH_WRITER_SIMULATED
+	if (!is_sim_address_valid(address))
+	{
+		return 0x0000U;
+	}
+	address -= FLASH_WRITER_SIM_BASE_ADDR;
+	return (uint16_t) (flash_writer_sim_memory()[address] | (flash_writer_sim_memory()[address+1] << 8));
+	#else
+	return *((volatile uint16_t *) address);
+	#endif
+}
+
+static FlashWriter_Status flash_program_half_word(uint32_t address, uint16_t value)
+{
+	#if FLASH_WRITER_SIMULATED
+	if (!is_sim_address_valid(address))
+	{
+		return FLASH_WRITER_EC_ERR;
+	}
+
+	/* Just like the FPEC, refuse to program a write protected page, or a half-word that is not erased unless it is being cleared to zero. */
+	if (is_sim_fault_injected(FLASH_WRITER_SIM_FAULT_WRPRTERR, address))
+	{
+		sim_fpec_sr |= FLASH_SR_WRPRTERR;
+	}
+	else if (((flash_read_half_word(address) != 0xFFFFU) && (value != 0x0000U)) || is_sim_fault_injected(FLASH_WRITER_SIM_FAULT_PGERR, address))
+	{
+		sim_fpec_sr |= FLASH_SR_PGERR;
+	}
+	else if (!is_sim_fault_injected(FLASH_WRITER_SIM_FAULT_NOT_PROGRAMMED, address))
+	{
+		sim_flash[address - FLASH_WRITER_SIM_BASE_ADDR]     = (uint8_t) value;
+		sim_flash[address - FLASH_WRITER_SIM_BASE_ADDR + 1] = (uint8_t) (value >> 8);
+	}
+	sim_fpec_start(FLASH_WRITER_SIM_PROGRAM_TIME, address);
+	#else
+	*((volatile uint16_t *) address) = value;
+	#endif
+
+	return fpec_wait_for_last_operation();
+}
+
+static FlashWriter_Status fpec_wait_for_last_operation(void)
+{
+	/** <b>Local variable tick_start:</b> Value of the HAL tick at which the waiting started. */
+	uint32_t tick_start = fpec_get_tick();
+	/** <b>Local variable sr:</b> Value of the FPEC Status Register once its current operation has finished. */
+	uint32_t sr;
+
+	while (fpec_read_sr() & FLASH_SR_BSY)
+	{
+		if ((fpec_get_tick() - tick_start) > FLASH_WRITER_TIMEOUT)
+		{
+			return FLASH_WRITER_EC_TIMEOUT;
+		}
+	}
+
+	/* Clear the flags of the finished operation, which are cleared by writing a 1 into them. */
+	sr = fpec_read_sr();
+	#if FLASH_WRITER_SIMULATED
+	sim_fpec_sr &= ~(sr & (FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPRTERR));
+	#else
+	FLASH->SR = sr & (FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPRTERR);
+	#endif
+	if (sr & (FLASH_SR_PGERR | FLASH_SR_WRPRTERR))
+	{
+		return FLASH_WRITER_EC_ERR;
+	}
+
+	return FLASH_WRITER_EC_OK;
+}
+
+static uint32_t fpec_read_sr(void)
+{
+	#if FLASH_WRITER_SIMULATED
+	/* Let the simulated time pass by one HAL tick each time that the busy simulated FPEC is polled. */
+	if (sim_time < sim_busy_until)
+	{
+		sim_time = ((sim_busy_until - sim_time) > FLASH_WRITER_SIM_TICK) ? (sim_time + FLASH_WRITER_SIM_TICK) : sim_busy_until;
+		return sim_fpec_sr | FLASH_SR_BSY;
+	}
+	return sim_fpec_sr;
+	#else
+	return FLASH->SR;
+	#endif
+}
+
+static uint32_t fpec_get_tick(void)
+{
+	#if FLASH_WRITER_SIMULATED
+	return (uint32_t) (sim_time / 1000U);
+	#else
+	return HAL_GetTick();
+	#endif
+}
+
+#if FLASH_WRITER_SIMULATED
+static bool is_sim_address_valid(uint32_t address)
+{
+	return (address >= FLASH_WRITER_SIM_BASE_ADDR) && ((address - FLASH_WRITER_SIM_BASE_ADDR) < FLASH_WRITER_SIM_SIZE);
+}
+
+static bool is_sim_fault_injected(FlashWriter_Sim_Fault fault, uint32_t address)
+{
+	return (sim_fault == fault) && ((address - sim_fault_page) < FLASH_WRITER_SIM_PAGE_SIZE);
+}
+
+static void sim_fpec_start(uint32_t duration, uint32_t address)
+{
+	sim_fpec_sr |= FLASH_SR_EOP;
+	sim_busy_until = is_sim_fault_injected(FLASH_WRITER_SIM_FAULT_STUCK_BUSY, address) ? UINT64_MAX : (sim_time + duration);
+}
+#endif
+
+/** @} */
@@ -4,6 +4,7 @@
 
 #include "pre_bl_side_etx_ota.h"
 #include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include "flash_writer.h" // We call the library that erases and programs the Flash Memory of our MCU/MPU directly through its FPEC registers.
 //#include <stdio.h>	// Library from which "printf()" is located at.
 
 /**@brief	Gets the corresponding @ref ETX_OTA_Status value depending on the given @ref HAL_StatusTypeDef value.
@@ -26,10 +27,6 @@ ETX_OTA_Status install_bl_stored_in_app_fw(firmware_update_config_data_t *p_fw_c
 {
 	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
 	uint8_t  ret;
-	/**	<b>Local variable bytes_flashed:</b> Indicator of how many bytes of the identified Bootloader Firmware Image pending to be installed, if any, have been written into the designated Flash Memory of the Bootloader Firmware. */
-	uint16_t bytes_flashed = 0;
-	/**	<b>Local variable p_data:</b> Pointer to the data at which a Bootloader Firmware Image pending to be installed should be located at but in \c uint32_t Type. */
-	uint32_t *p_data = (uint32_t *) ETX_APP_FLASH_ADDR;
 
     /* Validating that length of the Bootloader Firmware Image pending to be installed is perfectly divisible by 4 bytes. */
     if ((p_fw_config->App_fw_size)%4 != 0)
@@ -37,8 +34,8 @@ ETX_OTA_Status install_bl_stored_in_app_fw(firmware_update_config_data_t *p_fw_c
         return ETX_OTA_EC_ERR;
     }
 
-	/* Unlock the Flash Memory of our MCU/MPU. */
-	ret = HAL_FLASH_Unlock();
+	/* Unlock the Flash Memory of our MCU/MPU once for the whole installation. */
+	ret = flash_writer_begin();
 	ret = HAL_ret_handler(ret);
 	if(ret != HAL_OK)
 	{
@@ -46,36 +43,28 @@ ETX_OTA_Status install_bl_stored_in_app_fw(firmware_update_config_data_t *p_fw_c
 	}
 
 	/* Erase Flash Memory dedicated to our MCU/MPU's Bootloader Firmware. */
-	FLASH_EraseInitTypeDef EraseInitStruct;
-	uint32_t page_error;
-
-	EraseInitStruct.TypeErase    = FLASH_TYPEERASE_PAGES;
-	EraseInitStruct.Banks        = FLASH_BANK_1;
-	EraseInitStruct.PageAddress  = ETX_BL_FLASH_ADDR;
-	EraseInitStruct.NbPages      = ETX_BL_FLASH_PAGES_SIZE;
-
-	ret = HAL_FLASHEx_Erase(&EraseInitStruct, &page_error);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		return ret;
-	}
-
-	/* Write the entire Bootloader Firmware Image into our MCU/MPU's Flash Memory. */
-	for ( ; bytes_flashed<p_fw_config->App_fw_size; bytes_flashed+=4)
+	for (uint16_t page=0; page<ETX_BL_FLASH_PAGES_SIZE; page++)
 	{
-		ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,
-								(ETX_BL_FLASH_ADDR + bytes_flashed),
-								p_data[bytes_flashed/4]);
+		ret = flash_writer_erase_page(ETX_BL_FLASH_ADDR + ((uint32_t) page * FLASH_PAGE_SIZE_IN_BYTES));
 		ret = HAL_ret_handler(ret);
 		if (ret != HAL_OK)
 		{
+			flash_writer_end();
 			return ret;
 		}
 	}
 
+	/* Write the entire Bootloader Firmware Image into our MCU/MPU's Flash Memory. */
+	ret = flash_writer_program(ETX_BL_FLASH_ADDR, (uint8_t *) ETX_APP_FLASH_ADDR, p_fw_config->App_fw_size);
+	ret = HAL_ret_handler(ret);
+	if (ret != HAL_OK)
+	{
+		flash_writer_end();
+		return ret;
+	}
+
 	/* Lock the Flash Memory, just like it originally was before calling this @ref install_bl_stored_in_app_fw function. */
-	ret = HAL_FLASH_Lock();
+	ret = flash_writer_end();
 	ret = HAL_ret_handler(ret);
 	if (ret != HAL_OK)
 	{
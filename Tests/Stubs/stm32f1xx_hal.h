@@ -0,0 +1,172 @@
+/** @file
+ * @brief	Host stub of the STM32F1 HAL Drivers for the host tests of the firmware modules.
+ *
+ * @details	This stub emulates the CRC peripheral of the STM32F1 MCUs so that the CRC32/MPEG-2 Algorithm module of the
+ *          firmwares can be tested with @ref CRC32_MPEG2_HW_ACCELERATION enabled on a host machine. Writing the Data
+ *          Register feeds a word into the emulated peripheral, reading it gives the current 32-bit CRC and writing
+ *          @ref CRC_CR_RESET into the Control Register resets it to @ref CRC32_MPEG2_INIT_VALUE , just as the actual
+ *          peripheral does.
+ * @details	This stub also declares the UART, DMA and GPIO types and functions of the HAL Drivers that the ETX OTA
+ *          Protocol modules of the firmwares use, so that those modules can be run on a host machine. Their functions,
+ *          and the \c stub_ functions behind their macros, are defined by each host test that needs them, which
+ *          emulates the link with the host as it requires (see test_bl_early_ack.c ).
+ *
+ * @note	The register accesses of the CRC peripheral are emulated with C++ operator overloading, so the modules
+ *          that use that peripheral must be compiled as C++ (see run_tests.sh ).
+ */
+#ifndef STM32F1XX_HAL_H_
+#define STM32F1XX_HAL_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+
+#define UART_FLAG_ORE                   (0x08U)         /**< @brief Overrun Error flag of the Status Register of the UART. */
+#define UART_FLAG_IDLE                  (0x10U)         /**< @brief IDLE Line Detected flag of the Status Register of the UART. */
+#define GPIO_PIN_15                     (0x8000U)       /**< @brief Pin 15 of a GPIO port. */
+
+/**@brief	HAL Status structures definition.
+ */
+typedef enum
+{
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/**@brief	GPIO Bit SET and Bit RESET enumeration.
+ */
+typedef enum
+{
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+/**@brief	GPIO peripheral, whose registers are never accessed by the modules under test.
+ */
+typedef struct
+{
+    uint32_t reserved;              //!< Placeholder of the registers.
+} GPIO_TypeDef;
+
+/**@brief	UART peripheral, whose registers are never accessed by the modules under test.
+ */
+typedef struct
+{
+    uint32_t reserved;              //!< Placeholder of the registers.
+} USART_TypeDef;
+
+/**@brief	DMA handle, of which only the Transfer Complete callback is used by the modules under test.
+ */
+typedef struct __DMA_HandleTypeDef
+{
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);     //!< Transfer Complete callback, which is called each time that a circular transfer wraps around.
+} DMA_HandleTypeDef;
+
+/**@brief	UART initialization parameters, of which only the Baud rate is used by the modules under test.
+ */
+typedef struct
+{
+    uint32_t BaudRate;              //!< Baud rate of the UART.
+} UART_InitTypeDef;
+
+/**@brief	UART handle.
+ */
+typedef struct
+{
+    USART_TypeDef *Instance;        //!< Registers of the UART.
+    UART_InitTypeDef Init;          //!< Initialization parameters of the UART.
+    DMA_HandleTypeDef *hdmarx;      //!< Handle of the DMA linked to the Rx of the UART.
+} UART_HandleTypeDef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t stub_dma_get_counter(DMA_HandleTypeDef *hdma);
+bool stub_uart_get_flag(UART_HandleTypeDef *huart, uint32_t flag);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
+#ifdef __cplusplus
+}
+#endif
+
+extern USART_TypeDef *USART1;   /**< @brief Pointer to the USART1 peripheral. */
+
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)           (stub_dma_get_counter(__HANDLE__))  /**< @brief Gets the number of bytes that the DMA has left to transfer. */
+#define __HAL_DMA_GET_TC_FLAG_INDEX(__HANDLE__)     (0U)                                /**< @brief Gets the Transfer Complete flag of the DMA. */
+#define __HAL_DMA_GET_FLAG(__HANDLE__, __FLAG__)    (0U)                                /**< @brief Gets a flag of the DMA, which is never pending since the emulated DMA calls its callbacks right away. */
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__)   (stub_uart_get_flag((__HANDLE__), (__FLAG__)))  /**< @brief Gets a flag of the Status Register of the UART. */
+#define __HAL_UART_CLEAR_IDLEFLAG(__HANDLE__)       do {} while (0)                     /**< @brief Clears the IDLE flag of the UART, which the emulated one clears by itself. */
+
+#ifdef __cplusplus
+#define CRC_CR_RESET                    (0x1U)          /**< @brief Bit of the Control Register of the CRC peripheral that resets its Data Register. */
+#define __HAL_RCC_CRC_CLK_ENABLE()      do {} while (0) /**< @brief Enables the clock of the CRC peripheral, which the emulated one does not need. */
+
+/**@brief   Reverses the byte order of a word, just like the REV instruction of the Cortex-M3.
+ */
+static inline uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+/**@brief	Emulated Data Register of the CRC peripheral.
+ */
+struct CRC_DR_Emulated_t
+{
+    uint32_t value = 0xFFFFFFFF;    //!< Current 32-bit CRC held by the CRC peripheral.
+
+    /**@brief   Feeds a word into the CRC peripheral, which processes it from its most significant bit.
+     */
+    CRC_DR_Emulated_t &operator=(uint32_t word)
+    {
+        value ^= word;
+        for (int bit=0; bit<32; bit++)
+        {
+            value = (value & 0x80000000) ? ((value << 1) ^ 0x04C11DB7) : (value << 1);
+        }
+        return *this;
+    }
+
+    operator uint32_t() const
+    {
+        return value;
+    }
+};
+
+/**@brief	Emulated Control Register of the CRC peripheral.
+ */
+struct CRC_CR_Emulated_t
+{
+    CRC_DR_Emulated_t *p_dr;    //!< Data Register that is reset by this Control Register.
+
+    CRC_CR_Emulated_t &operator=(uint32_t bits)
+    {
+        if (bits & CRC_CR_RESET)
+        {
+            p_dr->value = 0xFFFFFFFF;
+        }
+        return *this;
+    }
+};
+
+/**@brief	Emulated CRC peripheral.
+ */
+struct CRC_Emulated_t
+{
+    CRC_DR_Emulated_t DR;           //!< Data Register.
+    CRC_CR_Emulated_t CR = {&DR};   //!< Control Register.
+};
+
+static CRC_Emulated_t crc_emulated_peripheral;  /**< @brief The single emulated CRC peripheral. */
+#define CRC                         (&crc_emulated_peripheral)  /**< @brief Pointer to the CRC peripheral. */
+#endif /* __cplusplus */
+
+#endif /* STM32F1XX_HAL_H_ */
@@ -0,0 +1,94 @@
+#!/bin/bash
+# Run this bash file from any folder to compile and run the host tests of the ETX OTA Protocol modules, which use the
+# GCC of the host machine and therefore do not need the ARM toolchain nor the MCU.
+# Each test is compiled into a temporary folder and is run once per copy of the module under test (i.e., the ones of
+# the Application, Custom Bootloader and Pre-Bootloader Firmwares, and the ones of the host programs). The firmware
+# modules are also compiled as C++ whenever they are tested against the emulated peripherals of "Stubs/".
+# Usage: ./run_tests.sh
+TESTS_DIR=$(cd "$(dirname "$0")" && pwd)
+REPO_DIR=$(dirname "$TESTS_DIR")
+BUILD_DIR=$(mktemp -d)
+trap 'rm -rf "$BUILD_DIR"' EXIT
+FIRMWARE_DIRS="Application_firmware_v0.4/Application_Firmware Custom_Bootloader_v0.4/Custom_Bootloader_Firmware Pre_Bootloader_v0.4/Pre_Bootloader_Firmware"
+FLASH_WRITER_FIRMWARE_DIRS="Custom_Bootloader_v0.4/Custom_Bootloader_Firmware Pre_Bootloader_v0.4/Pre_Bootloader_Firmware"
+HOST_CRC_DIRS="PcTool_App/PcTool/CRC32_MPEG2 Host_App/HostBleApp/APIs/uartPcToolAPI/CRC32_MPEG2 Host_App/HostBleApp/APIs/blePcToolAPI/CRC32_MPEG2"
+FAILED=""
+
+# Compiles and runs a single test, whose name is given first and whose compiler and its arguments are given next.
+run_test() {
+    NAME=$1
+    shift
+    echo "Running $NAME..."
+    if ! "$@" -o "$BUILD_DIR/test" || ! "$BUILD_DIR/test"; then
+        FAILED="$FAILED$NAME\n"
+    fi
+}
+
+for CRC_DIR in $HOST_CRC_DIRS; do
+    run_test "test_crc32_mpeg2_host ($CRC_DIR)" gcc -Wall -Wextra -O2 -I"$REPO_DIR/$CRC_DIR" "$TESTS_DIR/test_crc32_mpeg2_host.c"
+done
+for FIRMWARE_DIR in $FIRMWARE_DIRS; do
+    run_test "test_crc32_mpeg2_firmware ($FIRMWARE_DIR)" gcc -Wall -Wextra -O2 -DCRC32_MPEG2_HW_ACCELERATION=0 -I"$REPO_DIR/$FIRMWARE_DIR/Core/Inc" \
+        "$TESTS_DIR/test_crc32_mpeg2_firmware.c" "$REPO_DIR/$FIRMWARE_DIR/Core/Src/crc32_mpeg2.c"
+    run_test "test_crc32_mpeg2_firmware with the CRC peripheral ($FIRMWARE_DIR)" g++ -x c++ -Wall -Wextra -O2 -DCRC32_MPEG2_HW_ACCELERATION=1 -I"$TESTS_DIR/Stubs" \
+        -I"$REPO_DIR/$FIRMWARE_DIR/Core/Inc" "$TESTS_DIR/test_crc32_mpeg2_firmware.c" "$REPO_DIR/$FIRMWARE_DIR/Core/Src/crc32_mpeg2.c"
+done
+for FIRMWARE_DIR in $FLASH_WRITER_FIRMWARE_DIRS; do
+    run_test "test_flash_writer ($FIRMWARE_DIR)" gcc -Wall -Wextra -O2 -DFLASH_WRITER_SIMULATED=1 -I"$REPO_DIR/$FIRMWARE_DIR/Core/Inc" \
+        "$TESTS_DIR/test_flash_writer.c" "$REPO_DIR/$FIRMWARE_DIR/Core/Src/flash_writer.c"
+done
+# The binary patches generated by the PcTool are applied in place by the Custom Bootloader, so both sides are tested
+# together.
+PCTOOL_DIR="PcTool_App/PcTool"
+BOOTLOADER_DIR="Custom_Bootloader_v0.4/Custom_Bootloader_Firmware"
+run_test "test_bsdiff_bspatch ($PCTOOL_DIR and $BOOTLOADER_DIR)" gcc -Wall -Wextra -O2 -I"$REPO_DIR/$PCTOOL_DIR/BSDIFF" \
+    -I"$REPO_DIR/$PCTOOL_DIR/CRC32_MPEG2" -I"$REPO_DIR/$BOOTLOADER_DIR/Core/Inc" "$TESTS_DIR/test_bsdiff_bspatch.c" \
+    "$REPO_DIR/$PCTOOL_DIR/BSDIFF/bsdiff.c" "$REPO_DIR/$PCTOOL_DIR/CRC32_MPEG2/crc32_mpeg2.c" "$REPO_DIR/$BOOTLOADER_DIR/Core/Src/bspatch.c"
+# The compressed Payloads are also decompressed with the smallest window and flush size, so that the matches of the
+# encoder are bounded by the window that it is given rather than by the default one.
+for LZ4_WINDOW in "" "-DLZ4_DECODER_WINDOW_LOG2=8 -DLZ4_DECODER_FLUSH_SIZE=64"; do
+    run_test "test_lz4 ${LZ4_WINDOW:+with a 256-byte window }($PCTOOL_DIR and $BOOTLOADER_DIR)" gcc -Wall -Wextra -O2 $LZ4_WINDOW \
+        -I"$REPO_DIR/$PCTOOL_DIR/LZ4" -I"$REPO_DIR/$BOOTLOADER_DIR/Core/Inc" "$TESTS_DIR/test_lz4.c" \
+        "$REPO_DIR/$PCTOOL_DIR/LZ4/lz4_encoder.c" "$REPO_DIR/$BOOTLOADER_DIR/Core/Src/lz4_decoder.c"
+done
+run_test "test_reed_solomon ($PCTOOL_DIR and $BOOTLOADER_DIR)" gcc -Wall -Wextra -O2 -I"$REPO_DIR/$PCTOOL_DIR/REED_SOLOMON" \
+    -I"$REPO_DIR/$BOOTLOADER_DIR/Core/Inc" "$TESTS_DIR/test_reed_solomon.c" "$REPO_DIR/$PCTOOL_DIR/REED_SOLOMON/rs_encoder.c" \
+    "$REPO_DIR/$BOOTLOADER_DIR/Core/Src/rs_decoder.c"
+# The layout of the response to the ETX OTA Start Command is built by the firmwares and parsed by the PcTool from
+# copies of the same header file, which must therefore be identical.
+START_RESP_HEADERS="Application_firmware_v0.4/Application_Firmware/Core/Inc $PCTOOL_DIR"
+for START_RESP_DIR in $START_RESP_HEADERS; do
+    echo "Comparing etx_ota_start_resp.h ($START_RESP_DIR and $BOOTLOADER_DIR)..."
+    if ! cmp "$REPO_DIR/$BOOTLOADER_DIR/Core/Inc/etx_ota_start_resp.h" "$REPO_DIR/$START_RESP_DIR/etx_ota_start_resp.h"; then
+        FAILED="${FAILED}etx_ota_start_resp.h ($START_RESP_DIR and $BOOTLOADER_DIR)\n"
+    fi
+done
+run_test "test_image_parser ($PCTOOL_DIR)" gcc -Wall -Wextra -O2 -I"$REPO_DIR/$PCTOOL_DIR/IMAGE_PARSER" "$TESTS_DIR/test_image_parser.c" \
+    "$REPO_DIR/$PCTOOL_DIR/IMAGE_PARSER/image_parser.c"
+# The ETX OTA Protocol module of the Custom Bootloader is also built with its optional features enabled (i.e., the
+# Page CRC and Seek Commands, binary patches, compressed payloads, resumable transfers, Reed-Solomon and Data v2), so
+# that none of them is left uncompiled by the tests.
+BOOTLOADER_SRCS=()
+for SRC in bl_side_etx_ota.c crc32_mpeg2.c flash_writer.c hm10_ble_driver.c bspatch.c lz4_decoder.c rs_decoder.c; do
+    BOOTLOADER_SRCS+=("$REPO_DIR/$BOOTLOADER_DIR/Core/Src/$SRC")
+done
+BOOTLOADER_FEATURES="-DETX_OTA_SKIP_UNCHANGED_PAGES=1 -DETX_OTA_PATCH_UPDATE=1 -DETX_OTA_COMPRESSION=1 -DETX_OTA_RESUME=1 -DETX_OTA_FEC=1 -DETX_OTA_DATA_V2=1"
+for FEATURES in "" "$BOOTLOADER_FEATURES"; do
+    for EARLY_ACK in 1 0; do
+        run_test "test_bl_early_ack with ETX_OTA_EARLY_ACK=$EARLY_ACK ${FEATURES:+and all the features }($BOOTLOADER_DIR)" gcc -Wall -Wextra -O2 $FEATURES \
+            -DETX_OTA_EARLY_ACK=$EARLY_ACK -DFLASH_WRITER_SIMULATED=1 -DFLASH_WRITER_SIM_SIZE=0x20000 -DFLASH_WRITER_SIM_MEMORY=FLASH_WRITER_SIM_BASE_ADDR \
+            -DCRC32_MPEG2_HW_ACCELERATION=0 -I"$TESTS_DIR/Stubs" -I"$REPO_DIR/$BOOTLOADER_DIR/Core/Inc" "$TESTS_DIR/test_bl_early_ack.c" \
+            "${BOOTLOADER_SRCS[@]}"
+    done
+done
+# The Page CRC and Seek Commands, and the resumable transfers that are built on them, are tested with all the features,
+# since both are only compiled with ETX_OTA_SKIP_UNCHANGED_PAGES.
+run_test "test_bl_seek_resume ($BOOTLOADER_DIR)" gcc -Wall -Wextra -O2 $BOOTLOADER_FEATURES -DFLASH_WRITER_SIMULATED=1 \
+    -DFLASH_WRITER_SIM_SIZE=0x20000 -DFLASH_WRITER_SIM_MEMORY=FLASH_WRITER_SIM_BASE_ADDR -DCRC32_MPEG2_HW_ACCELERATION=0 -I"$TESTS_DIR/Stubs" \
+    -I"$REPO_DIR/$BOOTLOADER_DIR/Core/Inc" "$TESTS_DIR/test_bl_seek_resume.c" "${BOOTLOADER_SRCS[@]}"
+
+if [ -n "$FAILED" ]; then
+    echo -e "The following tests have failed:\n$FAILED"
+    exit 1
+fi
+echo "All the tests have passed."
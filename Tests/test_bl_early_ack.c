@@ -0,0 +1,460 @@
+/** @file
+ * @brief	Host test of the ETX OTA Protocol of the Custom Bootloader Firmware against its simulated Flash Memory.
+ *
+ * @details	This test runs whole ETX OTA Transactions through @ref firmware_image_download_and_install , where a
+ *          simulated host sends its ETX OTA Packets one byte at a time at @ref TEST_BAUD_RATE into an emulated
+ *          circular DMA, and where the Flash Memory is the simulated one of the @ref flash_writer , which takes the
+ *          typical page erase and half-word program times of the STM32F1 MCUs. Every event is ordered by the
+ *          simulated time of the @ref flash_writer , which also passes each time that the Custom Bootloader polls the
+ *          emulated DMA or the HAL tick.
+ * @details	The test checks that each ETX OTA Data Type Packet is acknowledged before it is programmed whenever
+ *          @ref ETX_OTA_EARLY_ACK is enabled (or only after it has been programmed otherwise), that programming it
+ *          then overlaps with the reception of the next one, and that a Flash Memory page that fails to be programmed
+ *          after its ETX OTA Data Type Packet has been acknowledged is NACKed with @ref ETX_OTA_NACK_REASON_FLASH ,
+ *          which ends the ETX OTA Transaction with @ref ETX_OTA_EC_ERR (see run_tests.sh ).
+ *
+ * @note	The Custom Bootloader reads the Flash Memory through pointers, so the simulated Flash Memory is mapped at
+ *          its actual address via \c FLASH_WRITER_SIM_MEMORY .
+ */
+#include "bl_side_etx_ota.h"
+#include "flash_writer.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h> // Library from which "memcpy()" and "memcmp()" are located at.
+#include <sys/mman.h> // Library from which "mmap()" is located at.
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE     (0)     /**< @brief Flag of "mmap()" that is only given by the newer C libraries, without which the requested address is just a hint. */
+#endif
+
+#define TEST_BAUD_RATE          (115200U)       /**< @brief Baud rate of the simulated link, where each byte takes 10 bits. */
+#define TEST_POLL_TIME          (1U)            /**< @brief Time in microseconds that passes each time that the Custom Bootloader polls the emulated DMA or the HAL tick. */
+#define TEST_FRAME_SIZE         (1024U)         /**< @brief Size in bytes of the data of the ETX OTA Data Type Packets, which is also the size of a Flash Memory page. */
+#define TEST_IMAGE_SIZE         (6U*TEST_FRAME_SIZE + 512U)     /**< @brief Size in bytes of the Firmware Image, whose last ETX OTA Data Type Packet is shorter than the rest. */
+#define TEST_FRAME_COUNT        ((TEST_IMAGE_SIZE + TEST_FRAME_SIZE - 1U) / TEST_FRAME_SIZE)    /**< @brief Number of ETX OTA Data Type Packets of the Firmware Image. */
+#define TEST_FAULT_FRAME        (3U)            /**< @brief Index of the ETX OTA Data Type Packet whose Flash Memory page fails to be programmed in @ref test_flash_fault_after_ack . */
+#define TEST_STREAM_MAX_SIZE    (16384U)        /**< @brief Maximum number of bytes that the simulated host can send in a single ETX OTA Transaction. */
+#define TEST_OVERHEAD           (9U)            /**< @brief Bytes of an ETX OTA Packet other than its "Data" field. */
+
+#define TEST_SOF                (0xAAU)         /**< @brief SOF byte of the ETX OTA Packets. */
+#define TEST_EOF                (0xBBU)         /**< @brief EOF byte of the ETX OTA Packets. */
+#define TEST_PACKET_TYPE_CMD    (0U)            /**< @brief Packet Type of the ETX OTA Command Type Packets. */
+#define TEST_PACKET_TYPE_DATA   (1U)            /**< @brief Packet Type of the ETX OTA Data Type Packets. */
+#define TEST_PACKET_TYPE_HEADER (2U)            /**< @brief Packet Type of the ETX OTA Header Type Packets. */
+#define TEST_PACKET_TYPE_RESP   (3U)            /**< @brief Packet Type of the ETX OTA Response Type Packets. */
+#define TEST_CMD_START          (0U)            /**< @brief ETX OTA Start Command. */
+#define TEST_CMD_END            (1U)            /**< @brief ETX OTA End Command. */
+#define TEST_START_FLAG_NACK_REASON (0x02U)     /**< @brief Flag of the ETX OTA Start Command with which the host requests the NACKs to carry their reason and offset. */
+#define TEST_ACK                (0U)            /**< @brief ACK Response Status. */
+#define TEST_NACK               (1U)            /**< @brief NACK Response Status. */
+#define TEST_READY              (2U)            /**< @brief READY beacon Response Status. */
+#define TEST_NACK_REASON_FLASH  (3U)            /**< @brief Reason of the NACKs given whenever the Flash Memory could not be programmed. */
+
+/**@brief	Phases of the ETX OTA Transaction of the simulated host.
+ */
+typedef enum
+{
+    HOST_WAIT_READY     = 0U,   //!< Waiting for the READY beacon of the Custom Bootloader.
+    HOST_START_SENT     = 1U,   //!< The ETX OTA Start Command has been sent.
+    HOST_HEADER_SENT    = 2U,   //!< The ETX OTA Header Type Packet has been sent.
+    HOST_DATA_SENT      = 3U,   //!< An ETX OTA Data Type Packet has been sent.
+    HOST_END_SENT       = 4U,   //!< The ETX OTA End Command has been sent.
+    HOST_DONE           = 5U    //!< The ETX OTA Transaction has either been completed or been NACKed.
+} Host_Phase;
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t image[TEST_IMAGE_SIZE];                      /**< @brief Firmware Image that the simulated host sends. */
+static uint8_t host_stream[TEST_STREAM_MAX_SIZE];           /**< @brief Bytes that the simulated host has sent, in order. */
+static uint64_t host_arrival[TEST_STREAM_MAX_SIZE];         /**< @brief Simulated time at which each byte of @ref host_stream has been fully received by the UART. */
+static uint32_t host_queued = 0U;                           /**< @brief Number of bytes of @ref host_stream that the simulated host has sent. */
+static uint32_t host_delivered = 0U;                        /**< @brief Number of bytes of @ref host_stream that have already been handed to the emulated DMA. */
+static Host_Phase host_phase = HOST_WAIT_READY;             /**< @brief Phase of the ETX OTA Transaction of the simulated host. */
+static uint32_t host_frames_sent = 0U;                      /**< @brief Number of ETX OTA Data Type Packets that the simulated host has sent. */
+static uint32_t host_frames_acked = 0U;                     /**< @brief Number of ETX OTA Data Type Packets that the Custom Bootloader has ACKed. */
+static bool is_frame_programmed_at_ack[TEST_FRAME_COUNT];   /**< @brief Whether each ETX OTA Data Type Packet was already in the Flash Memory when it was ACKed. */
+static bool is_prev_frame_programmed_at_ack[TEST_FRAME_COUNT];  /**< @brief Whether the ETX OTA Data Type Packet before each one was already in the Flash Memory when the latter was ACKed. */
+static uint8_t last_status = 0xFFU;                         /**< @brief Response Status of the latest ETX OTA Response Type Packet. */
+static uint8_t last_nack_reason = 0xFFU;                    /**< @brief Reason of the latest NACK, if it carried one. */
+static uint32_t last_nack_offset = 0xFFFFFFFFU;             /**< @brief Offset of the latest NACK, if it carried one. */
+static uint64_t last_resp_time = 0U;                        /**< @brief Simulated time at which the latest ETX OTA Response Type Packet was fully sent. */
+static uint8_t *p_dma_buffer = NULL;                        /**< @brief Circular buffer of the emulated DMA. */
+static uint16_t dma_size = 0U;                              /**< @brief Size in bytes of @ref p_dma_buffer . */
+static uint16_t dma_pos = 0U;                               /**< @brief Index of @ref p_dma_buffer into which the emulated DMA writes the next byte. */
+static bool is_dma_running = false;                         /**< @brief Whether the emulated DMA is currently receiving. */
+static DMA_HandleTypeDef hdma_rx;                           /**< @brief Handle of the emulated DMA. */
+static USART_TypeDef usart_emulated;                        /**< @brief Emulated UART peripheral. */
+static UART_HandleTypeDef huart = {&usart_emulated, {TEST_BAUD_RATE}, &hdma_rx};   /**< @brief Handle of the emulated UART. */
+static firmware_update_config_data_t fw_config;             /**< @brief Firmware Update Configurations given to the Custom Bootloader. */
+USART_TypeDef *USART1 = NULL;                               /**< @brief USART1 peripheral, which is not the emulated one. */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the simulated time that a number of bytes take in the simulated link.
+ */
+static uint64_t link_time(uint32_t bytes)
+{
+    return ((uint64_t) bytes * 10U * 1000000U) / TEST_BAUD_RATE;
+}
+
+/**@brief   Gets the address of the Flash Memory into which an ETX OTA Data Type Packet of the Firmware Image goes.
+ */
+static uint8_t *frame_at(uint32_t frame)
+{
+    return (uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + frame*TEST_FRAME_SIZE);
+}
+
+/**@brief   Gets the size in bytes of the data of an ETX OTA Data Type Packet of the Firmware Image.
+ */
+static uint16_t frame_len(uint32_t frame)
+{
+    return ((frame + 1U) < TEST_FRAME_COUNT) ? TEST_FRAME_SIZE : (TEST_IMAGE_SIZE - frame*TEST_FRAME_SIZE);
+}
+
+/**@brief   Hands the bytes that have been received by the UART so far to the emulated DMA, which loses them if it
+ *          is not receiving.
+ */
+static void dma_run(void)
+{
+    while ((host_delivered < host_queued) && (host_arrival[host_delivered] <= flash_writer_sim_time()))
+    {
+        if (is_dma_running)
+        {
+            p_dma_buffer[dma_pos++] = host_stream[host_delivered];
+            if (dma_pos == dma_size)
+            {
+                dma_pos = 0U;
+                if (hdma_rx.XferCpltCallback != NULL)
+                {
+                    hdma_rx.XferCpltCallback(&hdma_rx);
+                }
+            }
+        }
+        host_delivered++;
+    }
+}
+
+/**@brief   Sends an ETX OTA Packet from the simulated host, right after any bytes that it is still sending.
+ */
+static void host_send_packet(uint8_t packet_type, const uint8_t *p_data, uint16_t data_len)
+{
+    /** <b>Local variable packet:</b> Whole ETX OTA Packet to be sent. */
+    uint8_t packet[TEST_FRAME_SIZE + TEST_OVERHEAD];
+    /** <b>Local variable crc:</b> 32-bit CRC of the "Data" field of the ETX OTA Packet. */
+    uint32_t crc = crc32_mpeg2((uint8_t *) p_data, data_len);
+    /** <b>Local variable start:</b> Simulated time at which the first bit of the ETX OTA Packet is sent. */
+    uint64_t start = flash_writer_sim_time();
+
+    packet[0] = TEST_SOF;
+    packet[1] = packet_type;
+    memcpy(&packet[2], &data_len, sizeof(data_len));
+    memcpy(&packet[4], p_data, data_len);
+    memcpy(&packet[4 + data_len], &crc, sizeof(crc));
+    packet[8 + data_len] = TEST_EOF;
+
+    if ((host_queued > 0U) && (host_arrival[host_queued - 1U] > start))
+    {
+        start = host_arrival[host_queued - 1U];
+    }
+    for (uint32_t i=0; i<(data_len + TEST_OVERHEAD); i++)
+    {
+        host_stream[host_queued] = packet[i];
+        host_arrival[host_queued++] = start + link_time(i + 1U);
+    }
+}
+
+/**@brief   Sends the next ETX OTA Data Type Packet of the Firmware Image from the simulated host.
+ */
+static void host_send_next_frame(void)
+{
+    host_send_packet(TEST_PACKET_TYPE_DATA, &image[host_frames_sent*TEST_FRAME_SIZE], frame_len(host_frames_sent));
+    host_frames_sent++;
+    host_phase = HOST_DATA_SENT;
+}
+
+/**@brief   Makes the simulated host react to an ETX OTA Response Type Packet of the Custom Bootloader.
+ */
+static void host_on_response(uint8_t status)
+{
+    /** <b>Local variable start_cmd:</b> ETX OTA Start Command, which requests a window of 1 and the reasons of the NACKs. */
+    const uint8_t start_cmd[3] = {TEST_CMD_START, 1U, TEST_START_FLAG_NACK_REASON};
+    /** <b>Local variable end_cmd:</b> ETX OTA End Command. */
+    const uint8_t end_cmd[1] = {TEST_CMD_END};
+    /** <b>Local variable header:</b> ETX OTA Header of the Firmware Image, whose frame size is the one of its ETX OTA Data Type Packets. */
+    uint8_t header[16] = {0};
+    /** <b>Local variable value:</b> Value of a field of the ETX OTA Header. */
+    uint32_t value;
+
+    if (status == TEST_NACK)
+    {
+        host_phase = HOST_DONE;
+        return;
+    }
+    switch (host_phase)
+    {
+        case HOST_WAIT_READY:
+            CHECK(status == TEST_READY);
+            host_send_packet(TEST_PACKET_TYPE_CMD, start_cmd, sizeof(start_cmd));
+            host_phase = HOST_START_SENT;
+            break;
+        case HOST_START_SENT:
+            value = TEST_IMAGE_SIZE;
+            memcpy(&header[0], &value, sizeof(value));
+            value = crc32_mpeg2(image, TEST_IMAGE_SIZE);
+            memcpy(&header[4], &value, sizeof(value));
+            header[12] = (uint8_t) TEST_FRAME_SIZE;
+            header[13] = (uint8_t) (TEST_FRAME_SIZE >> 8);
+            host_send_packet(TEST_PACKET_TYPE_HEADER, header, sizeof(header));
+            host_phase = HOST_HEADER_SENT;
+            break;
+        case HOST_HEADER_SENT:
+            host_send_next_frame();
+            break;
+        case HOST_DATA_SENT:
+            /* Record whether the acknowledged ETX OTA Data Type Packet, and the one before it, are already in the Flash Memory. */
+            is_frame_programmed_at_ack[host_frames_acked] = (memcmp(frame_at(host_frames_acked), &image[host_frames_acked*TEST_FRAME_SIZE], frame_len(host_frames_acked)) == 0);
+            is_prev_frame_programmed_at_ack[host_frames_acked] = (host_frames_acked == 0U)
+                    || (memcmp(frame_at(host_frames_acked - 1U), &image[(host_frames_acked - 1U)*TEST_FRAME_SIZE], TEST_FRAME_SIZE) == 0);
+            host_frames_acked++;
+            if (host_frames_sent < TEST_FRAME_COUNT)
+            {
+                host_send_next_frame();
+            }
+            else
+            {
+                host_send_packet(TEST_PACKET_TYPE_CMD, end_cmd, sizeof(end_cmd));
+                host_phase = HOST_END_SENT;
+            }
+            break;
+        case HOST_END_SENT:
+        default:
+            host_phase = HOST_DONE;
+            break;
+    }
+}
+
+uint32_t stub_dma_get_counter(DMA_HandleTypeDef *hdma)
+{
+    (void) hdma;
+    flash_writer_sim_advance_time(TEST_POLL_TIME);
+    dma_run();
+    return dma_size - dma_pos;
+}
+
+bool stub_uart_get_flag(UART_HandleTypeDef *p_huart, uint32_t flag)
+{
+    (void) p_huart;
+    dma_run();
+    if (flag == UART_FLAG_IDLE)
+    {
+        return (host_delivered == host_queued) && ((host_queued == 0U) || (flash_writer_sim_time() >= (host_arrival[host_queued - 1U] + link_time(1U))));
+    }
+    return false;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    flash_writer_sim_advance_time(TEST_POLL_TIME);
+    return (uint32_t) (flash_writer_sim_time() / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    flash_writer_sim_advance_time(Delay * 1000U);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    (void) GPIOx;
+    (void) GPIO_Pin;
+    return GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *p_huart)
+{
+    (void) p_huart;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *p_huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    /** <b>Local variable data_len:</b> "Data Length" field of the ETX OTA Response Type Packet. */
+    uint16_t data_len;
+    /** <b>Local variable crc:</b> 32-bit CRC of the ETX OTA Response Type Packet. */
+    uint32_t crc;
+
+    (void) p_huart;
+    (void) Timeout;
+    flash_writer_sim_advance_time((uint32_t) link_time(Size));
+
+    /* Validate the ETX OTA Response Type Packet and let the simulated host react to it. */
+    memcpy(&data_len, &pData[2], sizeof(data_len));
+    memcpy(&crc, &pData[4 + data_len], sizeof(crc));
+    CHECK((pData[0] == TEST_SOF) && (pData[1] == TEST_PACKET_TYPE_RESP) && (Size == data_len + TEST_OVERHEAD));
+    CHECK(crc == crc32_mpeg2((uint8_t *) &pData[4], data_len));
+    last_status = pData[4];
+    if ((last_status == TEST_NACK) && (data_len == 6U))
+    {
+        last_nack_reason = pData[5];
+        memcpy(&last_nack_offset, &pData[6], sizeof(last_nack_offset));
+    }
+    last_resp_time = flash_writer_sim_time();
+    host_on_response(last_status);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *p_huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) p_huart;
+    (void) pData;
+    (void) Size;
+    HAL_Delay(Timeout);
+    return HAL_TIMEOUT;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *p_huart, uint8_t *pData, uint16_t Size)
+{
+    (void) p_huart;
+    dma_run();
+    p_dma_buffer = pData;
+    dma_size = Size;
+    dma_pos = 0U;
+    hdma_rx.XferCpltCallback = NULL;
+    is_dma_running = true;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *p_huart)
+{
+    (void) p_huart;
+    dma_run();
+    is_dma_running = false;
+    return HAL_OK;
+}
+
+FirmUpdConf_Status firmware_update_configurations_write(firmware_update_config_data_t *p_data)
+{
+    (void) p_data;
+    return FIRM_UPDT_CONF_EC_OK;
+}
+
+/**@brief   Resets the simulated host, link and Flash Memory, and initializes the ETX OTA Protocol module for a new ETX OTA
+ *          Transaction.
+ */
+static void reset_transaction(void)
+{
+    /* Leave a previous Firmware Image in the Flash Memory, so that each of its pages has to be erased before being programmed. */
+    flash_writer_sim_reset();
+    memset(frame_at(0U), 0x00, TEST_FRAME_COUNT*TEST_FRAME_SIZE);
+    host_queued = 0U;
+    host_delivered = 0U;
+    host_phase = HOST_WAIT_READY;
+    host_frames_sent = 0U;
+    host_frames_acked = 0U;
+    last_status = 0xFFU;
+    last_nack_reason = 0xFFU;
+    last_nack_offset = 0xFFFFFFFFU;
+    last_resp_time = 0U;
+    memset(&fw_config, 0xFF, sizeof(fw_config));
+    CHECK(init_firmware_update_module(ETX_OTA_hw_Protocol_UART, &huart, &fw_config, NULL) == ETX_OTA_EC_OK);
+}
+
+/**@brief   Tests that each ETX OTA Data Type Packet is acknowledged before being programmed if @ref ETX_OTA_EARLY_ACK
+ *          is enabled, or after it otherwise, and that the Firmware Image is installed either way.
+ */
+static void test_ack_ordering(void)
+{
+    /** <b>Local variable sequential_time:</b> Time that receiving and programming all the ETX OTA Data Type Packets would take, one after the other. */
+    uint64_t sequential_time = 0U;
+
+    reset_transaction();
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_OK);
+    CHECK(host_phase == HOST_DONE);
+    CHECK(last_status == TEST_ACK);
+    CHECK(host_frames_acked == TEST_FRAME_COUNT);
+    CHECK(memcmp(frame_at(0U), image, TEST_IMAGE_SIZE) == 0);
+    for (uint32_t i=0; i<TEST_FRAME_COUNT; i++)
+    {
+        #if ETX_OTA_EARLY_ACK
+        /* The ETX OTA Data Type Packet is ACKed before it is programmed, which then happens while the next one is received. */
+        CHECK(!is_frame_programmed_at_ack[i]);
+        #else
+        CHECK(is_frame_programmed_at_ack[i]);
+        #endif
+        CHECK(is_prev_frame_programmed_at_ack[i]);
+        sequential_time += link_time(frame_len(i) + TEST_OVERHEAD) + FLASH_WRITER_SIM_ERASE_TIME + (frame_len(i)/2U)*FLASH_WRITER_SIM_PROGRAM_TIME;
+    }
+
+    /* Programming the ETX OTA Data Type Packets only overlaps with the reception of the next ones if they are ACKed early. */
+    printf("ETX OTA Transaction time: %lu us (receiving and programming the ETX OTA Data Type Packets one after the other takes %lu us).\n",
+            (unsigned long) flash_writer_sim_time(), (unsigned long) sequential_time);
+    #if ETX_OTA_EARLY_ACK
+    CHECK(flash_writer_sim_time() < sequential_time);
+    #else
+    CHECK(flash_writer_sim_time() > sequential_time);
+    #endif
+}
+
+/**@brief   Tests that a Flash Memory page that cannot be programmed after its ETX OTA Data Type Packet has been ACKed
+ *          is NACKed with @ref TEST_NACK_REASON_FLASH , which ends the ETX OTA Transaction with @ref ETX_OTA_EC_ERR .
+ */
+static void test_flash_fault_after_ack(void)
+{
+    /* Make the Flash Memory page of one of the ETX OTA Data Type Packets fail to be programmed, although it can still be erased ahead of time. */
+    reset_transaction();
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_PGERR, (uint32_t) (uintptr_t) frame_at(TEST_FAULT_FRAME));
+
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_ERR);
+    CHECK(host_phase == HOST_DONE);
+    CHECK(last_status == TEST_NACK);
+    CHECK(last_nack_reason == TEST_NACK_REASON_FLASH);
+    /* The offset is the one up to which the Firmware Image had been received, which is the end of the failed page whenever it was staged in RAM. */
+    CHECK((last_nack_offset >= TEST_FAULT_FRAME*TEST_FRAME_SIZE) && (last_nack_offset <= (TEST_FAULT_FRAME + 1U)*TEST_FRAME_SIZE));
+    #if ETX_OTA_EARLY_ACK
+    /* The ETX OTA Data Type Packet had already been ACKed when its page failed to be programmed. */
+    CHECK(host_frames_acked == TEST_FAULT_FRAME + 1U);
+    /* That NACK is sent right away, while the host is still sending the next ETX OTA Data Type Packet, rather than in response to it. */
+    CHECK(host_frames_sent == TEST_FAULT_FRAME + 2U);
+    CHECK(last_resp_time < host_arrival[host_queued - 1U]);
+    #else
+    CHECK(host_frames_acked == TEST_FAULT_FRAME);
+    #endif
+    CHECK(memcmp(frame_at(0U), image, TEST_FAULT_FRAME*TEST_FRAME_SIZE) == 0);
+    CHECK(flash_writer_is_blank((uint32_t) (uintptr_t) frame_at(TEST_FAULT_FRAME), TEST_FRAME_SIZE));
+}
+
+int main(void)
+{
+    /** <b>Local variable seed:</b> State of the pseudo-random generator of the Firmware Image. */
+    uint32_t seed = 0xC0FFEE;
+    /** <b>Local pointer p_flash:</b> Host memory mapped at the address of the simulated Flash Memory. */
+    void *p_flash = mmap((void *) (uintptr_t) FLASH_WRITER_SIM_BASE_ADDR, FLASH_WRITER_SIM_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p_flash != (void *) (uintptr_t) FLASH_WRITER_SIM_BASE_ADDR)
+    {
+        printf("FAIL: the simulated Flash Memory could not be mapped at 0x%08X.\n", FLASH_WRITER_SIM_BASE_ADDR);
+        return 1;
+    }
+    for (uint32_t i=0; i<sizeof(image); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        image[i] = (uint8_t) (seed >> 16);
+    }
+    printf("Early ACK: %s\n", ETX_OTA_EARLY_ACK ? "enabled" : "disabled");
+
+    test_ack_ordering();
+    test_flash_fault_after_ack();
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,759 @@
+/** @file
+ * @brief	Host test of the ETX OTA Page CRC and Seek Commands, and of the resumable ETX OTA Transactions that are
+ *          built on them, of the Custom Bootloader Firmware against its simulated Flash Memory.
+ *
+ * @details	This test runs whole ETX OTA Transactions through @ref firmware_image_download_and_install , where a
+ *          simulated host sends its ETX OTA Packets one byte at a time at @ref TEST_BAUD_RATE into an emulated
+ *          circular DMA, just like in test_bl_early_ack.c , and where the Flash Memory is the simulated one of the
+ *          @ref flash_writer . A power loss is simulated by making the host go silent in the middle of an ETX OTA
+ *          Transaction, after which the Custom Bootloader starts over with the Firmware Update Configurations that it
+ *          last wrote.
+ * @details	The test checks that the ETX OTA Page CRC Command reports the 32-bit CRCs of the installed Flash Memory
+ *          pages, and that the ETX OTA Seek Command keeps the unchanged pages in place without erasing nor programming
+ *          them, while erasing the skipped pages that are blank in the Firmware Image whenever the host requests it.
+ * @details	It also checks that a checkpoint is appended into the checkpoint log every @ref ETX_OTA_CHECKPOINT_PAGES
+ *          Flash Memory pages, that a record left half-written by a power loss is not taken as a checkpoint, that the
+ *          ETX OTA Start Command then reports the offset of the latest checkpoint so that the host continues from there
+ *          via the ETX OTA Seek Command, and that a checkpoint log without room left is folded into the Firmware Update
+ *          Configurations before being erased (see run_tests.sh ).
+ *
+ * @note	The Custom Bootloader reads the Flash Memory through pointers, so the simulated Flash Memory is mapped at
+ *          its actual address via \c FLASH_WRITER_SIM_MEMORY .
+ */
+#include "bl_side_etx_ota.h"
+#include "flash_writer.h"
+#include "etx_ota_start_resp.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h> // Library from which "memcpy()", "memset()" and "memcmp()" are located at.
+#include <sys/mman.h> // Library from which "mmap()" is located at.
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE     (0)     /**< @brief Flag of "mmap()" that is only given by the newer C libraries, without which the requested address is just a hint. */
+#endif
+
+#define TEST_BAUD_RATE          (115200U)       /**< @brief Baud rate of the simulated link, where each byte takes 10 bits. */
+#define TEST_POLL_TIME          (1U)            /**< @brief Time in microseconds that passes each time that the Custom Bootloader polls the emulated DMA or the HAL tick. */
+#define TEST_FRAME_SIZE         (1024U)         /**< @brief Size in bytes of the data of the ETX OTA Data Type Packets, which is also the size of a Flash Memory page. */
+#define TEST_IMAGE_PAGES        (5U*ETX_OTA_CHECKPOINT_PAGES)   /**< @brief Number of whole Flash Memory pages of the Firmware Image, after each @ref ETX_OTA_CHECKPOINT_PAGES of which a checkpoint is made. */
+#define TEST_IMAGE_SIZE         (TEST_IMAGE_PAGES*TEST_FRAME_SIZE + 300U)   /**< @brief Size in bytes of the Firmware Image, whose last ETX OTA Data Type Packet is shorter than the rest. */
+#define TEST_PAGE_COUNT         ((TEST_IMAGE_SIZE + TEST_FRAME_SIZE - 1U) / TEST_FRAME_SIZE)    /**< @brief Number of Flash Memory pages covered by the Firmware Image, including its last and partial one. */
+#define TEST_STREAM_MAX_SIZE    (65536U)        /**< @brief Maximum number of bytes that the simulated host can send in a single ETX OTA Transaction. */
+#define TEST_OVERHEAD           (9U)            /**< @brief Bytes of an ETX OTA Packet other than its "Data" field. */
+#define TEST_RESP_DATA_MAX_SIZE (65U)           /**< @brief Maximum "Data" field's size in bytes of the ETX OTA Response Type Packets. */
+#define TEST_NO_STOP            (0xFFFFFFFFU)   /**< @brief Value of @ref host_stop_frames with which the simulated host never goes silent. */
+#define TEST_LOG_ADDR           (FLASH_START_ADDR + ETX_OTA_CHECKPOINT_LOG_PAGE*FLASH_PAGE_SIZE_IN_BYTES)   /**< @brief Start address of the Flash Memory page of the checkpoint log. */
+#define TEST_LOG_RECORDS        (FLASH_PAGE_SIZE_IN_BYTES / sizeof(test_checkpoint_record_t))             /**< @brief Number of records that fit into the checkpoint log. */
+#define TEST_CHECKPOINT_MAX_COUNT   ((ETX_APP_FLASH_PAGES_SIZE / ETX_OTA_CHECKPOINT_PAGES) + 1U)          /**< @brief Number of records for which the checkpoint log must have room before an ETX OTA Transaction starts. */
+
+#define TEST_SOF                (0xAAU)         /**< @brief SOF byte of the ETX OTA Packets. */
+#define TEST_EOF                (0xBBU)         /**< @brief EOF byte of the ETX OTA Packets. */
+#define TEST_PACKET_TYPE_CMD    (0U)            /**< @brief Packet Type of the ETX OTA Command Type Packets. */
+#define TEST_PACKET_TYPE_DATA   (1U)            /**< @brief Packet Type of the ETX OTA Data Type Packets. */
+#define TEST_PACKET_TYPE_HEADER (2U)            /**< @brief Packet Type of the ETX OTA Header Type Packets. */
+#define TEST_PACKET_TYPE_RESP   (3U)            /**< @brief Packet Type of the ETX OTA Response Type Packets. */
+#define TEST_CMD_START          (0U)            /**< @brief ETX OTA Start Command. */
+#define TEST_CMD_END            (1U)            /**< @brief ETX OTA End Command. */
+#define TEST_CMD_PAGE_CRC       (4U)            /**< @brief ETX OTA Page CRC Command. */
+#define TEST_CMD_SEEK           (5U)            /**< @brief ETX OTA Seek Command. */
+#define TEST_PAGE_CRC_MAX_COUNT (16U)           /**< @brief Maximum number of Flash Memory pages whose 32-bit CRCs can be requested in a single ETX OTA Page CRC Command. */
+#define TEST_SEEK_FLAG_ERASE    (0x01U)         /**< @brief Flag of the ETX OTA Seek Command with which the host requests the skipped Flash Memory pages to be erased. */
+#define TEST_START_FLAG_RESUME  (0x01U)         /**< @brief Flag of the ETX OTA Start Command with which the host requests the checkpoint of the latest ETX OTA Transaction. */
+#define TEST_FEATURE_RESUME     (0x08U)         /**< @brief Bit of the features byte of the response to the ETX OTA Start Command that indicates that the checkpoint is reported. */
+#define TEST_ACK                (0U)            /**< @brief ACK Response Status. */
+#define TEST_NACK               (1U)            /**< @brief NACK Response Status. */
+#define TEST_READY              (2U)            /**< @brief READY beacon Response Status. */
+
+/**@brief	Checkpoint record of the checkpoint log, as appended by the Custom Bootloader.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t crc;           //!< 32-bit CRC of the first \c pages Flash Memory pages of the Firmware Image.
+    uint16_t pages;         //!< Number of Flash Memory pages of the Firmware Image that had been written.
+    uint16_t pages_inv;     //!< Bitwise inverse of \c pages , which is left erased whenever the record was only half-written.
+} test_checkpoint_record_t;
+
+/**@brief	Phases of the ETX OTA Transaction of the simulated host.
+ */
+typedef enum
+{
+    HOST_WAIT_READY     = 0U,   //!< Waiting for the READY beacon of the Custom Bootloader.
+    HOST_START_SENT     = 1U,   //!< The ETX OTA Start Command has been sent.
+    HOST_PAGE_CRC_SENT  = 2U,   //!< An ETX OTA Page CRC Command has been sent.
+    HOST_HEADER_SENT    = 3U,   //!< The ETX OTA Header Type Packet has been sent.
+    HOST_SEEK_SENT      = 4U,   //!< An ETX OTA Seek Command has been sent.
+    HOST_DATA_SENT      = 5U,   //!< An ETX OTA Data Type Packet has been sent.
+    HOST_END_SENT       = 6U,   //!< The ETX OTA End Command has been sent.
+    HOST_DONE           = 7U    //!< The ETX OTA Transaction has either been completed, been NACKed or been cut off.
+} Host_Phase;
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t image[TEST_IMAGE_SIZE];                      /**< @brief Firmware Image that the simulated host sends. */
+static uint8_t host_stream[TEST_STREAM_MAX_SIZE];           /**< @brief Bytes that the simulated host has sent, in order. */
+static uint64_t host_arrival[TEST_STREAM_MAX_SIZE];         /**< @brief Simulated time at which each byte of @ref host_stream has been fully received by the UART. */
+static uint32_t host_queued = 0U;                           /**< @brief Number of bytes of @ref host_stream that the simulated host has sent. */
+static uint32_t host_delivered = 0U;                        /**< @brief Number of bytes of @ref host_stream that have already been handed to the emulated DMA. */
+static Host_Phase host_phase = HOST_WAIT_READY;             /**< @brief Phase of the ETX OTA Transaction of the simulated host. */
+static uint32_t host_offset = 0U;                           /**< @brief Offset of the Firmware Image from which the simulated host sends its next ETX OTA Data Type Packet. */
+static uint32_t host_frames_sent = 0U;                      /**< @brief Number of ETX OTA Data Type Packets that the simulated host has sent. */
+static uint32_t host_stop_frames = TEST_NO_STOP;            /**< @brief Number of ETX OTA Data Type Packets after which the simulated host goes silent, as if our MCU/MPU had lost its power. */
+static uint32_t host_run_end = 0U;                          /**< @brief Offset of the Firmware Image at which the run of ETX OTA Data Type Packets that the simulated host is currently sending ends. */
+static bool is_host_resuming = false;                       /**< @brief Whether the simulated host continues from the resume offset reported in the response to its ETX OTA Start Command. */
+static bool is_host_delta = false;                          /**< @brief Whether the simulated host only sends the Flash Memory pages whose 32-bit CRCs differ from the ones reported via the ETX OTA Page CRC Command, skipping the rest via the ETX OTA Seek Command. */
+static uint16_t host_crc_pages = 0U;                        /**< @brief Number of Flash Memory pages whose 32-bit CRCs have been reported to the simulated host. */
+static uint32_t host_page_crcs[TEST_PAGE_COUNT];            /**< @brief 32-bit CRCs of the Flash Memory pages covered by the Firmware Image, as reported via the ETX OTA Page CRC Command. */
+static uint8_t last_resp[TEST_RESP_DATA_MAX_SIZE];          /**< @brief Bytes that follow the Response Status of the latest ETX OTA Response Type Packet. */
+static uint16_t last_resp_len = 0U;                         /**< @brief Number of valid bytes in @ref last_resp . */
+static etx_ota_start_resp_t start_resp;                     /**< @brief Bytes that follow the Response Status of the response to the ETX OTA Start Command. */
+static uint16_t start_resp_len = 0U;                        /**< @brief Number of valid bytes in @ref start_resp . */
+static uint8_t last_status = 0xFFU;                         /**< @brief Response Status of the latest ETX OTA Response Type Packet. */
+static uint8_t *p_dma_buffer = NULL;                        /**< @brief Circular buffer of the emulated DMA. */
+static uint16_t dma_size = 0U;                              /**< @brief Size in bytes of @ref p_dma_buffer . */
+static uint16_t dma_pos = 0U;                               /**< @brief Index of @ref p_dma_buffer into which the emulated DMA writes the next byte. */
+static bool is_dma_running = false;                         /**< @brief Whether the emulated DMA is currently receiving. */
+static DMA_HandleTypeDef hdma_rx;                           /**< @brief Handle of the emulated DMA. */
+static USART_TypeDef usart_emulated;                        /**< @brief Emulated UART peripheral. */
+static UART_HandleTypeDef huart = {&usart_emulated, {TEST_BAUD_RATE}, &hdma_rx};   /**< @brief Handle of the emulated UART. */
+static firmware_update_config_data_t fw_config;             /**< @brief Firmware Update Configurations given to the Custom Bootloader. */
+static firmware_update_config_data_t stored_fw_config;      /**< @brief Firmware Update Configurations as last written by the Custom Bootloader, which are the ones that survive a power loss. */
+USART_TypeDef *USART1 = NULL;                               /**< @brief USART1 peripheral, which is not the emulated one. */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the simulated time that a number of bytes take in the simulated link.
+ */
+static uint64_t link_time(uint32_t bytes)
+{
+    return ((uint64_t) bytes * 10U * 1000000U) / TEST_BAUD_RATE;
+}
+
+/**@brief   Gets the records of the checkpoint log, as they are in the simulated Flash Memory.
+ */
+static test_checkpoint_record_t *checkpoint_log(void)
+{
+    return (test_checkpoint_record_t *) (uintptr_t) TEST_LOG_ADDR;
+}
+
+/**@brief   Gets the size in bytes of the ETX OTA Data Type Packet that starts at a given offset of the Firmware Image.
+ */
+static uint16_t frame_len(uint32_t offset)
+{
+    return ((TEST_IMAGE_SIZE - offset) > TEST_FRAME_SIZE) ? TEST_FRAME_SIZE : (TEST_IMAGE_SIZE - offset);
+}
+
+/**@brief   Gets whether a Flash Memory page of the Firmware Image is blank (i.e., all its bytes are \c 0xFF ).
+ */
+static bool is_image_page_blank(uint32_t page)
+{
+    for (uint32_t i=page*TEST_FRAME_SIZE; i<(page*TEST_FRAME_SIZE + frame_len(page*TEST_FRAME_SIZE)); i++)
+    {
+        if (image[i] != 0xFFU)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**@brief   Gets whether a Flash Memory page of the Firmware Image differs from the one whose 32-bit CRC was reported to
+ *          the simulated host, where the bytes of its last page beyond the end of the Firmware Image are taken as
+ *          erased ones.
+ */
+static bool is_image_page_changed(uint32_t page)
+{
+    /** <b>Local variable padded_page:</b> Flash Memory page of the Firmware Image, padded with \c 0xFF bytes. */
+    uint8_t padded_page[TEST_FRAME_SIZE];
+
+    memset(padded_page, 0xFF, sizeof(padded_page));
+    memcpy(padded_page, &image[page*TEST_FRAME_SIZE], frame_len(page*TEST_FRAME_SIZE));
+    return crc32_mpeg2(padded_page, sizeof(padded_page)) != host_page_crcs[page];
+}
+
+/**@brief   Hands the bytes that have been received by the UART so far to the emulated DMA, which loses them if it
+ *          is not receiving.
+ */
+static void dma_run(void)
+{
+    while ((host_delivered < host_queued) && (host_arrival[host_delivered] <= flash_writer_sim_time()))
+    {
+        if (is_dma_running)
+        {
+            p_dma_buffer[dma_pos++] = host_stream[host_delivered];
+            if (dma_pos == dma_size)
+            {
+                dma_pos = 0U;
+                if (hdma_rx.XferCpltCallback != NULL)
+                {
+                    hdma_rx.XferCpltCallback(&hdma_rx);
+                }
+            }
+        }
+        host_delivered++;
+    }
+}
+
+/**@brief   Sends an ETX OTA Packet from the simulated host, right after any bytes that it is still sending.
+ */
+static void host_send_packet(uint8_t packet_type, const uint8_t *p_data, uint16_t data_len)
+{
+    /** <b>Local variable packet:</b> Whole ETX OTA Packet to be sent. */
+    uint8_t packet[TEST_FRAME_SIZE + TEST_OVERHEAD];
+    /** <b>Local variable crc:</b> 32-bit CRC of the "Data" field of the ETX OTA Packet. */
+    uint32_t crc = crc32_mpeg2((uint8_t *) p_data, data_len);
+    /** <b>Local variable start:</b> Simulated time at which the first bit of the ETX OTA Packet is sent. */
+    uint64_t start = flash_writer_sim_time();
+
+    packet[0] = TEST_SOF;
+    packet[1] = packet_type;
+    memcpy(&packet[2], &data_len, sizeof(data_len));
+    memcpy(&packet[4], p_data, data_len);
+    memcpy(&packet[4 + data_len], &crc, sizeof(crc));
+    packet[8 + data_len] = TEST_EOF;
+
+    if ((host_queued > 0U) && (host_arrival[host_queued - 1U] > start))
+    {
+        start = host_arrival[host_queued - 1U];
+    }
+    for (uint32_t i=0; i<(data_len + TEST_OVERHEAD); i++)
+    {
+        host_stream[host_queued] = packet[i];
+        host_arrival[host_queued++] = start + link_time(i + 1U);
+    }
+}
+
+/**@brief   Sends the ETX OTA Header of the Firmware Image from the simulated host.
+ */
+static void host_send_header(void)
+{
+    /** <b>Local variable header:</b> ETX OTA Header of the Firmware Image, whose frame size is the one of its ETX OTA Data Type Packets. */
+    uint8_t header[16] = {0};
+    /** <b>Local variable value:</b> Value of a field of the ETX OTA Header. */
+    uint32_t value;
+
+    value = TEST_IMAGE_SIZE;
+    memcpy(&header[0], &value, sizeof(value));
+    value = crc32_mpeg2(image, TEST_IMAGE_SIZE);
+    memcpy(&header[4], &value, sizeof(value));
+    header[12] = (uint8_t) TEST_FRAME_SIZE;
+    header[13] = (uint8_t) (TEST_FRAME_SIZE >> 8);
+    host_send_packet(TEST_PACKET_TYPE_HEADER, header, sizeof(header));
+    host_phase = HOST_HEADER_SENT;
+}
+
+/**@brief   Requests the 32-bit CRCs of the next Flash Memory pages covered by the Firmware Image from the simulated
+ *          host.
+ */
+static void host_send_page_crc_cmd(void)
+{
+    /** <b>Local variable page_crc_cmd:</b> ETX OTA Page CRC Command. */
+    uint8_t page_crc_cmd[4] = {TEST_CMD_PAGE_CRC};
+
+    memcpy(&page_crc_cmd[1], &host_crc_pages, sizeof(host_crc_pages));
+    page_crc_cmd[3] = ((TEST_PAGE_COUNT - host_crc_pages) > TEST_PAGE_CRC_MAX_COUNT) ? TEST_PAGE_CRC_MAX_COUNT : (TEST_PAGE_COUNT - host_crc_pages);
+    host_send_packet(TEST_PACKET_TYPE_CMD, page_crc_cmd, sizeof(page_crc_cmd));
+    host_phase = HOST_PAGE_CRC_SENT;
+}
+
+/**@brief   Makes the simulated host continue from a given offset of the Firmware Image with a run of a given length.
+ *
+ * @param is_erase  Whether the skipped Flash Memory pages are to be erased, or otherwise kept in place.
+ */
+static void host_send_seek_cmd(uint32_t offset, uint32_t run_len, bool is_erase)
+{
+    /** <b>Local variable seek_cmd:</b> ETX OTA Seek Command, followed by its flags byte. */
+    uint8_t seek_cmd[10] = {TEST_CMD_SEEK};
+
+    memcpy(&seek_cmd[1], &offset, sizeof(offset));
+    memcpy(&seek_cmd[5], &run_len, sizeof(run_len));
+    seek_cmd[9] = TEST_SEEK_FLAG_ERASE;
+    host_send_packet(TEST_PACKET_TYPE_CMD, seek_cmd, is_erase ? 10U : 9U);
+    host_offset = offset;
+    host_run_end = offset + run_len;
+    host_phase = HOST_SEEK_SENT;
+}
+
+/**@brief   Makes the simulated host skip the Flash Memory pages that are either unchanged or, with their erasure
+ *          requested, blank in the Firmware Image, and then announce the run of changed pages that follows them, just
+ *          like the PcTool does.
+ */
+static void host_send_next_run(void)
+{
+    /** <b>Local variable page:</b> Flash Memory page of the Firmware Image that is currently being looked at. */
+    uint32_t page = host_offset / TEST_FRAME_SIZE;
+    /** <b>Local variable is_erase:</b> Whether the pages to be skipped are blank ones that are to be erased, or otherwise unchanged ones. */
+    bool is_erase = is_image_page_blank(page);
+    /** <b>Local variable run_start:</b> Offset of the Firmware Image at which the next run of changed pages starts. */
+    uint32_t run_start;
+
+    while ((page < TEST_PAGE_COUNT) && (is_image_page_blank(page) == is_erase) && (is_erase || !is_image_page_changed(page)))
+    {
+        page++;
+    }
+    run_start = (page < TEST_PAGE_COUNT) ? (page*TEST_FRAME_SIZE) : TEST_IMAGE_SIZE;
+    while ((page < TEST_PAGE_COUNT) && !is_image_page_blank(page) && is_image_page_changed(page))
+    {
+        page++;
+    }
+    host_send_seek_cmd(run_start, ((page < TEST_PAGE_COUNT) ? (page*TEST_FRAME_SIZE) : TEST_IMAGE_SIZE) - run_start, is_erase);
+}
+
+/**@brief   Sends the next ETX OTA Data Type Packet of the Firmware Image from the simulated host, or the next ETX OTA
+ *          Seek Command once its current run has been sent, or the ETX OTA End Command once the whole Firmware Image
+ *          has been sent, unless the simulated host has to go silent first.
+ */
+static void host_send_next(void)
+{
+    /** <b>Local variable end_cmd:</b> ETX OTA End Command. */
+    const uint8_t end_cmd[1] = {TEST_CMD_END};
+
+    if (host_frames_sent == host_stop_frames)
+    {
+        host_phase = HOST_DONE;
+    }
+    else if ((host_offset < TEST_IMAGE_SIZE) && (host_offset >= host_run_end))
+    {
+        host_send_next_run();
+    }
+    else if (host_offset < TEST_IMAGE_SIZE)
+    {
+        host_send_packet(TEST_PACKET_TYPE_DATA, &image[host_offset], frame_len(host_offset));
+        host_offset += frame_len(host_offset);
+        host_frames_sent++;
+        host_phase = HOST_DATA_SENT;
+    }
+    else
+    {
+        host_send_packet(TEST_PACKET_TYPE_CMD, end_cmd, sizeof(end_cmd));
+        host_phase = HOST_END_SENT;
+    }
+}
+
+/**@brief   Makes the simulated host react to an ETX OTA Response Type Packet of the Custom Bootloader.
+ */
+static void host_on_response(uint8_t status)
+{
+    /** <b>Local variable start_cmd:</b> ETX OTA Start Command, which requests a window of 1 and the checkpoint of the latest ETX OTA Transaction. */
+    const uint8_t start_cmd[3] = {TEST_CMD_START, 1U, TEST_START_FLAG_RESUME};
+    /** <b>Local variable value:</b> Value of a field of the latest ETX OTA Response Type Packet. */
+    uint32_t value;
+
+    if (status == TEST_NACK)
+    {
+        host_phase = HOST_DONE;
+        return;
+    }
+    switch (host_phase)
+    {
+        case HOST_WAIT_READY:
+            CHECK(status == TEST_READY);
+            host_send_packet(TEST_PACKET_TYPE_CMD, start_cmd, sizeof(start_cmd));
+            host_phase = HOST_START_SENT;
+            break;
+        case HOST_START_SENT:
+            if (is_host_delta)
+            {
+                host_send_page_crc_cmd();
+            }
+            else
+            {
+                host_send_header();
+            }
+            break;
+        case HOST_PAGE_CRC_SENT:
+            /* Keep the reported 32-bit CRCs, and then request the next ones until all the pages of the Firmware Image are covered. */
+            value = ((TEST_PAGE_COUNT - host_crc_pages) > TEST_PAGE_CRC_MAX_COUNT) ? TEST_PAGE_CRC_MAX_COUNT : (TEST_PAGE_COUNT - host_crc_pages);
+            CHECK(last_resp_len == 4U*value);
+            if (last_resp_len != 4U*value)
+            {
+                host_phase = HOST_DONE;
+                break;
+            }
+            memcpy(&host_page_crcs[host_crc_pages], last_resp, last_resp_len);
+            host_crc_pages += value;
+            if (host_crc_pages < TEST_PAGE_COUNT)
+            {
+                host_send_page_crc_cmd();
+            }
+            else
+            {
+                host_send_header();
+            }
+            break;
+        case HOST_HEADER_SENT:
+            /* Continue from the resume offset, as long as the checkpoint is the one of this same Firmware Image. */
+            host_run_end = is_host_delta ? 0U : TEST_IMAGE_SIZE;
+            if (is_host_resuming && (start_resp_len >= ETX_OTA_START_RESP_LEN(checkpoint_offset)))
+            {
+                value = start_resp.checkpoint_offset;
+                if (value > 0U)
+                {
+                    host_send_seek_cmd(value, TEST_IMAGE_SIZE - value, false);
+                    break;
+                }
+            }
+            host_send_next();
+            break;
+        case HOST_SEEK_SENT:
+        case HOST_DATA_SENT:
+            host_send_next();
+            break;
+        case HOST_END_SENT:
+        default:
+            host_phase = HOST_DONE;
+            break;
+    }
+}
+
+uint32_t stub_dma_get_counter(DMA_HandleTypeDef *hdma)
+{
+    (void) hdma;
+    flash_writer_sim_advance_time(TEST_POLL_TIME);
+    dma_run();
+    return dma_size - dma_pos;
+}
+
+bool stub_uart_get_flag(UART_HandleTypeDef *p_huart, uint32_t flag)
+{
+    (void) p_huart;
+    dma_run();
+    if (flag == UART_FLAG_IDLE)
+    {
+        return (host_delivered == host_queued) && ((host_queued == 0U) || (flash_writer_sim_time() >= (host_arrival[host_queued - 1U] + link_time(1U))));
+    }
+    return false;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    flash_writer_sim_advance_time(TEST_POLL_TIME);
+    return (uint32_t) (flash_writer_sim_time() / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    flash_writer_sim_advance_time(Delay * 1000U);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    (void) GPIOx;
+    (void) GPIO_Pin;
+    return GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *p_huart)
+{
+    (void) p_huart;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *p_huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    /** <b>Local variable data_len:</b> "Data Length" field of the ETX OTA Response Type Packet. */
+    uint16_t data_len;
+    /** <b>Local variable crc:</b> 32-bit CRC of the ETX OTA Response Type Packet. */
+    uint32_t crc;
+
+    (void) p_huart;
+    (void) Timeout;
+    flash_writer_sim_advance_time((uint32_t) link_time(Size));
+
+    /* Validate the ETX OTA Response Type Packet and let the simulated host react to it. */
+    memcpy(&data_len, &pData[2], sizeof(data_len));
+    memcpy(&crc, &pData[4 + data_len], sizeof(crc));
+    CHECK((pData[0] == TEST_SOF) && (pData[1] == TEST_PACKET_TYPE_RESP) && (Size == data_len + TEST_OVERHEAD));
+    CHECK(crc == crc32_mpeg2((uint8_t *) &pData[4], data_len));
+    last_status = pData[4];
+    last_resp_len = ((data_len > 0U) && (data_len <= sizeof(last_resp))) ? (data_len - 1U) : 0U;
+    memcpy(last_resp, &pData[5], last_resp_len);
+    if (host_phase == HOST_START_SENT)
+    {
+        start_resp_len = (last_resp_len <= sizeof(start_resp)) ? last_resp_len : sizeof(start_resp);
+        memcpy(&start_resp, last_resp, start_resp_len);
+    }
+    host_on_response(last_status);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *p_huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) p_huart;
+    (void) pData;
+    (void) Size;
+    HAL_Delay(Timeout);
+    return HAL_TIMEOUT;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *p_huart, uint8_t *pData, uint16_t Size)
+{
+    (void) p_huart;
+    dma_run();
+    p_dma_buffer = pData;
+    dma_size = Size;
+    dma_pos = 0U;
+    hdma_rx.XferCpltCallback = NULL;
+    is_dma_running = true;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *p_huart)
+{
+    (void) p_huart;
+    dma_run();
+    is_dma_running = false;
+    return HAL_OK;
+}
+
+FirmUpdConf_Status firmware_update_configurations_write(firmware_update_config_data_t *p_data)
+{
+    memcpy(&stored_fw_config, p_data, sizeof(stored_fw_config));
+    return FIRM_UPDT_CONF_EC_OK;
+}
+
+/**@brief   Resets the simulated Flash Memory, leaving a previous Firmware Image in it and no Firmware Update
+ *          Configurations, as if our MCU/MPU had never received an ETX OTA Transaction.
+ */
+static void reset_flash(void)
+{
+    flash_writer_sim_reset();
+    memset((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, 0x00, TEST_IMAGE_SIZE);
+    memset(&stored_fw_config, 0xFF, sizeof(stored_fw_config));
+}
+
+/**@brief   Starts over the simulated host and link, and initializes the ETX OTA Protocol module with the Firmware
+ *          Update Configurations that were last written, as our MCU/MPU does whenever it is powered on.
+ *
+ * @param stop_frames   Number of ETX OTA Data Type Packets after which the simulated host goes silent, or
+ *                      @ref TEST_NO_STOP to send the whole Firmware Image.
+ */
+static void power_on(uint32_t stop_frames)
+{
+    host_queued = 0U;
+    host_delivered = 0U;
+    host_phase = HOST_WAIT_READY;
+    host_offset = 0U;
+    host_frames_sent = 0U;
+    host_stop_frames = stop_frames;
+    host_run_end = 0U;
+    is_host_resuming = true;
+    is_host_delta = false;
+    host_crc_pages = 0U;
+    start_resp_len = 0U;
+    last_status = 0xFFU;
+    memcpy(&fw_config, &stored_fw_config, sizeof(fw_config));
+    CHECK(init_firmware_update_module(ETX_OTA_hw_Protocol_UART, &huart, &fw_config, NULL) == ETX_OTA_EC_OK);
+}
+
+/**@brief   Checks that the response to the ETX OTA Start Command reported the checkpoint of the Firmware Image under
+ *          test along with a given resume offset.
+ */
+static void check_resume_offset(uint32_t expected_offset)
+{
+    CHECK(start_resp_len >= ETX_OTA_START_RESP_LEN(checkpoint_offset));
+    CHECK((start_resp.features & TEST_FEATURE_RESUME) != 0U);
+    if (start_resp_len >= ETX_OTA_START_RESP_LEN(checkpoint_offset))
+    {
+        CHECK(start_resp.checkpoint_offset == expected_offset);
+    }
+}
+
+/**@brief   Checks that a record of the checkpoint log holds the checkpoint of a given number of Flash Memory pages of
+ *          the Firmware Image under test.
+ */
+static void check_record(uint16_t index, uint16_t pages)
+{
+    /** <b>Local pointer p_record:</b> Points to the record under test. */
+    const test_checkpoint_record_t *p_record = &checkpoint_log()[index];
+
+    CHECK(p_record->pages == pages);
+    CHECK((p_record->pages_inv ^ pages) == 0xFFFFU);
+    CHECK(p_record->crc == crc32_mpeg2(image, (uint32_t) pages * TEST_FRAME_SIZE));
+}
+
+/**@brief   Tests that the checkpoints appended before a power loss let the next ETX OTA Transaction of the same
+ *          Firmware Image continue from the latest one, even if a record was left half-written by that power loss.
+ */
+static void test_resume_after_power_loss(void)
+{
+    /** <b>Local variable stop_frames:</b> Number of ETX OTA Data Type Packets received before the power loss, which leaves two checkpoints and a staged page behind. */
+    const uint32_t stop_frames = 2U*ETX_OTA_CHECKPOINT_PAGES + 5U;
+    /** <b>Local variable torn_record:</b> Record that was being appended when the power was lost, whose last half-word was never programmed. */
+    test_checkpoint_record_t torn_record;
+
+    /* A first ETX OTA Transaction of the Firmware Image, which is cut off by a power loss. */
+    reset_flash();
+    power_on(stop_frames);
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_NR);
+    CHECK(host_frames_sent == stop_frames);
+    check_resume_offset(0U);
+    check_record(0U, ETX_OTA_CHECKPOINT_PAGES);
+    check_record(1U, 2U*ETX_OTA_CHECKPOINT_PAGES);
+    CHECK(flash_writer_is_blank((uint32_t) (uintptr_t) &checkpoint_log()[2], (TEST_LOG_RECORDS - 2U)*sizeof(test_checkpoint_record_t)));
+    CHECK(stored_fw_config.App_fw_size == TEST_IMAGE_SIZE);
+    CHECK(stored_fw_config.App_fw_resume_pages == 0U);
+
+    /* Leave the record of the next checkpoint half-written, as if the power had been lost while appending it. */
+    torn_record.crc = crc32_mpeg2(image, 3U*ETX_OTA_CHECKPOINT_PAGES*TEST_FRAME_SIZE);
+    torn_record.pages = 3U*ETX_OTA_CHECKPOINT_PAGES;
+    torn_record.pages_inv = 0xFFFFU;
+    memcpy(&checkpoint_log()[2], &torn_record, sizeof(torn_record));
+
+    /* The next ETX OTA Transaction continues from the latest whole checkpoint, skipping the half-written record. */
+    power_on(TEST_NO_STOP);
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_OK);
+    CHECK(host_phase == HOST_DONE);
+    CHECK(last_status == TEST_ACK);
+    check_resume_offset(2U*ETX_OTA_CHECKPOINT_PAGES*TEST_FRAME_SIZE);
+    CHECK(host_frames_sent == ((TEST_IMAGE_SIZE - 2U*ETX_OTA_CHECKPOINT_PAGES*TEST_FRAME_SIZE + TEST_FRAME_SIZE - 1U) / TEST_FRAME_SIZE));
+    CHECK(memcmp((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, image, TEST_IMAGE_SIZE) == 0);
+
+    /* The new checkpoints are appended after the half-written record, since the log still has room for them. */
+    check_record(1U, 2U*ETX_OTA_CHECKPOINT_PAGES);
+    CHECK(memcmp(&checkpoint_log()[2], &torn_record, sizeof(torn_record)) == 0);
+    for (uint16_t i=3U; i<=TEST_IMAGE_PAGES/ETX_OTA_CHECKPOINT_PAGES; i++)
+    {
+        check_record(i, i*ETX_OTA_CHECKPOINT_PAGES);
+    }
+    CHECK(flash_writer_is_blank((uint32_t) (uintptr_t) &checkpoint_log()[TEST_IMAGE_PAGES/ETX_OTA_CHECKPOINT_PAGES + 1U],
+            (TEST_LOG_RECORDS - TEST_IMAGE_PAGES/ETX_OTA_CHECKPOINT_PAGES - 1U)*sizeof(test_checkpoint_record_t)));
+
+    /* A checkpoint whose Flash Memory pages no longer match their 32-bit CRC is not resumed. */
+    *(uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + TEST_FRAME_SIZE) ^= 0x01U;
+    power_on(0U);
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_NR);
+    check_resume_offset(0U);
+}
+
+/**@brief   Tests that a checkpoint log without room left for the checkpoints of a whole Firmware Image has its latest
+ *          record folded into the Firmware Update Configurations before being erased, so that it is still resumed
+ *          after a power loss.
+ */
+static void test_checkpoint_log_fold(void)
+{
+    /** <b>Local variable records:</b> Number of records in the checkpoint log, which leaves room for one less checkpoint than the ones of a whole Firmware Image. */
+    const uint16_t records = TEST_LOG_RECORDS - TEST_CHECKPOINT_MAX_COUNT + 1U;
+    /** <b>Local variable fold_pages:</b> Number of Flash Memory pages of the latest record of the checkpoint log. */
+    const uint16_t fold_pages = 3U*ETX_OTA_CHECKPOINT_PAGES;
+    /** <b>Local variable record:</b> Record appended into the checkpoint log. */
+    test_checkpoint_record_t record;
+
+    /* Leave the log as earlier interrupted ETX OTA Transactions of the Firmware Image would have, whose latest record is the only valid one. */
+    reset_flash();
+    memcpy((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, image, (uint32_t) fold_pages * TEST_FRAME_SIZE);
+    stored_fw_config.App_fw_size = TEST_IMAGE_SIZE;
+    stored_fw_config.App_fw_rec_crc = crc32_mpeg2(image, TEST_IMAGE_SIZE);
+    stored_fw_config.App_fw_resume_pages = 0U;
+    stored_fw_config.App_fw_resume_crc = 0U;
+    stored_fw_config.is_bl_fw_stored_in_app_fw = BT_FW_NOT_STORED_IN_APP_FW;
+    stored_fw_config.is_bl_fw_install_pending = NOT_PENDING;
+    for (uint16_t i=0; i<records; i++)
+    {
+        record.pages = ((i + 1U) == records) ? fold_pages : ETX_OTA_CHECKPOINT_PAGES;
+        record.pages_inv = ((i + 1U) == records) ? (uint16_t) ~fold_pages : 0x0000U;
+        record.crc = crc32_mpeg2(image, (uint32_t) record.pages * TEST_FRAME_SIZE);
+        memcpy(&checkpoint_log()[i], &record, sizeof(record));
+    }
+
+    /* The ETX OTA Header folds the latest record and erases the log, and then the power is lost before the next checkpoint. */
+    power_on(2U);
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_NR);
+    check_resume_offset((uint32_t) fold_pages * TEST_FRAME_SIZE);
+    CHECK(stored_fw_config.App_fw_resume_pages == fold_pages);
+    CHECK(stored_fw_config.App_fw_resume_crc == crc32_mpeg2(image, (uint32_t) fold_pages * TEST_FRAME_SIZE));
+    CHECK(flash_writer_is_blank(TEST_LOG_ADDR, FLASH_PAGE_SIZE_IN_BYTES));
+
+    /* The checkpoint is then taken from the Firmware Update Configurations, and the new ones are appended from the start of the log. */
+    power_on(TEST_NO_STOP);
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_OK);
+    CHECK(last_status == TEST_ACK);
+    check_resume_offset((uint32_t) fold_pages * TEST_FRAME_SIZE);
+    CHECK(memcmp((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, image, TEST_IMAGE_SIZE) == 0);
+    for (uint16_t i=0; i<((TEST_IMAGE_PAGES - fold_pages) / ETX_OTA_CHECKPOINT_PAGES); i++)
+    {
+        check_record(i, fold_pages + (i + 1U)*ETX_OTA_CHECKPOINT_PAGES);
+    }
+}
+
+/**@brief   Tests that the ETX OTA Page CRC Command reports the 32-bit CRCs of the installed Flash Memory pages, and that
+ *          the ETX OTA Seek Command keeps the unchanged ones in place while erasing the skipped ones that are blank in
+ *          the Firmware Image.
+ */
+static void test_page_crc_and_seek(void)
+{
+    /** <b>Local variable changed_pages:</b> Flash Memory pages of the installed Firmware Image that differ from the ones of the Firmware Image under test, which include its last and partial page. */
+    const uint32_t changed_pages[] = {3U, 17U, 18U, TEST_PAGE_COUNT - 1U};
+    /** <b>Local variable blank_page:</b> First of the two Flash Memory pages that are blank in the Firmware Image under test, but not in the installed one. */
+    const uint32_t blank_page = 24U;
+    /** <b>Local variable unchanged_page:</b> Flash Memory page that is unchanged and that therefore fails to be erased or programmed if our MCU/MPU attempts to. */
+    const uint32_t unchanged_page = 10U;
+    /** <b>Local variable expected_crcs:</b> 32-bit CRCs of the installed Flash Memory pages. */
+    uint32_t expected_crcs[TEST_PAGE_COUNT];
+    /** <b>Local variable saved_pages:</b> Pages of the Firmware Image under test that are made blank during this test. */
+    static uint8_t saved_pages[2U*TEST_FRAME_SIZE];
+
+    /* Install a previous version of the Firmware Image, and blank two of the pages of the Firmware Image under test. */
+    reset_flash();
+    memcpy((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, image, TEST_IMAGE_SIZE);
+    for (uint32_t i=0; i<(sizeof(changed_pages) / sizeof(changed_pages[0])); i++)
+    {
+        *(uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + changed_pages[i]*TEST_FRAME_SIZE + 7U) ^= 0x5AU;
+    }
+    memcpy(saved_pages, &image[blank_page*TEST_FRAME_SIZE], sizeof(saved_pages));
+    memset(&image[blank_page*TEST_FRAME_SIZE], 0xFF, sizeof(saved_pages));
+    for (uint32_t i=0; i<TEST_PAGE_COUNT; i++)
+    {
+        expected_crcs[i] = crc32_mpeg2((uint8_t *) (uintptr_t) (ETX_APP_FLASH_ADDR + i*TEST_FRAME_SIZE), TEST_FRAME_SIZE);
+    }
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_WRPRTERR, ETX_APP_FLASH_ADDR + unchanged_page*TEST_FRAME_SIZE);
+
+    /* The host only sends the changed pages, and skips the rest. */
+    power_on(TEST_NO_STOP);
+    is_host_resuming = false;
+    is_host_delta = true;
+    CHECK(firmware_image_download_and_install() == ETX_OTA_EC_OK);
+    CHECK(host_phase == HOST_DONE);
+    CHECK(last_status == TEST_ACK);
+    CHECK(host_crc_pages == TEST_PAGE_COUNT);
+    CHECK(memcmp(host_page_crcs, expected_crcs, sizeof(expected_crcs)) == 0);
+    CHECK(host_frames_sent == (sizeof(changed_pages) / sizeof(changed_pages[0])));
+    CHECK(memcmp((uint8_t *) (uintptr_t) ETX_APP_FLASH_ADDR, image, TEST_IMAGE_SIZE) == 0);
+    CHECK(flash_writer_is_blank(ETX_APP_FLASH_ADDR + blank_page*TEST_FRAME_SIZE, sizeof(saved_pages)));
+
+    memcpy(&image[blank_page*TEST_FRAME_SIZE], saved_pages, sizeof(saved_pages));
+}
+
+int main(void)
+{
+    /** <b>Local variable seed:</b> State of the pseudo-random generator of the Firmware Image. */
+    uint32_t seed = 0xC0FFEE;
+    /** <b>Local pointer p_flash:</b> Host memory mapped at the address of the simulated Flash Memory. */
+    void *p_flash = mmap((void *) (uintptr_t) FLASH_WRITER_SIM_BASE_ADDR, FLASH_WRITER_SIM_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p_flash != (void *) (uintptr_t) FLASH_WRITER_SIM_BASE_ADDR)
+    {
+        printf("FAIL: the simulated Flash Memory could not be mapped at 0x%08X.\n", FLASH_WRITER_SIM_BASE_ADDR);
+        return 1;
+    }
+    for (uint32_t i=0; i<sizeof(image); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        image[i] = (uint8_t) (seed >> 16);
+    }
+
+    test_page_crc_and_seek();
+    test_resume_after_power_loss();
+    test_checkpoint_log_fold();
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+/** @file
+ * @brief	Host round-trip test of the Binary Patch Generator of the PcTool and of the Binary Patch Applier of the
+ *          Custom Bootloader Firmware.
+ *
+ * @details	This test generates binary patches with @ref bsdiff_create and applies them with @ref bspatch_feed over an
+ *          emulated Flash Memory that initially holds the old Firmware Image, which is overwritten page by page just as
+ *          the Custom Bootloader does it. Therefore, the old bytes are read from the emulated Flash Memory if their page
+ *          has not been overwritten yet, or otherwise from a copy of the last overwritten pages, and any read from an
+ *          older page is recorded as a failure of the in-place guarantee of the patch generator.
+ * @details	The new Firmware Images have code that was moved both forwards and backwards (i.e., overlapping in-place
+ *          copies), approximate matches, bytes that are sent literally and a different size than the old one. The
+ *          test also checks that a binary patch applied over a different old Firmware Image is rejected with
+ *          @ref BSPATCH_EC_NA , that a malformed binary patch is rejected with @ref BSPATCH_EC_ERR and that a corrupted
+ *          Diff or Extra byte is caught by the 32-bit CRC of the rebuilt Firmware Image (see run_tests.sh ).
+ */
+#include "bsdiff.h"
+#include "bspatch.h"
+#include "crc32_mpeg2.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <stdlib.h> // Library from which "free()" is located at.
+#include <string.h> // Library from which "memcpy()", "memset()" and "memcmp()" are located at.
+
+#define TEST_PAGE_SIZE          (1024U)     /**< @brief Flash Memory page size in bytes with which the binary patches are generated and applied. */
+#define TEST_FLASH_PAGES        (16U)       /**< @brief Number of pages of the emulated Flash Memory. */
+#define TEST_FLASH_SIZE         (TEST_FLASH_PAGES*TEST_PAGE_SIZE)   /**< @brief Size in bytes of the emulated Flash Memory. */
+#define TEST_MAX_BACKLOG_PAGES  (2U)        /**< @brief Maximum number of overwritten old pages that are kept in @ref backlog . */
+#define TEST_OLD_SIZE           (10U*TEST_PAGE_SIZE + 300U)     /**< @brief Size in bytes of the old Firmware Image. */
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t old_image[TEST_FLASH_SIZE];                  /**< @brief Old Firmware Image from which the binary patches are generated. */
+static uint8_t new_image[TEST_FLASH_SIZE];                  /**< @brief New Firmware Image that the binary patches rebuild. */
+static uint32_t new_size = 0U;                              /**< @brief Size in bytes of @ref new_image . */
+static uint8_t flash[TEST_FLASH_SIZE];                      /**< @brief Emulated Flash Memory, over which the new Firmware Image is rebuilt in place. */
+static uint8_t backlog[TEST_MAX_BACKLOG_PAGES][TEST_PAGE_SIZE]; /**< @brief Copy of the last overwritten old pages, where the page number \c p is held at the index <tt>p % backlog_pages</tt> . */
+static uint8_t backlog_pages = 0U;                          /**< @brief Number of backlog pages given in the header of the binary patch being applied. */
+static uint8_t stage[TEST_PAGE_SIZE];                       /**< @brief Bytes of the new Firmware Image that are staged until a whole page can be written. */
+static uint32_t stage_len = 0U;                             /**< @brief Number of valid bytes in @ref stage . */
+static uint32_t staged_page = 0U;                           /**< @brief Number of the page that is being staged, which is the first one that has not been overwritten yet. */
+static uint32_t expected_old_crc = 0U;                      /**< @brief 32-bit CRC of the Firmware Image that is installed in the emulated Flash Memory. */
+static bool is_overwritten_page_read = false;               /**< @brief Whether the binary patch has read from an old page that had already been overwritten and was no longer in @ref backlog . */
+static uint32_t seed = 1U;                                  /**< @brief State of the pseudo-random generator of @ref test_rand . */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the next value of a linear congruential pseudo-random generator, so that every run is the same.
+ */
+static uint32_t test_rand(void)
+{
+    seed = seed*1103515245U + 12345U;
+    return seed >> 16;
+}
+
+/**@brief   Overwrites the page that is being staged with @ref stage , after keeping a copy of its old bytes in
+ *          @ref backlog .
+ */
+static void flush_stage(void)
+{
+    memcpy(backlog[staged_page % backlog_pages], &flash[staged_page*TEST_PAGE_SIZE], TEST_PAGE_SIZE);
+    memcpy(&flash[staged_page*TEST_PAGE_SIZE], stage, stage_len);
+    memset(&flash[staged_page*TEST_PAGE_SIZE + stage_len], 0xFF, TEST_PAGE_SIZE - stage_len);
+    stage_len = 0U;
+    staged_page++;
+}
+
+/**@brief   Validates the header of the binary patch against the Firmware Image installed in the emulated Flash Memory.
+ */
+static BsPatch_Status test_check_header(const bspatch_header_t *p_header)
+{
+    if ((p_header->old_size != TEST_OLD_SIZE) || (p_header->old_crc != expected_old_crc))
+    {
+        return BSPATCH_EC_NA;
+    }
+    if ((p_header->new_size > TEST_FLASH_SIZE) || (p_header->page_size != TEST_PAGE_SIZE)
+            || (p_header->backlog_pages == 0U) || (p_header->backlog_pages > TEST_MAX_BACKLOG_PAGES))
+    {
+        return BSPATCH_EC_ERR;
+    }
+    backlog_pages = p_header->backlog_pages;
+
+    return BSPATCH_EC_OK;
+}
+
+/**@brief   Reads some bytes of the old Firmware Image from the emulated Flash Memory, or from @ref backlog for the
+ *          pages that have already been overwritten.
+ */
+static BsPatch_Status test_read_old(uint32_t offset, uint8_t *p_data, uint16_t length)
+{
+    /** <b>Local variable page:</b> Number of the page from which the bytes are currently being read. */
+    uint32_t page;
+    /** <b>Local variable n:</b> Number of bytes that are read from the current page. */
+    uint16_t n;
+
+    while (length > 0U)
+    {
+        page = offset / TEST_PAGE_SIZE;
+        n = TEST_PAGE_SIZE - (offset % TEST_PAGE_SIZE);
+        n = (n > length) ? length : n;
+        if (page >= staged_page)
+        {
+            memcpy(p_data, &flash[offset], n);
+        }
+        else if ((page + backlog_pages) >= staged_page)
+        {
+            memcpy(p_data, &backlog[page % backlog_pages][offset % TEST_PAGE_SIZE], n);
+        }
+        else
+        {
+            is_overwritten_page_read = true;
+            return BSPATCH_EC_ERR;
+        }
+        p_data += n;
+        offset += n;
+        length -= n;
+    }
+
+    return BSPATCH_EC_OK;
+}
+
+/**@brief   Stages the next bytes of the new Firmware Image, writing each page into the emulated Flash Memory as soon
+ *          as it is complete.
+ */
+static BsPatch_Status test_write_new(uint8_t *p_data, uint16_t length)
+{
+    /** <b>Local variable n:</b> Number of bytes that are staged in the current step. */
+    uint32_t n;
+
+    while (length > 0U)
+    {
+        if ((staged_page*TEST_PAGE_SIZE + stage_len) >= TEST_FLASH_SIZE)
+        {
+            return BSPATCH_EC_ERR;
+        }
+        n = TEST_PAGE_SIZE - stage_len;
+        n = (n > length) ? length : n;
+        memcpy(&stage[stage_len], p_data, n);
+        stage_len += n;
+        p_data += n;
+        length -= n;
+        if (stage_len == TEST_PAGE_SIZE)
+        {
+            flush_stage();
+        }
+    }
+
+    return BSPATCH_EC_OK;
+}
+
+static const bspatch_io_t test_io = {test_check_header, test_read_old, test_write_new};  /**< @brief Callbacks through which the binary patches are applied. */
+
+/**@brief   Installs a Firmware Image in the emulated Flash Memory, whose erased bytes are \c 0xFF .
+ */
+static void install_image(const uint8_t *p_image, uint32_t size)
+{
+    memset(flash, 0xFF, sizeof(flash));
+    memcpy(flash, p_image, size);
+    expected_old_crc = crc32_mpeg2(p_image, size);
+}
+
+/**@brief   Applies a binary patch over the emulated Flash Memory, feeding it in pseudo-random pieces of 1 to 200 bytes.
+ *
+ * @return  The first Exception Code other than @ref BSPATCH_EC_OK returned by @ref bspatch_feed , or otherwise
+ *          @ref BSPATCH_EC_OK .
+ */
+static BsPatch_Status apply_patch(uint8_t *p_patch, uint32_t patch_size)
+{
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsPatch_Status function type. */
+    BsPatch_Status ret = BSPATCH_EC_OK;
+    /** <b>Local variable n:</b> Number of bytes of the binary patch that are fed in the current step. */
+    uint32_t n;
+
+    stage_len = 0U;
+    staged_page = 0U;
+    backlog_pages = 1U;
+    is_overwritten_page_read = false;
+    bspatch_init(&test_io);
+    while ((patch_size > 0U) && (ret == BSPATCH_EC_OK))
+    {
+        n = 1U + (test_rand() % 200U);
+        n = (n > patch_size) ? patch_size : n;
+        ret = bspatch_feed(p_patch, n);
+        p_patch += n;
+        patch_size -= n;
+    }
+    if ((ret == BSPATCH_EC_OK) && (stage_len > 0U))
+    {
+        flush_stage();
+    }
+
+    return ret;
+}
+
+/**@brief   Fills the old Firmware Image with pseudo-random "code".
+ */
+static void make_old_image(void)
+{
+    for (uint32_t i=0; i<TEST_OLD_SIZE; i++)
+    {
+        old_image[i] = (uint8_t) test_rand();
+    }
+}
+
+/**@brief   Makes a new Firmware Image where a block was inserted near the start, so that most of the old code moves
+ *          forwards and over the pages from which it is read, where some of the moved bytes were changed (i.e.,
+ *          approximate matches of relocated addresses) and where some new code was appended.
+ */
+static void make_new_image_moved_forwards(void)
+{
+    /** <b>Local variable inserted:</b> Number of bytes inserted at offset 700 of the old Firmware Image. */
+    uint32_t inserted = 1500U;
+
+    memcpy(new_image, old_image, 700U);
+    for (uint32_t i=0; i<inserted; i++)
+    {
+        new_image[700U + i] = (uint8_t) test_rand();
+    }
+    memcpy(&new_image[700U + inserted], &old_image[700U], TEST_OLD_SIZE - 700U);
+    new_size = TEST_OLD_SIZE + inserted;
+    for (uint32_t i=3000U; i<new_size; i+=61U)
+    {
+        new_image[i] += 4U;
+    }
+    for (uint32_t i=0; i<400U; i++)
+    {
+        new_image[new_size + i] = (uint8_t) test_rand();
+    }
+    new_size += 400U;
+}
+
+/**@brief   Makes a new Firmware Image where a block near the start was removed, so that most of the old code moves
+ *          backwards, and where a block from the first old page was duplicated near the end, so that it can no longer
+ *          be read from the old Firmware Image once it has been rebuilt in place.
+ */
+static void make_new_image_moved_backwards(void)
+{
+    /** <b>Local variable removed:</b> Number of bytes removed at offset 200 of the old Firmware Image. */
+    uint32_t removed = 2600U;
+
+    memcpy(new_image, old_image, 200U);
+    memcpy(&new_image[200U], &old_image[200U + removed], TEST_OLD_SIZE - 200U - removed);
+    new_size = TEST_OLD_SIZE - removed;
+    memcpy(&new_image[new_size - 900U], &old_image[50U], 600U);
+    new_image[new_size - 500U] ^= 0x5AU;
+}
+
+/**@brief   Generates the binary patch from @ref old_image to @ref new_image and checks that it rebuilds the latter in
+ *          place with \p pages backlog pages.
+ */
+static void test_round_trip(uint8_t pages)
+{
+    /** <b>Local variable p_patch:</b> Pointer to the generated binary patch. */
+    uint8_t *p_patch = NULL;
+    /** <b>Local variable patch_size:</b> Size in bytes of the generated binary patch. */
+    uint32_t patch_size = 0U;
+
+    CHECK(bsdiff_create(old_image, TEST_OLD_SIZE, new_image, new_size, TEST_PAGE_SIZE, pages, &p_patch, &patch_size) == BSDIFF_EC_OK);
+    if (p_patch == NULL)
+    {
+        return;
+    }
+    CHECK((patch_size % 4U) == 0U);
+    CHECK(patch_size < new_size);
+
+    install_image(old_image, TEST_OLD_SIZE);
+    CHECK(apply_patch(p_patch, patch_size) == BSPATCH_EC_OK);
+    CHECK(!is_overwritten_page_read);
+    CHECK(bspatch_is_done());
+    CHECK(memcmp(flash, new_image, new_size) == 0);
+    free(p_patch);
+}
+
+/**@brief   Checks that corrupted binary patches, or ones applied over a different old Firmware Image, are rejected.
+ */
+static void test_corrupted_patch(void)
+{
+    /** <b>Local variable p_patch:</b> Pointer to the generated binary patch. */
+    uint8_t *p_patch = NULL;
+    /** <b>Local variable patch_size:</b> Size in bytes of the generated binary patch. */
+    uint32_t patch_size = 0U;
+    /** <b>Local variable p_field:</b> Pointer to the field of the binary patch that is corrupted. */
+    uint8_t *p_field;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref BsPatch_Status function type. */
+    BsPatch_Status ret;
+
+    make_new_image_moved_forwards();
+    CHECK(bsdiff_create(old_image, TEST_OLD_SIZE, new_image, new_size, TEST_PAGE_SIZE, 1U, &p_patch, &patch_size) == BSDIFF_EC_OK);
+    if (p_patch == NULL)
+    {
+        return;
+    }
+
+    /* A binary patch applied over a different old Firmware Image is rejected before anything is written. */
+    old_image[TEST_OLD_SIZE / 2U] ^= 0x01U;
+    install_image(old_image, TEST_OLD_SIZE);
+    old_image[TEST_OLD_SIZE / 2U] ^= 0x01U;
+    CHECK(apply_patch(p_patch, patch_size) == BSPATCH_EC_NA);
+    CHECK(staged_page == 0U);
+    CHECK(stage_len == 0U);
+
+    /* A wrong magic number is rejected. */
+    install_image(old_image, TEST_OLD_SIZE);
+    p_patch[0] ^= 0xFFU;
+    CHECK(apply_patch(p_patch, patch_size) == BSPATCH_EC_ERR);
+    p_patch[0] ^= 0xFFU;
+
+    /* A Control Entry that goes beyond the new Firmware Image is rejected. */
+    install_image(old_image, TEST_OLD_SIZE);
+    p_field = &p_patch[BSPATCH_HEADER_SIZE];
+    p_field[2] ^= 0x7FU;
+    CHECK(apply_patch(p_patch, patch_size) == BSPATCH_EC_ERR);
+    CHECK(!bspatch_is_done());
+    p_field[2] ^= 0x7FU;
+
+    /* A truncated binary patch leaves the new Firmware Image incomplete. */
+    install_image(old_image, TEST_OLD_SIZE);
+    CHECK(apply_patch(p_patch, patch_size / 2U) == BSPATCH_EC_OK);
+    CHECK(!bspatch_is_done());
+
+    /* A corrupted byte after the first Control Entry is either rejected or caught by the 32-bit CRC of the new Firmware Image. */
+    install_image(old_image, TEST_OLD_SIZE);
+    p_patch[BSPATCH_HEADER_SIZE + BSPATCH_CTRL_SIZE + 10U] ^= 0x10U;
+    ret = apply_patch(p_patch, patch_size);
+    CHECK((ret != BSPATCH_EC_OK) || (crc32_mpeg2(flash, new_size) != crc32_mpeg2(new_image, new_size)));
+    free(p_patch);
+}
+
+int main(void)
+{
+    make_old_image();
+    for (uint8_t pages=1U; pages<=TEST_MAX_BACKLOG_PAGES; pages++)
+    {
+        make_new_image_moved_forwards();
+        test_round_trip(pages);
+        make_new_image_moved_backwards();
+        test_round_trip(pages);
+    }
+    test_corrupted_patch();
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+/** @file
+ * @brief	Host test of the CRC32/MPEG-2 Algorithm module of the firmwares.
+ *
+ * @details	This test compares @ref crc32_mpeg2 and @ref crc32_mpeg2_update against a bitwise reference implementation
+ *          of the 32-bit CRC (MPEG-2) for every data length from 0 up to @ref TEST_MAX_LENGTH bytes at every alignment
+ *          from 0 up to @ref TEST_MAX_ALIGNMENT bytes, and for incremental updates split at every byte. It is meant
+ *          to be compiled both with @ref CRC32_MPEG2_HW_ACCELERATION disabled, and with it enabled against the
+ *          emulated CRC peripheral of Stubs/stm32f1xx_hal.h , in which case the unaligned leading and trailing bytes
+ *          that are processed in software are also covered (see run_tests.sh ).
+ */
+#include "crc32_mpeg2.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+
+#define TEST_MAX_LENGTH         (600U)      /**< @brief Maximum data length in bytes that is tested. */
+#define TEST_MAX_ALIGNMENT      (8U)        /**< @brief Number of different alignments of the data that are tested. */
+#define TEST_SPLIT_LENGTH       (257U)      /**< @brief Data length in bytes with which the incremental updates are tested. */
+#define TEST_CHECK_VALUE        (0x0376E6E7)    /**< @brief 32-bit CRC (MPEG-2) of the ASCII string "123456789". */
+
+static uint8_t test_data[TEST_MAX_LENGTH + TEST_MAX_ALIGNMENT] __attribute__((aligned(4)));  /**< @brief Pseudo-random data from which the 32-bit CRCs are calculated. */
+static int failures = 0;                                                                    /**< @brief Number of checks that have failed so far. */
+
+/**@brief   Calculates the 32-bit CRC (MPEG-2) one bit at a time, which is the reference for the module under test.
+ *
+ * @param checksum		The 32-bit CRC of all the bytes that preceded the ones at \p p_data .
+ * @param[in] p_data    Pointer to the data.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+static uint32_t crc32_mpeg2_bitwise(uint32_t checksum, const uint8_t *p_data, uint32_t data_length)
+{
+    for (uint32_t i=0; i<data_length; i++)
+    {
+        checksum ^= (uint32_t) p_data[i] << 24;
+        for (int bit=0; bit<8; bit++)
+        {
+            checksum = (checksum & 0x80000000) ? ((checksum << 1) ^ 0x04C11DB7) : (checksum << 1);
+        }
+    }
+    return checksum;
+}
+
+/**@brief   Records a failed check whenever \p actual differs from \p expected .
+ */
+static void check(const char *name, uint32_t length, uint32_t alignment, uint32_t actual, uint32_t expected)
+{
+    if (actual != expected)
+    {
+        printf("FAIL: %s (length = %u, alignment = %u): 0x%08X != 0x%08X\n", name, length, alignment, actual, expected);
+        failures++;
+    }
+}
+
+int main(void)
+{
+    /** <b>Local variable seed:</b> State of the pseudo-random generator of the test data. */
+    uint32_t seed = 0xC0FFEE;
+    /** <b>Local variable check_string:</b> Data whose 32-bit CRC (MPEG-2) is @ref TEST_CHECK_VALUE . */
+    uint8_t check_string[] = "123456789";
+
+    for (uint32_t i=0; i<sizeof(test_data); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        test_data[i] = (uint8_t) (seed >> 16);
+    }
+    printf("CRC peripheral emulation: %s\n", CRC32_MPEG2_HW_ACCELERATION ? "enabled" : "disabled");
+
+    /* Test the known check value, and then every length at every alignment from both the initial value and a non-trivial checksum. */
+    check("check value", 9, 0, crc32_mpeg2(check_string, 9), TEST_CHECK_VALUE);
+    for (uint32_t alignment=0; alignment<TEST_MAX_ALIGNMENT; alignment++)
+    {
+        for (uint32_t length=1; length<=TEST_MAX_LENGTH; length++)
+        {
+            check("crc32_mpeg2", length, alignment, crc32_mpeg2(&test_data[alignment], length), crc32_mpeg2_bitwise(CRC32_MPEG2_INIT_VALUE, &test_data[alignment], length));
+            check("crc32_mpeg2_update", length, alignment, crc32_mpeg2_update(0x12345678, &test_data[alignment], length), crc32_mpeg2_bitwise(0x12345678, &test_data[alignment], length));
+        }
+    }
+
+    /* Test incremental updates split at every byte, which makes the second one start at every alignment. */
+    for (uint32_t split=0; split<=TEST_SPLIT_LENGTH; split++)
+    {
+        /** <b>Local variable checksum:</b> 32-bit CRC of the data calculated in two incremental updates. */
+        uint32_t checksum = crc32_mpeg2_update(crc32_mpeg2_update(CRC32_MPEG2_INIT_VALUE, &test_data[1], split), &test_data[1 + split], TEST_SPLIT_LENGTH - split);
+        check("incremental update", TEST_SPLIT_LENGTH, split, checksum, crc32_mpeg2_bitwise(CRC32_MPEG2_INIT_VALUE, &test_data[1], TEST_SPLIT_LENGTH));
+    }
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
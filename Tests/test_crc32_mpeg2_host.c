@@ -0,0 +1,116 @@
+/** @file
+ * @brief	Host test of the CRC32/MPEG-2 Algorithm module of the host programs.
+ *
+ * @details	This test compares the Slicing-by-8 and the PCLMULQDQ folding engines, as well as the engine chosen at
+ *          runtime, against a bitwise reference implementation of the 32-bit CRC (MPEG-2). This is done for every
+ *          data length from 0 up to @ref TEST_MAX_LENGTH bytes at every alignment from 0 up to
+ *          @ref TEST_MAX_ALIGNMENT bytes, for incremental updates split at every byte, and for
+ *          @ref crc32_mpeg2_combine . The PCLMULQDQ folding engine is only tested whenever the CPU supports it.
+ *
+ * @note	The module source file is included directly so that its engines can be called individually, which is why
+ *          this test must be compiled with the folder of the module source file in its include paths (see
+ *          run_tests.sh ).
+ */
+#include "crc32_mpeg2.c"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h> // Library from which "strcmp()" is located at.
+
+#define TEST_MAX_LENGTH         (1100U)     /**< @brief Maximum data length in bytes that is tested, which covers several 64-byte blocks of the PCLMULQDQ folding engine plus all of its possible remainders. */
+#define TEST_MAX_ALIGNMENT      (16U)       /**< @brief Number of different alignments of the data that are tested. */
+#define TEST_SPLIT_LENGTH       (777U)      /**< @brief Data length in bytes with which the incremental updates are tested. */
+#define TEST_CHECK_VALUE        (0x0376E6E7)    /**< @brief 32-bit CRC (MPEG-2) of the ASCII string "123456789". */
+
+static uint8_t test_data[TEST_MAX_LENGTH + TEST_MAX_ALIGNMENT];  /**< @brief Pseudo-random data from which the 32-bit CRCs are calculated. */
+static int failures = 0;                                        /**< @brief Number of checks that have failed so far. */
+
+/**@brief   Calculates the 32-bit CRC (MPEG-2) one bit at a time, which is the reference for all the engines.
+ *
+ * @param checksum		The 32-bit CRC of all the bytes that preceded the ones at \p p_data .
+ * @param[in] p_data    Pointer to the data.
+ * @param data_length   Length in bytes of the \p p_data param.
+ *
+ * @return              The 32-bit CRC of all the bytes preceding \p p_data plus the ones at \p p_data .
+ */
+static uint32_t crc32_mpeg2_bitwise(uint32_t checksum, const uint8_t *p_data, uint32_t data_length)
+{
+    for (uint32_t i=0; i<data_length; i++)
+    {
+        checksum ^= (uint32_t) p_data[i] << 24;
+        for (int bit=0; bit<8; bit++)
+        {
+            checksum = (checksum & 0x80000000) ? ((checksum << 1) ^ CRC32_MPEG2_POLYNOMIAL) : (checksum << 1);
+        }
+    }
+    return checksum;
+}
+
+/**@brief   Records a failed check whenever \p actual differs from \p expected .
+ */
+static void check(const char *name, uint32_t length, uint32_t alignment, uint32_t actual, uint32_t expected)
+{
+    if (actual != expected)
+    {
+        printf("FAIL: %s (length = %u, alignment = %u): 0x%08X != 0x%08X\n", name, length, alignment, actual, expected);
+        failures++;
+    }
+}
+
+/**@brief   Tests an engine against @ref crc32_mpeg2_bitwise at every length and alignment, from both the initial
+ *          value and a non-trivial checksum, and with incremental updates split at every byte.
+ */
+static void test_engine(const char *name, uint32_t (*engine)(uint32_t, const uint8_t *, uint32_t))
+{
+    for (uint32_t alignment=0; alignment<TEST_MAX_ALIGNMENT; alignment++)
+    {
+        for (uint32_t length=0; length<=TEST_MAX_LENGTH; length++)
+        {
+            check(name, length, alignment, engine(CRC32_MPEG2_INIT_VALUE, &test_data[alignment], length), crc32_mpeg2_bitwise(CRC32_MPEG2_INIT_VALUE, &test_data[alignment], length));
+            check(name, length, alignment, engine(0x12345678, &test_data[alignment], length), crc32_mpeg2_bitwise(0x12345678, &test_data[alignment], length));
+        }
+    }
+    for (uint32_t split=0; split<=TEST_SPLIT_LENGTH; split++)
+    {
+        /** <b>Local variable checksum:</b> 32-bit CRC of the data calculated in two incremental updates. */
+        uint32_t checksum = engine(engine(CRC32_MPEG2_INIT_VALUE, &test_data[1], split), &test_data[1 + split], TEST_SPLIT_LENGTH - split);
+        check(name, TEST_SPLIT_LENGTH, split, checksum, crc32_mpeg2_bitwise(CRC32_MPEG2_INIT_VALUE, &test_data[1], TEST_SPLIT_LENGTH));
+    }
+}
+
+int main(void)
+{
+    /** <b>Local variable seed:</b> State of the pseudo-random generator of the test data. */
+    uint32_t seed = 0xC0FFEE;
+
+    for (uint32_t i=0; i<sizeof(test_data); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        test_data[i] = (uint8_t) (seed >> 16);
+    }
+
+    /* Test the known check value and the engine chosen at runtime, which also builds the tables of all the engines. */
+    check("check value", 9, 0, crc32_mpeg2((const uint8_t *) "123456789", 9), TEST_CHECK_VALUE);
+    printf("Engine chosen at runtime: %s\n", crc32_mpeg2_engine());
+    test_engine("crc32_mpeg2_update", crc32_mpeg2_update);
+    test_engine("slice-by-8", crc32_mpeg2_slice_by_8);
+    #if CRC32_MPEG2_IS_PCLMUL_BUILD
+    if (strcmp(crc32_mpeg2_engine(), "pclmul") == 0)
+    {
+        test_engine("pclmul", crc32_mpeg2_pclmul);
+    }
+    else
+    {
+        printf("SKIP: the CPU does not support the PCLMULQDQ folding engine.\n");
+    }
+    #endif
+
+    /* Test combining the 32-bit CRCs of two blocks at every split. */
+    for (uint32_t split=0; split<=TEST_SPLIT_LENGTH; split++)
+    {
+        check("crc32_mpeg2_combine", TEST_SPLIT_LENGTH, split,
+              crc32_mpeg2_combine(crc32_mpeg2(test_data, split), crc32_mpeg2(&test_data[split], TEST_SPLIT_LENGTH - split), TEST_SPLIT_LENGTH - split),
+              crc32_mpeg2_bitwise(CRC32_MPEG2_INIT_VALUE, test_data, TEST_SPLIT_LENGTH));
+    }
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
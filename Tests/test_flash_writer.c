@@ -0,0 +1,168 @@
+/** @file
+ * @brief	Host test of the Flash Writer module of the firmwares against its simulated Flash Memory.
+ *
+ * @details	This test checks the erase and program operations, including their simulated latencies, that programming
+ *          non-erased half-words is rejected, that the \c PGERR and \c WRPRTERR flags of the simulated FPEC are
+ *          mapped into @ref FLASH_WRITER_EC_ERR , and that a stuck FPEC is mapped into @ref FLASH_WRITER_EC_TIMEOUT
+ *          (see run_tests.sh ).
+ */
+#include "flash_writer.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h> // Library from which "memcmp()" is located at.
+
+#define TEST_PAGE_0     (FLASH_WRITER_SIM_BASE_ADDR)                                /**< @brief Start address of the first page of the simulated Flash Memory. */
+#define TEST_PAGE_1     (FLASH_WRITER_SIM_BASE_ADDR + FLASH_WRITER_SIM_PAGE_SIZE)   /**< @brief Start address of the second page of the simulated Flash Memory. */
+
+static int failures = 0;    /**< @brief Number of checks that have failed so far. */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the simulated Flash Memory at a given address.
+ */
+static uint8_t *sim_at(uint32_t address)
+{
+    return &flash_writer_sim_memory()[address - FLASH_WRITER_SIM_BASE_ADDR];
+}
+
+/**@brief   Tests the erase and program operations, their latencies and the padding of odd lengths.
+ */
+static void test_erase_and_program(void)
+{
+    /** <b>Local variable data:</b> Data to be programmed, which starts at an odd index so that it is unaligned. */
+    uint8_t data[12] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB};
+    /** <b>Local variable start:</b> Simulated time at which the operation under test started. */
+    uint64_t start;
+
+    flash_writer_sim_reset();
+    CHECK(flash_writer_erase_page(TEST_PAGE_0) == FLASH_WRITER_EC_BUSY);
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_BUSY);
+    CHECK(flash_writer_begin() == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_begin() == FLASH_WRITER_EC_OK);
+
+    /* Program 11 unaligned bytes, which take 6 half-words where the last one is padded with 0xFF. */
+    start = flash_writer_sim_time();
+    CHECK(flash_writer_program(TEST_PAGE_0 + 4, &data[1], 11) == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_sim_time() - start == 6 * FLASH_WRITER_SIM_PROGRAM_TIME);
+    CHECK(memcmp(sim_at(TEST_PAGE_0 + 4), &data[1], 11) == 0);
+    CHECK(*sim_at(TEST_PAGE_0 + 15) == 0xFF);
+    CHECK(!flash_writer_is_blank(TEST_PAGE_0, FLASH_WRITER_SIM_PAGE_SIZE));
+    CHECK(flash_writer_is_blank(TEST_PAGE_1, FLASH_WRITER_SIM_PAGE_SIZE));
+
+    /* Half-words that are to be left as 0xFFFF in erased locations are not programmed, so they take no time. */
+    memset(data, 0xFF, sizeof(data));
+    start = flash_writer_sim_time();
+    CHECK(flash_writer_program(TEST_PAGE_1, data, sizeof(data)) == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_sim_time() == start);
+
+    /* Erasing a page takes its whole erase time and leaves the next page untouched. */
+    data[0] = 0x12;
+    CHECK(flash_writer_program(TEST_PAGE_1, data, 2) == FLASH_WRITER_EC_OK);
+    start = flash_writer_sim_time();
+    CHECK(flash_writer_erase_page(TEST_PAGE_0 + 100) == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_sim_time() - start == FLASH_WRITER_SIM_ERASE_TIME);
+    CHECK(flash_writer_is_blank(TEST_PAGE_0, FLASH_WRITER_SIM_PAGE_SIZE));
+    CHECK(*sim_at(TEST_PAGE_1) == 0x12);
+
+    /* Misaligned and out of range addresses are rejected. */
+    CHECK(flash_writer_program(TEST_PAGE_0 + 1, data, 2) == FLASH_WRITER_EC_ERR);
+    CHECK(flash_writer_program(FLASH_WRITER_SIM_BASE_ADDR + FLASH_WRITER_SIM_SIZE, data, 2) == FLASH_WRITER_EC_ERR);
+    CHECK(flash_writer_erase_page(FLASH_WRITER_SIM_BASE_ADDR - FLASH_WRITER_SIM_PAGE_SIZE) == FLASH_WRITER_EC_ERR);
+
+    /* Once locked back, nothing can be erased nor programmed. */
+    CHECK(flash_writer_end() == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_erase_page(TEST_PAGE_1) == FLASH_WRITER_EC_BUSY);
+    CHECK(*sim_at(TEST_PAGE_1) == 0x12);
+}
+
+/**@brief   Tests that programming non-erased half-words is rejected, except for clearing them to zero.
+ */
+static void test_non_erased_half_words(void)
+{
+    /** <b>Local variable first:</b> Data that is programmed first. */
+    const uint8_t first[4] = {0x34, 0x12, 0x78, 0x56};
+    /** <b>Local variable second:</b> Data that is then programmed over \c first , whose half-words are all non-zero. */
+    const uint8_t second[4] = {0x30, 0x10, 0x70, 0x50};
+    /** <b>Local variable zeros:</b> Data that clears the half-words to zero. */
+    const uint8_t zeros[4] = {0x00, 0x00, 0x00, 0x00};
+
+    flash_writer_sim_reset();
+    CHECK(flash_writer_begin() == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_program(TEST_PAGE_0, first, sizeof(first)) == FLASH_WRITER_EC_OK);
+
+    /* The simulated FPEC flags PGERR and leaves the half-word untouched, even though its bits could only be cleared. */
+    CHECK(flash_writer_program(TEST_PAGE_0, second, sizeof(second)) == FLASH_WRITER_EC_ERR);
+    CHECK(memcmp(sim_at(TEST_PAGE_0), first, sizeof(first)) == 0);
+
+    /* The PGERR flag is cleared once it has been reported, so the next operations work normally. */
+    CHECK(flash_writer_program(TEST_PAGE_0, zeros, sizeof(zeros)) == FLASH_WRITER_EC_OK);
+    CHECK(memcmp(sim_at(TEST_PAGE_0), zeros, sizeof(zeros)) == 0);
+    CHECK(flash_writer_program(TEST_PAGE_0 + 8, first, sizeof(first)) == FLASH_WRITER_EC_OK);
+    flash_writer_end();
+}
+
+/**@brief   Tests the mapping of the flags of the simulated FPEC into the @ref FlashWriter_Status , via fault injection.
+ */
+static void test_injected_faults(void)
+{
+    /** <b>Local variable data:</b> Data to be programmed. */
+    const uint8_t data[4] = {0xA5, 0x5A, 0x0F, 0xF0};
+    /** <b>Local variable start:</b> Simulated time at which the operation under test started. */
+    uint64_t start;
+
+    /* A write protected page flags WRPRTERR on both erase and program operations, and is left untouched. */
+    flash_writer_sim_reset();
+    CHECK(flash_writer_begin() == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_program(TEST_PAGE_1, data, sizeof(data)) == FLASH_WRITER_EC_OK);
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_WRPRTERR, TEST_PAGE_1 + 10);
+    CHECK(flash_writer_erase_page(TEST_PAGE_1) == FLASH_WRITER_EC_ERR);
+    CHECK(memcmp(sim_at(TEST_PAGE_1), data, sizeof(data)) == 0);
+    CHECK(flash_writer_program(TEST_PAGE_1 + 8, data, sizeof(data)) == FLASH_WRITER_EC_ERR);
+    CHECK(flash_writer_is_blank(TEST_PAGE_1 + 8, 4));
+
+    /* The fault only applies to the page into which it was injected. */
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_erase_page(TEST_PAGE_0) == FLASH_WRITER_EC_OK);
+
+    /* A programming error flags PGERR. */
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_PGERR, TEST_PAGE_0);
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_ERR);
+    CHECK(flash_writer_is_blank(TEST_PAGE_0, 4));
+
+    /* Half-words that silently stay unprogrammed are caught by the read back. */
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_NOT_PROGRAMMED, TEST_PAGE_0);
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_ERR);
+
+    /* A stuck FPEC makes the operations time out once FLASH_WRITER_TIMEOUT has passed. */
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_STUCK_BUSY, TEST_PAGE_0);
+    start = flash_writer_sim_time();
+    CHECK(flash_writer_erase_page(TEST_PAGE_0) == FLASH_WRITER_EC_TIMEOUT);
+    CHECK(flash_writer_sim_time() - start > (uint64_t) FLASH_WRITER_TIMEOUT * 1000U);
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_TIMEOUT);
+
+    /* Removing the fault makes the simulated FPEC work normally again. */
+    flash_writer_sim_inject_fault(FLASH_WRITER_SIM_FAULT_NONE, TEST_PAGE_0);
+    CHECK(flash_writer_erase_page(TEST_PAGE_0) == FLASH_WRITER_EC_OK);
+    CHECK(flash_writer_program(TEST_PAGE_0, data, sizeof(data)) == FLASH_WRITER_EC_OK);
+    CHECK(memcmp(sim_at(TEST_PAGE_0), data, sizeof(data)) == 0);
+    flash_writer_end();
+}
+
+int main(void)
+{
+    test_erase_and_program();
+    test_non_erased_half_words();
+    test_injected_faults();
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,302 @@
+/** @file
+ * @brief	Host test of the Firmware Image Parser of the PcTool.
+ *
+ * @details	This test flattens small Intel HEX, Motorola S-record and ELF fixture Files, which describe the same
+ *          non-contiguous segments of a Firmware Image, with @ref image_parser_flatten . It checks that the segments
+ *          are placed at their addresses with \c 0xFF bytes in between, that contiguous records are counted as a single
+ *          segment, that the Flash Memory pages that fall in the gap are blank according to
+ *          @ref image_parser_is_blank (i.e., that they would be erased instead of being sent), and that the Files with
+ *          wrong checksums, segments outside of the slot or malformed headers are rejected with
+ *          @ref IMAGE_PARSER_EC_ERR (see run_tests.sh ).
+ */
+#include "image_parser.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <stdlib.h> // Library from which "free()" is located at.
+#include <string.h> // Library from which "memcpy()", "memset()", "memcmp()", "strlen()" and "strstr()" are located at.
+
+#define TEST_BASE_ADDRESS       (0x08008000U)   /**< @brief Flash Memory address from which the slot of the Firmware Image starts. */
+#define TEST_SLOT_SIZE          (0x4000U)       /**< @brief Length in bytes of the slot of the Firmware Image. */
+#define TEST_PAGE_SIZE          (1024U)         /**< @brief Flash Memory page size in bytes with which the blank pages are looked for. */
+#define TEST_IMAGE_SIZE         (0xC14U)        /**< @brief Length in bytes of the Firmware Image of the text fixtures, which ends 3 bytes after 0x08008C10 and is padded to a multiple of 4 bytes. */
+#define TEST_ELF_SIZE           (208U)          /**< @brief Length in bytes of the ELF fixture File. */
+
+/**@brief   Intel HEX fixture File, with an Extended Linear Address record, two contiguous data records at 0x08008000,
+ *          two separate ones in the fourth page and a Start Linear Address record.
+ */
+static const char ihex_file[] =
+    ":020000040800F2\r\n"
+    ":10800000000102030405060708090A0B0C0D0E0FF8\r\n"
+    ":088010001011121314151617CC\r\n"
+    ":048C0000DEADBEEF38\r\n"
+    ":038C10000102035B\r\n"
+    ":04000005080081016D\r\n"
+    ":00000001FF\r\n";
+
+/**@brief   Motorola S-record fixture File, with the same data records as @ref ihex_file , a header, a count and a
+ *          termination record.
+ */
+static const char srec_file[] =
+    "S00600004844521B\n"
+    "S31508008000000102030405060708090A0B0C0D0E0FEA\n"
+    "S30D080080101011121314151617BE\n"
+    "S30908008C00DEADBEEF2A\n"
+    "S30808008C100102034D\n"
+    "S5030004F8\n"
+    "S7050800810170\n";
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t expected[TEST_SLOT_SIZE];                    /**< @brief Firmware Image that the fixture Files describe. */
+static uint8_t elf_file[TEST_ELF_SIZE];                     /**< @brief ELF fixture File (see @ref make_elf_file ). */
+static uint8_t file[1024];                                  /**< @brief Copy of a fixture File that is corrupted before being flattened. */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Writes a little-endian value of up to 4 bytes.
+ */
+static void put_le(uint8_t *p_data, uint32_t value, uint8_t len)
+{
+    for (uint8_t i=0; i<len; i++)
+    {
+        p_data[i] = (uint8_t) (value >> (8U*i));
+    }
+}
+
+/**@brief   Makes the Firmware Image that the text fixture Files describe.
+ */
+static void make_expected_image(void)
+{
+    memset(expected, 0xFF, sizeof(expected));
+    for (uint8_t i=0; i<24U; i++)
+    {
+        expected[i] = i;
+    }
+    memcpy(&expected[0xC00], "\xDE\xAD\xBE\xEF", 4U);
+    memcpy(&expected[0xC10], "\x01\x02\x03", 3U);
+}
+
+/**@brief   Makes an ELF fixture File whose \c PT_LOAD program segments hold the first 24 bytes of @ref expected at
+ *          0x08008000, and the 4 bytes at 0x08008C00 as initialized data whose virtual address is in RAM, along with a
+ *          \c PT_NOTE segment and a \c PT_LOAD segment without bytes in the File (i.e., the ".bss"), which are skipped.
+ */
+static void make_elf_file(void)
+{
+    /** <b>Local variable p_phdr:</b> Points to the program header that is currently being written. */
+    uint8_t *p_phdr;
+
+    memset(elf_file, 0, sizeof(elf_file));
+    memcpy(elf_file, "\x7F" "ELF", 4U);
+    elf_file[4] = 1U;   // 32-bit.
+    elf_file[5] = 1U;   // Little-endian.
+    elf_file[6] = 1U;
+    put_le(&elf_file[16], 2U, 2U);      // Executable File.
+    put_le(&elf_file[18], 40U, 2U);     // ARM.
+    put_le(&elf_file[28], 52U, 4U);     // Program headers offset.
+    put_le(&elf_file[40], 52U, 2U);     // ELF header size.
+    put_le(&elf_file[42], 32U, 2U);     // Program header size.
+    put_le(&elf_file[44], 4U, 2U);      // Number of program headers.
+
+    /* ".text" segment. */
+    p_phdr = &elf_file[52];
+    put_le(&p_phdr[0], 1U, 4U);
+    put_le(&p_phdr[4], 180U, 4U);
+    put_le(&p_phdr[8], TEST_BASE_ADDRESS, 4U);
+    put_le(&p_phdr[12], TEST_BASE_ADDRESS, 4U);
+    put_le(&p_phdr[16], 24U, 4U);
+    put_le(&p_phdr[20], 24U, 4U);
+
+    /* Note segment, which is not loaded. */
+    p_phdr += 32;
+    put_le(&p_phdr[0], 4U, 4U);
+    put_le(&p_phdr[4], 0U, 4U);
+    put_le(&p_phdr[16], 8U, 4U);
+
+    /* ".data" segment, which is copied into RAM from its physical address. */
+    p_phdr += 32;
+    put_le(&p_phdr[0], 1U, 4U);
+    put_le(&p_phdr[4], 204U, 4U);
+    put_le(&p_phdr[8], 0x20000000U, 4U);
+    put_le(&p_phdr[12], TEST_BASE_ADDRESS + 0xC00U, 4U);
+    put_le(&p_phdr[16], 4U, 4U);
+    put_le(&p_phdr[20], 4U, 4U);
+
+    /* ".bss" segment, which has no bytes in the File. */
+    p_phdr += 32;
+    put_le(&p_phdr[0], 1U, 4U);
+    put_le(&p_phdr[8], 0x20000004U, 4U);
+    put_le(&p_phdr[12], 0x20000004U, 4U);
+    put_le(&p_phdr[20], 0x100U, 4U);
+
+    memcpy(&elf_file[180], expected, 24U);
+    memcpy(&elf_file[204], &expected[0xC00], 4U);
+}
+
+/**@brief   Flattens a File and checks the resulting Firmware Image, its size, its number of segments and which of its
+ *          Flash Memory pages are blank.
+ */
+static void check_flatten(const uint8_t *p_file, uint32_t file_size, uint32_t image_size, uint32_t segment_count)
+{
+    /** <b>Local variable p_image:</b> Pointer to the flattened Firmware Image. */
+    uint8_t *p_image = NULL;
+    /** <b>Local variable size:</b> Length in bytes of the flattened Firmware Image. */
+    uint32_t size = 0U;
+    /** <b>Local variable segments:</b> Number of segments found in the File. */
+    uint32_t segments = 0U;
+    /** <b>Local variable len:</b> Number of bytes of the Firmware Image in the current Flash Memory page. */
+    uint32_t len;
+
+    CHECK(image_parser_flatten(p_file, file_size, TEST_BASE_ADDRESS, TEST_SLOT_SIZE, &p_image, &size, &segments) == IMAGE_PARSER_EC_OK);
+    if (p_image == NULL)
+    {
+        return;
+    }
+    CHECK(size == image_size);
+    CHECK(segments == segment_count);
+    CHECK(memcmp(p_image, expected, size) == 0);
+
+    /* Only the second and third pages fall in the gap between the segments, so they are the only blank ones. */
+    for (uint32_t i=0; i<size; i+=TEST_PAGE_SIZE)
+    {
+        len = ((size - i) > TEST_PAGE_SIZE) ? TEST_PAGE_SIZE : (size - i);
+        CHECK(image_parser_is_blank(&p_image[i], len) == ((i == TEST_PAGE_SIZE) || (i == 2U*TEST_PAGE_SIZE)));
+    }
+    free(p_image);
+}
+
+/**@brief   Checks that a File is rejected.
+ */
+static void check_rejected(const uint8_t *p_file, uint32_t file_size)
+{
+    /** <b>Local variable p_image:</b> Pointer to the flattened Firmware Image, which must not be given. */
+    uint8_t *p_image = NULL;
+    /** <b>Local variable size:</b> Length in bytes of the flattened Firmware Image. */
+    uint32_t size = 0U;
+    /** <b>Local variable segments:</b> Number of segments found in the File. */
+    uint32_t segments = 0U;
+
+    CHECK(image_parser_flatten(p_file, file_size, TEST_BASE_ADDRESS, TEST_SLOT_SIZE, &p_image, &size, &segments) == IMAGE_PARSER_EC_ERR);
+    CHECK(p_image == NULL);
+}
+
+/**@brief   Copies a text fixture File into @ref file and replaces one of its characters.
+ *
+ * @return  The length in bytes of the File.
+ */
+static uint32_t corrupt_text(const char *p_text, const char *p_find, char replacement)
+{
+    /** <b>Local variable len:</b> Length in bytes of the File. */
+    uint32_t len = strlen(p_text);
+
+    memcpy(file, p_text, len);
+    file[strstr(p_text, p_find) - p_text] = (uint8_t) replacement;
+
+    return len;
+}
+
+/**@brief   Tests the Intel HEX fixture File and its corrupted copies.
+ */
+static void test_ihex(void)
+{
+    /** <b>Local variable out_of_slot:</b> Intel HEX File with a data record right before the slot. */
+    static const char out_of_slot[] = ":020000040800F2\n:107FF000000102030405060708090A0B0C0D0E0F09\n:00000001FF\n";
+    /** <b>Local variable len:</b> Length in bytes of the File under test. */
+    uint32_t len;
+
+    CHECK(image_parser_get_format((const uint8_t *) ihex_file, strlen(ihex_file)) == IMAGE_PARSER_FORMAT_IHEX);
+    check_flatten((const uint8_t *) ihex_file, strlen(ihex_file), TEST_IMAGE_SIZE, 3U);
+
+    /* A wrong checksum. */
+    len = corrupt_text(ihex_file, "CC\r", 'D');
+    check_rejected(file, len);
+
+    /* A wrong data byte, which breaks the checksum too. */
+    len = corrupt_text(ihex_file, "DEADBEEF", 'C');
+    check_rejected(file, len);
+
+    /* An odd number of hexadecimal digits. */
+    len = corrupt_text(ihex_file, "5B\r", '\r');
+    check_rejected(file, len);
+
+    /* A segment outside of the slot. */
+    check_rejected((const uint8_t *) out_of_slot, strlen(out_of_slot));
+}
+
+/**@brief   Tests the Motorola S-record fixture File and its corrupted copies.
+ */
+static void test_srec(void)
+{
+    /** <b>Local variable len:</b> Length in bytes of the File under test. */
+    uint32_t len;
+
+    CHECK(image_parser_get_format((const uint8_t *) srec_file, strlen(srec_file)) == IMAGE_PARSER_FORMAT_SREC);
+    check_flatten((const uint8_t *) srec_file, strlen(srec_file), TEST_IMAGE_SIZE, 3U);
+
+    /* A wrong checksum. */
+    len = corrupt_text(srec_file, "2A\n", '3');
+    check_rejected(file, len);
+
+    /* A wrong byte count. */
+    len = corrupt_text(srec_file, "0D0800", '1');
+    check_rejected(file, len);
+
+    /* An unknown record type. */
+    len = corrupt_text(srec_file, "S5", '4');
+    check_rejected(file, len);
+}
+
+/**@brief   Tests the ELF fixture File and its corrupted copies.
+ */
+static void test_elf(void)
+{
+    CHECK(image_parser_get_format(elf_file, TEST_ELF_SIZE) == IMAGE_PARSER_FORMAT_ELF);
+    check_flatten(elf_file, TEST_ELF_SIZE, 0xC04U, 2U);
+
+    /* A 64-bit ELF File. */
+    memcpy(file, elf_file, TEST_ELF_SIZE);
+    file[4] = 2U;
+    check_rejected(file, TEST_ELF_SIZE);
+
+    /* Program headers beyond the File. */
+    memcpy(file, elf_file, TEST_ELF_SIZE);
+    put_le(&file[44], 5U, 2U);
+    check_rejected(file, TEST_ELF_SIZE);
+
+    /* A program segment beyond the File. */
+    memcpy(file, elf_file, TEST_ELF_SIZE);
+    put_le(&file[52 + 2*32 + 16], 5U, 4U);
+    check_rejected(file, TEST_ELF_SIZE);
+
+    /* A truncated ELF header. */
+    check_rejected(elf_file, 40U);
+}
+
+int main(void)
+{
+    /** <b>Local variable blank:</b> Intel HEX File whose only data record is blank. */
+    static const char blank[] = ":020000040800F2\n:04800000FFFFFFFF80\n:00000001FF\n";
+
+    make_expected_image();
+    make_elf_file();
+    test_ihex();
+    test_srec();
+    test_elf();
+
+    /* A File without any populated byte, and a raw binary File, are not flattened. */
+    check_rejected((const uint8_t *) blank, strlen(blank));
+    CHECK(image_parser_get_format(expected, 16U) == IMAGE_PARSER_FORMAT_BINARY);
+    check_rejected(expected, 16U);
+    CHECK(image_parser_is_blank(&expected[TEST_PAGE_SIZE], 2U*TEST_PAGE_SIZE));
+    CHECK(!image_parser_is_blank(&expected[TEST_PAGE_SIZE], 2U*TEST_PAGE_SIZE + 1U));
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,289 @@
+/** @file
+ * @brief	Host round-trip test of the LZ4 Encoder of the PcTool and of the Streaming LZ4 Decoder of the Custom
+ *          Bootloader Firmware.
+ *
+ * @details	This test compresses data with @ref lz4_encoder_compress , for the window of the decoder, and then
+ *          decompresses it with @ref lz4_decoder_feed while splitting the compressed stream in several ways (i.e., one
+ *          byte at a time, in pseudo-random pieces and in ETX OTA Data Type Packets whose last one has an odd length),
+ *          so that tokens, offsets, length bytes and matches are split across the calls to the decoder. The data has
+ *          repetitions both within and beyond the window of the decoder, so every successful round trip also shows
+ *          that no match reaches further back than the @ref LZ4_DECODER_WINDOW_SIZE bytes that the decoder keeps in
+ *          RAM.
+ * @details	The test also checks that the decompressed bytes are given in pieces of @ref LZ4_DECODER_FLUSH_SIZE bytes,
+ *          except for the last one, that a hand-made overlapping match that crosses both a feeding boundary and a flush
+ *          boundary is decompressed correctly, and that malformed streams and failures of the write callback are
+ *          rejected with @ref LZ4_DECODER_EC_ERR (see run_tests.sh ).
+ */
+#include "lz4_encoder.h"
+#include "lz4_decoder.h"
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <stdlib.h> // Library from which "free()" is located at.
+#include <string.h> // Library from which "memcpy()", "memset()" and "memcmp()" are located at.
+
+#define TEST_DATA_SIZE          (20001U)    /**< @brief Size in bytes of the data to be compressed, which is odd so that the last decompressed piece is too. */
+#define TEST_FRAME_SIZE         (1024U)     /**< @brief Size in bytes of the data of the ETX OTA Data Type Packets in which the compressed stream is sent. */
+#define TEST_HANDMADE_SIZE      (304U)      /**< @brief Size in bytes of the data of the hand-made compressed stream of @ref test_handmade_match . */
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t data[TEST_DATA_SIZE];                        /**< @brief Data to be compressed. */
+static uint8_t decoded[TEST_DATA_SIZE];                     /**< @brief Bytes given to the write callback of the decoder so far. */
+static uint32_t decoded_len = 0U;                           /**< @brief Number of valid bytes in @ref decoded . */
+static uint32_t write_calls = 0U;                           /**< @brief Number of calls to the write callback of the decoder. */
+static uint32_t short_writes = 0U;                          /**< @brief Number of calls to the write callback with less than @ref LZ4_DECODER_FLUSH_SIZE bytes. */
+static uint32_t fail_after_writes = 0xFFFFFFFFU;            /**< @brief Number of calls to the write callback after which it fails. */
+static uint32_t seed = 1U;                                  /**< @brief State of the pseudo-random generator of @ref test_rand . */
+static uint8_t handmade_lz4[] = {0x4F, 'A', 'B', 'C', 'D', 0x04, 0x00, 0xFF, 300U - 4U - 15U - 255U, 0x00, 0x00, 0x00};  /**< @brief Hand-made compressed stream of 4 literals followed by a match of offset 4 and of 300 bytes, and by padding. */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the next value of a linear congruential pseudo-random generator, so that every run is the same.
+ */
+static uint32_t test_rand(void)
+{
+    seed = seed*1103515245U + 12345U;
+    return seed >> 16;
+}
+
+/**@brief   Gathers the decompressed bytes into @ref decoded , recording how they were split.
+ */
+static Lz4Decoder_Status test_write(uint8_t *p_data, uint16_t length)
+{
+    if (write_calls >= fail_after_writes)
+    {
+        return LZ4_DECODER_EC_ERR;
+    }
+    write_calls++;
+    if (length != LZ4_DECODER_FLUSH_SIZE)
+    {
+        short_writes++;
+    }
+    if ((length > LZ4_DECODER_FLUSH_SIZE) || (length > (sizeof(decoded) - decoded_len)))
+    {
+        return LZ4_DECODER_EC_ERR;
+    }
+    memcpy(&decoded[decoded_len], p_data, length);
+    decoded_len += length;
+
+    return LZ4_DECODER_EC_OK;
+}
+
+/**@brief   Starts decompressing \p size bytes into @ref decoded .
+ */
+static void start_decoding(uint32_t size)
+{
+    memset(decoded, 0, sizeof(decoded));
+    decoded_len = 0U;
+    write_calls = 0U;
+    short_writes = 0U;
+    fail_after_writes = 0xFFFFFFFFU;
+    lz4_decoder_init(size, test_write);
+}
+
+/**@brief   Fills @ref data with text-like repetitions, long runs, pseudo-random bytes and a block that is repeated
+ *          beyond the window of the decoder.
+ */
+static void make_data(void)
+{
+    /** <b>Local variable words:</b> Words from which the text-like part of the data is made. */
+    static const char *words[] = {"flash ", "page ", "write ", "erase ", "ETX ", "OTA ", "packet ", "0x08008000 "};
+    /** <b>Local variable i:</b> Number of bytes of @ref data that have been filled so far. */
+    uint32_t i = 0U;
+    /** <b>Local variable p_word:</b> Pointer to the current word. */
+    const char *p_word;
+
+    while (i < 6000U)
+    {
+        p_word = words[test_rand() % 8U];
+        memcpy(&data[i], p_word, strlen(p_word));
+        i += strlen(p_word);
+    }
+    memset(&data[i], 0x00, 3000U);
+    i += 3000U;
+    for (; i<13000U; i++)
+    {
+        data[i] = (uint8_t) test_rand();
+    }
+    memcpy(&data[i], &data[i - 4000U], 4000U);
+    i += 4000U;
+    for (; i<TEST_DATA_SIZE; i++)
+    {
+        data[i] = (uint8_t) (i / 7U);
+    }
+}
+
+/**@brief   Compresses @ref data with a given level and checks that it is decompressed back whichever way the compressed
+ *          stream is split.
+ */
+static void test_round_trip(uint8_t level)
+{
+    /** <b>Local variable p_lz4:</b> Pointer to the compressed stream. */
+    uint8_t *p_lz4 = NULL;
+    /** <b>Local variable lz4_size:</b> Size in bytes of the compressed stream. */
+    uint32_t lz4_size = 0U;
+    /** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref Lz4Decoder_Status function type. */
+    Lz4Decoder_Status ret;
+    /** <b>Local variable n:</b> Number of bytes of the compressed stream that are fed in the current step. */
+    uint32_t n;
+
+    CHECK(lz4_encoder_compress(data, TEST_DATA_SIZE, LZ4_DECODER_WINDOW_SIZE, level, &p_lz4, &lz4_size) == LZ4_ENCODER_EC_OK);
+    if (p_lz4 == NULL)
+    {
+        return;
+    }
+    CHECK((lz4_size % 4U) == 0U);
+    CHECK(lz4_size < TEST_DATA_SIZE);
+
+    /* One byte at a time, so that every field of every LZ4 sequence is split across the calls to the decoder. */
+    start_decoding(TEST_DATA_SIZE);
+    ret = LZ4_DECODER_EC_OK;
+    for (uint32_t i=0; (i<lz4_size) && (ret==LZ4_DECODER_EC_OK); i++)
+    {
+        ret = lz4_decoder_feed(&p_lz4[i], 1U);
+    }
+    CHECK(ret == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_is_done());
+    CHECK(decoded_len == TEST_DATA_SIZE);
+    CHECK(memcmp(decoded, data, TEST_DATA_SIZE) == 0);
+    CHECK(short_writes == 1U);
+    CHECK(write_calls == ((TEST_DATA_SIZE + LZ4_DECODER_FLUSH_SIZE - 1U) / LZ4_DECODER_FLUSH_SIZE));
+
+    /* In pseudo-random pieces of 1 to 300 bytes. */
+    start_decoding(TEST_DATA_SIZE);
+    ret = LZ4_DECODER_EC_OK;
+    for (uint32_t i=0; (i<lz4_size) && (ret==LZ4_DECODER_EC_OK); i+=n)
+    {
+        n = 1U + (test_rand() % 300U);
+        n = (n > (lz4_size - i)) ? (lz4_size - i) : n;
+        ret = lz4_decoder_feed(&p_lz4[i], n);
+    }
+    CHECK(ret == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_is_done());
+    CHECK(memcmp(decoded, data, TEST_DATA_SIZE) == 0);
+
+    /* In ETX OTA Data Type Packets, where the last ones have an odd length. */
+    start_decoding(TEST_DATA_SIZE);
+    ret = LZ4_DECODER_EC_OK;
+    for (uint32_t i=0; (i<lz4_size) && (ret==LZ4_DECODER_EC_OK); i+=n)
+    {
+        n = ((lz4_size - i) > TEST_FRAME_SIZE) ? TEST_FRAME_SIZE : (lz4_size - i);
+        if ((n < TEST_FRAME_SIZE) && ((n % 2U) == 0U))
+        {
+            n--;
+        }
+        ret = lz4_decoder_feed(&p_lz4[i], n);
+        CHECK(lz4_decoder_is_done() == (decoded_len == TEST_DATA_SIZE));
+    }
+    CHECK(ret == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_is_done());
+    CHECK(memcmp(decoded, data, TEST_DATA_SIZE) == 0);
+
+    /* A truncated stream leaves the data incomplete. */
+    start_decoding(TEST_DATA_SIZE);
+    CHECK(lz4_decoder_feed(p_lz4, lz4_size / 2U) == LZ4_DECODER_EC_OK);
+    CHECK(!lz4_decoder_is_done());
+    CHECK(decoded_len < TEST_DATA_SIZE);
+    free(p_lz4);
+}
+
+/**@brief   Checks a hand-made overlapping match (i.e., one whose offset is smaller than its length) that crosses a
+ *          flush boundary, and whose offset and length bytes are split across the calls to the decoder.
+ */
+static void test_handmade_match(void)
+{
+    /** <b>Local variable expected:</b> Decompressed data of @ref handmade_lz4 . */
+    uint8_t expected[TEST_HANDMADE_SIZE];
+
+    for (uint32_t i=0; i<TEST_HANDMADE_SIZE; i++)
+    {
+        expected[i] = "ABCD"[i % 4U];
+    }
+    start_decoding(TEST_HANDMADE_SIZE);
+    CHECK(lz4_decoder_feed(&handmade_lz4[0], 3U) == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_feed(&handmade_lz4[3], 3U) == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_feed(&handmade_lz4[6], 2U) == LZ4_DECODER_EC_OK);
+    CHECK(decoded_len == 0U);
+    CHECK(lz4_decoder_feed(&handmade_lz4[8], sizeof(handmade_lz4) - 8U) == LZ4_DECODER_EC_OK);
+    CHECK(lz4_decoder_is_done());
+    CHECK(decoded_len == TEST_HANDMADE_SIZE);
+    CHECK(memcmp(decoded, expected, TEST_HANDMADE_SIZE) == 0);
+}
+
+/**@brief   Checks that malformed streams, and failures of the write callback, are rejected.
+ */
+static void test_malformed(void)
+{
+    /** <b>Local variable zero_offset:</b> A match whose offset is zero. */
+    uint8_t zero_offset[] = {0x10, 'A', 0x00, 0x00};
+    /** <b>Local variable offset_too_far:</b> A match that reaches before the first decompressed byte. */
+    uint8_t offset_too_far[] = {0x10, 'A', 0x02, 0x00};
+    /** <b>Local variable literals_too_long:</b> More literals than the decompressed size. */
+    uint8_t literals_too_long[] = {0x30, 'A', 'B', 'C'};
+    /** <b>Local variable match_too_long:</b> A match that goes beyond the decompressed size. */
+    uint8_t match_too_long[] = {0x1F, 'A', 0x01, 0x00, 0x10};
+    /** <b>Local variable beyond_window:</b> A match whose offset is greater than the window of the decoder. */
+    uint8_t beyond_window[] = {0xF0, 0xFF, 0x00, 0x00};
+    /** <b>Local variable literal:</b> Literal byte that is fed to reach the window of the decoder. */
+    uint8_t literal = 0x5AU;
+    /** <b>Local variable window_len:</b> Number of literals of @ref beyond_window , which is one more than the window. */
+    uint32_t window_len = LZ4_DECODER_WINDOW_SIZE + 1U;
+
+    start_decoding(16U);
+    CHECK(lz4_decoder_feed(zero_offset, sizeof(zero_offset)) == LZ4_DECODER_EC_ERR);
+    CHECK(!lz4_decoder_is_done());
+    CHECK(lz4_decoder_feed(zero_offset, 1U) == LZ4_DECODER_EC_ERR);
+
+    start_decoding(16U);
+    CHECK(lz4_decoder_feed(offset_too_far, sizeof(offset_too_far)) == LZ4_DECODER_EC_ERR);
+
+    start_decoding(2U);
+    CHECK(lz4_decoder_feed(literals_too_long, sizeof(literals_too_long)) == LZ4_DECODER_EC_ERR);
+
+    start_decoding(16U);
+    CHECK(lz4_decoder_feed(match_too_long, sizeof(match_too_long)) == LZ4_DECODER_EC_ERR);
+
+    /* The literals length is 15 + 255*n + m, so that the offset then reaches one byte before the window. */
+    start_decoding(window_len + 8U);
+    beyond_window[0] = 0xF4;
+    CHECK(lz4_decoder_feed(beyond_window, 1U) == LZ4_DECODER_EC_OK);
+    for (window_len -= 15U; window_len >= 255U; window_len -= 255U)
+    {
+        CHECK(lz4_decoder_feed(&beyond_window[1], 1U) == LZ4_DECODER_EC_OK);
+    }
+    beyond_window[2] = (uint8_t) window_len;
+    CHECK(lz4_decoder_feed(&beyond_window[2], 1U) == LZ4_DECODER_EC_OK);
+    for (uint32_t i=0; i<=LZ4_DECODER_WINDOW_SIZE; i++)
+    {
+        CHECK(lz4_decoder_feed(&literal, 1U) == LZ4_DECODER_EC_OK);
+    }
+    beyond_window[0] = (uint8_t) ((LZ4_DECODER_WINDOW_SIZE + 1U) & 0xFFU);
+    beyond_window[1] = (uint8_t) ((LZ4_DECODER_WINDOW_SIZE + 1U) >> 8);
+    CHECK(lz4_decoder_feed(beyond_window, 2U) == LZ4_DECODER_EC_ERR);
+
+    /* A failure of the write callback is given back. */
+    start_decoding(TEST_HANDMADE_SIZE);
+    fail_after_writes = 0U;
+    CHECK(lz4_decoder_feed(handmade_lz4, sizeof(handmade_lz4)) == LZ4_DECODER_EC_ERR);
+    CHECK(!lz4_decoder_is_done());
+}
+
+int main(void)
+{
+    make_data();
+    test_round_trip(LZ4_ENCODER_MIN_LEVEL);
+    test_round_trip(LZ4_ENCODER_MAX_LEVEL);
+    test_handmade_match();
+    test_malformed();
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/** @file
+ * @brief	Host round-trip test of the Reed-Solomon Encoder of the PcTool and of the Reed-Solomon Decoder of the Custom
+ *          Bootloader Firmware.
+ *
+ * @details	This test calculates the parity bytes of blocks of data of several lengths with @ref rs_encoder_encode ,
+ *          which give one or more interleaved and possibly shortened codewords, and then corrupts them before repairing
+ *          them with @ref rs_decoder_repair . It checks that up to @ref RS_DECODER_MAX_ERRORS corrupted bytes per
+ *          codeword, wherever they are (i.e., including the parity bytes and bursts across the interleaved codewords),
+ *          are all repaired, and that one more corrupted byte in any codeword is rejected with
+ *          @ref RS_DECODER_EC_ERR (see run_tests.sh ).
+ */
+#include "rs_encoder.h"
+#include "rs_decoder.h"
+#include <stdbool.h> // This library contains the aliases: bool, true and false.
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h> // Library from which "memcpy()", "memset()" and "memcmp()" are located at.
+
+#define TEST_MAX_DATA_SIZE      (1024U)     /**< @brief Maximum length in bytes of the blocks of data, which is the one of the ETX OTA Data Type Packets. */
+#define TEST_MAX_CODEWORDS      ((TEST_MAX_DATA_SIZE + RS_ENCODER_MAX_DATA_SIZE - 1U) / RS_ENCODER_MAX_DATA_SIZE)   /**< @brief Maximum number of codewords of a block of data. */
+#define TEST_MAX_TOTAL_SIZE     (TEST_MAX_DATA_SIZE + TEST_MAX_CODEWORDS*RS_ENCODER_PARITY_SIZE)                     /**< @brief Maximum length in bytes of a block of data together with its parity bytes. */
+#define TEST_TRIALS             (20U)       /**< @brief Number of times that each block of data is corrupted in a different way. */
+
+static int failures = 0;                                    /**< @brief Number of checks that have failed so far. */
+static uint8_t original[TEST_MAX_TOTAL_SIZE];               /**< @brief Block of data followed by its parity bytes, as sent by the host. */
+static uint8_t received[TEST_MAX_TOTAL_SIZE];               /**< @brief Corrupted copy of @ref original , which is repaired in place. */
+static uint32_t seed = 1U;                                  /**< @brief State of the pseudo-random generator of @ref test_rand . */
+
+/**@brief   Records a failed check whenever \p condition is \c false .
+ */
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if (!(condition))                                                   \
+        {                                                                   \
+            printf("FAIL: %s (line %d)\n", #condition, __LINE__);           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/**@brief   Gets the next value of a linear congruential pseudo-random generator, so that every run is the same.
+ */
+static uint32_t test_rand(void)
+{
+    seed = seed*1103515245U + 12345U;
+    return seed >> 16;
+}
+
+/**@brief   Gets the index, within a block of data followed by its parity bytes, of a byte of a codeword.
+ *
+ * @param data_len  Length in bytes of the block of data.
+ * @param codeword  Number of the codeword.
+ * @param index     Index of the byte within the codeword, where its data bytes come first and its parity bytes next.
+ */
+static uint32_t codeword_byte(uint16_t data_len, uint16_t codeword, uint16_t index)
+{
+    /** <b>Local variable count:</b> Number of codewords of the block of data. */
+    uint16_t count = rs_encoder_get_codeword_count(data_len);
+    /** <b>Local variable codeword_data_len:</b> Number of data bytes of the codeword. */
+    uint16_t codeword_data_len = (data_len - codeword + count - 1U) / count;
+
+    if (index < codeword_data_len)
+    {
+        return (uint32_t) index*count + codeword;
+    }
+    return data_len + (uint32_t) codeword*RS_ENCODER_PARITY_SIZE + (index - codeword_data_len);
+}
+
+/**@brief   Corrupts a given number of distinct bytes of each codeword of @ref received , at pseudo-random positions and
+ *          with pseudo-random non-zero errors.
+ *
+ * @return  The number of corrupted bytes.
+ */
+static uint16_t corrupt_codewords(uint16_t data_len, uint16_t errors_per_codeword)
+{
+    /** <b>Local variable count:</b> Number of codewords of the block of data. */
+    uint16_t count = rs_encoder_get_codeword_count(data_len);
+    /** <b>Local variable is_corrupted:</b> Whether each byte of the current codeword has already been corrupted. */
+    bool is_corrupted[RS_ENCODER_BLOCK_SIZE];
+    /** <b>Local variable codeword_len:</b> Number of bytes of the current codeword, including its parity bytes. */
+    uint16_t codeword_len;
+    /** <b>Local variable index:</b> Index, within the current codeword, of the byte to be corrupted. */
+    uint16_t index;
+
+    for (uint16_t codeword=0; codeword<count; codeword++)
+    {
+        memset(is_corrupted, 0, sizeof(is_corrupted));
+        codeword_len = (data_len - codeword + count - 1U) / count + RS_ENCODER_PARITY_SIZE;
+        for (uint16_t i=0; i<errors_per_codeword; i++)
+        {
+            do
+            {
+                index = test_rand() % codeword_len;
+            } while (is_corrupted[index]);
+            is_corrupted[index] = true;
+            received[codeword_byte(data_len, codeword, index)] ^= (uint8_t) (1U + (test_rand() % 255U));
+        }
+    }
+
+    return count*errors_per_codeword;
+}
+
+/**@brief   Encodes a block of data of a given length and checks that it is repaired whenever each of its codewords has
+ *          up to @ref RS_DECODER_MAX_ERRORS corrupted bytes, and that it is rejected otherwise.
+ */
+static void test_block(uint16_t data_len)
+{
+    /** <b>Local variable count:</b> Number of codewords of the block of data. */
+    uint16_t count = rs_encoder_get_codeword_count(data_len);
+    /** <b>Local variable total_len:</b> Length in bytes of the block of data together with its parity bytes. */
+    uint16_t total_len = data_len + count*RS_ENCODER_PARITY_SIZE;
+    /** <b>Local variable repaired:</b> Number of bytes repaired by @ref rs_decoder_repair . */
+    uint16_t repaired;
+    /** <b>Local variable corrupted:</b> Number of bytes that have been corrupted. */
+    uint16_t corrupted;
+
+    for (uint16_t i=0; i<data_len; i++)
+    {
+        original[i] = (uint8_t) test_rand();
+    }
+    rs_encoder_encode(original, data_len, &original[data_len]);
+    CHECK(rs_decoder_get_codeword_count(data_len) == count);
+    CHECK(rs_decoder_get_data_len(total_len) == data_len);
+
+    /* An intact block of data is left as it is. */
+    memcpy(received, original, total_len);
+    CHECK(rs_decoder_repair(received, data_len, &repaired) == RS_DECODER_EC_OK);
+    CHECK(repaired == 0U);
+    CHECK(memcmp(received, original, total_len) == 0);
+
+    for (uint16_t trial=0; trial<TEST_TRIALS; trial++)
+    {
+        /* From 1 up to the maximum number of corrupted bytes in each codeword, which are all repaired. */
+        memcpy(received, original, total_len);
+        corrupted = corrupt_codewords(data_len, 1U + (trial % RS_DECODER_MAX_ERRORS));
+        CHECK(rs_decoder_repair(received, data_len, &repaired) == RS_DECODER_EC_OK);
+        CHECK(repaired == corrupted);
+        CHECK(memcmp(received, original, total_len) == 0);
+
+        /* One more corrupted byte than the ones that can be repaired in each codeword. */
+        memcpy(received, original, total_len);
+        corrupt_codewords(data_len, RS_DECODER_MAX_ERRORS + 1U);
+        CHECK(rs_decoder_repair(received, data_len, &repaired) == RS_DECODER_EC_ERR);
+    }
+
+    /* A burst that spans the maximum number of corrupted bytes of all the interleaved codewords is repaired. */
+    if (data_len >= (count*RS_DECODER_MAX_ERRORS))
+    {
+        memcpy(received, original, total_len);
+        for (uint16_t i=0; i<(count*RS_DECODER_MAX_ERRORS); i++)
+        {
+            received[(data_len - count*RS_DECODER_MAX_ERRORS) / 2U + i] ^= 0xFFU;
+        }
+        CHECK(rs_decoder_repair(received, data_len, &repaired) == RS_DECODER_EC_OK);
+        CHECK(repaired == count*RS_DECODER_MAX_ERRORS);
+        CHECK(memcmp(received, original, total_len) == 0);
+
+        /* A single codeword with one more corrupted byte is enough for the whole block of data to be rejected. */
+        memcpy(received, original, total_len);
+        for (uint16_t i=0; i<=RS_DECODER_MAX_ERRORS; i++)
+        {
+            received[codeword_byte(data_len, count - 1U, i)] ^= 0x5AU;
+        }
+        CHECK(rs_decoder_repair(received, data_len, &repaired) == RS_DECODER_EC_ERR);
+    }
+}
+
+int main(void)
+{
+    /** <b>Local variable data_lens:</b> Lengths of the blocks of data under test, which give shortened, whole and several codewords. */
+    static const uint16_t data_lens[] = {1U, 17U, 100U, RS_ENCODER_MAX_DATA_SIZE, RS_ENCODER_MAX_DATA_SIZE + 1U, 777U, TEST_MAX_DATA_SIZE};
+
+    for (uint32_t i=0; i<(sizeof(data_lens) / sizeof(data_lens[0])); i++)
+    {
+        test_block(data_lens[i]);
+    }
+
+    /* The lengths that fall in between the ones that a block of data can give are rejected. */
+    CHECK(rs_decoder_get_data_len(RS_DECODER_PARITY_SIZE) == 0U);
+    CHECK(rs_decoder_get_data_len(RS_DECODER_BLOCK_SIZE + 1U) == 0U);
+    CHECK(rs_decoder_get_data_len(RS_DECODER_BLOCK_SIZE + RS_DECODER_PARITY_SIZE) == 0U);
+    CHECK(rs_decoder_get_data_len(RS_DECODER_BLOCK_SIZE + RS_DECODER_PARITY_SIZE + 1U) == (RS_DECODER_MAX_DATA_SIZE + 1U));
+
+    printf("%s: %d failure(s).\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}